@@ -114,9 +114,20 @@
 #define ECDSA_BLOCK_SIZE 32
 /*! @brief maximum accepted 32 bits word size */
 #define ECDSA_MAX_32B_WORDSIZE ECC_SECP521R1_32B_WORDS_SIZE
+/*! @brief maximum accepted 64 bits word size */
+#define ECDSA_MAX_64B_WORDSIZE ECC_SECP521R1_64B_WORDS_SIZE
+/*! @brief maximum accepted byte size */
+#define ECDSA_MAX_BYTESIZE ECC_SECP521R1_BYTESIZE
 
 #define ECDSA_MIN_32B_WORDSIZE ECC_SECP224R1_32B_WORDS_SIZE
 
+/*! @brief SEC1 compressed point prefix, y coordinate is even */
+#define ECC_POINT_COMPRESSED_EVEN 0x02
+/*! @brief SEC1 compressed point prefix, y coordinate is odd */
+#define ECC_POINT_COMPRESSED_ODD 0x03
+/*! @brief size of a SEC1 compressed point in byte (prefix and x coordinate) */
+#define ECC_POINT_COMPRESSED_BYTESIZE(curve_bsize) (1 + (curve_bsize))
+
 /*! @brief standard supported curves (SECG teminology is used) */
 enum ecc_std_curves_e
 {
@@ -196,12 +207,45 @@ typedef struct ecc_curve_s
     const uint64_t *square_p;
     const uint64_t *precomputed_1_x;
     const uint64_t *precomputed_1_y;
+    /*! @brief R^2 mod n, R = 2^(32 * curve_wsize) (optional) */
+    const uint64_t *n_mont_r2;
+    /*! @brief -n^(-1) mod 2^32 (optional) */
+    uint32_t n_mont_n0;
     size_t curve_wsize;
     size_t curve_bsize;
     size_t curve_bitsize;
     enum ecc_std_curves_e curve;
 } ecc_curve_t;
 
+/**
+ * @brief resumable scalar multiplication (co-Z Montgomery ladder) context
+ * @details the whole ladder state lives here, so that the scalar
+ * multiplication can be run a few bits at a time
+ * @note big integers are little endian, 64 bits aligned
+ * @warning it holds the scalar, it is zeroized by the finish function
+ */
+typedef struct ecc_ladder_ctx_s
+{
+    /*! @brief curve the ladder runs on */
+    const ecc_curve_t *curve_params;
+    /*! @brief scalar */
+    uint64_t k[ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief input point x coordinate */
+    uint64_t point_x[ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief input point y coordinate */
+    uint64_t point_y[ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief ladder register R0 x coordinate */
+    uint64_t r0_x[ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief ladder register R0 y coordinate */
+    uint64_t r0_y[ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief ladder register R1 x coordinate */
+    uint64_t r1_x[ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief ladder register R1 y coordinate */
+    uint64_t r1_y[ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief next bit of the scalar to process, the loop is over at 0 */
+    size_t bit_idx;
+} ecc_ladder_ctx_t;
+
 /*! @brief SECP256R1 curve */
 extern const ecc_curve_t ecc_secp256r1;
 
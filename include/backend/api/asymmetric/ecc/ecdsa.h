@@ -33,8 +33,11 @@
 #ifndef SCL_BACKEND_ECDSA_H
 #define SCL_BACKEND_ECDSA_H
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include <backend/api/asymmetric/ecc/ecc.h>
+
 /**
  * @addtogroup COMMON
  * @addtogroup ECC
@@ -65,6 +68,88 @@ typedef struct ecdsa_signature_const_s
     const uint8_t *s;
 } ecdsa_signature_const_t;
 
+/*! @brief ECDSA nonce generation mode */
+typedef enum
+{
+    /*! @brief nonce drawn from the TRNG */
+    SCL_ECDSA_NONCE_RANDOM = 0,
+    /*! @brief deterministic nonce (RFC 6979) */
+    SCL_ECDSA_NONCE_DETERMINISTIC = 1,
+    /**
+     * @brief deterministic nonce (RFC 6979) with a small TRNG seed as
+     * additional data (RFC 6979 section 3.6)
+     */
+    SCL_ECDSA_NONCE_HEDGED = 2
+} ecdsa_nonce_mode_t;
+
+/**
+ * @brief ECDSA precomputed nonce (offline part of the signature)
+ * @note Elements are big integer (little endian, 64 bits aligned)
+ * @warning This is secret data, knowing k^(-1) and a signature performed with
+ * it reveals the private key
+ */
+typedef struct ecdsa_nonce_s
+{
+    /*! @brief k^(-1) mod n */
+    uint64_t k_inv[ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief r = (k.G).x mod n */
+    uint64_t r[ECDSA_MAX_64B_WORDSIZE];
+} ecdsa_nonce_t;
+
+/**
+ * @brief ECDSA precomputed nonce pool, bound to a curve and a private key
+ * @note nonces storage is provided by the caller
+ */
+typedef struct ecdsa_nonce_pool_s
+{
+    /*! @brief curve the pool is bound to */
+    const ecc_curve_t *curve_params;
+    /*! @brief private key the pool is bound to (big endian) */
+    uint8_t priv_key[ECDSA_MAX_BYTESIZE];
+    /*! @brief caller provided nonces storage */
+    ecdsa_nonce_t *nonces;
+    /*! @brief number of elements in nonces storage */
+    size_t nb_nonces;
+    /*! @brief number of precomputed nonces ready to be used */
+    size_t nb_available;
+} ecdsa_nonce_pool_t;
+
+/*! @brief ECDSA verification window width (in bits) */
+#define SCL_ECDSA_WINDOW_WIDTH 2
+/*! @brief ECDSA verification iP + jQ table size */
+#define SCL_ECDSA_ARRAY_SIZE 16
+
+/**
+ * @brief ECDSA resumable verification context
+ * @note Elements are big integer (little endian, 64 bits aligned), points are
+ * in jacobian coordinates
+ */
+typedef struct ecdsa_verification_ctx_s
+{
+    /*! @brief curve the verification is performed on */
+    const ecc_curve_t *curve_params;
+    /*! @brief signature r element */
+    uint64_t r[ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief u1 = e.s^(-1) mod n */
+    uint64_t u1[ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief u2 = r.s^(-1) mod n */
+    uint64_t u2[ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief iP + jQ table x coordinates */
+    uint64_t ip_jq_x[SCL_ECDSA_ARRAY_SIZE][ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief iP + jQ table y coordinates */
+    uint64_t ip_jq_y[SCL_ECDSA_ARRAY_SIZE][ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief iP + jQ table z coordinates */
+    uint64_t ip_jq_z[SCL_ECDSA_ARRAY_SIZE][ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief accumulator x coordinate */
+    uint64_t x1[ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief accumulator y coordinate */
+    uint64_t y1[ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief accumulator z coordinate */
+    uint64_t z1[ECDSA_MAX_64B_WORDSIZE];
+    /*! @brief number of windows left to process */
+    size_t window_idx;
+} ecdsa_verification_ctx_t;
+
 /** @}*/
 
 #endif /* SCL_BACKEND_ECDSA_H */
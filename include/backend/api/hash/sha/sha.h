@@ -33,10 +33,15 @@
 #ifndef SCL_BACKEND_SHA_H
 #define SCL_BACKEND_SHA_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include <backend/api/hash/sha/sha224.h>
 #include <backend/api/hash/sha/sha256.h>
 #include <backend/api/hash/sha/sha384.h>
 #include <backend/api/hash/sha/sha512.h>
+#include <backend/api/hash/sha/sha512_224.h>
+#include <backend/api/hash/sha/sha512_256.h>
 
 /**
  * @addtogroup COMMON
@@ -55,7 +60,11 @@ typedef enum
     /*! @brief Define SHA384 mode */
     SCL_HASH_SHA384 = 2,
     /*! @brief Define SHA512 mode */
-    SCL_HASH_SHA512 = 3
+    SCL_HASH_SHA512 = 3,
+    /*! @brief Define SHA512/224 mode */
+    SCL_HASH_SHA512_224 = 4,
+    /*! @brief Define SHA512/256 mode */
+    SCL_HASH_SHA512_256 = 5
 } hash_mode_t;
 
 /*! @brief Unified SHA context */
@@ -67,11 +76,31 @@ typedef struct
         sha256_ctx_t sha256;
         sha384_ctx_t sha384;
         sha512_ctx_t sha512;
+        sha512_224_ctx_t sha512_224;
+        sha512_256_ctx_t sha512_256;
     } ctx;
     /*! Hash mode  */
     hash_mode_t mode;
+    /**
+     * @brief set when an imported state could not be loaded in the hardware
+     * accelerator, the computation is then resumed in software
+     */
+    bool soft_resume;
 } sha_ctx_t;
 
+/*! @brief SHA intermediate state, exported independently of the backend */
+typedef struct
+{
+    /*! @brief intermediate hash, big endian (32 bytes for SHA224/SHA256) */
+    uint8_t digest[SHA512_BYTE_HASHSIZE];
+    /*! @brief number of bits already absorbed */
+    uint64_t bitlen;
+    /*! @brief bytes of the incomplete block not yet processed */
+    uint8_t block_buffer[SHA512_BYTE_BLOCKSIZE];
+    /*! Hash mode  */
+    hash_mode_t mode;
+} sha_state_t;
+
 /** @}*/
 
 #endif /* SCL_BACKEND_SHA_H */
@@ -0,0 +1,60 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+
+/**
+ * @file sha512_256.h
+ * @brief sha512/256 implementation/wrapper
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#ifndef SCL_BACKEND_SHA512_256_H
+#define SCL_BACKEND_SHA512_256_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <backend/api/hash/sha/sha512.h>
+
+/**
+ * @addtogroup COMMON
+ * @addtogroup SHA
+ * @ingroup COMMON
+ *  @{
+ */
+
+#define SHA512_256_BYTE_HASHSIZE 32
+
+/**
+ * @brief SHA512/256 context
+ * @note Since SHA512/256 use SHA512 block computation, it can also use the
+ * same context
+ */
+typedef sha512_ctx_t sha512_256_ctx_t;
+
+/** @}*/
+
+#endif /* SCL_BACKEND_SHA512_256_H */
@@ -33,7 +33,11 @@
 #ifndef SCL_BACKEND_KDF_H
 #define SCL_BACKEND_KDF_H
 
+#include <backend/api/blockcipher/aes/aes.h>
 #include <backend/api/hash/sha/sha.h>
+#include <backend/api/message_auth/hmac.h>
+
+#include <scl/scl_defs.h>
 
 /**
  * @addtogroup COMMON
@@ -58,6 +62,62 @@ typedef struct
     hash_mode_t hash_mode;
 } x963kdf_ctx_t;
 
+/*! @brief SP 800-108 pseudorandom functions */
+typedef enum
+{
+    /*! @brief HMAC-SHA2 */
+    SCL_KDF_PRF_HMAC = 0,
+    /*! @brief AES-CMAC */
+    SCL_KDF_PRF_CMAC = 1,
+} sp800108kdf_prf_t;
+
+/**
+ * @brief SP 800-108 counter mode kdf context
+ * @details the PRF key setup (HMAC pad midstates or CMAC subkeys) is done
+ * once at init, and reused for every block of every derivation
+ * @warning the context holds key material, it should be cleared by the caller
+ * once no longer needed
+ */
+typedef struct
+{
+    /*! @brief pseudorandom function */
+    sp800108kdf_prf_t prf;
+    /*! @brief PRF output length (in byte) */
+    size_t prf_len;
+    /*! @brief HMAC key context (HMAC PRF) */
+    hmac_key_ctx_t hmac_key_ctx;
+    /**
+     * @brief sha context (HMAC PRF)
+     * @note we use pointer here, in order to avoid sha context duplication
+     */
+    sha_ctx_t *sha_ctx;
+    /*! @brief AES key, in the setkey format (CMAC PRF) */
+    uint64_t aes_key[4] __attribute__((aligned(8)));
+    /*! @brief AES key type (CMAC PRF) */
+    scl_aes_key_type_t aes_key_type;
+    /*! @brief CMAC subkey K1 (CMAC PRF) */
+    uint8_t cmac_k1[AES_BLOCKSIZE_NB_BYTE];
+    /*! @brief CMAC subkey K2 (CMAC PRF) */
+    uint8_t cmac_k2[AES_BLOCKSIZE_NB_BYTE];
+} sp800108kdf_ctx_t;
+
+/*! @brief SP 800-108 derivation request (one derived key) */
+typedef struct
+{
+    /*! @brief label */
+    const uint8_t *label;
+    /*! @brief label length (in byte) */
+    size_t label_len;
+    /*! @brief context */
+    const uint8_t *context;
+    /*! @brief context length (in byte) */
+    size_t context_len;
+    /*! @brief derived key */
+    uint8_t *derivated_key;
+    /*! @brief derived key length (in byte) */
+    size_t derivated_key_length;
+} sp800108kdf_request_t;
+
 /** @}*/
 
 #endif /* SCL_BACKEND_KDF_H */
@@ -42,6 +42,28 @@
  *  @{
  */
 
+/**
+ * @brief HMAC key context
+ * @details holds the hash states after absorbing k0 ^ ipad and k0 ^ opad, so
+ * that a key can be used for several MACs without hashing these blocks again.
+ * When the hash backend can't resume an imported state where it computed it
+ * (HCA 0.5.x resumes them in software), k0 is kept instead and each MAC
+ * hashes these two blocks, on the accelerator.
+ */
+typedef struct
+{
+    /*! @brief state after absorbing k0 ^ ipad (resume_state set) */
+    sha_state_t inner;
+    /*! @brief state after absorbing k0 ^ opad (resume_state set) */
+    sha_state_t outer;
+    /*! @brief HMAC preprocessed key (resume_state not set) */
+    uint8_t k0[SHA512_BYTE_BLOCKSIZE] __attribute__((aligned(8)));
+    /*! @brief set when the MACs resume from the inner and outer states */
+    bool resume_state;
+    /*! @brief Hash mode  */
+    hash_mode_t hash_mode;
+} hmac_key_ctx_t;
+
 /*! @brief Unified HMAC context */
 typedef struct
 {
@@ -52,6 +74,11 @@ typedef struct
      * @note we use pointer here, in order to avoid sha context duplication
      */
     sha_ctx_t *sha_ctx;
+    /**
+     * @brief key context, NULL when the HMAC was initialized with a raw key
+     * (k0 is then used)
+     */
+    const hmac_key_ctx_t *key_ctx;
     /*! @brief Hash mode  */
     hash_mode_t hash_mode;
 
@@ -196,6 +196,75 @@ struct __hash_func
      */
     int32_t (*sha_finish)(const metal_scl_t *const scl, sha_ctx_t *const ctx,
                           uint8_t *const hash, size_t *const hash_len);
+    /**
+     * @brief Compute the hashes of several independent messages
+     *
+     * @param[in] scl               metal scl context
+     * @param[in] hash_mode         hash mode
+     * @param[in] msgs              messages to hash
+     * @param[in] lens              messages length (in bytes)
+     * @param[in] count             number of messages
+     * @param[out] digests          hash output buffers, one per message
+     * @param[in,out] hash_len      length of each hash buffer/length of the
+     * hash
+     * @return 0                    SUCCESS
+     * @return != 0                 otherwise @ref scl_errors_t
+     */
+    int32_t (*sha_multi)(const metal_scl_t *const scl, hash_mode_t hash_mode,
+                         const uint8_t *const *const msgs,
+                         const size_t *const lens, size_t count,
+                         uint8_t *const *const digests,
+                         size_t *const hash_len);
+    /**
+     * @brief Export the intermediate state of a sha context
+     *
+     * @param[in] scl               metal scl context
+     * @param[in] ctx               sha context
+     * @param[out] state            exported state
+     * @return 0                    SUCCESS
+     * @return != 0                 otherwise @ref scl_errors_t
+     */
+    int32_t (*sha_export_state)(const metal_scl_t *const scl,
+                                const sha_ctx_t *const ctx,
+                                sha_state_t *const state);
+    /**
+     * @brief Resume a sha context from an exported state
+     *
+     * @param[in] scl               metal scl context
+     * @param[out] ctx              sha context
+     * @param[in] state             state to import
+     * @return 0                    SUCCESS
+     * @return != 0                 otherwise @ref scl_errors_t
+     */
+    int32_t (*sha_import_state)(const metal_scl_t *const scl,
+                                sha_ctx_t *const ctx,
+                                const sha_state_t *const state);
+    /**
+     * @brief Compute the SHA256 of a 32 or 64 bytes message
+     *
+     * @param[in] scl               metal scl context
+     * @param[in] in                message
+     * @param[in] in_len            message length (32 or 64 bytes)
+     * @param[out] digest           32 bytes digest
+     * @return 0                    SUCCESS
+     * @return != 0                 otherwise @ref scl_errors_t
+     */
+    int32_t (*sha256_fixed)(const metal_scl_t *const scl,
+                            const uint8_t *const in, size_t in_len,
+                            uint8_t *const digest);
+    /**
+     * @brief Compute one level of a SHA256 Merkle tree
+     *
+     * @param[in] scl               metal scl context
+     * @param[in] nodes             nb_nodes concatenated 32 bytes nodes
+     * @param[in] nb_nodes          number of nodes
+     * @param[out] parents          (nb_nodes + 1) / 2 concatenated parents
+     * @return 0                    SUCCESS
+     * @return != 0                 otherwise @ref scl_errors_t
+     */
+    int32_t (*sha256_merkle_level)(const metal_scl_t *const scl,
+                                   const uint8_t *const nodes,
+                                   size_t nb_nodes, uint8_t *const parents);
 };
 
 /*! @brief True Random Number Generator low level API entry points */
@@ -568,6 +637,52 @@ struct __bignum_func
                        /*@in@*/ const uint64_t *const in_b,
                        /*@out@*/ uint64_t *const out, size_t nb_32b_words);
 
+    /**
+     * @brief Modular addition without full reduction
+     * @details the result is congruent to in_a + in_b and lower than
+     * 2 * modulus, it is intended to feed another modular operation
+     * @note optional, ECC operations use mod_add when it is not set
+     *
+     * @param[in] scl               metal scl context
+     * @param[in] ctx               bignumber context (contain modulus info)
+     * @param[in] in_a              Input array a
+     * @param[in] in_b              Input array b
+     * @param[out] out              Output array (addition result)
+     * @param[in] nb_32b_words      number of 32 bits words to use in calcul
+     * @return >= 0 success
+     * @return < 0 in case of errors @ref scl_errors_t
+     * @warning the modulus used should be of nb_32b_words size
+     */
+    int32_t (*mod_add_lazy)(/*@in@*/ const metal_scl_t *const scl,
+                            /*@in@*/ const bignum_ctx_t *const ctx,
+                            /*@in@*/ const uint64_t *const in_a,
+                            /*@in@*/ const uint64_t *const in_b,
+                            /*@out@*/ uint64_t *const out,
+                            size_t nb_32b_words);
+
+    /**
+     * @brief Modular subtraction without full reduction
+     * @details the result is congruent to in_a - in_b and lower than
+     * 2 * modulus, it is intended to feed another modular operation
+     * @note optional, ECC operations use mod_sub when it is not set
+     *
+     * @param[in] scl               metal scl context
+     * @param[in] ctx               bignumber context (contain modulus info)
+     * @param[in] in_a              Input array a
+     * @param[in] in_b              Input array b
+     * @param[out] out              Output array (subtraction result)
+     * @param[in] nb_32b_words      number of 32 bits words to use in calcul
+     * @return >= 0 success
+     * @return < 0 in case of errors @ref scl_errors_t
+     * @warning the modulus used should be of nb_32b_words size
+     */
+    int32_t (*mod_sub_lazy)(/*@in@*/ const metal_scl_t *const scl,
+                            /*@in@*/ const bignum_ctx_t *const ctx,
+                            /*@in@*/ const uint64_t *const in_a,
+                            /*@in@*/ const uint64_t *const in_b,
+                            /*@out@*/ uint64_t *const out,
+                            size_t nb_32b_words);
+
     /**
      * @brief Modular multiplication
      *
@@ -681,6 +796,109 @@ struct __ecdsa_func
                             const ecc_affine_const_point_t *const pub_key,
                             const ecdsa_signature_const_t *const signature,
                             const uint8_t *const hash, size_t hash_len);
+
+    /**
+     * @brief ECDSA signature with a selectable nonce generation mode
+     *
+     * @param[in] scl           metal scl context
+     * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+     *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+     * @param[in] priv_key      private key
+     * @param[out] signature    signature structure that will hold results
+     * @param[in] hash          hash value to sign
+     * @param[in] hash_len      hash value length
+     * @param[in] mode          nonce generation mode
+     * @return 0 in case of success
+     * @return > 0 in case of failure @ref scl_errors_t
+     * @note In deterministic modes, the HMAC hash function is selected from
+     * hash_len (SHA224, SHA256, SHA384 or SHA512 digest length)
+     */
+    int32_t (*signature_with_nonce_mode)(
+        const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+        const uint8_t *const priv_key, const ecdsa_signature_t *const signature,
+        const uint8_t *const hash, size_t hash_len, ecdsa_nonce_mode_t mode);
+
+    /**
+     * @brief ECDSA nonces precomputation (offline part of the signature)
+     *
+     * @param[in] scl           metal scl context
+     * @param[in,out] pool      nonce pool to fill
+     * @param[in] nb_nonces     maximum number of nonces to precompute
+     * @return >= 0 number of nonces available in the pool
+     * @return < 0 in case of failure @ref scl_errors_t
+     */
+    int32_t (*nonce_pool_fill)(const metal_scl_t *const scl,
+                               ecdsa_nonce_pool_t *const pool,
+                               size_t nb_nonces);
+
+    /**
+     * @brief ECDSA signature using a precomputed nonce when available
+     *
+     * @param[in] scl           metal scl context
+     * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+     *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+     * @param[in] priv_key      private key
+     * @param[in,out] pool      nonce pool bound to curve_params and priv_key
+     * @param[out] signature    signature structure that will hold results
+     * @param[in] hash          hash value to sign
+     * @param[in] hash_len      hash value length
+     * @return 0 in case of success
+     * @return > 0 in case of failure @ref scl_errors_t
+     * @note when the pool is empty, a regular signature is performed
+     */
+    int32_t (*signature_with_pool)(const metal_scl_t *const scl,
+                                   const ecc_curve_t *const curve_params,
+                                   const uint8_t *const priv_key,
+                                   ecdsa_nonce_pool_t *const pool,
+                                   const ecdsa_signature_t *const signature,
+                                   const uint8_t *const hash, size_t hash_len);
+    /**
+     * @brief start a resumable ECDSA signature verification
+     *
+     * @param[in] scl           metal scl context
+     * @param[out] ctx          verification context
+     * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+     *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+     * @param[in] pub_key       public key
+     * @param[in] signature     signature to check
+     * @param[in] hash          hash value on which the signature has been
+     * performed
+     * @param[in] hash_len      hash value length
+     * @return 0 in case of success
+     * @return < 0 in case of failure @ref scl_errors_t
+     */
+    int32_t (*verification_start)(
+        const metal_scl_t *const scl, ecdsa_verification_ctx_t *const ctx,
+        const ecc_curve_t *const curve_params,
+        const ecc_affine_const_point_t *const pub_key,
+        const ecdsa_signature_const_t *const signature,
+        const uint8_t *const hash, size_t hash_len);
+
+    /**
+     * @brief process a bounded part of a resumable ECDSA verification
+     *
+     * @param[in] scl               metal scl context
+     * @param[in,out] ctx           verification context
+     * @param[in] max_iterations    maximum number of windows to process
+     * @return 0 all windows are processed
+     * @return > 0 number of windows left
+     * @return < 0 in case of failure @ref scl_errors_t
+     */
+    int32_t (*verification_step)(const metal_scl_t *const scl,
+                                 ecdsa_verification_ctx_t *const ctx,
+                                 size_t max_iterations);
+
+    /**
+     * @brief finish a resumable ECDSA signature verification
+     *
+     * @param[in] scl           metal scl context
+     * @param[in,out] ctx       verification context
+     * @return 0 the signature is valid
+     * @return SCL_BUSY if some windows are left
+     * @return < 0 in case of failure @ref scl_errors_t
+     */
+    int32_t (*verification_finish)(const metal_scl_t *const scl,
+                                   ecdsa_verification_ctx_t *const ctx);
 };
 
 /*! @brief ECC (Elliptic Curve Cryptography) low level API entry points */
@@ -700,6 +918,25 @@ struct __ecc_func
                               const ecc_curve_t *const curve_params,
                               const ecc_affine_const_point_t *const point);
 
+    /**
+     * @brief checking several affine points are on the provided curve
+     *
+     * @param[in] scl           metal scl context
+     * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+     *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+     * @param[in] points        array of count affine points to check
+     * @param[in] count         number of points
+     * @param[out] valid        bitmap of (count + 31) / 32 words, bit i % 32
+     * of word i / 32 is set when point i is on the curve
+     * @return 0 if all the points are on the curve
+     * @return SCL_ERR_POINT if at least one point is not on the curve
+     * @return < 0 in case of failure @ref scl_errors_t
+     */
+    int32_t (*point_on_curve_batch)(
+        const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+        const ecc_affine_const_point_t *const points, size_t count,
+        uint32_t *const valid);
+
     /**
      * @brief compute public key from private key and curve parameters
      *
@@ -732,6 +969,23 @@ struct __ecc_func
                                   uint8_t *const priv_key,
                                   ecc_affine_point_t *const pub_key);
 
+    /**
+     * @brief generate several ECC keypairs
+     *
+     * @param[in] scl           metal scl context
+     * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+     *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+     * @param[in] count             number of keypairs to generate
+     * @param[out] priv_keys        private keys, count * curve_bsize bytes
+     * @param[out] pub_keys         array of count public keys
+     * @return 0 in case of success
+     * @return > 0 in case of failure @ref scl_errors_t
+     */
+    int32_t (*keypair_generation_batch)(const metal_scl_t *const scl,
+                                        const ecc_curve_t *const curve_params,
+                                        size_t count, uint8_t *const priv_keys,
+                                        ecc_affine_point_t *const pub_keys);
+
     /**
      * @brief compute shared secret with ECDH
      *
@@ -752,6 +1006,121 @@ struct __ecc_func
                     const ecc_affine_const_point_t *const peer_pub_key,
                     uint8_t *const shared_secret,
                     size_t *const shared_secret_len);
+
+    /**
+     * @brief encode an affine point in SEC1 compressed form
+     *
+     * @param[in] scl           metal scl context
+     * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+     *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+     * @param[in] point             affine point to compress
+     * @param[out] compressed       compressed point buffer
+     * @param[in,out] compressed_len compressed point buffer length/compressed
+     * point length
+     * @return 0 in case of success
+     * @return > 0 in case of failure @ref scl_errors_t
+     */
+    int32_t (*point_compress)(const metal_scl_t *const scl,
+                              const ecc_curve_t *const curve_params,
+                              const ecc_affine_const_point_t *const point,
+                              uint8_t *const compressed,
+                              size_t *const compressed_len);
+
+    /**
+     * @brief decode a SEC1 compressed point
+     *
+     * @param[in] scl           metal scl context
+     * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+     *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+     * @param[in] compressed        compressed point
+     * @param[in] compressed_len    compressed point length
+     * @param[out] point            decompressed affine point
+     * @return 0 in case of success
+     * @return > 0 in case of failure @ref scl_errors_t
+     */
+    int32_t (*point_decompress)(const metal_scl_t *const scl,
+                                const ecc_curve_t *const curve_params,
+                                const uint8_t *const compressed,
+                                size_t compressed_len,
+                                ecc_affine_point_t *const point);
+    /**
+     * @brief start a resumable public key computation
+     *
+     * @param[in] scl           metal scl context
+     * @param[out] ctx          ladder context
+     * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+     *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+     * @param[in] priv_key      private key
+     * @return 0 in case of success
+     * @return < 0 in case of failure @ref scl_errors_t
+     */
+    int32_t (*pubkey_generation_start)(const metal_scl_t *const scl,
+                                       ecc_ladder_ctx_t *const ctx,
+                                       const ecc_curve_t *const curve_params,
+                                       const uint8_t *const priv_key);
+
+    /**
+     * @brief finish a resumable public key computation
+     *
+     * @param[in] scl           metal scl context
+     * @param[in,out] ctx       ladder context
+     * @param[out] pub_key      public key
+     * @return 0 in case of success
+     * @return SCL_BUSY if the ladder is not over
+     * @return < 0 in case of failure @ref scl_errors_t
+     */
+    int32_t (*pubkey_generation_finish)(const metal_scl_t *const scl,
+                                        ecc_ladder_ctx_t *const ctx,
+                                        ecc_affine_point_t *const pub_key);
+
+    /**
+     * @brief start a resumable ECDH shared secret computation
+     *
+     * @param[in] scl                   metal scl context
+     * @param[out] ctx                  ladder context
+     * @param[in] curve_params          ECC curve parameters (use @ref
+     * ecc_secp256r1, @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+     * @param[in] priv_key              private key
+     * @param[in] peer_pub_key          peer public key
+     * @return 0 in case of success
+     * @return < 0 in case of failure @ref scl_errors_t
+     */
+    int32_t (*ecdh_start)(const metal_scl_t *const scl,
+                          ecc_ladder_ctx_t *const ctx,
+                          const ecc_curve_t *const curve_params,
+                          const uint8_t *const priv_key,
+                          const ecc_affine_const_point_t *const peer_pub_key);
+
+    /**
+     * @brief finish a resumable ECDH shared secret computation
+     *
+     * @param[in] scl                   metal scl context
+     * @param[in,out] ctx               ladder context
+     * @param[out] shared_secret        shared secret buffer
+     * @param[in,out] shared_secret_len output buffer length/ shared_secret
+     * length
+     * @return 0 in case of success
+     * @return SCL_BUSY if the ladder is not over
+     * @return < 0 in case of failure @ref scl_errors_t
+     */
+    int32_t (*ecdh_finish)(const metal_scl_t *const scl,
+                           ecc_ladder_ctx_t *const ctx,
+                           uint8_t *const shared_secret,
+                           size_t *const shared_secret_len);
+
+    /**
+     * @brief process a bounded part of a resumable scalar multiplication
+     *
+     * @param[in] scl               metal scl context
+     * @param[in,out] ctx           ladder context
+     * @param[in] max_iterations    maximum number of ladder iterations
+     * @return 0 the ladder is over
+     * @return > 0 number of iterations left
+     * @return < 0 in case of failure @ref scl_errors_t
+     */
+    int32_t (*ladder_step)(const metal_scl_t *const scl,
+                           ecc_ladder_ctx_t *const ctx,
+                           size_t max_iterations);
 };
 
 /*! @brief HMAC low level API entry points */
@@ -804,6 +1173,42 @@ struct __hmac_func
      */
     int32_t (*finish)(const metal_scl_t *const scl, hmac_ctx_t *const hmac_ctx,
                       uint8_t *const mac, size_t *const mac_len);
+
+    /**
+     * @brief Precompute the inner and outer hash states of a key
+     *
+     * @param[in] scl_ctx           scl context
+     * @param[out] key_ctx          hmac key context
+     * @param[in,out] sha_ctx       sha context used for the computation
+     * @param[in] hash_mode         hash mode to use
+     * @param[in] key               Key to use for HMAC computation
+     * @param[in] key_len           Key length (in byte)
+     * @return 0    in case of SUCCESS
+     * @return != 0 in case of errors @ref scl_errors_t
+     */
+    int32_t (*key_init)(const metal_scl_t *const scl,
+                        hmac_key_ctx_t *const key_ctx,
+                        sha_ctx_t *const sha_ctx, hash_mode_t hash_mode,
+                        const uint8_t *const key, size_t key_len);
+
+    /**
+     * @brief Initialize HMAC computation from a precomputed key context
+     *
+     * @param[in] scl_ctx           scl context
+     * @param[in,out] hmac_ctx      hmac context
+     * @param[in,out] sha_ctx       sha context (this will be referenced into
+     * hmac context)
+     * @param[in] key_ctx           hmac key context (this will be referenced
+     * into hmac context)
+     * @return 0    in case of SUCCESS
+     * @return != 0 in case of errors @ref scl_errors_t
+     * @warning Do not override sha_ctx and key_ctx before calling
+     * soft_hmac_finish()
+     */
+    int32_t (*init_with_key)(const metal_scl_t *const scl,
+                             hmac_ctx_t *const hmac_ctx,
+                             sha_ctx_t *const sha_ctx,
+                             const hmac_key_ctx_t *const key_ctx);
 };
 
 /*! @brief KDF low level API entry points */
@@ -845,6 +1250,76 @@ struct __kdf_func
                            const uint8_t *const input_key, size_t input_key_len,
                            uint8_t *const derivated_key,
                            size_t derivated_key_length);
+
+    /**
+     * @brief derive key based on PBKDF2 with HMAC-SHA
+     *
+     * @param[in] scl                   metal scl context
+     * @param[in] hash_mode             hash mode
+     * @param[in] password              password
+     * @param[in] password_len          password length (in byte)
+     * @param[in] salt                  salt
+     * @param[in] salt_len              salt length (in byte)
+     * @param[in] iterations            iteration count (> 0)
+     * @param[out] derivated_key        derived key
+     * @param[in] derivated_key_length  derived key length
+     * @return 0                        SUCCESS
+     * @return != 0                     otherwise @ref scl_errors_t
+     */
+    int32_t (*pbkdf2)(const metal_scl_t *const scl, hash_mode_t hash_mode,
+                      const uint8_t *const password, size_t password_len,
+                      const uint8_t *const salt, size_t salt_len,
+                      uint32_t iterations, uint8_t *const derivated_key,
+                      size_t derivated_key_length);
+
+    /**
+     * @brief init SP 800-108 kdf context with an HMAC-SHA PRF
+     *
+     * @param[in] scl                   metal scl context
+     * @param[out] sp800108kdf_ctx      SP 800-108 kdf context
+     * @param[in] sha_ctx               sha context
+     * @param[in] hash_mode             hash mode
+     * @param[in] key                   key derivation key
+     * @param[in] key_len               key derivation key length (in byte)
+     * @return 0                        SUCCESS
+     * @return != 0                     otherwise @ref scl_errors_t
+     */
+    int32_t (*sp800108_hmac_init)(const metal_scl_t *const scl,
+                                  sp800108kdf_ctx_t *const sp800108kdf_ctx,
+                                  sha_ctx_t *const sha_ctx,
+                                  hash_mode_t hash_mode,
+                                  const uint8_t *const key, size_t key_len);
+
+    /**
+     * @brief init SP 800-108 kdf context with an AES-CMAC PRF
+     *
+     * @param[in] scl                   metal scl context
+     * @param[out] sp800108kdf_ctx      SP 800-108 kdf context
+     * @param[in] key_type              AES key type (128, 192, 256)
+     * @param[in] key                   key derivation key, in the setkey
+     * format
+     * @return 0                        SUCCESS
+     * @return != 0                     otherwise @ref scl_errors_t
+     */
+    int32_t (*sp800108_cmac_init)(const metal_scl_t *const scl,
+                                  sp800108kdf_ctx_t *const sp800108kdf_ctx,
+                                  scl_aes_key_type_t key_type,
+                                  const uint64_t *const key);
+
+    /**
+     * @brief derive keys based on SP 800-108 counter mode
+     *
+     * @param[in] scl                   metal scl context
+     * @param[in] sp800108kdf_ctx       SP 800-108 kdf context
+     * @param[in,out] requests          derivation requests
+     * @param[in] nb_requests           number of requests
+     * @return 0                        SUCCESS
+     * @return != 0                     otherwise @ref scl_errors_t
+     */
+    int32_t (*sp800108_derive)(
+        const metal_scl_t *const scl,
+        const sp800108kdf_ctx_t *const sp800108kdf_ctx,
+        const sp800108kdf_request_t *const requests, size_t nb_requests);
 };
 
 /*! @see _metal_scl_struct */
@@ -97,6 +97,41 @@ CRYPTO_FUNCTION int32_t hca_sha_finish(const metal_scl_t *const scl,
                                        uint8_t *const hash,
                                        size_t *const hash_len);
 
+/**
+ * @brief Export the intermediate state of a hardware sha context
+ * @details the intermediate hash is read back from the accelerator HASH
+ * registers: no other HCA hash computation (sha, hmac, ...) shall run
+ * between the last hca_sha_core() on this context and this call, its blocks
+ * would overwrite them. As long as less than one block has been hashed, the
+ * registers are not used and the standard IV of ctx->mode is exported.
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] ctx               sha context
+ * @param[out] state            exported state
+ * @return 0                    SUCCESS
+ * @return != 0                 otherwise @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t hca_sha_export_state(const metal_scl_t *const scl,
+                                             const sha_ctx_t *const ctx,
+                                             sha_state_t *const state);
+
+/**
+ * @brief Resume a hardware sha context from an exported state
+ * @details the HCA 0.5.x hash registers are read only, the intermediate hash
+ * can not be loaded back in the accelerator: the context is resumed in
+ * software and ctx->soft_resume is set to report it. hca_sha_core() and
+ * hca_sha_finish() then use the software implementation for this context.
+ *
+ * @param[in] scl               metal scl context
+ * @param[out] ctx              sha context
+ * @param[in] state             state to import
+ * @return 0                    SUCCESS
+ * @return != 0                 otherwise @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t hca_sha_import_state(const metal_scl_t *const scl,
+                                             sha_ctx_t *const ctx,
+                                             const sha_state_t *const state);
+
 /** @}*/
 
 #endif /* SCL_BACKEND_HCA_SHA_H */
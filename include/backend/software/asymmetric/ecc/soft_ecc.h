@@ -50,6 +50,7 @@
 
 /**
  * @brief copy ecc affine point
+ * @details when both points are packed (x||y), one block copy is done
  *
  * @param[in] src                   source affine point
  * @param[out] dst                  destination affine point
@@ -62,6 +63,7 @@ soft_ecc_affine_copy(const ecc_bignum_affine_point_t *const src,
 
 /**
  * @brief zeroize copy ecc affine point
+ * @details a packed point (x||y) is zeroized as one block
  *
  * @param[in,out] point             jacobian point to zeroize
  * @param[in] curve_nb_32b_words    number of 32 bits words per coordinate
@@ -72,6 +74,7 @@ soft_ecc_affine_zeroize(ecc_bignum_affine_point_t *const point,
 
 /**
  * @brief copy ecc jacobian point
+ * @details when both points are packed (x||y||z), one block copy is done
  *
  * @param[in] src                   source jacobian point
  * @param[out] dst                  destination jacobian point
@@ -84,6 +87,7 @@ soft_ecc_jacobian_copy(const ecc_bignum_jacobian_point_t *const src,
 
 /**
  * @brief zeroize ecc jacobian point
+ * @details a packed point (x||y||z) is zeroized as one block
  *
  * @param[in,out] point             jacobian point to zeroize
  * @param[in] curve_nb_32b_words    number of 32 bits words per coordinate
@@ -92,6 +96,125 @@ CRYPTO_FUNCTION void
 soft_ecc_jacobian_zeroize(ecc_bignum_jacobian_point_t *const point,
                           size_t curve_nb_32b_words);
 
+/**
+ * Packed point layouts
+ * a packed affine point is one block x||y, a packed jacobian point is one
+ * block x||y||z. Each coordinate takes curve_nb_32b_words rounded up to an
+ * even number of words (P-521: 17 words padded to 18), so that every
+ * coordinate stays 64 bits aligned. A table of points is a flat array of
+ * packed points with a fixed stride, so copying, zeroizing or scanning it
+ * touches one contiguous region, padding included.
+ * Packed blocks must be 64 bits aligned, as any big integer.
+ */
+
+/**
+ * @brief number of 32 bits words of one coordinate in a packed block
+ */
+#define SOFT_ECC_PACKED_COORD_WSIZE(curve_nb_32b_words)                        \
+    (((curve_nb_32b_words) + 1) & ~(size_t)1)
+
+/**
+ * @brief number of 32 bits words of a packed affine point (x||y)
+ */
+#define SOFT_ECC_AFFINE_PACKED_WSIZE(curve_nb_32b_words)                       \
+    (2 * SOFT_ECC_PACKED_COORD_WSIZE(curve_nb_32b_words))
+
+/**
+ * @brief number of 32 bits words of a packed jacobian point (x||y||z)
+ */
+#define SOFT_ECC_JACOBIAN_PACKED_WSIZE(curve_nb_32b_words)                     \
+    (3 * SOFT_ECC_PACKED_COORD_WSIZE(curve_nb_32b_words))
+
+/**
+ * @brief map an affine point structure on a packed x||y block
+ * @details the padding words of the block are cleared
+ *
+ * @param[in,out] packed            packed block
+ * @param[out] point                affine point pointing into packed
+ * @param[in] curve_nb_32b_words    number of 32 bits words per coordinate
+ */
+CRYPTO_FUNCTION void
+soft_ecc_affine_map_packed(uint32_t *const packed,
+                           ecc_bignum_affine_point_t *const point,
+                           size_t curve_nb_32b_words);
+
+/**
+ * @brief map a jacobian point structure on a packed x||y||z block
+ * @details the padding words of the block are cleared
+ *
+ * @param[in,out] packed            packed block
+ * @param[out] point                jacobian point pointing into packed
+ * @param[in] curve_nb_32b_words    number of 32 bits words per coordinate
+ */
+CRYPTO_FUNCTION void
+soft_ecc_jacobian_map_packed(uint32_t *const packed,
+                             ecc_bignum_jacobian_point_t *const point,
+                             size_t curve_nb_32b_words);
+
+/**
+ * @brief copy an affine point into a packed x||y block
+ *
+ * @param[in] src                   source affine point
+ * @param[out] packed               destination packed block
+ * @param[in] curve_nb_32b_words    number of 32 bits words per coordinate
+ */
+CRYPTO_FUNCTION void
+soft_ecc_affine_pack(const ecc_bignum_affine_const_point_t *const src,
+                     uint32_t *const packed, size_t curve_nb_32b_words);
+
+/**
+ * @brief copy a packed x||y block into an affine point
+ *
+ * @param[in] packed                source packed block
+ * @param[out] dst                  destination affine point
+ * @param[in] curve_nb_32b_words    number of 32 bits words per coordinate
+ */
+CRYPTO_FUNCTION void
+soft_ecc_affine_unpack(const uint32_t *const packed,
+                       ecc_bignum_affine_point_t *const dst,
+                       size_t curve_nb_32b_words);
+
+/**
+ * @brief copy a jacobian point into a packed x||y||z block
+ *
+ * @param[in] src                   source jacobian point
+ * @param[out] packed               destination packed block
+ * @param[in] curve_nb_32b_words    number of 32 bits words per coordinate
+ */
+CRYPTO_FUNCTION void
+soft_ecc_jacobian_pack(const ecc_bignum_jacobian_point_t *const src,
+                       uint32_t *const packed, size_t curve_nb_32b_words);
+
+/**
+ * @brief copy a packed x||y||z block into a jacobian point
+ *
+ * @param[in] packed                source packed block
+ * @param[out] dst                  destination jacobian point
+ * @param[in] curve_nb_32b_words    number of 32 bits words per coordinate
+ */
+CRYPTO_FUNCTION void
+soft_ecc_jacobian_unpack(const uint32_t *const packed,
+                         ecc_bignum_jacobian_point_t *const dst,
+                         size_t curve_nb_32b_words);
+
+/**
+ * @brief constant time lookup in a table of packed points
+ * @details every entry of the table is read and masked, so neither the
+ * timing nor the memory access pattern depend on idx
+ *
+ * @param[in] table                 flat table of packed points
+ * @param[in] nb_entries            number of entries in the table
+ * @param[in] entry_nb_32b_words    table stride (packed point size) in 32
+ * bits words
+ * @param[in] idx                   index of the entry to select
+ * @param[out] out                  selected packed point
+ */
+CRYPTO_FUNCTION void soft_ecc_packed_table_select(const uint32_t *const table,
+                                                  size_t nb_entries,
+                                                  size_t entry_nb_32b_words,
+                                                  size_t idx,
+                                                  uint32_t *const out);
+
 /**
  * @brief  convert affine coordinate into jacobian coordinates
  *
@@ -124,6 +247,41 @@ CRYPTO_FUNCTION int32_t soft_ecc_convert_jacobian_to_affine(
     const ecc_bignum_jacobian_point_t *const in,
     ecc_bignum_affine_point_t *const out, size_t nb_32b_words);
 
+/**
+ * @brief number of points sharing one inversion in
+ * soft_ecc_batch_jacobian_to_affine()
+ */
+#ifndef SOFT_ECC_BATCH_AFFINE_GROUP_SIZE
+#define SOFT_ECC_BATCH_AFFINE_GROUP_SIZE 16
+#endif
+
+/**
+ * @brief convert an array of jacobian points into affine coordinates with a
+ * single modular inversion
+ * @details Montgomery simultaneous inversion: the products z0 * ... * zi are
+ * accumulated, inverted once and unwound, that is 3 * (count - 1) modular
+ * multiplications plus one inversion for the whole array, instead of two
+ * inversions per point with soft_ecc_convert_jacobian_to_affine(). Meant for
+ * precomputed tables, batch key generation and batch verification.
+ * out[i] may share its coordinates with in[i].
+ * The points are processed by groups of @ref SOFT_ECC_BATCH_AFFINE_GROUP_SIZE,
+ * one inversion per group, so the stack scratch does not depend on count.
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      elliptic curve parameters
+ * @param[in] in                Input jacobian points array
+ * @param[out] out              Output affine points array
+ * @param[in] count             number of points in the arrays
+ * @param[in] nb_32b_words      number of 32 bits words per coordinate
+ * @return = 0 in case of success
+ * @return < 0 otherwise @ref scl_errors_t (SCL_INVALID_INPUT if one of the
+ * points is at the infinite)
+ */
+CRYPTO_FUNCTION int32_t soft_ecc_batch_jacobian_to_affine(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_bignum_jacobian_point_t *const in,
+    ecc_bignum_affine_point_t *const out, size_t count, size_t nb_32b_words);
+
 /**
  * @brief check if point is at the infinite
  * @details by definition in the choosen jacobian projection, infinite point is
@@ -284,6 +442,156 @@ CRYPTO_FUNCTION int32_t soft_ecc_mult_coz(
     const ecc_bignum_affine_const_point_t *const point, const uint64_t *const k,
     size_t k_nb_32bits_words, ecc_bignum_affine_point_t *const q);
 
+/**
+ * @brief registers of the x-only co-Z ladder, both points share the same Z:
+ * x(R0) = X0 / Z^2, x(R1) = X1 / Z^2, and along with them w = Z^2,
+ * xd = x(R1 - R0).Z^2, ta = a.Z^4 and tb = 2b.Z^6
+ */
+#define SOFT_ECC_XZ_X0 0
+#define SOFT_ECC_XZ_X1 1
+#define SOFT_ECC_XZ_W 2
+#define SOFT_ECC_XZ_XD 3
+#define SOFT_ECC_XZ_TA 4
+#define SOFT_ECC_XZ_TB 5
+#define SOFT_ECC_XZ_NB_REGS 6
+
+/**
+ * @brief x-only Montgomery ladder with (X,Z) co-Z formulas  q_x = x(k * point)
+ * @details Goundar-Joye-Miyaji style ladder on the x-coordinates only: both
+ * points share the same Z and the y-coordinate is never computed nor
+ * recovered (13M + 4S per bit). The ladder runs on k + n or k + 2n, whichever
+ * has the bit length of n plus one, so its length does not depend on k.
+ * Intended for ECDH and ECDSA where only the x-coordinate of the result is
+ * used.
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] point             input point, of order n (point->y is not used)
+ * @param[in] k                 scalar to multiply, 0 < k < n
+ * @param[in] k_nb_32bits_words scalar length
+ * @param[out] q_x              affine x-coordinate of the output point
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecc_mult_coz_x(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_bignum_affine_const_point_t *const point, const uint64_t *const k,
+    size_t k_nb_32bits_words, uint64_t *const q_x);
+
+/**
+ * @brief when set to 1, soft_ecdh() and the ECDSA r computation use
+ * soft_ecc_mult_coz_x() instead of soft_ecc_mult_window()
+ * @details the x-only ladder needs neither the window table nor the
+ * y-coordinate, the window method needs fewer field operations
+ */
+#ifndef SOFT_ECC_X_ONLY_LADDER
+#define SOFT_ECC_X_ONLY_LADDER 0
+#endif
+
+/**
+ * @brief start a resumable q = k * point (co-Z Montgomery ladder)
+ * @details same computation as soft_ecc_mult_coz(), the ladder state is kept
+ * in ctx so that soft_ecc_ladder_step() can process a bounded number of bits
+ * per call
+ *
+ * @param[in] scl               metal scl context
+ * @param[out] ctx              ladder context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] point             input point
+ * @param[in] k                 scalar to multiply
+ * @param[in] k_nb_32bits_words scalar length
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecc_ladder_start(
+    const metal_scl_t *const scl, ecc_ladder_ctx_t *const ctx,
+    const ecc_curve_t *const curve_params,
+    const ecc_bignum_affine_const_point_t *const point, const uint64_t *const k,
+    size_t k_nb_32bits_words);
+
+/**
+ * @brief process at most max_iterations bits of the scalar
+ *
+ * @param[in] scl               metal scl context
+ * @param[in,out] ctx           ladder context
+ * @param[in] max_iterations    maximum number of ladder iterations (one
+ * iteration per scalar bit, each one costs the same)
+ * @return 0 the ladder is over, soft_ecc_ladder_finish() can be called
+ * @return > 0 number of iterations left
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecc_ladder_step(const metal_scl_t *const scl,
+                                             ecc_ladder_ctx_t *const ctx,
+                                             size_t max_iterations);
+
+/**
+ * @brief finish a resumable scalar multiplication
+ *
+ * @param[in] scl               metal scl context
+ * @param[in,out] ctx           ladder context (zeroized on return)
+ * @param[out] q                output point
+ * @return 0 success
+ * @return SCL_BUSY if the ladder is not over
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecc_ladder_finish(
+    const metal_scl_t *const scl, ecc_ladder_ctx_t *const ctx,
+    ecc_bignum_affine_point_t *const q);
+
+/**
+ * @brief width w of the signed window used by soft_ecc_mult_window()
+ */
+#ifndef SOFT_ECC_WINDOW_WIDTH
+#define SOFT_ECC_WINDOW_WIDTH 4
+#endif
+/**
+ * @brief number of precomputed points (P, 3P, ... (2^w - 1)P) used by
+ * soft_ecc_mult_window()
+ */
+#define SOFT_ECC_WINDOW_TABLE_SIZE (1U << (SOFT_ECC_WINDOW_WIDTH - 1))
+
+/**
+ * @brief regular signed fixed-window scalar multiplication  q = k * point
+ * @details The scalar is recoded into odd, non zero digits in
+ * [-(2^w - 1), 2^w - 1] (Joye-Tunstall regular recoding), so every window
+ * costs w doublings and one addition whatever the scalar value. The table
+ * entry of each digit is read with a masked scan of the whole table and its
+ * sign is applied with a masked negation, without secret dependent branch
+ * or memory access.
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] point             input point (of order n)
+ * @param[in] k                 scalar to multiply, in [1, n - 1]
+ * @param[in] k_nb_32bits_words scalar length (at most curve_wsize)
+ * @param[out] q                output point
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecc_mult_window(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_bignum_affine_const_point_t *const point, const uint64_t *const k,
+    size_t k_nb_32bits_words, ecc_bignum_affine_point_t *const q);
+
+/**
+ * @brief soft_ecc_mult_window() without the final conversion to affine
+ * @details The result is left in jacobian coordinates so that several
+ * results can share one inversion with soft_ecc_batch_jacobian_to_affine().
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] point             input point (of order n)
+ * @param[in] k                 scalar to multiply, in [1, n - 1]
+ * @param[in] k_nb_32bits_words scalar length (at most curve_wsize)
+ * @param[out] q                output point (jacobian)
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecc_mult_window_jacobian(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_bignum_affine_const_point_t *const point, const uint64_t *const k,
+    size_t k_nb_32bits_words, ecc_bignum_jacobian_point_t *const q);
+
 /**
  * Modular Arthmetic optimized for ecc
  */
@@ -383,6 +691,28 @@ CRYPTO_FUNCTION int32_t soft_ecc_mod(const metal_scl_t *const scl,
                                      size_t modulus_nb_32b_words,
                                      uint64_t *const remainder);
 
+/**
+ * @brief modular square root over the curve prime field
+ * @details out = in^((p + 1) / 4) mod p, computed with a fixed addition chain
+ * for secp256r1 and secp384r1, the dedicated field arithmetic for secp521r1
+ * and square and multiply otherwise
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] in                input big integer (lower than p)
+ * @param[out] out              one of the square roots of in
+ * @param[in] nb_32b_words      number of 32 bits words of in and out
+ * @return 0 success
+ * @return SCL_ERROR if in is not a quadratic residue
+ * @return SCL_NOT_YET_SUPPORTED if p is not congruent to 3 modulo 4
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecc_mod_sqrt(const metal_scl_t *const scl,
+                                          const ecc_curve_t *const curve_params,
+                                          const uint64_t *const in,
+                                          uint64_t *const out,
+                                          size_t nb_32b_words);
+
 /** @}*/
 
 #endif /* SCL_BACKEND_SOFT_ECC_H */
@@ -75,6 +75,28 @@ CRYPTO_FUNCTION int32_t soft_ecc_point_on_curve(
     const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
     const ecc_affine_const_point_t *const point);
 
+/**
+ * @brief checking several affine points are on the provided curve
+ * @details Meant for trust stores: the API and the curve are checked once,
+ * the fast reduction of the curve is selected once, then every point is
+ * converted once and y^2 is compared to (x^2 + a).x + b.
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+ *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] points        array of count affine points to check
+ * @param[in] count         number of points
+ * @param[out] valid        bitmap of (count + 31) / 32 words, bit i % 32 of
+ * word i / 32 is set when point i is on the curve
+ * @return 0 if all the points are on the curve
+ * @return SCL_ERR_POINT if at least one point is not on the curve
+ * @return < 0 in case of failure @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecc_point_on_curve_batch(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_affine_const_point_t *const points, size_t count,
+    uint32_t *const valid);
+
 /**
  * @brief compute public key from private key and curve parameters
  *
@@ -105,6 +127,103 @@ CRYPTO_FUNCTION int32_t soft_ecc_keypair_generation(
     const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
     uint8_t *const priv_key, ecc_affine_point_t *const pub_key);
 
+/**
+ * @brief number of keypairs processed together by
+ * soft_ecc_keypair_generation_batch(), this bounds its stack usage
+ */
+#ifndef SOFT_ECC_KEYGEN_BATCH_SIZE
+#define SOFT_ECC_KEYGEN_BATCH_SIZE 8
+#endif
+
+/**
+ * @brief generate several ECC keypairs
+ * @details The keypairs are processed by groups of
+ * @ref SOFT_ECC_KEYGEN_BATCH_SIZE: the entropy of the whole group is fetched
+ * at once, the generator multiplications run back to back and the public
+ * keys share a single modular inversion.
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+ *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] count             number of keypairs to generate
+ * @param[out] priv_keys        private keys, count * curve_bsize bytes, key i
+ * at offset i * curve_bsize
+ * @param[out] pub_keys         array of count public keys
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t, all the private and
+ * public keys are then zeroized
+ */
+CRYPTO_FUNCTION int32_t soft_ecc_keypair_generation_batch(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    size_t count, uint8_t *const priv_keys, ecc_affine_point_t *const pub_keys);
+
+/**
+ * @brief encode an affine point in SEC1 compressed form
+ * @details out = (0x02 | lsb(y)) || x
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+ *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] point             affine point to compress
+ * @param[out] compressed       compressed point buffer
+ * @param[in,out] compressed_len    compressed point buffer length/compressed
+ * point length (@ref ECC_POINT_COMPRESSED_BYTESIZE)
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecc_point_compress(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_affine_const_point_t *const point, uint8_t *const compressed,
+    size_t *const compressed_len);
+
+/**
+ * @brief decode a SEC1 compressed point
+ * @details y is recovered as a square root of x^3 + a.x + b
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+ *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] compressed        compressed point
+ * @param[in] compressed_len    compressed point length
+ * @param[out] point            decompressed affine point
+ * @return 0 in case of success
+ * @return SCL_ERR_POINT if x does not match a point of the curve
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecc_point_decompress(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const uint8_t *const compressed, size_t compressed_len,
+    ecc_affine_point_t *const point);
+
+/**
+ * @brief start a resumable public key generation
+ * @details the scalar multiplication is then run with soft_ecc_ladder_step()
+ *
+ * @param[in] scl           metal scl context
+ * @param[out] ctx          ladder context
+ * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+ *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] priv_key      private key
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecc_pubkey_generation_start(
+    const metal_scl_t *const scl, ecc_ladder_ctx_t *const ctx,
+    const ecc_curve_t *const curve_params, const uint8_t *const priv_key);
+
+/**
+ * @brief finish a resumable public key generation
+ *
+ * @param[in] scl           metal scl context
+ * @param[in,out] ctx       ladder context (zeroized on return)
+ * @param[out] pub_key      public key
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecc_pubkey_generation_finish(
+    const metal_scl_t *const scl, ecc_ladder_ctx_t *const ctx,
+    ecc_affine_point_t *const pub_key);
+
 /** @}*/
 
 #endif /* SCL_BACKEND_SOFT_ECC_KEYGEN_H */
@@ -0,0 +1,143 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+
+/**
+ * @file soft_ecc_msm.h
+ * @brief software multi-scalar multiplication q = sum(k_i.P_i)
+ * @details Straus interleaving (one table of multiples per point, shared
+ * doublings) is used for a few points, the bucket method of Pippenger above
+ * SOFT_ECC_MSM_STRAUS_MAX_POINTS. Both run on the jacobian formulas of
+ * soft_ecc.h and take their tables or buckets from a caller provided
+ * workspace, sized with soft_ecc_msm_workspace_size().
+ * These functions are not constant time, they are meant for public scalars
+ * and points (batch verification, signature aggregation).
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#ifndef SCL_BACKEND_SOFT_ECC_MSM_H
+#define SCL_BACKEND_SOFT_ECC_MSM_H
+
+#include <crypto_cfg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <backend/api/asymmetric/ecc/ecc.h>
+#include <backend/api/scl_backend_api.h>
+
+/**
+ * @addtogroup SOFTWARE
+ * @addtogroup SOFT_ECC_MSM
+ * @ingroup SOFTWARE
+ *  @{
+ */
+
+/**
+ * @brief largest number of points processed with the Straus method
+ */
+#ifndef SOFT_ECC_MSM_STRAUS_MAX_POINTS
+#define SOFT_ECC_MSM_STRAUS_MAX_POINTS 16
+#endif
+
+/**
+ * @brief window width of the Straus method, each point gets a table of
+ * 2^w - 1 multiples
+ */
+#ifndef SOFT_ECC_MSM_STRAUS_WIDTH
+#define SOFT_ECC_MSM_STRAUS_WIDTH 3
+#endif
+
+/**
+ * @brief largest window width of the Pippenger method (2^c - 1 buckets)
+ */
+#ifndef SOFT_ECC_MSM_MAX_WIDTH
+#define SOFT_ECC_MSM_MAX_WIDTH 12
+#endif
+
+/**
+ * @brief workspace size needed by soft_ecc_msm_jacobian()
+ * @details Straus: nb_points * (2^w - 1) packed jacobian points, Pippenger:
+ * 2^c - 1 packed jacobian points, c being chosen from nb_points and the
+ * curve size so that the cost per point decreases as log(nb_points)
+ *
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] nb_points         number of points
+ * @return workspace size in 32 bits words (0 on invalid parameters)
+ */
+CRYPTO_FUNCTION size_t
+soft_ecc_msm_workspace_size(const ecc_curve_t *const curve_params,
+                            size_t nb_points);
+
+/**
+ * @brief multi-scalar multiplication q = sum(scalars[i].points[i])
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] points            input points (affine, on the curve)
+ * @param[in] scalars           input scalars, any value
+ * @param[in] k_nb_32bits_words scalars length (at most curve_wsize)
+ * @param[in] nb_points         number of points and scalars
+ * @param[in] workspace         workspace (64 bits aligned)
+ * @param[in] workspace_nb_32b_words workspace size in 32 bits words, at least
+ * soft_ecc_msm_workspace_size()
+ * @param[out] q                output point (jacobian, may be the infinite)
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecc_msm_jacobian(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_bignum_affine_const_point_t *const points,
+    const uint64_t *const *const scalars, size_t k_nb_32bits_words,
+    size_t nb_points, uint32_t *const workspace,
+    size_t workspace_nb_32b_words, ecc_bignum_jacobian_point_t *const q);
+
+/**
+ * @brief soft_ecc_msm_jacobian() followed by the conversion to affine
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] points            input points (affine, on the curve)
+ * @param[in] scalars           input scalars, any value
+ * @param[in] k_nb_32bits_words scalars length (at most curve_wsize)
+ * @param[in] nb_points         number of points and scalars
+ * @param[in] workspace         workspace (64 bits aligned)
+ * @param[in] workspace_nb_32b_words workspace size in 32 bits words, at least
+ * soft_ecc_msm_workspace_size()
+ * @param[out] q                output point
+ * @return 0 success
+ * @return SCL_ERR_POINT if the result is the infinite point
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecc_msm(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_bignum_affine_const_point_t *const points,
+    const uint64_t *const *const scalars, size_t k_nb_32bits_words,
+    size_t nb_points, uint32_t *const workspace,
+    size_t workspace_nb_32b_words, ecc_bignum_affine_point_t *const q);
+
+/** @}*/
+
+#endif /* SCL_BACKEND_SOFT_ECC_MSM_H */
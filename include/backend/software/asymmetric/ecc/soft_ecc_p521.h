@@ -0,0 +1,296 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ * @file soft_ecc_p521.h
+ * @brief software SECP521R1 field arithmetic and point formulas on
+ * unsaturated limbs
+ * @details Field elements of p = 2^521 - 1 are held in limbs of 58 bits
+ * (RV64) or 29 bits (RV32), the top limb is one bit shorter. The spare bits
+ * of every limb absorb the carries of additions and subtractions, those are
+ * only propagated after a multiplication, and the reduction is a shift and
+ * add as 2^521 = 1 mod p.
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#ifndef SCL_BACKEND_SOFT_ECC_P521_H
+#define SCL_BACKEND_SOFT_ECC_P521_H
+
+#include <crypto_cfg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <backend/api/asymmetric/ecc/ecc.h>
+#include <backend/software/asymmetric/ecc/soft_ecc.h>
+
+/**
+ * @addtogroup SOFTWARE
+ * @addtogroup SOFT_ECC_P521
+ * @ingroup SOFTWARE
+ *  @{
+ */
+
+/**
+ * @brief when set to 1, the software ECC point formulas use this module for
+ * @ref ecc_secp521r1 instead of the bignum API
+ */
+#ifndef SOFT_ECC_P521_FIELD
+#define SOFT_ECC_P521_FIELD 1
+#endif
+
+#if __riscv_xlen == 64
+/*! @brief number of limbs of a field element */
+#define SOFT_ECC_P521_NB_LIMBS 9
+/*! @brief number of bits of a limb (the top limb has one bit less) */
+#define SOFT_ECC_P521_LIMB_BITS 58
+/*! @brief limb */
+typedef uint64_t soft_ecc_p521_limb_t;
+#if defined(__SIZEOF_INT128__)
+/*! @brief double limb, holds the sum of the products */
+__extension__ typedef unsigned __int128 soft_ecc_p521_dlimb_t;
+#else
+#error "SOFT_ECC_P521_FIELD requires a 128 bits integer type on RV64"
+#endif /* __SIZEOF_INT128__ */
+#elif __riscv_xlen == 32
+/*! @brief number of limbs of a field element */
+#define SOFT_ECC_P521_NB_LIMBS 18
+/*! @brief number of bits of a limb (the top limb has one bit less) */
+#define SOFT_ECC_P521_LIMB_BITS 29
+/*! @brief limb */
+typedef uint32_t soft_ecc_p521_limb_t;
+/*! @brief double limb, holds the sum of the products */
+typedef uint64_t soft_ecc_p521_dlimb_t;
+#endif /* __riscv_xlen */
+
+/*! @brief field element, little endian limbs */
+typedef struct soft_ecc_p521_fe_s
+{
+    soft_ecc_p521_limb_t limbs[SOFT_ECC_P521_NB_LIMBS];
+} soft_ecc_p521_fe_t;
+
+/**
+ * @brief load a field element from a big integer
+ *
+ * @param[in] in        big integer (ECC_SECP521R1_32B_WORDS_SIZE words),
+ * lower than 2^521
+ * @param[out] out      field element
+ */
+CRYPTO_FUNCTION void soft_ecc_p521_from_bignum(const uint64_t *const in,
+                                               soft_ecc_p521_fe_t *const out);
+
+/**
+ * @brief store a field element as a fully reduced big integer
+ *
+ * @param[in] in        field element
+ * @param[out] out      big integer in [0, p - 1]
+ * (ECC_SECP521R1_32B_WORDS_SIZE words)
+ */
+CRYPTO_FUNCTION void soft_ecc_p521_to_bignum(const soft_ecc_p521_fe_t *const in,
+                                             uint64_t *const out);
+
+/**
+ * @brief propagate the carries, every limb gets back to its nominal size
+ * (the lowest one may exceed it by a few units)
+ *
+ * @param[in,out] a     field element
+ */
+CRYPTO_FUNCTION void soft_ecc_p521_carry(soft_ecc_p521_fe_t *const a);
+
+/**
+ * @brief out = a + b, carries are not propagated on RV64
+ *
+ * @param[in] a         first operand
+ * @param[in] b         second operand
+ * @param[out] out      result
+ */
+CRYPTO_FUNCTION void soft_ecc_p521_add(const soft_ecc_p521_fe_t *const a,
+                                       const soft_ecc_p521_fe_t *const b,
+                                       soft_ecc_p521_fe_t *const out);
+
+/**
+ * @brief out = a - b, computed as a + 4p - b, carries are not propagated on
+ * RV64
+ * @warning b must be a carried element or the sum of two of them
+ *
+ * @param[in] a         first operand
+ * @param[in] b         second operand
+ * @param[out] out      result
+ */
+CRYPTO_FUNCTION void soft_ecc_p521_sub(const soft_ecc_p521_fe_t *const a,
+                                       const soft_ecc_p521_fe_t *const b,
+                                       soft_ecc_p521_fe_t *const out);
+
+/**
+ * @brief out = a * b mod p, the result is carried
+ *
+ * @param[in] a         first operand
+ * @param[in] b         second operand
+ * @param[out] out      result (may alias a or b)
+ */
+CRYPTO_FUNCTION void soft_ecc_p521_mult(const soft_ecc_p521_fe_t *const a,
+                                        const soft_ecc_p521_fe_t *const b,
+                                        soft_ecc_p521_fe_t *const out);
+
+/**
+ * @brief out = a^2 mod p, the result is carried
+ *
+ * @param[in] a         operand
+ * @param[out] out      result (may alias a)
+ */
+CRYPTO_FUNCTION void soft_ecc_p521_square(const soft_ecc_p521_fe_t *const a,
+                                          soft_ecc_p521_fe_t *const out);
+
+/**
+ * @brief out = a^-1 mod p, computed as a^(p - 2) (constant time)
+ *
+ * @param[in] a         operand
+ * @param[out] out      result (may alias a), 0 if a = 0
+ */
+CRYPTO_FUNCTION void soft_ecc_p521_inv(const soft_ecc_p521_fe_t *const a,
+                                       soft_ecc_p521_fe_t *const out);
+
+/**
+ * @brief out = a^((p + 1) / 4) mod p, square root candidate of a
+ *
+ * @param[in] a         operand
+ * @param[out] out      result (may alias a), a square root of a only if a is
+ * a quadratic residue
+ */
+CRYPTO_FUNCTION void soft_ecc_p521_sqrt(const soft_ecc_p521_fe_t *const a,
+                                        soft_ecc_p521_fe_t *const out);
+
+/**
+ * @brief jacobian point doubling (a = -3), same result as
+ * soft_ecc_double_jacobian()
+ *
+ * @param[in] in        input point
+ * @param[out] out      output point (may alias in)
+ */
+CRYPTO_FUNCTION void
+soft_ecc_p521_double_jacobian(const ecc_bignum_jacobian_point_t *const in,
+                              ecc_bignum_jacobian_point_t *const out);
+
+/**
+ * @brief jacobian point addition, same result as
+ * soft_ecc_add_jacobian_jacobian() for points not at the infinite
+ *
+ * @param[in] in_a      first point
+ * @param[in] in_b      second point
+ * @param[out] out      output point (may alias in_a or in_b)
+ */
+CRYPTO_FUNCTION void soft_ecc_p521_add_jacobian_jacobian(
+    const ecc_bignum_jacobian_point_t *const in_a,
+    const ecc_bignum_jacobian_point_t *const in_b,
+    ecc_bignum_jacobian_point_t *const out);
+
+/**
+ * @brief jacobian to affine conversion, with a single (Fermat) inversion
+ *
+ * @param[in] in        input point
+ * @param[out] out      output point
+ * @return 0 in case of success
+ * @return SCL_INVALID_INPUT if the point is at the infinite (Z = 0)
+ */
+CRYPTO_FUNCTION int32_t
+soft_ecc_p521_jacobian_to_affine(const ecc_bignum_jacobian_point_t *const in,
+                                 ecc_bignum_affine_point_t *const out);
+
+/**
+ * @brief co-Z addition, same result as soft_ecc_xycz_add()
+ *
+ * @param[in] in1       first point (X1, Y1)
+ * @param[in] in2       second point (X2, Y2)
+ * @param[out] out1     P1 + P2
+ * @param[out] out2     P1 with the same Z as out1
+ */
+CRYPTO_FUNCTION void
+soft_ecc_p521_xycz_add(const ecc_bignum_affine_const_point_t *const in1,
+                       const ecc_bignum_affine_const_point_t *const in2,
+                       ecc_bignum_affine_point_t *const out1,
+                       ecc_bignum_affine_point_t *const out2);
+
+/**
+ * @brief conjugate co-Z addition, same result as soft_ecc_xycz_addc()
+ *
+ * @param[in] in1       first point (X1, Y1)
+ * @param[in] in2       second point (X2, Y2)
+ * @param[out] out1     P2 - P1
+ * @param[out] out2     P1 + P2 with the same Z as out1
+ */
+CRYPTO_FUNCTION void
+soft_ecc_p521_xycz_addc(const ecc_bignum_affine_const_point_t *const in1,
+                        const ecc_bignum_affine_const_point_t *const in2,
+                        ecc_bignum_affine_point_t *const out1,
+                        ecc_bignum_affine_point_t *const out2);
+
+/**
+ * @brief co-Z initial doubling (a = -3), same result as soft_ecc_xycz_idbl()
+ *
+ * @param[in] in        affine point
+ * @param[out] out1     2P
+ * @param[out] out2     P with the same Z as out1
+ */
+CRYPTO_FUNCTION void
+soft_ecc_p521_xycz_idbl(const ecc_bignum_affine_const_point_t *const in,
+                        ecc_bignum_affine_point_t *const out1,
+                        ecc_bignum_affine_point_t *const out2);
+
+/**
+ * @brief x-only co-Z ladder registers for R0 = P and R1 = 2.P, same result
+ * as the generic start of soft_ecc_mult_coz_x()
+ *
+ * @param[in] x         x-coordinate of P
+ * @param[in] a         curve parameter a
+ * @param[in] b         curve parameter b
+ * @param[out] reg      ladder registers (@ref SOFT_ECC_XZ_X0 ...)
+ */
+CRYPTO_FUNCTION void
+soft_ecc_p521_xz_start(const uint64_t *const x, const uint64_t *const a,
+                       const uint64_t *const b,
+                       uint64_t *const reg[SOFT_ECC_XZ_NB_REGS]);
+
+/**
+ * @brief x-only co-Z ladder iteration (R0, R1) = (2.R0, R0 + R1), same
+ * result as the generic iteration of soft_ecc_mult_coz_x()
+ *
+ * @param[in,out] reg   ladder registers (@ref SOFT_ECC_XZ_X0 ...)
+ */
+CRYPTO_FUNCTION void
+soft_ecc_p521_xz_iteration(uint64_t *const reg[SOFT_ECC_XZ_NB_REGS]);
+
+/**
+ * @brief affine x-coordinate of R0, X0 / Z^2
+ *
+ * @param[in] reg       ladder registers (@ref SOFT_ECC_XZ_X0 ...)
+ * @param[out] x        x(R0), 0 if Z = 0
+ */
+CRYPTO_FUNCTION void
+soft_ecc_p521_xz_affine(uint64_t *const reg[SOFT_ECC_XZ_NB_REGS],
+                        uint64_t *const x);
+
+/** @}*/
+
+#endif /* SCL_BACKEND_SOFT_ECC_P521_H */
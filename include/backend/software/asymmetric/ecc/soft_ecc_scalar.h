@@ -0,0 +1,185 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ * @file soft_ecc_scalar.h
+ * @brief software arithmetic modulo the ECC curve order n
+ * @details Montgomery multiplication (R = 2^(32 * curve_wsize)) with the
+ * constants stored in the curve parameters, the inversion is a Fermat
+ * exponentiation with a fixed window schedule. None of them relies on the
+ * generic bignum division.
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#ifndef SCL_BACKEND_SOFT_ECC_SCALAR_H
+#define SCL_BACKEND_SOFT_ECC_SCALAR_H
+
+#include <crypto_cfg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <backend/api/asymmetric/ecc/ecc.h>
+
+/**
+ * @addtogroup SOFTWARE
+ * @addtogroup SOFT_ECC_SCALAR
+ * @ingroup SOFTWARE
+ *  @{
+ */
+
+/**
+ * @brief when set to 1, the software ECDSA uses this module for the mod n
+ * operations of the curves providing the Montgomery constants
+ */
+#ifndef SOFT_ECC_SCALAR_FIELD
+#define SOFT_ECC_SCALAR_FIELD 1
+#endif
+
+/**
+ * @brief check the curve provides the mod n Montgomery constants
+ *
+ * @param[in] curve_params  ECC curve parameters
+ * @return true the functions of this module can be used
+ * @return false otherwise
+ */
+CRYPTO_FUNCTION bool
+soft_ecc_scalar_supported(const ecc_curve_t *const curve_params);
+
+/**
+ * @brief Montgomery multiplication out = a.b.R^(-1) mod n
+ *
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] a             first operand (curve_wsize words)
+ * @param[in] b             second operand (curve_wsize words)
+ * @param[out] out          result in [0, n - 1], may alias a or b
+ * @note one of the operands at least shall be lower than n
+ */
+CRYPTO_FUNCTION void soft_ecc_scalar_mont_mult(
+    const ecc_curve_t *const curve_params, const uint64_t *const a,
+    const uint64_t *const b, uint64_t *const out);
+
+/**
+ * @brief Montgomery square out = a^2.R^(-1) mod n
+ *
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] a             operand, lower than n
+ * @param[out] out          result in [0, n - 1], may alias a
+ */
+CRYPTO_FUNCTION void
+soft_ecc_scalar_mont_square(const ecc_curve_t *const curve_params,
+                            const uint64_t *const a, uint64_t *const out);
+
+/**
+ * @brief conversion to Montgomery representation out = a.R mod n
+ *
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] a             operand (curve_wsize words, any value)
+ * @param[out] out          result in [0, n - 1], may alias a
+ */
+CRYPTO_FUNCTION void
+soft_ecc_scalar_to_mont(const ecc_curve_t *const curve_params,
+                        const uint64_t *const a, uint64_t *const out);
+
+/**
+ * @brief conversion from Montgomery representation out = a.R^(-1) mod n
+ *
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] a             operand (curve_wsize words, any value)
+ * @param[out] out          result in [0, n - 1], may alias a
+ */
+CRYPTO_FUNCTION void
+soft_ecc_scalar_from_mont(const ecc_curve_t *const curve_params,
+                          const uint64_t *const a, uint64_t *const out);
+
+/**
+ * @brief reduction out = a mod n
+ *
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] a             operand (curve_wsize words, any value)
+ * @param[out] out          result in [0, n - 1], may alias a
+ */
+CRYPTO_FUNCTION void
+soft_ecc_scalar_reduce(const ecc_curve_t *const curve_params,
+                       const uint64_t *const a, uint64_t *const out);
+
+/**
+ * @brief modular multiplication out = a.b mod n
+ *
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] a             first operand (curve_wsize words)
+ * @param[in] b             second operand (curve_wsize words)
+ * @param[out] out          result in [0, n - 1], may alias a or b
+ * @note one of the operands at least shall be lower than n
+ */
+CRYPTO_FUNCTION void soft_ecc_scalar_mult(const ecc_curve_t *const curve_params,
+                                          const uint64_t *const a,
+                                          const uint64_t *const b,
+                                          uint64_t *const out);
+
+/**
+ * @brief modular addition out = a + b mod n
+ *
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] a             first operand, lower than n
+ * @param[in] b             second operand, lower than n
+ * @param[out] out          result in [0, n - 1], may alias a or b
+ */
+CRYPTO_FUNCTION void soft_ecc_scalar_add(const ecc_curve_t *const curve_params,
+                                         const uint64_t *const a,
+                                         const uint64_t *const b,
+                                         uint64_t *const out);
+
+/**
+ * @brief modular subtraction out = a - b mod n
+ *
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] a             first operand, lower or equal to n
+ * @param[in] b             second operand, lower than n
+ * @param[out] out          result in [0, n], may alias a or b
+ */
+CRYPTO_FUNCTION void soft_ecc_scalar_sub(const ecc_curve_t *const curve_params,
+                                         const uint64_t *const a,
+                                         const uint64_t *const b,
+                                         uint64_t *const out);
+
+/**
+ * @brief modular inversion out = a^(-1) mod n (Fermat: a^(n - 2))
+ *
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] a             operand (curve_wsize words, any value)
+ * @param[out] out          result in [0, n - 1], may alias a
+ * @return 0 in case of success
+ * @return < 0 in case of failure @ref scl_errors_t
+ * @note n shall be prime, the sequence of operations only depends on n
+ */
+CRYPTO_FUNCTION int32_t
+soft_ecc_scalar_inv(const ecc_curve_t *const curve_params,
+                    const uint64_t *const a, uint64_t *const out);
+
+/** @}*/
+
+#endif /* SCL_BACKEND_SOFT_ECC_SCALAR_H */
@@ -69,6 +69,40 @@ soft_ecdh(const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
           const ecc_affine_const_point_t *const peer_pub_key,
           uint8_t *const shared_secret, size_t *const shared_secret_len);
 
+/**
+ * @brief start a resumable ECDH shared secret computation
+ * @details the peer public key is checked here, the scalar multiplication is
+ * then run with soft_ecc_ladder_step()
+ *
+ * @param[in] scl                   metal scl context
+ * @param[out] ctx                  ladder context
+ * @param[in] curve_params          ECC curve parameters (use @ref
+ * ecc_secp256r1, @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] priv_key              private key
+ * @param[in] peer_pub_key          peer public key
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecdh_start(
+    const metal_scl_t *const scl, ecc_ladder_ctx_t *const ctx,
+    const ecc_curve_t *const curve_params, const uint8_t *const priv_key,
+    const ecc_affine_const_point_t *const peer_pub_key);
+
+/**
+ * @brief finish a resumable ECDH shared secret computation
+ *
+ * @param[in] scl                   metal scl context
+ * @param[in,out] ctx               ladder context (zeroized on return)
+ * @param[out] shared_secret        shared secret buffer
+ * @param[in,out] shared_secret_len output buffer length/ shared_secret length
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecdh_finish(const metal_scl_t *const scl,
+                                         ecc_ladder_ctx_t *const ctx,
+                                         uint8_t *const shared_secret,
+                                         size_t *const shared_secret_len);
+
 /** @}*/
 
 #endif /* SCL_BACKEND_SOFT_ECDH_H */
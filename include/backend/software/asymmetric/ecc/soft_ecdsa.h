@@ -110,6 +110,124 @@ CRYPTO_FUNCTION int32_t soft_ecdsa_verification(
     const ecdsa_signature_const_t *const signature, const uint8_t *const hash,
     size_t hash_len);
 
+/**
+ * @brief ECDSA signature with a selectable nonce generation mode
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+ *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] priv_key      private key
+ * @param[out] signature    signature structure that will hold results
+ * @param[in] hash          hash value to sign
+ * @param[in] hash_len      hash value length
+ * @param[in] mode          nonce generation mode
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ * @note In @ref SCL_ECDSA_NONCE_DETERMINISTIC mode, k is derived as in RFC 6979
+ * section 3.2, the masks protecting d are drawn from the same HMAC_DRBG, so
+ * the TRNG is not used at all
+ * @note In @ref SCL_ECDSA_NONCE_HEDGED mode, a small TRNG seed is used as
+ * additional data (RFC 6979 section 3.6)
+ * @note The HMAC hash function is selected from hash_len (SHA224, SHA256,
+ * SHA384 or SHA512 digest length)
+ * @note Same format requirements as @ref soft_ecdsa_signature
+ */
+CRYPTO_FUNCTION int32_t soft_ecdsa_signature_with_nonce_mode(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const uint8_t *const priv_key, const ecdsa_signature_t *const signature,
+    const uint8_t *const hash, size_t hash_len, ecdsa_nonce_mode_t mode);
+
+/**
+ * @brief ECDSA nonces precomputation (offline part of the signature)
+ *
+ * @param[in] scl           metal scl context
+ * @param[in,out] pool      nonce pool to fill
+ * @param[in] nb_nonces     maximum number of nonces to precompute
+ * @return >= 0 number of nonces available in the pool
+ * @return < 0 in case of failure @ref scl_errors_t
+ * @note Each nonce costs a scalar multiplication and a modular inversion, this
+ * is intended to be called when the system is idle
+ */
+CRYPTO_FUNCTION int32_t soft_ecdsa_nonce_pool_fill(
+    const metal_scl_t *const scl, ecdsa_nonce_pool_t *const pool,
+    size_t nb_nonces);
+
+/**
+ * @brief ECDSA signature using a precomputed nonce when available
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+ *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] priv_key      private key
+ * @param[in,out] pool      nonce pool bound to curve_params and priv_key
+ * @param[out] signature    signature structure that will hold results
+ * @param[in] hash          hash value to sign
+ * @param[in] hash_len      hash value length
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ * @note Only s=k^(-1).(h+r.d) mod n is computed when a nonce is available
+ * @note When the pool is empty, @ref soft_ecdsa_signature is used
+ * @note Same format requirements as @ref soft_ecdsa_signature
+ */
+CRYPTO_FUNCTION int32_t soft_ecdsa_signature_with_pool(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const uint8_t *const priv_key, ecdsa_nonce_pool_t *const pool,
+    const ecdsa_signature_t *const signature, const uint8_t *const hash,
+    size_t hash_len);
+
+/**
+ * @brief start a resumable ECDSA signature verification
+ * @details the signature checks, u1/u2 and the iP + jQ table are computed
+ * here, the scalar multiplication u1.G + u2.Q is performed by
+ * soft_ecdsa_verification_step()
+ *
+ * @param[in] scl           metal scl context
+ * @param[out] ctx          verification context
+ * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+ *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] pub_key       public key
+ * @param[in] signature     signature to check
+ * @param[in] hash          hash value on which the signature has been performed
+ * @param[in] hash_len      hash value length
+ * @return 0 in case of success
+ * @return < 0 in case of failure @ref scl_errors_t
+ * @note Same format requirements as @ref soft_ecdsa_verification
+ */
+CRYPTO_FUNCTION int32_t soft_ecdsa_verification_start(
+    const metal_scl_t *const scl, ecdsa_verification_ctx_t *const ctx,
+    const ecc_curve_t *const curve_params,
+    const ecc_affine_const_point_t *const pub_key,
+    const ecdsa_signature_const_t *const signature, const uint8_t *const hash,
+    size_t hash_len);
+
+/**
+ * @brief process at most max_iterations windows of u1.G + u2.Q
+ *
+ * @param[in] scl               metal scl context
+ * @param[in,out] ctx           verification context
+ * @param[in] max_iterations    maximum number of windows to process (each one
+ * costs @ref SCL_ECDSA_WINDOW_WIDTH doublings and at most one addition)
+ * @return 0 all windows are processed, soft_ecdsa_verification_finish() can be
+ * called
+ * @return > 0 number of windows left
+ * @return < 0 in case of failure @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecdsa_verification_step(
+    const metal_scl_t *const scl, ecdsa_verification_ctx_t *const ctx,
+    size_t max_iterations);
+
+/**
+ * @brief finish a resumable ECDSA signature verification
+ *
+ * @param[in] scl           metal scl context
+ * @param[in,out] ctx       verification context
+ * @return 0 the signature is valid
+ * @return SCL_BUSY if some windows are left
+ * @return < 0 in case of failure @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_ecdsa_verification_finish(
+    const metal_scl_t *const scl, ecdsa_verification_ctx_t *const ctx);
+
 /** @}*/
 
 #endif /* SCL_BACKEND_SOFT_ECDSA_H */
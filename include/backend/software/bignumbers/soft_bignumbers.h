@@ -456,6 +456,61 @@ CRYPTO_FUNCTION int32_t soft_bignum_mod_sub(const metal_scl_t *const scl,
                                             uint64_t *const out,
                                             size_t nb_32b_words);
 
+/**
+ * @brief Modular addition without full reduction
+ * @details out = (in_a + in_b) mod ctx->modulus, lazily reduced: the modulus
+ * is only subtracted while the result does not fit under the most
+ * significant word of the modulus. The result is congruent to in_a + in_b
+ * and lower than 2 * ctx->modulus, but may be greater than or equal to
+ * ctx->modulus.
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] ctx               bignumber context (contain modulus info)
+ * @param[in] in_a              Input array a
+ * @param[in] in_b              Input array b
+ * @param[out] out              Output array (addition result)
+ * @param[in] nb_32b_words      number of 32 bits words to use in calcul
+ * @return >= 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ * @warning the modulus used should be of nb_32b_words size
+ * @warning inputs shall be fully reduced or come from a lazy operation, the
+ * result shall only be used as input of a modular operation (not compared or
+ * returned to the caller)
+ */
+CRYPTO_FUNCTION int32_t soft_bignum_mod_add_lazy(const metal_scl_t *const scl,
+                                                 const bignum_ctx_t *const ctx,
+                                                 const uint64_t *const in_a,
+                                                 const uint64_t *const in_b,
+                                                 uint64_t *const out,
+                                                 size_t nb_32b_words);
+
+/**
+ * @brief Modular subtraction without full reduction
+ * @details out = (in_a - in_b) mod ctx->modulus, lazily reduced: the modulus
+ * is only added back while the subtraction borrows. The result is congruent
+ * to in_a - in_b and lower than 2 * ctx->modulus, but may be greater than or
+ * equal to ctx->modulus.
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] ctx               bignumber context (contain modulus info)
+ * @param[in] in_a              Input array a
+ * @param[in] in_b              Input array b
+ * @param[out] out              Output array (subtraction result)
+ * @param[in] nb_32b_words      number of 32 bits words to use in calcul
+ * @return >= 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ * @warning the modulus used should be of nb_32b_words size
+ * @warning inputs shall be fully reduced or come from a lazy operation, the
+ * result shall only be used as input of a modular operation (not compared or
+ * returned to the caller)
+ */
+CRYPTO_FUNCTION int32_t soft_bignum_mod_sub_lazy(const metal_scl_t *const scl,
+                                                 const bignum_ctx_t *const ctx,
+                                                 const uint64_t *const in_a,
+                                                 const uint64_t *const in_b,
+                                                 uint64_t *const out,
+                                                 size_t nb_32b_words);
+
 /**
  * @brief Modular multiplication
  * @details out = (in_a * in_b) mod ctx->modulus
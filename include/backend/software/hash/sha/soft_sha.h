@@ -97,6 +97,90 @@ CRYPTO_FUNCTION int32_t soft_sha_finish(const metal_scl_t *const scl,
                                         uint8_t *const hash,
                                         size_t *const hash_len);
 
+/**
+ * @brief Export the intermediate state of a software sha context
+ *
+ * @param[in] scl               metal scl context (not used in case of soft sha)
+ * @param[in] ctx               sha context
+ * @param[out] state            exported state
+ * @return 0                    SUCCESS
+ * @return != 0                 otherwise @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_sha_export_state(const metal_scl_t *const scl,
+                                              const sha_ctx_t *const ctx,
+                                              sha_state_t *const state);
+
+/**
+ * @brief Resume a software sha context from an exported state
+ *
+ * @param[in] scl               metal scl context (not used in case of soft sha)
+ * @param[out] ctx              sha context
+ * @param[in] state             state to import
+ * @return 0                    SUCCESS
+ * @return != 0                 otherwise @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_sha_import_state(const metal_scl_t *const scl,
+                                              sha_ctx_t *const ctx,
+                                              const sha_state_t *const state);
+
+/**
+ * @brief Compute the hashes of several independent messages
+ * @details messages are hashed one after the other, without going through
+ * the scl dispatch for each of them. The 32 and 64 bytes SHA256 messages use
+ * soft_sha256_fixed().
+ * @note there is no interleaved multi-message kernel, the throughput is the
+ * one of soft_sha_core()
+ *
+ * @param[in] scl               metal scl context (not used in case of soft sha)
+ * @param[in] hash_mode         hash mode
+ * @param[in] msgs              messages to hash
+ * @param[in] lens              messages length (in bytes)
+ * @param[in] count             number of messages
+ * @param[out] digests          hash output buffers, one per message
+ * @param[in,out] hash_len      length of each hash buffer/length of the hash
+ * @return 0                    SUCCESS
+ * @return != 0                 otherwise @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_sha_multi(const metal_scl_t *const scl,
+                                       hash_mode_t hash_mode,
+                                       const uint8_t *const *const msgs,
+                                       const size_t *const lens, size_t count,
+                                       uint8_t *const *const digests,
+                                       size_t *const hash_len);
+
+/**
+ * @brief Compute the SHA256 of a 32 or 64 bytes message
+ * @see soft_sha256_32B() soft_sha256_64B()
+ *
+ * @param[in] scl               metal scl context (not used in case of soft sha)
+ * @param[in] in                message
+ * @param[in] in_len            message length (32 or 64 bytes)
+ * @param[out] digest           32 bytes digest
+ * @return 0                    SUCCESS
+ * @return != 0                 otherwise @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_sha256_fixed(const metal_scl_t *const scl,
+                                          const uint8_t *const in,
+                                          size_t in_len, uint8_t *const digest);
+
+/**
+ * @brief Compute one level of a SHA256 Merkle tree
+ * @details parent i is SHA256(node 2i || node 2i+1), an odd last node is
+ * promoted to the next level unchanged. parents may be the same buffer as
+ * nodes, to reduce a tree in place.
+ *
+ * @param[in] scl               metal scl context (not used in case of soft sha)
+ * @param[in] nodes             nb_nodes concatenated 32 bytes nodes
+ * @param[in] nb_nodes          number of nodes
+ * @param[out] parents          (nb_nodes + 1) / 2 concatenated parents
+ * @return 0                    SUCCESS
+ * @return != 0                 otherwise @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_sha256_merkle_level(const metal_scl_t *const scl,
+                                                 const uint8_t *const nodes,
+                                                 size_t nb_nodes,
+                                                 uint8_t *const parents);
+
 /** @}*/
 
 #endif /* SCL_BACKEND_SOFT_SHA_H */
@@ -106,6 +106,32 @@ CRYPTO_FUNCTION int32_t soft_sha256_finish(sha256_ctx_t *const ctx,
 CRYPTO_FUNCTION void soft_sha256_append_bit_len(uint8_t *const buffer,
                                                 uint64_t *const length);
 
+/**
+ * @brief SHA256 of a 32 bytes message (e.g. a hash chain step)
+ * @details the message and its padding fit in one block, the padding words
+ * are set directly instead of going through the context buffer
+ *
+ * @param[in] in                32 bytes message
+ * @param[out] out              32 bytes digest
+ * @return 0                    SUCCESS
+ * @return != 0                 otherwise @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_sha256_32B(const uint8_t *const in,
+                                        uint8_t *const out);
+
+/**
+ * @brief SHA256 of a 64 bytes message (e.g. two concatenated digests)
+ * @details the padding block is the same for every 64 bytes message, its
+ * message schedule (added to the round constants) is precomputed
+ *
+ * @param[in] in                64 bytes message
+ * @param[out] out              32 bytes digest
+ * @return 0                    SUCCESS
+ * @return != 0                 otherwise @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_sha256_64B(const uint8_t *const in,
+                                        uint8_t *const out);
+
 /** @}*/
 
 #endif /* SCL_BACKEND_SOFT_SHA256_H */
@@ -0,0 +1,81 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+
+/**
+ * @file soft_kdf_pbkdf2.h
+ * @brief software PBKDF2 implementation
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#ifndef SCL_BACKEND_SOFT_PBKDF2_H
+#define SCL_BACKEND_SOFT_PBKDF2_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <crypto_cfg.h>
+
+#include <backend/api/defs.h>
+#include <backend/api/scl_backend_api.h>
+
+#include <scl/scl_retdefs.h>
+
+/**
+ * @addtogroup SOFTWARE
+ * @addtogroup SOFT_API_KDF
+ * @ingroup SOFTWARE
+ *  @{
+ */
+
+/**
+ * @brief derive key based on PBKDF2 with HMAC-SHA (RFC 8018)
+ * @details the password is keyed once with the HMAC key_init entry point,
+ * U_1 goes through the HMAC interface, then every U_j (j > 1) costs exactly
+ * two compressions: the inner and outer messages are the hash length long,
+ * so their single padded block is built once and only the hash part changes.
+ *
+ * @param[in] scl                   metal scl context
+ * @param[in] hash_mode             hash mode
+ * @param[in] password              password
+ * @param[in] password_len          password length (in byte)
+ * @param[in] salt                  salt
+ * @param[in] salt_len              salt length (in byte)
+ * @param[in] iterations            iteration count (> 0)
+ * @param[out] derivated_key        derived key
+ * @param[in] derivated_key_length  derived key length
+ * @return 0                        SUCCESS
+ * @return != 0                     otherwise @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_kdf_pbkdf2(
+    const metal_scl_t *const scl, hash_mode_t hash_mode,
+    const uint8_t *const password, size_t password_len,
+    const uint8_t *const salt, size_t salt_len, uint32_t iterations,
+    uint8_t *const derivated_key, size_t derivated_key_length);
+
+/** @}*/
+
+#endif /* SCL_BACKEND_SOFT_PBKDF2_H */
@@ -0,0 +1,111 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+
+/**
+ * @file soft_kdf_sp800108.h
+ * @brief software SP 800-108 counter mode kdf implementation
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#ifndef SCL_BACKEND_SOFT_SP800108_H
+#define SCL_BACKEND_SOFT_SP800108_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <crypto_cfg.h>
+
+#include <backend/api/defs.h>
+#include <backend/api/key_derivation_functions/kdf.h>
+#include <backend/api/scl_backend_api.h>
+
+#include <scl/scl_retdefs.h>
+
+/**
+ * @addtogroup SOFTWARE
+ * @addtogroup SOFT_API_KDF
+ * @ingroup SOFTWARE
+ *  @{
+ */
+
+/**
+ * @brief init SP 800-108 kdf context with an HMAC-SHA PRF
+ * @details the key is turned into HMAC pad midstates once, with the
+ * hmac_func.key_init entry point
+ *
+ * @param[in] scl                   metal scl context
+ * @param[out] sp800108kdf_ctx      SP 800-108 kdf context
+ * @param[in] sha_ctx               sha context
+ * @param[in] hash_mode             hash mode
+ * @param[in] key                   key derivation key
+ * @param[in] key_len               key derivation key length (in byte)
+ * @return 0                        SUCCESS
+ * @return != 0                     otherwise @ref scl_errors_t
+ * @warning Do not override sha_ctx before the end of the derivations
+ */
+CRYPTO_FUNCTION int32_t soft_kdf_sp800108_hmac_init(
+    const metal_scl_t *const scl, sp800108kdf_ctx_t *const sp800108kdf_ctx,
+    sha_ctx_t *const sha_ctx, hash_mode_t hash_mode, const uint8_t *const key,
+    size_t key_len);
+
+/**
+ * @brief init SP 800-108 kdf context with an AES-CMAC PRF
+ * @details the CMAC subkeys are computed once, AES itself goes through the
+ * aes_func entry points
+ *
+ * @param[in] scl                   metal scl context
+ * @param[out] sp800108kdf_ctx      SP 800-108 kdf context
+ * @param[in] key_type              AES key type (128, 192, 256)
+ * @param[in] key                   key derivation key, in the setkey format
+ * @return 0                        SUCCESS
+ * @return != 0                     otherwise @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_kdf_sp800108_cmac_init(
+    const metal_scl_t *const scl, sp800108kdf_ctx_t *const sp800108kdf_ctx,
+    scl_aes_key_type_t key_type, const uint64_t *const key);
+
+/**
+ * @brief derive keys based on SP 800-108 counter mode
+ * @details K(i) = PRF(KI, [i]_32 || Label || 0x00 || Context || [L]_32), for
+ * each request. With the CMAC PRF, the AES key is loaded once for the whole
+ * batch.
+ *
+ * @param[in] scl                   metal scl context
+ * @param[in] sp800108kdf_ctx       SP 800-108 kdf context
+ * @param[in,out] requests          derivation requests
+ * @param[in] nb_requests           number of requests
+ * @return 0                        SUCCESS
+ * @return != 0                     otherwise @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_kdf_sp800108_derive(
+    const metal_scl_t *const scl,
+    const sp800108kdf_ctx_t *const sp800108kdf_ctx,
+    const sp800108kdf_request_t *const requests, size_t nb_requests);
+
+/** @}*/
+
+#endif /* SCL_BACKEND_SOFT_SP800108_H */
@@ -102,6 +102,45 @@ CRYPTO_FUNCTION int32_t soft_hmac_finish(const metal_scl_t *const scl,
                                          uint8_t *const mac,
                                          size_t *const mac_len);
 
+/**
+ * @brief Precompute the inner and outer hash states of a key
+ * @details k0 ^ ipad and k0 ^ opad are hashed once, the resulting states are
+ * exported in the key context
+ *
+ * @param[in] scl               scl context
+ * @param[out] key_ctx          hmac key context
+ * @param[in,out] sha_ctx       sha context used for the computation
+ * @param[in] hash_mode         hash mode to use
+ * @param[in] key               Key to use for HMAC computation
+ * @param[in] key_len           Key length (in byte)
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ */
+CRYPTO_FUNCTION int32_t soft_hmac_key_init(const metal_scl_t *const scl,
+                                           hmac_key_ctx_t *const key_ctx,
+                                           sha_ctx_t *const sha_ctx,
+                                           hash_mode_t hash_mode,
+                                           const uint8_t *const key,
+                                           size_t key_len);
+
+/**
+ * @brief Initialize HMAC computation from a precomputed key context
+ *
+ * @param[in] scl               scl context
+ * @param[in,out] hmac_ctx      hmac context
+ * @param[in,out] sha_ctx       sha context (this will be referenced into hmac
+ * context)
+ * @param[in] key_ctx           hmac key context (this will be referenced into
+ * hmac context)
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ * @warning Do not override sha_ctx and key_ctx before calling
+ * soft_hmac_finish()
+ */
+CRYPTO_FUNCTION int32_t soft_hmac_init_with_key(
+    const metal_scl_t *const scl, hmac_ctx_t *const hmac_ctx,
+    sha_ctx_t *const sha_ctx, const hmac_key_ctx_t *const key_ctx);
+
 /** @}*/
 
 #endif /* SCL_BACKEND_SOFT_HMAC_H */
@@ -38,10 +38,15 @@
 
 #include <backend/software/asymmetric/ecc/soft_ecc.h>
 #include <backend/software/asymmetric/ecc/soft_ecc_keygen.h>
+#include <backend/software/asymmetric/ecc/soft_ecc_msm.h>
+#include <backend/software/asymmetric/ecc/soft_ecc_p521.h>
+#include <backend/software/asymmetric/ecc/soft_ecc_scalar.h>
 #include <backend/software/asymmetric/ecc/soft_ecdh.h>
 #include <backend/software/asymmetric/ecc/soft_ecdsa.h>
 #include <backend/software/bignumbers/soft_bignumbers.h>
 #include <backend/software/hash/sha/soft_sha.h>
+#include <backend/software/key_derivation_functions/soft_kdf_pbkdf2.h>
+#include <backend/software/key_derivation_functions/soft_kdf_sp800108.h>
 #include <backend/software/key_derivation_functions/soft_kdf_x963.h>
 #include <backend/software/message_auth/soft_hmac.h>
 
@@ -74,6 +74,57 @@ scl_ecdh(const metal_scl_t *const scl_ctx,
          const ecc_affine_const_point_t *const peer_pub_key,
          uint8_t *const shared_secret, size_t *const shared_secret_len);
 
+/**
+ * @brief start a resumable ECDH shared secret computation
+ *
+ * @param[in] scl_ctx               metal scl context
+ * @param[out] ctx                  ladder context (caller owned)
+ * @param[in] curve_params          ECC curve parameters (use @ref
+ * ecc_secp256r1, @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] priv_key              private key
+ * @param[in] peer_pub_key          peer public key
+ * @return 0 in case of success
+ * @return < 0 in case of failure @ref scl_errors_t
+ * @note priv_key key, peer_pub_key shall be big endian
+ * @warning ctx holds secret data until scl_ecdh_finish() is called
+ */
+SCL_FUNCTION int32_t
+scl_ecdh_start(const metal_scl_t *const scl_ctx, ecc_ladder_ctx_t *const ctx,
+               const ecc_curve_t *const curve_params,
+               const uint8_t *const priv_key,
+               const ecc_affine_const_point_t *const peer_pub_key);
+
+/**
+ * @brief process a bounded part of a resumable ECDH computation
+ *
+ * @param[in] scl_ctx               metal scl context
+ * @param[in,out] ctx               ladder context
+ * @param[in] max_iterations        maximum number of iterations to perform,
+ * one iteration per private key bit, each one having the same cost
+ * @return 0 the computation can be finished with scl_ecdh_finish()
+ * @return > 0 number of iterations left
+ * @return < 0 in case of failure @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_ecdh_step(const metal_scl_t *const scl_ctx,
+                                   ecc_ladder_ctx_t *const ctx,
+                                   size_t max_iterations);
+
+/**
+ * @brief finish a resumable ECDH shared secret computation
+ *
+ * @param[in] scl_ctx               metal scl context
+ * @param[in,out] ctx               ladder context (zeroized on return)
+ * @param[out] shared_secret        shared secret buffer
+ * @param[in,out] shared_secret_len output buffer length/ shared_secret length
+ * @return 0 in case of success
+ * @return SCL_BUSY if some iterations are left
+ * @return < 0 in case of failure @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_ecdh_finish(const metal_scl_t *const scl_ctx,
+                                     ecc_ladder_ctx_t *const ctx,
+                                     uint8_t *const shared_secret,
+                                     size_t *const shared_secret_len);
+
 /** @}*/
 
 #endif /* SCL_ECDH_H */
@@ -108,6 +108,153 @@ SCL_FUNCTION int32_t scl_ecdsa_verification(
     const ecdsa_signature_const_t *const signature, const uint8_t *const hash,
     size_t hash_len);
 
+/**
+ * @brief ECDSA signature with a selectable nonce generation mode
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+ *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] priv_key      private key
+ * @param[out] signature    signature structure that will hold results
+ * @param[in] hash          hash value to sign
+ * @param[in] hash_len      hash value length
+ * @param[in] mode          nonce generation mode (@ref ecdsa_nonce_mode_t)
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ * @note Same format requirements as @ref scl_ecdsa_signature
+ * @note @ref SCL_ECDSA_NONCE_DETERMINISTIC derives the nonce from the private
+ * key and the hash (RFC 6979), no TRNG access is performed
+ * @note @ref SCL_ECDSA_NONCE_HEDGED adds a small TRNG seed to the RFC 6979
+ * derivation
+ */
+SCL_FUNCTION int32_t scl_ecdsa_signature_with_nonce_mode(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const uint8_t *const priv_key, const ecdsa_signature_t *const signature,
+    const uint8_t *const hash, size_t hash_len, ecdsa_nonce_mode_t mode);
+
+/**
+ * @brief Initialize an ECDSA nonce pool, bound to a curve and a private key
+ *
+ * @param[out] pool         nonce pool to initialize
+ * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+ *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] priv_key      private key the pool is bound to
+ * @param[in] nonces        nonces storage (caller provided)
+ * @param[in] nb_nonces     number of elements in nonces storage
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ * @note Private key shall be big endian, curve_params->curve_bsize long
+ * @warning The pool holds secret material, call
+ * @ref scl_ecdsa_nonce_pool_zeroize once done
+ */
+SCL_FUNCTION int32_t scl_ecdsa_nonce_pool_init(
+    ecdsa_nonce_pool_t *const pool, const ecc_curve_t *const curve_params,
+    const uint8_t *const priv_key, ecdsa_nonce_t *const nonces,
+    size_t nb_nonces);
+
+/**
+ * @brief Precompute ECDSA nonces (k^(-1) mod n, r) into the pool
+ *
+ * @param[in] scl           metal scl context
+ * @param[in,out] pool      nonce pool to fill
+ * @param[in] nb_nonces     maximum number of nonces to precompute
+ * @return >= 0 number of nonces available in the pool
+ * @return < 0 in case of failure @ref scl_errors_t
+ * @note This is the costly part of the signature (scalar multiplication and
+ * modular inversion), it is intended to be called when the system is idle
+ */
+SCL_FUNCTION int32_t scl_ecdsa_nonce_pool_fill(const metal_scl_t *const scl,
+                                               ecdsa_nonce_pool_t *const pool,
+                                               size_t nb_nonces);
+
+/**
+ * @brief Zeroize an ECDSA nonce pool and its nonces storage
+ *
+ * @param[in,out] pool      nonce pool to zeroize
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_ecdsa_nonce_pool_zeroize(
+    ecdsa_nonce_pool_t *const pool);
+
+/**
+ * @brief ECDSA signature using a precomputed nonce when available
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+ *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] priv_key      private key
+ * @param[in,out] pool      nonce pool bound to curve_params and priv_key
+ * @param[out] signature    signature structure that will hold results
+ * @param[in] hash          hash value to sign
+ * @param[in] hash_len      hash value length
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ * @note Same format requirements as @ref scl_ecdsa_signature
+ * @note A precomputed nonce is consumed (and zeroized) by each signature, when
+ * the pool is empty a regular signature is performed
+ */
+SCL_FUNCTION int32_t scl_ecdsa_signature_with_pool(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const uint8_t *const priv_key, ecdsa_nonce_pool_t *const pool,
+    const ecdsa_signature_t *const signature, const uint8_t *const hash,
+    size_t hash_len);
+
+/**
+ * @brief start a resumable ECDSA signature verification
+ *
+ * @param[in] scl           metal scl context
+ * @param[out] ctx          verification context (caller owned)
+ * @param[in] curve_params  ECC curve parameters (use @ref ecc_secp256r1,
+ *          @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] pub_key       public key
+ * @param[in] signature     signature to check
+ * @param[in] hash          hash value on which the signature has been performed
+ * @param[in] hash_len      hash value length
+ * @return 0 in case of success
+ * @return < 0 in case of failure @ref scl_errors_t
+ * @note Same format requirements as @ref scl_ecdsa_verification
+ * @note The scalar multiplication is performed by scl_ecdsa_verification_step()
+ * so that the latency of each call can be bounded
+ */
+SCL_FUNCTION int32_t scl_ecdsa_verification_start(
+    const metal_scl_t *const scl, ecdsa_verification_ctx_t *const ctx,
+    const ecc_curve_t *const curve_params,
+    const ecc_affine_const_point_t *const pub_key,
+    const ecdsa_signature_const_t *const signature, const uint8_t *const hash,
+    size_t hash_len);
+
+/**
+ * @brief process a bounded part of a resumable ECDSA signature verification
+ *
+ * @param[in] scl               metal scl context
+ * @param[in,out] ctx           verification context
+ * @param[in] max_iterations    maximum number of iterations to perform, one
+ * iteration is @ref SCL_ECDSA_WINDOW_WIDTH point doublings and at most one
+ * point addition
+ * @return 0 the verification can be finished with
+ * scl_ecdsa_verification_finish()
+ * @return > 0 number of iterations left
+ * @return < 0 in case of failure @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t
+scl_ecdsa_verification_step(const metal_scl_t *const scl,
+                            ecdsa_verification_ctx_t *const ctx,
+                            size_t max_iterations);
+
+/**
+ * @brief finish a resumable ECDSA signature verification
+ *
+ * @param[in] scl           metal scl context
+ * @param[in,out] ctx       verification context
+ * @return 0 the signature is valid
+ * @return SCL_BUSY if some iterations are left
+ * @return < 0 in case of failure @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t
+scl_ecdsa_verification_finish(const metal_scl_t *const scl,
+                              ecdsa_verification_ctx_t *const ctx);
+
 /** @}*/
 
 #endif /* SCL_ECDSA_H */
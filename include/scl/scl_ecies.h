@@ -0,0 +1,270 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+
+/**
+ * @file scl_ecies.h
+ * @brief defines the ECIES hybrid encryption interface (ECDH + x9.63 KDF +
+ * AES-GCM)
+ * @details The ephemeral ECDH shared secret is fed as is to the x9.63 KDF,
+ * which derives the AES key and the GCM IV in a single call. The payload is
+ * then processed once by AES-GCM, directly from the source buffer to the
+ * destination buffer.
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#ifndef SCL_ECIES_H
+#define SCL_ECIES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <scl_cfg.h>
+
+#include <scl/scl_defs.h>
+#include <scl/scl_retdefs.h>
+
+#include <backend/api/asymmetric/ecc/ecc.h>
+#include <backend/api/blockcipher/aes/aes.h>
+#include <backend/api/scl_backend_api.h>
+
+#include <scl/scl_sha.h>
+
+/**
+ * @addtogroup SCL
+ * @addtogroup SCL_ECIES
+ * @ingroup SCL
+ *  @{
+ */
+
+/*! @brief GCM IV size derived by the KDF (in bytes) */
+#define SCL_ECIES_IV_BYTESIZE 12
+/*! @brief maximum GCM tag size (in bytes) */
+#define SCL_ECIES_TAG_MAX_BYTESIZE AES_BLOCKSIZE_NB_BYTE
+
+/*! @brief ECIES streaming context */
+typedef struct
+{
+    /*! @brief AES-GCM context */
+    aes_auth_ctx_t aes_ctx;
+    /*! @brief type of operation @ref scl_process_t */
+    scl_process_t mode;
+} scl_ecies_ctx_t;
+
+/**
+ * @brief Initialize an ECIES encryption
+ * @details generate an ephemeral keypair, compute the ECDH shared secret with
+ * the recipient public key, derive the AES key and IV from it and initialize
+ * AES-GCM with them.
+ *
+ * @param[in] scl_ctx               metal scl context
+ * @param[in,out] ctx               ECIES context
+ * @param[in] curve_params          ECC curve parameters (use @ref
+ * ecc_secp256r1, @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] peer_pub_key          recipient public key
+ * @param[out] ephemeral_pub_key    ephemeral public key, to be sent along with
+ * the ciphertext
+ * @param[in] hash_mode             hash mode used by the KDF
+ * @param[in] shared_info           KDF shared information
+ * @param[in] shared_info_len       KDF shared information length
+ * @param[in] key_byte_len          AES key length (16, 24 or 32)
+ * @param[in] aad                   Additional Authenticated Data
+ * @param[in] aad_byte_len          length in bytes of aad
+ * @param[in] pld_byte_len          total length in bytes of the payload
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ * @note peer_pub_key and ephemeral_pub_key are big endian
+ */
+SCL_FUNCTION int32_t scl_ecies_encrypt_init(
+    const metal_scl_t *const scl_ctx, scl_ecies_ctx_t *const ctx,
+    const ecc_curve_t *const curve_params,
+    const ecc_affine_const_point_t *const peer_pub_key,
+    ecc_affine_point_t *const ephemeral_pub_key, scl_hash_mode_t hash_mode,
+    const uint8_t *const shared_info, size_t shared_info_len,
+    size_t key_byte_len, const uint8_t *const aad, size_t aad_byte_len,
+    size_t pld_byte_len);
+
+/**
+ * @brief Initialize an ECIES decryption
+ * @details compute the ECDH shared secret with the sender ephemeral public
+ * key, derive the AES key and IV from it and initialize AES-GCM with them.
+ *
+ * @param[in] scl_ctx               metal scl context
+ * @param[in,out] ctx               ECIES context
+ * @param[in] curve_params          ECC curve parameters (use @ref
+ * ecc_secp256r1, @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] priv_key              recipient private key
+ * @param[in] ephemeral_pub_key     sender ephemeral public key
+ * @param[in] hash_mode             hash mode used by the KDF
+ * @param[in] shared_info           KDF shared information
+ * @param[in] shared_info_len       KDF shared information length
+ * @param[in] key_byte_len          AES key length (16, 24 or 32)
+ * @param[in] aad                   Additional Authenticated Data
+ * @param[in] aad_byte_len          length in bytes of aad
+ * @param[in] pld_byte_len          total length in bytes of the payload
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ * @note priv_key and ephemeral_pub_key are big endian
+ */
+SCL_FUNCTION int32_t scl_ecies_decrypt_init(
+    const metal_scl_t *const scl_ctx, scl_ecies_ctx_t *const ctx,
+    const ecc_curve_t *const curve_params, const uint8_t *const priv_key,
+    const ecc_affine_const_point_t *const ephemeral_pub_key,
+    scl_hash_mode_t hash_mode, const uint8_t *const shared_info,
+    size_t shared_info_len, size_t key_byte_len, const uint8_t *const aad,
+    size_t aad_byte_len, size_t pld_byte_len);
+
+/**
+ * @brief Encrypt or decrypt a payload chunk
+ *
+ * @param[in] scl_ctx           metal scl context
+ * @param[in,out] ctx           ECIES context
+ * @param[out] dst              output buffer
+ * @param[out] dst_byte_len     length of data (in bytes) written into output
+ * buffer
+ * @param[in] src               data to process
+ * @param[in] src_byte_len      length in bytes of data
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_ecies_core(const metal_scl_t *const scl_ctx,
+                                    scl_ecies_ctx_t *const ctx,
+                                    uint8_t *const dst,
+                                    size_t *const dst_byte_len,
+                                    const uint8_t *const src,
+                                    size_t src_byte_len);
+
+/**
+ * @brief Finalize an ECIES encryption and return the authentication tag
+ *
+ * @param[in] scl_ctx           metal scl context
+ * @param[in,out] ctx           ECIES context
+ * @param[out] tag              authentication tag
+ * @param[in] tag_byte_len      length in bytes of tag
+ * @param[out] dst              output buffer
+ * @param[in] src               last data to process
+ * @param[in] src_byte_len      length in bytes of data
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_ecies_encrypt_finish(const metal_scl_t *const scl_ctx,
+                                              scl_ecies_ctx_t *const ctx,
+                                              uint8_t *const tag,
+                                              size_t tag_byte_len,
+                                              uint8_t *const dst,
+                                              const uint8_t *const src,
+                                              size_t src_byte_len);
+
+/**
+ * @brief Finalize an ECIES decryption and check the authentication tag
+ *
+ * @param[in] scl_ctx           metal scl context
+ * @param[in,out] ctx           ECIES context
+ * @param[in] tag               expected authentication tag
+ * @param[in] tag_byte_len      length in bytes of tag
+ * @param[out] dst              output buffer
+ * @param[in] src               last data to process
+ * @param[in] src_byte_len      length in bytes of data
+ * @return 0    in case of SUCCESS
+ * @return SCL_ERR_TAG if the tag does not match
+ * @return != 0 in case of errors @ref scl_errors_t
+ * @warning the plaintext released by scl_ecies_core() shall not be used
+ * before this function succeeded
+ */
+SCL_FUNCTION int32_t scl_ecies_decrypt_finish(const metal_scl_t *const scl_ctx,
+                                              scl_ecies_ctx_t *const ctx,
+                                              const uint8_t *const tag,
+                                              size_t tag_byte_len,
+                                              uint8_t *const dst,
+                                              const uint8_t *const src,
+                                              size_t src_byte_len);
+
+/**
+ * @brief ECIES encryption in one call
+ *
+ * @param[in] scl_ctx               metal scl context
+ * @param[in] curve_params          ECC curve parameters (use @ref
+ * ecc_secp256r1, @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] peer_pub_key          recipient public key
+ * @param[out] ephemeral_pub_key    ephemeral public key
+ * @param[in] hash_mode             hash mode used by the KDF
+ * @param[in] shared_info           KDF shared information
+ * @param[in] shared_info_len       KDF shared information length
+ * @param[in] key_byte_len          AES key length (16, 24 or 32)
+ * @param[in] aad                   Additional Authenticated Data
+ * @param[in] aad_byte_len          length in bytes of aad
+ * @param[out] dst                  ciphertext
+ * @param[in] src                   plaintext
+ * @param[in] src_byte_len          length in bytes of plaintext
+ * @param[out] tag                  authentication tag
+ * @param[in] tag_byte_len          length in bytes of tag
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_ecies_encrypt(
+    const metal_scl_t *const scl_ctx, const ecc_curve_t *const curve_params,
+    const ecc_affine_const_point_t *const peer_pub_key,
+    ecc_affine_point_t *const ephemeral_pub_key, scl_hash_mode_t hash_mode,
+    const uint8_t *const shared_info, size_t shared_info_len,
+    size_t key_byte_len, const uint8_t *const aad, size_t aad_byte_len,
+    uint8_t *const dst, const uint8_t *const src, size_t src_byte_len,
+    uint8_t *const tag, size_t tag_byte_len);
+
+/**
+ * @brief ECIES decryption in one call
+ *
+ * @param[in] scl_ctx               metal scl context
+ * @param[in] curve_params          ECC curve parameters (use @ref
+ * ecc_secp256r1, @ref ecc_secp384r1, @ref ecc_secp521r1, or custom curves)
+ * @param[in] priv_key              recipient private key
+ * @param[in] ephemeral_pub_key     sender ephemeral public key
+ * @param[in] hash_mode             hash mode used by the KDF
+ * @param[in] shared_info           KDF shared information
+ * @param[in] shared_info_len       KDF shared information length
+ * @param[in] key_byte_len          AES key length (16, 24 or 32)
+ * @param[in] aad                   Additional Authenticated Data
+ * @param[in] aad_byte_len          length in bytes of aad
+ * @param[out] dst                  plaintext
+ * @param[in] src                   ciphertext
+ * @param[in] src_byte_len          length in bytes of ciphertext
+ * @param[in] tag                   expected authentication tag
+ * @param[in] tag_byte_len          length in bytes of tag
+ * @return 0    in case of SUCCESS
+ * @return SCL_ERR_TAG if the tag does not match (dst is then cleared)
+ * @return != 0 in case of errors @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_ecies_decrypt(
+    const metal_scl_t *const scl_ctx, const ecc_curve_t *const curve_params,
+    const uint8_t *const priv_key,
+    const ecc_affine_const_point_t *const ephemeral_pub_key,
+    scl_hash_mode_t hash_mode, const uint8_t *const shared_info,
+    size_t shared_info_len, size_t key_byte_len, const uint8_t *const aad,
+    size_t aad_byte_len, uint8_t *const dst, const uint8_t *const src,
+    size_t src_byte_len, const uint8_t *const tag, size_t tag_byte_len);
+
+/** @}*/
+
+#endif /* SCL_ECIES_H */
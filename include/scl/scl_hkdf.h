@@ -0,0 +1,134 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+
+/**
+ * @file scl_hkdf.h
+ * @brief HMAC-based key derivation function (RFC 5869)
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#ifndef SCL_HKDF_H
+#define SCL_HKDF_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <scl_cfg.h>
+
+#include <scl/scl_defs.h>
+#include <scl/scl_retdefs.h>
+
+#include <backend/api/scl_backend_api.h>
+
+#include <scl/scl_hmac.h>
+#include <scl/scl_sha.h>
+
+/**
+ * @addtogroup SCL
+ * @addtogroup SCL_KDF
+ * @ingroup SCL
+ *  @{
+ */
+
+/*! @brief Maximum number of HKDF-Expand output blocks */
+#define SCL_HKDF_MAX_BLOCKS 255
+
+/*! @brief HKDF-Expand context */
+typedef struct
+{
+    /*! @brief HMAC key context keyed once with the PRK */
+    scl_hmac_key_ctx_t prk_ctx;
+    /*! @brief hash length (in byte) */
+    size_t hash_len;
+} scl_hkdf_ctx_t;
+
+/**
+ * @brief HKDF-Extract, compute PRK = HMAC-Hash(salt, IKM)
+ *
+ * @param[in] scl_ctx           metal scl context
+ * @param[in] hash_mode         hash mode
+ * @param[in] salt              optional salt (NULL when not provided)
+ * @param[in] salt_len          salt length (in byte)
+ * @param[in] ikm               input keying material
+ * @param[in] ikm_len           input keying material length (in byte)
+ * @param[out] prk              pseudorandom key
+ * @param[in,out] prk_len       prk buffer length / prk length (in byte)
+ * @return 0                    SUCCESS
+ * @return != 0                 otherwise @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_hkdf_extract(const metal_scl_t *const scl_ctx,
+                                      scl_hash_mode_t hash_mode,
+                                      const uint8_t *const salt,
+                                      size_t salt_len,
+                                      const uint8_t *const ikm,
+                                      size_t ikm_len, uint8_t *const prk,
+                                      size_t *const prk_len);
+
+/**
+ * @brief Initialize HKDF-Expand with a pseudorandom key
+ * @details the HMAC inner and outer states of the PRK are computed once here
+ * and reused by every scl_hkdf_expand() call and every output block
+ *
+ * @param[in] scl_ctx           metal scl context
+ * @param[out] hkdf_ctx         HKDF-Expand context
+ * @param[in] hash_mode         hash mode
+ * @param[in] prk               pseudorandom key
+ * @param[in] prk_len           pseudorandom key length (in byte), at least the
+ * hash length
+ * @return 0                    SUCCESS
+ * @return != 0                 otherwise @ref scl_errors_t
+ * @note the context holds secret material, clear it once not used anymore
+ */
+SCL_FUNCTION int32_t scl_hkdf_expand_init(const metal_scl_t *const scl_ctx,
+                                          scl_hkdf_ctx_t *const hkdf_ctx,
+                                          scl_hash_mode_t hash_mode,
+                                          const uint8_t *const prk,
+                                          size_t prk_len);
+
+/**
+ * @brief HKDF-Expand, derive output keying material for one info label
+ *
+ * @param[in] scl_ctx           metal scl context
+ * @param[in] hkdf_ctx          HKDF-Expand context
+ * @param[in] info              optional context information (may be NULL
+ * when info_len is 0)
+ * @param[in] info_len          context information length (in byte)
+ * @param[out] okm              output keying material
+ * @param[in] okm_len           output keying material length (in byte), at
+ * most SCL_HKDF_MAX_BLOCKS times the hash length
+ * @return 0                    SUCCESS
+ * @return != 0                 otherwise @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_hkdf_expand(const metal_scl_t *const scl_ctx,
+                                     const scl_hkdf_ctx_t *const hkdf_ctx,
+                                     const uint8_t *const info,
+                                     size_t info_len, uint8_t *const okm,
+                                     size_t okm_len);
+
+/** @}*/
+
+#endif /* SCL_HKDF_H */
@@ -61,6 +61,12 @@
  */
 typedef hmac_ctx_t scl_hmac_ctx_t;
 
+/**
+ * @brief SCL HMAC key context definition
+ * @see hmac_key_ctx_t
+ */
+typedef hmac_key_ctx_t scl_hmac_key_ctx_t;
+
 /**
  * @brief Initialize HMAC computation
  *
@@ -113,6 +119,49 @@ SCL_FUNCTION int32_t scl_hmac_finish(const metal_scl_t *const scl_ctx,
                                      scl_hmac_ctx_t *const hmac_ctx,
                                      uint8_t *const mac, size_t *const mac_len);
 
+/**
+ * @brief Precompute the inner and outer hash states of a HMAC key
+ * @details the key context can then be used with scl_hmac_init_with_key() for
+ * any number of MACs, each one saving the hash of two blocks. On backends
+ * that would resume these states in software (HCA 0.5.x), only k0 is kept so
+ * that the MACs stay on the accelerator, without that saving.
+ *
+ * @param[in] scl_ctx           scl context
+ * @param[out] key_ctx          hmac key context
+ * @param[in,out] sha_ctx       sha context used for the computation
+ * @param[in] hash_mode         hash mode to use
+ * @param[in] key               Key to use for HMAC computation
+ * @param[in] key_len           Key length (in byte)
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ * @note the key context holds secret material, clear it once not used anymore
+ */
+SCL_FUNCTION int32_t scl_hmac_key_init(const metal_scl_t *const scl_ctx,
+                                       scl_hmac_key_ctx_t *const key_ctx,
+                                       scl_sha_ctx_t *const sha_ctx,
+                                       scl_hash_mode_t hash_mode,
+                                       const uint8_t *const key,
+                                       size_t key_len);
+
+/**
+ * @brief Initialize HMAC computation from a precomputed key context
+ * @details the computation goes on with scl_hmac_core() and scl_hmac_finish()
+ *
+ * @param[in] scl_ctx           scl context
+ * @param[in,out] hmac_ctx      hmac context
+ * @param[in,out] sha_ctx       sha context (this will be referenced into hmac
+ * context)
+ * @param[in] key_ctx           hmac key context (this will be referenced into
+ * hmac context)
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ * @warning Do not override sha_ctx and key_ctx before calling
+ * scl_hmac_finish()
+ */
+SCL_FUNCTION int32_t scl_hmac_init_with_key(
+    const metal_scl_t *const scl_ctx, scl_hmac_ctx_t *const hmac_ctx,
+    scl_sha_ctx_t *const sha_ctx, const scl_hmac_key_ctx_t *const key_ctx);
+
 /** @}*/
 
 #endif /* SCL_HMAC_H */
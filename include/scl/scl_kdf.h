@@ -60,6 +60,18 @@
  */
 typedef x963kdf_ctx_t scl_x963kdf_ctx_t;
 
+/**
+ * @brief SCL KDF SP 800-108 context definition
+ * @see sp800108kdf_ctx_t
+ */
+typedef sp800108kdf_ctx_t scl_sp800108kdf_ctx_t;
+
+/**
+ * @brief SCL KDF SP 800-108 derivation request definition
+ * @see sp800108kdf_request_t
+ */
+typedef sp800108kdf_request_t scl_sp800108kdf_request_t;
+
 /**
  * @brief Initiate kdf x9.63 context
  *
@@ -100,6 +112,103 @@ SCL_FUNCTION int32_t scl_kdf_x963_derive(const metal_scl_t *const scl_ctx,
                                          uint8_t *const derivated_key,
                                          size_t derivated_key_length);
 
+/**
+ * @brief derive key based on PBKDF2 with HMAC-SHA (RFC 8018)
+ *
+ * @param[in] scl_ctx               metal scl context
+ * @param[in] hash_mode             hash mode
+ * @param[in] password              password
+ * @param[in] password_len          password length (in byte)
+ * @param[in] salt                  salt
+ * @param[in] salt_len              salt length (in byte)
+ * @param[in] iterations            iteration count (> 0)
+ * @param[out] derivated_key        derived key
+ * @param[in] derivated_key_length  derived key length
+ * @return 0                        SUCCESS
+ * @return != 0                     otherwise @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_pbkdf2(const metal_scl_t *const scl_ctx,
+                                scl_hash_mode_t hash_mode,
+                                const uint8_t *const password,
+                                size_t password_len, const uint8_t *const salt,
+                                size_t salt_len, uint32_t iterations,
+                                uint8_t *const derivated_key,
+                                size_t derivated_key_length);
+
+/**
+ * @brief Initiate kdf SP 800-108 context with an HMAC-SHA PRF
+ *
+ * @param[in] scl_ctx               metal scl context
+ * @param[out] sp800108kdf_ctx      SP 800-108 kdf context
+ * @param[in,out] sha_ctx           sha context (this will be referenced into
+ * kdf context)
+ * @param[in] hash_mode             hash mode
+ * @param[in] key                   key derivation key
+ * @param[in] key_len               key derivation key length (in byte)
+ * @return 0                        SUCCESS
+ * @return != 0                     otherwise @ref scl_errors_t
+ * @warning Do not override sha_ctx before the end of the derivations
+ */
+SCL_FUNCTION int32_t
+scl_kdf_sp800108_hmac_init(const metal_scl_t *const scl_ctx,
+                           scl_sp800108kdf_ctx_t *const sp800108kdf_ctx,
+                           scl_sha_ctx_t *const sha_ctx,
+                           scl_hash_mode_t hash_mode, const uint8_t *const key,
+                           size_t key_len);
+
+/**
+ * @brief Initiate kdf SP 800-108 context with an AES-CMAC PRF
+ *
+ * @param[in] scl_ctx               metal scl context
+ * @param[out] sp800108kdf_ctx      SP 800-108 kdf context
+ * @param[in] key                   key derivation key
+ * @param[in] key_len               key derivation key length (16, 24 or 32)
+ * @return 0                        SUCCESS
+ * @return != 0                     otherwise @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t
+scl_kdf_sp800108_cmac_init(const metal_scl_t *const scl_ctx,
+                           scl_sp800108kdf_ctx_t *const sp800108kdf_ctx,
+                           const uint8_t *const key, size_t key_len);
+
+/**
+ * @brief derive key based on SP 800-108 counter mode
+ *
+ * @param[in] scl_ctx               metal scl context
+ * @param[in] sp800108kdf_ctx       SP 800-108 kdf context
+ * @param[in] label                 label
+ * @param[in] label_len             label length (in byte)
+ * @param[in] context               context
+ * @param[in] context_len           context length (in byte)
+ * @param[out] derivated_key        derived key
+ * @param[in] derivated_key_length  derived key length
+ * @return 0                        SUCCESS
+ * @return != 0                     otherwise @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_kdf_sp800108_derive(
+    const metal_scl_t *const scl_ctx,
+    const scl_sp800108kdf_ctx_t *const sp800108kdf_ctx,
+    const uint8_t *const label, size_t label_len, const uint8_t *const context,
+    size_t context_len, uint8_t *const derivated_key,
+    size_t derivated_key_length);
+
+/**
+ * @brief derive several keys based on SP 800-108 counter mode
+ * @details the PRF key setup is shared by all the requests, with the CMAC PRF
+ * the AES key is loaded only once
+ *
+ * @param[in] scl_ctx               metal scl context
+ * @param[in] sp800108kdf_ctx       SP 800-108 kdf context
+ * @param[in,out] requests          derivation requests
+ * @param[in] nb_requests           number of requests
+ * @return 0                        SUCCESS
+ * @return != 0                     otherwise @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_kdf_sp800108_derive_batch(
+    const metal_scl_t *const scl_ctx,
+    const scl_sp800108kdf_ctx_t *const sp800108kdf_ctx,
+    const scl_sp800108kdf_request_t *const requests, size_t nb_requests);
+
 /** @}*/
 
 #endif /* SCL_KDF_H */
@@ -96,6 +96,8 @@ typedef enum
     SCL_ERR_HASH = -22,
     /*! @brief error invalid point (not on ECC curve) */
     SCL_ERR_POINT = -23,
+    /*! @brief error authentication tag mismatch */
+    SCL_ERR_TAG = -24,
 
     /*! @brief error functionnality not present */
     SCL_NOT_PRESENT = -30,
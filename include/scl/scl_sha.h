@@ -58,6 +58,12 @@
  */
 typedef sha_ctx_t scl_sha_ctx_t;
 
+/**
+ * @brief SCL SHA exported state definition
+ * @see sha_state_t
+ */
+typedef sha_state_t scl_sha_state_t;
+
 /**
  * @brief compute SHA hash on the data inn parameter and return result
  *
@@ -117,6 +123,75 @@ SCL_FUNCTION int32_t scl_sha_finish(const metal_scl_t *const scl_ctx,
                                     uint8_t *const hash,
                                     size_t *const hash_len);
 
+/**
+ * @brief Export the intermediate state of a SHA computation
+ * @details the exported state can be imported several times, to hash
+ * different messages sharing the same prefix without hashing it again
+ *
+ * @param[in] scl_ctx           scl context
+ * @param[in] ctx               SHA context
+ * @param[out] state            exported state
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_sha_export_state(const metal_scl_t *const scl_ctx,
+                                          const scl_sha_ctx_t *const ctx,
+                                          scl_sha_state_t *const state);
+
+/**
+ * @brief Resume a SHA computation from an exported state
+ * @note with a hardware backend unable to load the state, the computation is
+ * resumed in software and ctx->soft_resume is set
+ *
+ * @param[in] scl_ctx           scl context
+ * @param[out] ctx              SHA context
+ * @param[in] state             state to import
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_sha_import_state(const metal_scl_t *const scl_ctx,
+                                          scl_sha_ctx_t *const ctx,
+                                          const scl_sha_state_t *const state);
+
+/**
+ * @brief Clone a SHA context
+ * @details both contexts can then be updated and finalized independently
+ *
+ * @param[in] scl_ctx           scl context
+ * @param[in] src               SHA context to clone
+ * @param[out] dst              cloned SHA context
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_sha_ctx_clone(const metal_scl_t *const scl_ctx,
+                                       const scl_sha_ctx_t *const src,
+                                       scl_sha_ctx_t *const dst);
+
+/**
+ * @brief compute SHA hashes of several independent messages
+ * @details uses the backend multi-message entry point when available,
+ * otherwise the messages are hashed one after the other with scl_sha().
+ * @note this is a batching convenience, it is not faster than hashing the
+ * messages one by one: the software backend hashes them serially too, no
+ * interleaved multi-message kernel is provided.
+ *
+ * @param[in] scl_ctx           scl context
+ * @param[in] algo              hash algorithm to use
+ * @param[in] msgs              messages to hash
+ * @param[in] lens              length in bytes of each message
+ * @param[in] count             number of messages
+ * @param[out] digests          hash output buffers, one per message
+ * @param[in,out] hash_len      length of each output buffer / hash length
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_sha_multi(const metal_scl_t *const scl_ctx,
+                                   scl_hash_mode_t algo,
+                                   const uint8_t *const *const msgs,
+                                   const size_t *const lens, size_t count,
+                                   uint8_t *const *const digests,
+                                   size_t *const hash_len);
+
 /**
  * @brief   Check if the input length is a valid SHA length
  * @details  this function is used to determine if a proposed integer is a
@@ -128,6 +203,51 @@ SCL_FUNCTION int32_t scl_sha_finish(const metal_scl_t *const scl_ctx,
  */
 SCL_FUNCTION int32_t scl_valid_hash_digest_length(size_t inputlength);
 
+/**
+ * @brief compute the SHA256 of a 32 bytes message (e.g. a hash chain step)
+ * @details uses the backend fixed length entry point when available
+ *
+ * @param[in] scl_ctx           scl context
+ * @param[in] in                32 bytes message
+ * @param[out] out              32 bytes digest
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_sha256_32B(const metal_scl_t *const scl_ctx,
+                                    const uint8_t *const in,
+                                    uint8_t *const out);
+
+/**
+ * @brief compute the SHA256 of a 64 bytes message (e.g. two child digests)
+ * @details uses the backend fixed length entry point when available
+ *
+ * @param[in] scl_ctx           scl context
+ * @param[in] in                64 bytes message
+ * @param[out] out              32 bytes digest
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_sha256_64B(const metal_scl_t *const scl_ctx,
+                                    const uint8_t *const in,
+                                    uint8_t *const out);
+
+/**
+ * @brief compute one level of a SHA256 Merkle tree
+ * @details parent i is SHA256(node 2i || node 2i+1), an odd last node is
+ * promoted to the next level unchanged. out may be the same buffer as in, so
+ * that a whole tree can be reduced in place down to its root.
+ *
+ * @param[in] scl_ctx           scl context
+ * @param[in] in                n concatenated 32 bytes nodes
+ * @param[in] n                 number of nodes
+ * @param[out] out              (n + 1) / 2 concatenated 32 bytes parents
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_sha256_merkle_level(const metal_scl_t *const scl_ctx,
+                                             const uint8_t *const in, size_t n,
+                                             uint8_t *const out);
+
 /** @}*/
 
 #endif /* SCL_SHA_H */
@@ -0,0 +1,164 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+
+/**
+ * @file scl_sha_tree.h
+ * @brief Merkle tree hashing of large images, split in fixed size chunks
+ * @details leaf i is the hash of 0x00 || chunk i (the last chunk may be
+ * shorter, an empty image is one empty chunk), parents are the hash of
+ * 0x01 || left child || right child, an odd last node is promoted to the next
+ * level unchanged. The prefixes are those of RFC 6962: a node can't be
+ * passed off as a leaf, so the root also binds the number of chunks.
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#ifndef SCL_SHA_TREE_H
+#define SCL_SHA_TREE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <scl_cfg.h>
+
+#include <scl/scl_defs.h>
+#include <scl/scl_retdefs.h>
+
+#include <backend/api/scl_backend_api.h>
+
+#include <scl/scl_sha.h>
+
+/**
+ * @addtogroup SCL
+ * @addtogroup SCL_SHA
+ * @ingroup SCL
+ *  @{
+ */
+
+/**
+ * @brief number of leaves hashed per round, when SCL_SHA_TREE_PTHREAD is not
+ * defined
+ */
+#ifndef SCL_SHA_TREE_BATCH
+#define SCL_SHA_TREE_BATCH 8
+#endif
+
+#if defined(SCL_SHA_TREE_PTHREAD)
+/**
+ * @brief number of threads hashing leaves (host build), created and joined
+ * at each round
+ */
+#ifndef SCL_SHA_TREE_THREADS
+#define SCL_SHA_TREE_THREADS 4
+#endif
+
+/*! @brief number of leaves hashed by each thread per round (host build) */
+#ifndef SCL_SHA_TREE_THREAD_LEAVES
+#define SCL_SHA_TREE_THREAD_LEAVES 64
+#endif
+#endif
+
+/**
+ * @brief number of chunks of an image
+ *
+ * @param[in] len               image length (in byte)
+ * @param[in] chunk_size        chunk size (in byte, > 0)
+ * @return number of chunks (0 if chunk_size is 0)
+ */
+SCL_FUNCTION size_t scl_sha_tree_nb_chunks(size_t len, size_t chunk_size);
+
+/**
+ * @brief compute the Merkle tree root of an image
+ *
+ * @param[in] scl_ctx           scl context
+ * @param[in] algo              hash algorithm to use
+ * @param[in] data              image
+ * @param[in] len               image length (in byte)
+ * @param[in] chunk_size        chunk size (in byte)
+ * @param[out] root             root hash
+ * @param[in,out] root_len      length of the root buffer / hash length
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_sha_tree(const metal_scl_t *const scl_ctx,
+                                  scl_hash_mode_t algo,
+                                  const uint8_t *const data, size_t len,
+                                  size_t chunk_size, uint8_t *const root,
+                                  size_t *const root_len);
+
+/**
+ * @brief compute the leaves of the Merkle tree of an image (the per chunk
+ * hashes of a manifest)
+ *
+ * @param[in] scl_ctx           scl context
+ * @param[in] algo              hash algorithm to use
+ * @param[in] data              image
+ * @param[in] len               image length (in byte)
+ * @param[in] chunk_size        chunk size (in byte)
+ * @param[out] leaves           concatenated leaves
+ * @param[in] leaves_len        length of the leaves buffer, at least
+ * scl_sha_tree_nb_chunks() hashes
+ * @return 0    in case of SUCCESS
+ * @return != 0 in case of errors @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_sha_tree_leaves(const metal_scl_t *const scl_ctx,
+                                         scl_hash_mode_t algo,
+                                         const uint8_t *const data,
+                                         size_t len, size_t chunk_size,
+                                         uint8_t *const leaves,
+                                         size_t leaves_len);
+
+/**
+ * @brief verify an image against its manifest, and report the chunks to
+ * fetch again
+ * @details the expected leaves are first checked against the expected root
+ * (when provided), then each chunk is hashed and compared to its leaf.
+ *
+ * @param[in] scl_ctx           scl context
+ * @param[in] algo              hash algorithm to use
+ * @param[in] data              image
+ * @param[in] len               image length (in byte)
+ * @param[in] chunk_size        chunk size (in byte)
+ * @param[in] expected_leaves   concatenated expected leaves
+ * @param[in] expected_root     expected root (NULL if the leaves are trusted)
+ * @param[out] bad_chunks       bitmap, bit i % 32 of word i / 32 is set when
+ * chunk i does not match
+ * @param[in] bad_chunks_len    length of the bitmap (in byte), at least
+ * (scl_sha_tree_nb_chunks() + 31) / 32 words
+ * @return 0 if all the chunks match
+ * @return SCL_ERR_HASH if at least one chunk does not match
+ * @return SCL_INVALID_INPUT if the expected leaves do not match the root
+ * @return < 0 in case of failure @ref scl_errors_t
+ */
+SCL_FUNCTION int32_t scl_sha_tree_verify(
+    const metal_scl_t *const scl_ctx, scl_hash_mode_t algo,
+    const uint8_t *const data, size_t len, size_t chunk_size,
+    const uint8_t *const expected_leaves, const uint8_t *const expected_root,
+    uint32_t *const bad_chunks, size_t bad_chunks_len);
+
+/** @}*/
+
+#endif /* SCL_SHA_TREE_H */
@@ -51,6 +51,25 @@ int32_t scl_ecc_key_on_curve(const metal_scl_t *const scl,
     return (scl->ecc_func.point_on_curve(scl, curve_params, point));
 }
 
+int32_t scl_ecc_key_on_curve_batch(const metal_scl_t *const scl,
+                                   const ecc_curve_t *const curve_params,
+                                   const ecc_affine_const_point_t *const points,
+                                   size_t count, uint32_t *const valid)
+{
+    if ((NULL == scl))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->ecc_func.point_on_curve_batch))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl->ecc_func.point_on_curve_batch(scl, curve_params, points, count,
+                                               valid));
+}
+
 int32_t scl_ecc_pubkey_generation(const metal_scl_t *const scl,
                                   const ecc_curve_t *const curve_params,
                                   const uint8_t *const priv_key,
@@ -88,3 +107,115 @@ int32_t scl_ecc_keypair_generation(const metal_scl_t *const scl,
     return (
         scl->ecc_func.keypair_generation(scl, curve_params, priv_key, pub_key));
 }
+
+int32_t scl_ecc_keypair_generation_batch(const metal_scl_t *const scl,
+                                         const ecc_curve_t *const curve_params,
+                                         size_t count, uint8_t *const priv_keys,
+                                         ecc_affine_point_t *const pub_keys)
+{
+    if ((NULL == scl))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->ecc_func.keypair_generation_batch))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl->ecc_func.keypair_generation_batch(scl, curve_params, count,
+                                                   priv_keys, pub_keys));
+}
+
+int32_t scl_ecc_point_compress(const metal_scl_t *const scl,
+                               const ecc_curve_t *const curve_params,
+                               const ecc_affine_const_point_t *const point,
+                               uint8_t *const compressed,
+                               size_t *const compressed_len)
+{
+    if ((NULL == scl))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->ecc_func.point_compress))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl->ecc_func.point_compress(scl, curve_params, point, compressed,
+                                         compressed_len));
+}
+
+int32_t scl_ecc_point_decompress(const metal_scl_t *const scl,
+                                 const ecc_curve_t *const curve_params,
+                                 const uint8_t *const compressed,
+                                 size_t compressed_len,
+                                 ecc_affine_point_t *const point)
+{
+    if ((NULL == scl))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->ecc_func.point_decompress))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl->ecc_func.point_decompress(scl, curve_params, compressed,
+                                           compressed_len, point));
+}
+
+int32_t scl_ecc_pubkey_generation_start(const metal_scl_t *const scl,
+                                        ecc_ladder_ctx_t *const ctx,
+                                        const ecc_curve_t *const curve_params,
+                                        const uint8_t *const priv_key)
+{
+    if ((NULL == scl))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->ecc_func.pubkey_generation_start))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl->ecc_func.pubkey_generation_start(scl, ctx, curve_params,
+                                                  priv_key));
+}
+
+int32_t scl_ecc_pubkey_generation_step(const metal_scl_t *const scl,
+                                       ecc_ladder_ctx_t *const ctx,
+                                       size_t max_iterations)
+{
+    if ((NULL == scl))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->ecc_func.ladder_step))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl->ecc_func.ladder_step(scl, ctx, max_iterations));
+}
+
+int32_t scl_ecc_pubkey_generation_finish(const metal_scl_t *const scl,
+                                         ecc_ladder_ctx_t *const ctx,
+                                         ecc_affine_point_t *const pub_key)
+{
+    if ((NULL == scl))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->ecc_func.pubkey_generation_finish))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl->ecc_func.pubkey_generation_finish(scl, ctx, pub_key));
+}
@@ -54,3 +54,58 @@ int32_t scl_ecdh(const metal_scl_t *const scl_ctx,
                                    peer_pub_key, shared_secret,
                                    shared_secret_len));
 }
+
+int32_t scl_ecdh_start(const metal_scl_t *const scl_ctx,
+                       ecc_ladder_ctx_t *const ctx,
+                       const ecc_curve_t *const curve_params,
+                       const uint8_t *const priv_key,
+                       const ecc_affine_const_point_t *const peer_pub_key)
+{
+    if (NULL == scl_ctx)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl_ctx->ecc_func.ecdh_start))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl_ctx->ecc_func.ecdh_start(scl_ctx, ctx, curve_params, priv_key,
+                                         peer_pub_key));
+}
+
+int32_t scl_ecdh_step(const metal_scl_t *const scl_ctx,
+                      ecc_ladder_ctx_t *const ctx, size_t max_iterations)
+{
+    if (NULL == scl_ctx)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl_ctx->ecc_func.ladder_step))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl_ctx->ecc_func.ladder_step(scl_ctx, ctx, max_iterations));
+}
+
+int32_t scl_ecdh_finish(const metal_scl_t *const scl_ctx,
+                        ecc_ladder_ctx_t *const ctx,
+                        uint8_t *const shared_secret,
+                        size_t *const shared_secret_len)
+{
+    if (NULL == scl_ctx)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl_ctx->ecc_func.ecdh_finish))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl_ctx->ecc_func.ecdh_finish(scl_ctx, ctx, shared_secret,
+                                          shared_secret_len));
+}
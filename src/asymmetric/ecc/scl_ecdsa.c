@@ -31,29 +31,23 @@
  * @copyright SPDX-License-Identifier: MIT
  */
 
+#include <string.h>
+
 #include <scl/scl_ecdsa.h>
 #include <scl/scl_retdefs.h>
 #include <scl/scl_sha.h>
 
-int32_t scl_ecdsa_signature(const metal_scl_t *const scl,
-                            const ecc_curve_t *const curve_params,
-                            const uint8_t *const priv_key,
-                            const ecdsa_signature_t *const signature,
-                            const uint8_t *const hash, size_t hash_len)
+/**
+ * @brief check the hash length is suitable for the curve
+ *
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] hash_len      hash value length
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+static int32_t scl_ecdsa_check_hash_len(const ecc_curve_t *const curve_params,
+                                        size_t hash_len)
 {
-    int32_t result = 0;
-
-    if ((NULL == scl) || (NULL == hash) || (NULL == curve_params))
-    {
-        return (SCL_INVALID_INPUT);
-    }
-
-    if ((NULL == scl->ecdsa_func.signature))
-    {
-        return (SCL_ERROR_API_ENTRY_POINT);
-    }
-
-    /* Check hash length to avoid error */
     switch (hash_len)
     {
     case SHA256_BYTE_HASHSIZE:
@@ -82,6 +76,34 @@ int32_t scl_ecdsa_signature(const metal_scl_t *const scl,
         return (SCL_ERR_HASH);
     }
 
+    return (SCL_OK);
+}
+
+int32_t scl_ecdsa_signature(const metal_scl_t *const scl,
+                            const ecc_curve_t *const curve_params,
+                            const uint8_t *const priv_key,
+                            const ecdsa_signature_t *const signature,
+                            const uint8_t *const hash, size_t hash_len)
+{
+    int32_t result = 0;
+
+    if ((NULL == scl) || (NULL == hash) || (NULL == curve_params))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->ecdsa_func.signature))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    /* Check hash length to avoid error */
+    result = scl_ecdsa_check_hash_len(curve_params, hash_len);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
     result = scl->ecdsa_func.signature(scl, curve_params, priv_key, signature,
                                        hash, hash_len);
 
@@ -107,32 +129,10 @@ int32_t scl_ecdsa_verification(const metal_scl_t *const scl,
     }
 
     /* Check hash length to avoid error */
-    switch (hash_len)
+    result = scl_ecdsa_check_hash_len(curve_params, hash_len);
+    if (SCL_OK != result)
     {
-    case SHA256_BYTE_HASHSIZE:
-        if ((curve_params->curve_bsize > hash_len))
-        {
-            return (SCL_ERR_HASH);
-        }
-        break;
-    case SHA384_BYTE_HASHSIZE:
-        if ((curve_params->curve_bsize > hash_len))
-        {
-            return (SCL_ERR_HASH);
-        }
-        break;
-
-    case SHA512_BYTE_HASHSIZE:
-        /* code */
-        if ((curve_params->curve_bsize > hash_len) &&
-            (ECC_SECP521R1 != curve_params->curve))
-        {
-            return (SCL_ERR_HASH);
-        }
-        break;
-
-    default:
-        return (SCL_ERR_HASH);
+        return (result);
     }
 
     result = scl->ecdsa_func.verification(scl, curve_params, pub_key, signature,
@@ -140,3 +140,195 @@ int32_t scl_ecdsa_verification(const metal_scl_t *const scl,
 
     return (result);
 }
+
+int32_t scl_ecdsa_signature_with_nonce_mode(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const uint8_t *const priv_key, const ecdsa_signature_t *const signature,
+    const uint8_t *const hash, size_t hash_len, ecdsa_nonce_mode_t mode)
+{
+    int32_t result = 0;
+
+    if ((NULL == scl) || (NULL == hash) || (NULL == curve_params))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->ecdsa_func.signature_with_nonce_mode))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    /* Check hash length to avoid error */
+    result = scl_ecdsa_check_hash_len(curve_params, hash_len);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    result = scl->ecdsa_func.signature_with_nonce_mode(
+        scl, curve_params, priv_key, signature, hash, hash_len, mode);
+
+    return (result);
+}
+
+int32_t scl_ecdsa_nonce_pool_init(ecdsa_nonce_pool_t *const pool,
+                                  const ecc_curve_t *const curve_params,
+                                  const uint8_t *const priv_key,
+                                  ecdsa_nonce_t *const nonces, size_t nb_nonces)
+{
+    if ((NULL == pool) || (NULL == curve_params) || (NULL == priv_key) ||
+        (NULL == nonces))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (ECDSA_MAX_BYTESIZE < curve_params->curve_bsize)
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    memset(pool, 0, sizeof(*pool));
+    memset(nonces, 0, nb_nonces * sizeof(*nonces));
+
+    pool->curve_params = curve_params;
+    memcpy(pool->priv_key, priv_key, curve_params->curve_bsize);
+    pool->nonces = nonces;
+    pool->nb_nonces = nb_nonces;
+    pool->nb_available = 0;
+
+    return (SCL_OK);
+}
+
+int32_t scl_ecdsa_nonce_pool_fill(const metal_scl_t *const scl,
+                                  ecdsa_nonce_pool_t *const pool,
+                                  size_t nb_nonces)
+{
+    if ((NULL == scl) || (NULL == pool))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (NULL == scl->ecdsa_func.nonce_pool_fill)
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl->ecdsa_func.nonce_pool_fill(scl, pool, nb_nonces));
+}
+
+int32_t scl_ecdsa_nonce_pool_zeroize(ecdsa_nonce_pool_t *const pool)
+{
+    if (NULL == pool)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (NULL != pool->nonces)
+    {
+        memset(pool->nonces, 0, pool->nb_nonces * sizeof(*pool->nonces));
+    }
+
+    memset(pool, 0, sizeof(*pool));
+
+    return (SCL_OK);
+}
+
+int32_t scl_ecdsa_signature_with_pool(const metal_scl_t *const scl,
+                                      const ecc_curve_t *const curve_params,
+                                      const uint8_t *const priv_key,
+                                      ecdsa_nonce_pool_t *const pool,
+                                      const ecdsa_signature_t *const signature,
+                                      const uint8_t *const hash,
+                                      size_t hash_len)
+{
+    int32_t result = 0;
+
+    if ((NULL == scl) || (NULL == hash) || (NULL == curve_params) ||
+        (NULL == pool))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->ecdsa_func.signature_with_pool))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    /* Check hash length to avoid error */
+    result = scl_ecdsa_check_hash_len(curve_params, hash_len);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    result = scl->ecdsa_func.signature_with_pool(
+        scl, curve_params, priv_key, pool, signature, hash, hash_len);
+
+    return (result);
+}
+
+int32_t scl_ecdsa_verification_start(
+    const metal_scl_t *const scl, ecdsa_verification_ctx_t *const ctx,
+    const ecc_curve_t *const curve_params,
+    const ecc_affine_const_point_t *const pub_key,
+    const ecdsa_signature_const_t *const signature, const uint8_t *const hash,
+    size_t hash_len)
+{
+    int32_t result = 0;
+
+    if ((NULL == scl) || (NULL == hash) || (NULL == curve_params))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->ecdsa_func.verification_start))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    /* Check hash length to avoid error */
+    result = scl_ecdsa_check_hash_len(curve_params, hash_len);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    result = scl->ecdsa_func.verification_start(scl, ctx, curve_params,
+                                                pub_key, signature, hash,
+                                                hash_len);
+
+    return (result);
+}
+
+int32_t scl_ecdsa_verification_step(const metal_scl_t *const scl,
+                                    ecdsa_verification_ctx_t *const ctx,
+                                    size_t max_iterations)
+{
+    if (NULL == scl)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->ecdsa_func.verification_step))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl->ecdsa_func.verification_step(scl, ctx, max_iterations));
+}
+
+int32_t scl_ecdsa_verification_finish(const metal_scl_t *const scl,
+                                      ecdsa_verification_ctx_t *const ctx)
+{
+    if (NULL == scl)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->ecdsa_func.verification_finish))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl->ecdsa_func.verification_finish(scl, ctx));
+}
@@ -0,0 +1,344 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+
+/**
+ * @file scl_ecies.c
+ * @brief ECIES hybrid encryption (ECDH + x9.63 KDF + AES-GCM)
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#include <string.h>
+
+#include <scl/scl_retdefs.h>
+
+#include <scl/scl_aes_gcm.h>
+#include <scl/scl_ecc_keygen.h>
+#include <scl/scl_ecdh.h>
+#include <scl/scl_ecies.h>
+#include <scl/scl_kdf.h>
+
+static int32_t scl_ecies_setup(
+    const metal_scl_t *const scl_ctx, scl_ecies_ctx_t *const ctx,
+    const ecc_curve_t *const curve_params, const uint8_t *const priv_key,
+    const ecc_affine_const_point_t *const pub_key, scl_hash_mode_t hash_mode,
+    const uint8_t *const shared_info, size_t shared_info_len,
+    size_t key_byte_len, const uint8_t *const aad, size_t aad_byte_len,
+    size_t pld_byte_len, scl_process_t mode);
+
+static int32_t scl_ecies_check_params(const metal_scl_t *const scl_ctx,
+                                      const scl_ecies_ctx_t *const ctx,
+                                      const ecc_curve_t *const curve_params,
+                                      size_t key_byte_len);
+
+static int32_t scl_ecies_check_params(const metal_scl_t *const scl_ctx,
+                                      const scl_ecies_ctx_t *const ctx,
+                                      const ecc_curve_t *const curve_params,
+                                      size_t key_byte_len)
+{
+    if ((NULL == scl_ctx) || (NULL == ctx) || (NULL == curve_params))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((0 == curve_params->curve_bsize) ||
+        (ECDSA_MAX_BYTESIZE < curve_params->curve_bsize))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    if ((SCL_KEY128 != key_byte_len) && (SCL_KEY192 != key_byte_len) &&
+        (SCL_KEY256 != key_byte_len))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    return (SCL_OK);
+}
+
+static int32_t scl_ecies_setup(
+    const metal_scl_t *const scl_ctx, scl_ecies_ctx_t *const ctx,
+    const ecc_curve_t *const curve_params, const uint8_t *const priv_key,
+    const ecc_affine_const_point_t *const pub_key, scl_hash_mode_t hash_mode,
+    const uint8_t *const shared_info, size_t shared_info_len,
+    size_t key_byte_len, const uint8_t *const aad, size_t aad_byte_len,
+    size_t pld_byte_len, scl_process_t mode)
+{
+    int32_t result;
+    size_t shared_secret_len = curve_params->curve_bsize;
+    scl_sha_ctx_t sha_ctx;
+    scl_x963kdf_ctx_t kdf_ctx;
+
+    /* shared secret, as the big endian x coordinate given to the KDF */
+    uint8_t shared_secret[curve_params->curve_bsize]
+        __attribute__((aligned(8)));
+    /* AES key followed by the GCM IV */
+    uint8_t keying[SCL_KEY256 + SCL_ECIES_IV_BYTESIZE]
+        __attribute__((aligned(8)));
+
+    result = scl_ecdh(scl_ctx, curve_params, priv_key, pub_key, shared_secret,
+                      &shared_secret_len);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    result = scl_kdf_x963_init(scl_ctx, &kdf_ctx, &sha_ctx, hash_mode,
+                               shared_info, shared_info_len);
+    if (SCL_OK == result)
+    {
+        /* key and IV are derived in a single KDF call */
+        result = scl_kdf_x963_derive(scl_ctx, &kdf_ctx, shared_secret,
+                                     shared_secret_len, keying,
+                                     key_byte_len + SCL_ECIES_IV_BYTESIZE);
+    }
+
+    if (SCL_OK == result)
+    {
+        result = scl_aes_gcm_init(scl_ctx, &ctx->aes_ctx, keying, key_byte_len,
+                                  &keying[key_byte_len], SCL_ECIES_IV_BYTESIZE,
+                                  aad, aad_byte_len, pld_byte_len, mode);
+    }
+
+    ctx->mode = mode;
+
+    /* @FIXME: */
+    /* secrets should be erased and be sure compiler optimization do not
+     * remove this operation */
+    memset(shared_secret, 0, sizeof(shared_secret));
+    memset(keying, 0, sizeof(keying));
+    memset(&sha_ctx, 0, sizeof(sha_ctx));
+
+    return (result);
+}
+
+int32_t scl_ecies_encrypt_init(
+    const metal_scl_t *const scl_ctx, scl_ecies_ctx_t *const ctx,
+    const ecc_curve_t *const curve_params,
+    const ecc_affine_const_point_t *const peer_pub_key,
+    ecc_affine_point_t *const ephemeral_pub_key, scl_hash_mode_t hash_mode,
+    const uint8_t *const shared_info, size_t shared_info_len,
+    size_t key_byte_len, const uint8_t *const aad, size_t aad_byte_len,
+    size_t pld_byte_len)
+{
+    int32_t result;
+
+    result =
+        scl_ecies_check_params(scl_ctx, ctx, curve_params, key_byte_len);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    {
+        uint8_t ephemeral_priv_key[curve_params->curve_bsize]
+            __attribute__((aligned(8)));
+
+        result = scl_ecc_keypair_generation(scl_ctx, curve_params,
+                                            ephemeral_priv_key,
+                                            ephemeral_pub_key);
+        if (SCL_OK == result)
+        {
+            result = scl_ecies_setup(scl_ctx, ctx, curve_params,
+                                     ephemeral_priv_key, peer_pub_key,
+                                     hash_mode, shared_info, shared_info_len,
+                                     key_byte_len, aad, aad_byte_len,
+                                     pld_byte_len, SCL_ENCRYPT);
+        }
+
+        /* @FIXME: */
+        /* ephemeral_priv_key should be secure erased */
+        memset(ephemeral_priv_key, 0, sizeof(ephemeral_priv_key));
+    }
+
+    return (result);
+}
+
+int32_t scl_ecies_decrypt_init(
+    const metal_scl_t *const scl_ctx, scl_ecies_ctx_t *const ctx,
+    const ecc_curve_t *const curve_params, const uint8_t *const priv_key,
+    const ecc_affine_const_point_t *const ephemeral_pub_key,
+    scl_hash_mode_t hash_mode, const uint8_t *const shared_info,
+    size_t shared_info_len, size_t key_byte_len, const uint8_t *const aad,
+    size_t aad_byte_len, size_t pld_byte_len)
+{
+    int32_t result;
+
+    result =
+        scl_ecies_check_params(scl_ctx, ctx, curve_params, key_byte_len);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    return (scl_ecies_setup(scl_ctx, ctx, curve_params, priv_key,
+                            ephemeral_pub_key, hash_mode, shared_info,
+                            shared_info_len, key_byte_len, aad, aad_byte_len,
+                            pld_byte_len, SCL_DECRYPT));
+}
+
+int32_t scl_ecies_core(const metal_scl_t *const scl_ctx,
+                       scl_ecies_ctx_t *const ctx, uint8_t *const dst,
+                       size_t *const dst_byte_len, const uint8_t *const src,
+                       size_t src_byte_len)
+{
+    if ((NULL == scl_ctx) || (NULL == ctx))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    return (scl_aes_gcm_core(scl_ctx, &ctx->aes_ctx, dst, dst_byte_len, src,
+                             src_byte_len));
+}
+
+int32_t scl_ecies_encrypt_finish(const metal_scl_t *const scl_ctx,
+                                 scl_ecies_ctx_t *const ctx, uint8_t *const tag,
+                                 size_t tag_byte_len, uint8_t *const dst,
+                                 const uint8_t *const src, size_t src_byte_len)
+{
+    if ((NULL == scl_ctx) || (NULL == ctx) || (NULL == tag))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (SCL_ENCRYPT != ctx->mode)
+    {
+        return (SCL_INVALID_MODE);
+    }
+
+    if ((0 == tag_byte_len) || (SCL_ECIES_TAG_MAX_BYTESIZE < tag_byte_len))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    return (scl_aes_gcm_finish(scl_ctx, &ctx->aes_ctx, tag, tag_byte_len, dst,
+                               src, src_byte_len));
+}
+
+int32_t scl_ecies_decrypt_finish(const metal_scl_t *const scl_ctx,
+                                 scl_ecies_ctx_t *const ctx,
+                                 const uint8_t *const tag, size_t tag_byte_len,
+                                 uint8_t *const dst, const uint8_t *const src,
+                                 size_t src_byte_len)
+{
+    int32_t result;
+    size_t i;
+    uint8_t diff = 0;
+    uint8_t computed_tag[SCL_ECIES_TAG_MAX_BYTESIZE]
+        __attribute__((aligned(8))) = {0};
+
+    if ((NULL == scl_ctx) || (NULL == ctx) || (NULL == tag))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (SCL_DECRYPT != ctx->mode)
+    {
+        return (SCL_INVALID_MODE);
+    }
+
+    if ((0 == tag_byte_len) || (SCL_ECIES_TAG_MAX_BYTESIZE < tag_byte_len))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    result = scl_aes_gcm_finish(scl_ctx, &ctx->aes_ctx, computed_tag,
+                                tag_byte_len, dst, src, src_byte_len);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    /* constant time comparison */
+    for (i = 0; i < tag_byte_len; i++)
+    {
+        diff |= (uint8_t)(computed_tag[i] ^ tag[i]);
+    }
+
+    if (0 != diff)
+    {
+        return (SCL_ERR_TAG);
+    }
+
+    return (SCL_OK);
+}
+
+int32_t scl_ecies_encrypt(
+    const metal_scl_t *const scl_ctx, const ecc_curve_t *const curve_params,
+    const ecc_affine_const_point_t *const peer_pub_key,
+    ecc_affine_point_t *const ephemeral_pub_key, scl_hash_mode_t hash_mode,
+    const uint8_t *const shared_info, size_t shared_info_len,
+    size_t key_byte_len, const uint8_t *const aad, size_t aad_byte_len,
+    uint8_t *const dst, const uint8_t *const src, size_t src_byte_len,
+    uint8_t *const tag, size_t tag_byte_len)
+{
+    int32_t result;
+    scl_ecies_ctx_t ctx;
+
+    result = scl_ecies_encrypt_init(scl_ctx, &ctx, curve_params, peer_pub_key,
+                                    ephemeral_pub_key, hash_mode, shared_info,
+                                    shared_info_len, key_byte_len, aad,
+                                    aad_byte_len, src_byte_len);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    return (scl_ecies_encrypt_finish(scl_ctx, &ctx, tag, tag_byte_len, dst,
+                                     src, src_byte_len));
+}
+
+int32_t scl_ecies_decrypt(
+    const metal_scl_t *const scl_ctx, const ecc_curve_t *const curve_params,
+    const uint8_t *const priv_key,
+    const ecc_affine_const_point_t *const ephemeral_pub_key,
+    scl_hash_mode_t hash_mode, const uint8_t *const shared_info,
+    size_t shared_info_len, size_t key_byte_len, const uint8_t *const aad,
+    size_t aad_byte_len, uint8_t *const dst, const uint8_t *const src,
+    size_t src_byte_len, const uint8_t *const tag, size_t tag_byte_len)
+{
+    int32_t result;
+    scl_ecies_ctx_t ctx;
+
+    result = scl_ecies_decrypt_init(scl_ctx, &ctx, curve_params, priv_key,
+                                    ephemeral_pub_key, hash_mode, shared_info,
+                                    shared_info_len, key_byte_len, aad,
+                                    aad_byte_len, src_byte_len);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    result = scl_ecies_decrypt_finish(scl_ctx, &ctx, tag, tag_byte_len, dst,
+                                      src, src_byte_len);
+    if ((SCL_ERR_TAG == result) && (NULL != dst))
+    {
+        /* do not release an unauthenticated plaintext */
+        memset(dst, 0, src_byte_len);
+    }
+
+    return (result);
+}
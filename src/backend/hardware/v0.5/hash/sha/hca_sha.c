@@ -32,6 +32,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <scl/scl_retdefs.h>
 
@@ -52,9 +53,12 @@
 #include <backend/hardware/v0.5/hash/sha/hca_sha384.h>
 #include <backend/hardware/v0.5/hash/sha/hca_sha512.h>
 
+#include <backend/software/hash/sha/soft_sha.h>
+
 int32_t hca_sha_init(const metal_scl_t *const scl, sha_ctx_t *const ctx,
                      hash_mode_t hash_mode, endianness_t data_endianness)
 {
+    int32_t result;
 
     if ((NULL == ctx) || (NULL == scl))
     {
@@ -67,7 +71,26 @@ int32_t hca_sha_init(const metal_scl_t *const scl, sha_ctx_t *const ctx,
         return SCL_ERROR;
     }
 
+    if ((SCL_HASH_SHA512_224 == hash_mode) ||
+        (SCL_HASH_SHA512_256 == hash_mode))
+    {
+        /*
+         * HCA 0.5.x SHA engine only starts from the standard SHA IVs, the
+         * SHA512/t IVs can't be loaded so these modes run in software
+         */
+        result = soft_sha_init(scl, ctx, hash_mode, data_endianness);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+
+        ctx->soft_resume = true;
+
+        return (SCL_OK);
+    }
+
     ctx->mode = hash_mode;
+    ctx->soft_resume = false;
 
     switch (ctx->mode)
     {
@@ -120,6 +143,11 @@ int32_t hca_sha_core(const metal_scl_t *const scl, sha_ctx_t *const ctx,
         return (SCL_INVALID_INPUT);
     }
 
+    if (true == ctx->soft_resume)
+    {
+        return (soft_sha_core(scl, ctx, data, data_byte_len));
+    }
+
     switch (ctx->mode)
     {
     case SCL_HASH_SHA224:
@@ -149,6 +177,11 @@ int32_t hca_sha_finish(const metal_scl_t *const scl, sha_ctx_t *const ctx,
         return (SCL_INVALID_INPUT);
     }
 
+    if (true == ctx->soft_resume)
+    {
+        return (soft_sha_finish(scl, ctx, hash, hash_len));
+    }
+
     switch (ctx->mode)
     {
     case SCL_HASH_SHA224:
@@ -165,4 +198,121 @@ int32_t hca_sha_finish(const metal_scl_t *const scl, sha_ctx_t *const ctx,
 
     return (SCL_ERROR);
 }
+
+/**
+ * @brief export the standard IV of a sha mode, computed in software
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] hash_mode         hash mode
+ * @param[out] state            exported state (digest and mode)
+ * @return 0                    SUCCESS
+ * @return != 0                 otherwise @ref scl_errors_t
+ */
+static int32_t hca_sha_export_iv(const metal_scl_t *const scl,
+                                 hash_mode_t hash_mode,
+                                 sha_state_t *const state)
+{
+    int32_t result;
+    sha_ctx_t iv_ctx;
+
+    result = soft_sha_init(scl, &iv_ctx, hash_mode, SCL_BIG_ENDIAN_MODE);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    return (soft_sha_export_state(scl, &iv_ctx, state));
+}
+
+int32_t hca_sha_export_state(const metal_scl_t *const scl,
+                             const sha_ctx_t *const ctx,
+                             sha_state_t *const state)
+{
+    int32_t result;
+
+    if ((NULL == ctx) || (NULL == scl))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (NULL == state)
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    if (true == ctx->soft_resume)
+    {
+        return (soft_sha_export_state(scl, ctx, state));
+    }
+
+    switch (ctx->mode)
+    {
+    case SCL_HASH_SHA224:
+    case SCL_HASH_SHA256:
+        if (ctx->ctx.sha256.bitlen < (SHA256_BYTE_BLOCKSIZE << 3))
+        {
+            // no block went through the HCA, the HASH registers are stale
+            result = hca_sha_export_iv(scl, ctx->mode, state);
+        }
+        else
+        {
+            // the full sha256 state is read, even in sha224 mode
+            result = hca_sha256_read(scl, state->digest);
+        }
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+        state->bitlen = ctx->ctx.sha256.bitlen;
+        memcpy(state->block_buffer, ctx->ctx.sha256.block_buffer,
+               SHA256_BYTE_BLOCKSIZE);
+        break;
+    case SCL_HASH_SHA384:
+    case SCL_HASH_SHA512:
+        if (ctx->ctx.sha512.bitlen < (SHA512_BYTE_BLOCKSIZE << 3))
+        {
+            // no block went through the HCA, the HASH registers are stale
+            result = hca_sha_export_iv(scl, ctx->mode, state);
+        }
+        else
+        {
+            result = hca_sha512_read(scl, state->digest);
+        }
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+        state->bitlen = ctx->ctx.sha512.bitlen;
+        memcpy(state->block_buffer, ctx->ctx.sha512.block_buffer,
+               SHA512_BYTE_BLOCKSIZE);
+        break;
+    default:
+        return (SCL_ERROR);
+    }
+
+    state->mode = ctx->mode;
+
+    return (SCL_OK);
+}
+
+int32_t hca_sha_import_state(const metal_scl_t *const scl,
+                             sha_ctx_t *const ctx,
+                             const sha_state_t *const state)
+{
+    int32_t result;
+
+    /*
+     * HCA 0.5.x has no way to load an intermediate hash in the HASH
+     * registers, so the computation goes on in software
+     */
+    result = soft_sha_import_state(scl, ctx, state);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    ctx->soft_resume = true;
+
+    return (SCL_OK);
+}
 #endif  /* METAL_SIFIVE_HCA_VERSION >= HCA_VERSION(0, 5, 0) */
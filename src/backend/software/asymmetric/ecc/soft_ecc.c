@@ -42,6 +42,7 @@
 
 #include <backend/api/asymmetric/ecc/ecc.h>
 #include <backend/software/asymmetric/ecc/soft_ecc.h>
+#include <backend/software/asymmetric/ecc/soft_ecc_p521.h>
 #include <backend/software/bignumbers/soft_bignumbers.h>
 
 /* SECP256R1 */
@@ -89,6 +90,11 @@ CRYPTO_CONST_DATA static const uint64_t
         0xfffffffe00000001, 0xfffffffe00000002,
 };
 
+CRYPTO_CONST_DATA static const uint64_t
+    ecc_n_mont_r2_p256r1[ECC_SECP256R1_64B_WORDS_SIZE] = {
+        0x83244c95be79eea2, 0x4699799c49bd6fa6, 0x2845b2392b6bec59,
+        0x66e12d94f3d95620};
+
 CRYPTO_CONST_DATA static const ecc_bignum_affine_const_point_t ecc_g_p256r1 = {
     ecc_xg_p256r1, ecc_yg_p256r1};
 
@@ -102,6 +108,8 @@ CRYPTO_CONST_DATA const ecc_curve_t ecc_secp256r1 = {
     .square_p = ecc_square_p_p256r1,
     .precomputed_1_x = ecc_precomputed_1_x_p256r1,
     .precomputed_1_y = ecc_precomputed_1_y_p256r1,
+    .n_mont_r2 = ecc_n_mont_r2_p256r1,
+    .n_mont_n0 = 0xee00bc4f,
     .curve_wsize = ECC_SECP256R1_32B_WORDS_SIZE,
     .curve_bsize = ECC_SECP256R1_BYTESIZE,
     .curve_bitsize = ECC_SECP256R1_BITSIZE,
@@ -153,6 +161,11 @@ CRYPTO_CONST_DATA static const uint64_t
         0x00000001FFFFFFFE, 0xFFFFFFFE00000000, 0xFFFFFFFFFFFFFFFD,
         0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF};
 
+CRYPTO_CONST_DATA static const uint64_t
+    ecc_n_mont_r2_p384r1[ECC_SECP384R1_64B_WORDS_SIZE] = {
+        0x2d319b2419b409a9, 0xff3d81e5df1aa419, 0xbc3e483afcb82947,
+        0xd40d49174aab1cc5, 0x3fb05b7a28266895, 0x0c84ee012b39bf21};
+
 CRYPTO_CONST_DATA static const ecc_bignum_affine_const_point_t ecc_g_p384r1 = {
     ecc_xg_p384r1, ecc_yg_p384r1};
 
@@ -166,6 +179,8 @@ CRYPTO_CONST_DATA const ecc_curve_t ecc_secp384r1 = {
     .square_p = ecc_square_p_p384r1,
     .precomputed_1_x = ecc_precomputed_1_x_p384r1,
     .precomputed_1_y = ecc_precomputed_1_y_p384r1,
+    .n_mont_r2 = ecc_n_mont_r2_p384r1,
+    .n_mont_n0 = 0xe88fdc45,
     .curve_wsize = ECC_SECP384R1_32B_WORDS_SIZE,
     .curve_bsize = ECC_SECP384R1_BYTESIZE,
     .curve_bitsize = ECC_SECP384R1_BITSIZE,
@@ -228,6 +243,12 @@ CRYPTO_CONST_DATA static const uint64_t
         0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
         0xFFFFFFFFFFFFFFFF, 0x000000000003FFFF, 0x0000000000000000};
 
+CRYPTO_CONST_DATA static const uint64_t
+    ecc_n_mont_r2_p521r1[ECC_SECP521R1_64B_WORDS_SIZE] = {
+        0x1163115a61c64ca7, 0x18354a564374a642, 0x5d4dd6d30791d9dc,
+        0x4fb35b72d3402705, 0xcff3d142b7756e3a, 0x5bcc6d61a8e567bc,
+        0x2d8e03d1492d0d45, 0x5b5a3afe8c44383d, 0x000000000000019a};
+
 CRYPTO_CONST_DATA static const ecc_bignum_affine_const_point_t ecc_g_p521r1 = {
     ecc_xg_p521r1, ecc_yg_p521r1};
 
@@ -241,15 +262,151 @@ CRYPTO_CONST_DATA const ecc_curve_t ecc_secp521r1 = {
     .square_p = ecc_square_p_p521r1,
     .precomputed_1_x = ecc_precomputed_1_x_p521r1,
     .precomputed_1_y = ecc_precomputed_1_y_p521r1,
+    .n_mont_r2 = ecc_n_mont_r2_p521r1,
+    .n_mont_n0 = 0x79a995c7,
     .curve_wsize = ECC_SECP521R1_32B_WORDS_SIZE,
     .curve_bsize = ECC_SECP521R1_BYTESIZE,
     .curve_bitsize = ECC_SECP521R1_BITSIZE,
     .curve = ECC_SECP521R1};
 
+/**
+ * @brief check if the coordinates of an affine point are stored as one
+ * packed x||y block
+ *
+ * @param[in] point                 affine point
+ * @param[in] curve_nb_32b_words    number of 32 bits words per coordinate
+ * @return true if the point is packed, false otherwise
+ */
+static bool
+soft_ecc_affine_is_packed(const ecc_bignum_affine_point_t *const point,
+                          size_t curve_nb_32b_words)
+{
+    return ((const uint32_t *)point->x +
+                SOFT_ECC_PACKED_COORD_WSIZE(curve_nb_32b_words) ==
+            (const uint32_t *)point->y);
+}
+
+/**
+ * @brief check if the coordinates of a jacobian point are stored as one
+ * packed x||y||z block
+ *
+ * @param[in] point                 jacobian point
+ * @param[in] curve_nb_32b_words    number of 32 bits words per coordinate
+ * @return true if the point is packed, false otherwise
+ */
+static bool
+soft_ecc_jacobian_is_packed(const ecc_bignum_jacobian_point_t *const point,
+                            size_t curve_nb_32b_words)
+{
+    return (((const uint32_t *)point->x +
+                 SOFT_ECC_PACKED_COORD_WSIZE(curve_nb_32b_words) ==
+             (const uint32_t *)point->y) &&
+            ((const uint32_t *)point->y +
+                 SOFT_ECC_PACKED_COORD_WSIZE(curve_nb_32b_words) ==
+             (const uint32_t *)point->z));
+}
+
+/**
+ * @brief modular addition without full reduction, using mod_add when the
+ * backend does not provide mod_add_lazy
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] ctx               bignumber context (contain modulus info)
+ * @param[in] in_a              Input array a
+ * @param[in] in_b              Input array b
+ * @param[out] out              Output array (addition result)
+ * @param[in] nb_32b_words      number of 32 bits words to use in calcul
+ * @return >= 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+static int32_t soft_ecc_mod_add_lazy(const metal_scl_t *const scl,
+                                     const bignum_ctx_t *const ctx,
+                                     const uint64_t *const in_a,
+                                     const uint64_t *const in_b,
+                                     uint64_t *const out, size_t nb_32b_words)
+{
+    if (NULL != scl->bignum_func.mod_add_lazy)
+    {
+        return (scl->bignum_func.mod_add_lazy(scl, ctx, in_a, in_b, out,
+                                              nb_32b_words));
+    }
+
+    return (scl->bignum_func.mod_add(scl, ctx, in_a, in_b, out, nb_32b_words));
+}
+
+/**
+ * @brief modular subtraction without full reduction, using mod_sub when the
+ * backend does not provide mod_sub_lazy
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] ctx               bignumber context (contain modulus info)
+ * @param[in] in_a              Input array a
+ * @param[in] in_b              Input array b
+ * @param[out] out              Output array (subtraction result)
+ * @param[in] nb_32b_words      number of 32 bits words to use in calcul
+ * @return >= 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+static int32_t soft_ecc_mod_sub_lazy(const metal_scl_t *const scl,
+                                     const bignum_ctx_t *const ctx,
+                                     const uint64_t *const in_a,
+                                     const uint64_t *const in_b,
+                                     uint64_t *const out, size_t nb_32b_words)
+{
+    if (NULL != scl->bignum_func.mod_sub_lazy)
+    {
+        return (scl->bignum_func.mod_sub_lazy(scl, ctx, in_a, in_b, out,
+                                              nb_32b_words));
+    }
+
+    return (scl->bignum_func.mod_sub(scl, ctx, in_a, in_b, out, nb_32b_words));
+}
+
+/**
+ * @brief check that a number is below 2^max_bitsize
+ * @note only the in_nb_32b_words words of in are read, whatever their parity
+ *
+ * @param[in] in                    number to check
+ * @param[in] in_nb_32b_words       number of 32 bits words of in
+ * @param[in] max_bitsize           bound, in bits
+ * @return true if in < 2^max_bitsize, false otherwise
+ */
+static bool soft_ecc_mod_input_fits(const uint64_t *const in,
+                                    size_t in_nb_32b_words, size_t max_bitsize)
+{
+    size_t i;
+    uint32_t word;
+
+    for (i = max_bitsize / 32; i < in_nb_32b_words; i++)
+    {
+        word = ((const uint32_t *)in)[i];
+        if (max_bitsize / 32 == i)
+        {
+            word >>= max_bitsize % 32;
+        }
+
+        if (0 != word)
+        {
+            return (false);
+        }
+    }
+
+    return (true);
+}
+
 void soft_ecc_affine_copy(const ecc_bignum_affine_point_t *const src,
                           ecc_bignum_affine_point_t *const dst,
                           size_t curve_nb_32b_words)
 {
+    if ((false != soft_ecc_affine_is_packed(src, curve_nb_32b_words)) &&
+        (false != soft_ecc_affine_is_packed(dst, curve_nb_32b_words)))
+    {
+        memcpy(dst->x, src->x,
+               SOFT_ECC_AFFINE_PACKED_WSIZE(curve_nb_32b_words) *
+                   sizeof(uint32_t));
+        return;
+    }
+
     memcpy(dst->x, src->x, curve_nb_32b_words * sizeof(uint32_t));
     memcpy(dst->y, src->y, curve_nb_32b_words * sizeof(uint32_t));
 }
@@ -257,6 +414,14 @@ void soft_ecc_affine_copy(const ecc_bignum_affine_point_t *const src,
 void soft_ecc_affine_zeroize(ecc_bignum_affine_point_t *const point,
                              size_t curve_nb_32b_words)
 {
+    if (false != soft_ecc_affine_is_packed(point, curve_nb_32b_words))
+    {
+        memset(point->x, 0,
+               SOFT_ECC_AFFINE_PACKED_WSIZE(curve_nb_32b_words) *
+                   sizeof(uint32_t));
+        return;
+    }
+
     memset(point->x, 0, curve_nb_32b_words * sizeof(uint32_t));
     memset(point->y, 0, curve_nb_32b_words * sizeof(uint32_t));
 }
@@ -265,6 +430,15 @@ void soft_ecc_jacobian_copy(const ecc_bignum_jacobian_point_t *const src,
                             ecc_bignum_jacobian_point_t *const dst,
                             size_t curve_nb_32b_words)
 {
+    if ((false != soft_ecc_jacobian_is_packed(src, curve_nb_32b_words)) &&
+        (false != soft_ecc_jacobian_is_packed(dst, curve_nb_32b_words)))
+    {
+        memcpy(dst->x, src->x,
+               SOFT_ECC_JACOBIAN_PACKED_WSIZE(curve_nb_32b_words) *
+                   sizeof(uint32_t));
+        return;
+    }
+
     memcpy(dst->x, src->x, curve_nb_32b_words * sizeof(uint32_t));
     memcpy(dst->y, src->y, curve_nb_32b_words * sizeof(uint32_t));
     memcpy(dst->z, src->z, curve_nb_32b_words * sizeof(uint32_t));
@@ -273,11 +447,123 @@ void soft_ecc_jacobian_copy(const ecc_bignum_jacobian_point_t *const src,
 void soft_ecc_jacobian_zeroize(ecc_bignum_jacobian_point_t *const point,
                                size_t curve_nb_32b_words)
 {
+    if (false != soft_ecc_jacobian_is_packed(point, curve_nb_32b_words))
+    {
+        memset(point->x, 0,
+               SOFT_ECC_JACOBIAN_PACKED_WSIZE(curve_nb_32b_words) *
+                   sizeof(uint32_t));
+        return;
+    }
+
     memset(point->x, 0, curve_nb_32b_words * sizeof(uint32_t));
     memset(point->y, 0, curve_nb_32b_words * sizeof(uint32_t));
     memset(point->z, 0, curve_nb_32b_words * sizeof(uint32_t));
 }
 
+void soft_ecc_affine_map_packed(uint32_t *const packed,
+                                ecc_bignum_affine_point_t *const point,
+                                size_t curve_nb_32b_words)
+{
+    size_t i;
+    size_t coord_wsize = SOFT_ECC_PACKED_COORD_WSIZE(curve_nb_32b_words);
+
+    /* padding words are read as the top half of the last 64 bits word */
+    for (i = curve_nb_32b_words; i < coord_wsize; i++)
+    {
+        packed[i] = 0;
+        packed[coord_wsize + i] = 0;
+    }
+
+    point->x = (uint64_t *)&packed[0];
+    point->y = (uint64_t *)&packed[coord_wsize];
+}
+
+void soft_ecc_jacobian_map_packed(uint32_t *const packed,
+                                  ecc_bignum_jacobian_point_t *const point,
+                                  size_t curve_nb_32b_words)
+{
+    size_t i;
+    size_t coord_wsize = SOFT_ECC_PACKED_COORD_WSIZE(curve_nb_32b_words);
+
+    /* padding words are read as the top half of the last 64 bits word */
+    for (i = curve_nb_32b_words; i < coord_wsize; i++)
+    {
+        packed[i] = 0;
+        packed[coord_wsize + i] = 0;
+        packed[2 * coord_wsize + i] = 0;
+    }
+
+    point->x = (uint64_t *)&packed[0];
+    point->y = (uint64_t *)&packed[coord_wsize];
+    point->z = (uint64_t *)&packed[2 * coord_wsize];
+}
+
+void soft_ecc_affine_pack(const ecc_bignum_affine_const_point_t *const src,
+                          uint32_t *const packed, size_t curve_nb_32b_words)
+{
+    size_t coord_wsize = SOFT_ECC_PACKED_COORD_WSIZE(curve_nb_32b_words);
+
+    memcpy(&packed[0], src->x, curve_nb_32b_words * sizeof(uint32_t));
+    memcpy(&packed[coord_wsize], src->y,
+           curve_nb_32b_words * sizeof(uint32_t));
+}
+
+void soft_ecc_affine_unpack(const uint32_t *const packed,
+                            ecc_bignum_affine_point_t *const dst,
+                            size_t curve_nb_32b_words)
+{
+    size_t coord_wsize = SOFT_ECC_PACKED_COORD_WSIZE(curve_nb_32b_words);
+
+    memcpy(dst->x, &packed[0], curve_nb_32b_words * sizeof(uint32_t));
+    memcpy(dst->y, &packed[coord_wsize],
+           curve_nb_32b_words * sizeof(uint32_t));
+}
+
+void soft_ecc_jacobian_pack(const ecc_bignum_jacobian_point_t *const src,
+                            uint32_t *const packed, size_t curve_nb_32b_words)
+{
+    size_t coord_wsize = SOFT_ECC_PACKED_COORD_WSIZE(curve_nb_32b_words);
+
+    memcpy(&packed[0], src->x, curve_nb_32b_words * sizeof(uint32_t));
+    memcpy(&packed[coord_wsize], src->y,
+           curve_nb_32b_words * sizeof(uint32_t));
+    memcpy(&packed[2 * coord_wsize], src->z,
+           curve_nb_32b_words * sizeof(uint32_t));
+}
+
+void soft_ecc_jacobian_unpack(const uint32_t *const packed,
+                              ecc_bignum_jacobian_point_t *const dst,
+                              size_t curve_nb_32b_words)
+{
+    size_t coord_wsize = SOFT_ECC_PACKED_COORD_WSIZE(curve_nb_32b_words);
+
+    memcpy(dst->x, &packed[0], curve_nb_32b_words * sizeof(uint32_t));
+    memcpy(dst->y, &packed[coord_wsize],
+           curve_nb_32b_words * sizeof(uint32_t));
+    memcpy(dst->z, &packed[2 * coord_wsize],
+           curve_nb_32b_words * sizeof(uint32_t));
+}
+
+void soft_ecc_packed_table_select(const uint32_t *const table,
+                                  size_t nb_entries, size_t entry_nb_32b_words,
+                                  size_t idx, uint32_t *const out)
+{
+    size_t e, i;
+    uint32_t mask;
+
+    memset(out, 0, entry_nb_32b_words * sizeof(uint32_t));
+
+    /* the whole table is read, one stride after the other */
+    for (e = 0; e < nb_entries; e++)
+    {
+        mask = (uint32_t)0 - (uint32_t)(e == idx);
+        for (i = 0; i < entry_nb_32b_words; i++)
+        {
+            out[i] |= table[e * entry_nb_32b_words + i] & mask;
+        }
+    }
+}
+
 int32_t soft_ecc_convert_affine_to_jacobian(
     const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
     const ecc_bignum_affine_const_point_t *const in,
@@ -338,6 +624,13 @@ int32_t soft_ecc_convert_jacobian_to_affine(
         return (SCL_ERROR_API_ENTRY_POINT);
     }
 
+#if SOFT_ECC_P521_FIELD
+    if (ECC_SECP521R1 == curve_params->curve)
+    {
+        return (soft_ecc_p521_jacobian_to_affine(in, out));
+    }
+#endif /* SOFT_ECC_P521_FIELD */
+
     {
         uint32_t tmp[nb_32b_words] __attribute__((aligned(8)));
         uint32_t tmp1[nb_32b_words] __attribute__((aligned(8)));
@@ -402,6 +695,195 @@ int32_t soft_ecc_convert_jacobian_to_affine(
     return (SCL_OK);
 }
 
+int32_t soft_ecc_batch_jacobian_to_affine(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_bignum_jacobian_point_t *const in,
+    ecc_bignum_affine_point_t *const out, size_t count, size_t nb_32b_words)
+{
+    int32_t result;
+    size_t i, first, group_len;
+    size_t prefix_wsize = SOFT_ECC_PACKED_COORD_WSIZE(nb_32b_words);
+    const ecc_bignum_jacobian_point_t *g_in;
+    ecc_bignum_affine_point_t *g_out;
+    bignum_ctx_t bignum_ctx;
+
+    if ((NULL == scl) || (NULL == in) || (NULL == out) ||
+        (NULL == curve_params))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    /* check length consistency */
+    if ((nb_32b_words != curve_params->curve_wsize) || (0 == count))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    if ((NULL == scl->bignum_func.set_modulus) ||
+        (NULL == scl->bignum_func.mod_square) ||
+        (NULL == scl->bignum_func.mod_inv) ||
+        (NULL == scl->bignum_func.mod_mult) ||
+        (NULL == scl->bignum_func.is_null))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    {
+        /* prefix[i] = z0 * z1 * ... * zi in a group, 64 bits aligned entries */
+        uint32_t prefix[SOFT_ECC_BATCH_AFFINE_GROUP_SIZE * prefix_wsize]
+            __attribute__((aligned(8)));
+        uint32_t inv[nb_32b_words] __attribute__((aligned(8)));
+        uint32_t z_inv[nb_32b_words] __attribute__((aligned(8)));
+        uint32_t z_inv2[nb_32b_words] __attribute__((aligned(8)));
+
+        memset(prefix, 0, sizeof(prefix));
+
+        result = scl->bignum_func.set_modulus(scl, &bignum_ctx, curve_params->p,
+                                              nb_32b_words);
+        if (SCL_OK > result)
+        {
+            goto cleanup;
+        }
+
+        /**
+         * a point at the infinite has no affine representation, all of them
+         * are checked before any output is written
+         */
+        for (i = 0; i < count; i++)
+        {
+            result = scl->bignum_func.is_null(scl, (uint32_t *)in[i].z,
+                                              nb_32b_words);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+            else if ((int32_t) false != result)
+            {
+                result = SCL_INVALID_INPUT;
+                goto cleanup;
+            }
+        }
+
+        /* one inversion per group of SOFT_ECC_BATCH_AFFINE_GROUP_SIZE points */
+        for (first = 0; first < count; first += group_len)
+        {
+            group_len = count - first;
+            if (SOFT_ECC_BATCH_AFFINE_GROUP_SIZE < group_len)
+            {
+                group_len = SOFT_ECC_BATCH_AFFINE_GROUP_SIZE;
+            }
+
+            g_in = &in[first];
+            g_out = &out[first];
+
+            /* prefix products, group_len - 1 modular multiplications */
+            memcpy(prefix, g_in[0].z, nb_32b_words * sizeof(uint32_t));
+            for (i = 1; i < group_len; i++)
+            {
+                result = scl->bignum_func.mod_mult(
+                    scl, &bignum_ctx,
+                    (uint64_t *)&prefix[(i - 1) * prefix_wsize], g_in[i].z,
+                    (uint64_t *)&prefix[i * prefix_wsize], nb_32b_words);
+                if (SCL_OK > result)
+                {
+                    goto cleanup;
+                }
+            }
+
+            /* the only modular inversion: (z0 * ... * zn-1)^-1 */
+            result = scl->bignum_func.mod_inv(
+                scl, &bignum_ctx,
+                (uint64_t *)&prefix[(group_len - 1) * prefix_wsize],
+                (uint64_t *)inv, nb_32b_words);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+
+            /**
+             * walk back from the last point:
+             * zi^-1 = (z0 * ... * zi)^-1 * (z0 * ... * zi-1)
+             * (z0 * ... * zi-1)^-1 = (z0 * ... * zi)^-1 * zi
+             * in[i] is entirely consumed before out[i] is written, so both
+             * may share the same coordinates
+             */
+            i = group_len;
+            while (i > 0)
+            {
+                i--;
+
+                if (0 != i)
+                {
+                    result = scl->bignum_func.mod_mult(
+                        scl, &bignum_ctx, (uint64_t *)inv,
+                        (uint64_t *)&prefix[(i - 1) * prefix_wsize],
+                        (uint64_t *)z_inv, nb_32b_words);
+                    if (SCL_OK > result)
+                    {
+                        goto cleanup;
+                    }
+
+                    result = scl->bignum_func.mod_mult(
+                        scl, &bignum_ctx, (uint64_t *)inv, g_in[i].z,
+                        (uint64_t *)inv, nb_32b_words);
+                    if (SCL_OK > result)
+                    {
+                        goto cleanup;
+                    }
+                }
+                else
+                {
+                    memcpy(z_inv, inv, sizeof(z_inv));
+                }
+
+                /* x:y:z corresponds to x/z^2:y/z^3 */
+                result = scl->bignum_func.mod_square(
+                    scl, &bignum_ctx, (uint64_t *)z_inv, (uint64_t *)z_inv2,
+                    nb_32b_words);
+                if (SCL_OK > result)
+                {
+                    goto cleanup;
+                }
+
+                result = scl->bignum_func.mod_mult(
+                    scl, &bignum_ctx, g_in[i].x, (uint64_t *)z_inv2,
+                    g_out[i].x, nb_32b_words);
+                if (SCL_OK > result)
+                {
+                    goto cleanup;
+                }
+
+                /* z^-3 */
+                result = scl->bignum_func.mod_mult(
+                    scl, &bignum_ctx, (uint64_t *)z_inv2, (uint64_t *)z_inv,
+                    (uint64_t *)z_inv2, nb_32b_words);
+                if (SCL_OK > result)
+                {
+                    goto cleanup;
+                }
+
+                result = scl->bignum_func.mod_mult(
+                    scl, &bignum_ctx, g_in[i].y, (uint64_t *)z_inv2,
+                    g_out[i].y, nb_32b_words);
+                if (SCL_OK > result)
+                {
+                    goto cleanup;
+                }
+            }
+        }
+
+        result = SCL_OK;
+
+    cleanup:
+        memset(prefix, 0, sizeof(prefix));
+        memset(inv, 0, sizeof(inv));
+        memset(z_inv, 0, sizeof(z_inv));
+        memset(z_inv2, 0, sizeof(z_inv2));
+    }
+
+    return (result);
+}
+
 int32_t
 soft_ecc_infinite_jacobian(const metal_scl_t *const scl,
                            const ecc_bignum_jacobian_point_t *const point,
@@ -634,6 +1116,14 @@ int32_t soft_ecc_add_jacobian_jacobian(
         return (SCL_OK);
     }
 
+#if SOFT_ECC_P521_FIELD
+    if (ECC_SECP521R1 == curve_params->curve)
+    {
+        soft_ecc_p521_add_jacobian_jacobian(in_a, in_b, out);
+        return (SCL_OK);
+    }
+#endif /* SOFT_ECC_P521_FIELD */
+
     {
         uint32_t a[nb_32b_words] __attribute__((aligned(8)));
         uint32_t b[nb_32b_words] __attribute__((aligned(8)));
@@ -703,9 +1193,9 @@ int32_t soft_ecc_add_jacobian_jacobian(
         }
 
         /* c = c - a = X2 * Z1^2 - a */
-        result = scl->bignum_func.mod_sub(scl, &bignum_ctx, (uint64_t *)c,
-                                          (uint64_t *)a, (uint64_t *)c,
-                                          nb_32b_words);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, (uint64_t *)c,
+                                       (uint64_t *)a, (uint64_t *)c,
+                                       nb_32b_words);
         if (SCL_OK > result)
         {
             return (result);
@@ -730,9 +1220,9 @@ int32_t soft_ecc_add_jacobian_jacobian(
         }
 
         /* d = d - b = Y2 * Z1^3 - b */
-        result = scl->bignum_func.mod_sub(scl, &bignum_ctx, (uint64_t *)d,
-                                          (uint64_t *)b, (uint64_t *)d,
-                                          nb_32b_words);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, (uint64_t *)d,
+                                       (uint64_t *)b, (uint64_t *)d,
+                                       nb_32b_words);
         if (SCL_OK > result)
         {
             return (result);
@@ -789,17 +1279,17 @@ int32_t soft_ecc_add_jacobian_jacobian(
         }
 
         /* X3 = X3 - t1 = D^2 - C^3 */
-        result = scl->bignum_func.mod_sub(scl, &bignum_ctx, out->x,
-                                          (uint64_t *)t1, out->x, nb_32b_words);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, out->x, (uint64_t *)t1,
+                                       out->x, nb_32b_words);
         if (SCL_OK > result)
         {
             return (result);
         }
 
         /* t3 = 2 * t2 = 2 * AC^2 */
-        result = scl->bignum_func.mod_add(scl, &bignum_ctx, (uint64_t *)t2,
-                                          (uint64_t *)t2, (uint64_t *)t3,
-                                          nb_32b_words);
+        result = soft_ecc_mod_add_lazy(scl, &bignum_ctx, (uint64_t *)t2,
+                                       (uint64_t *)t2, (uint64_t *)t3,
+                                       nb_32b_words);
         if (SCL_OK > result)
         {
             return (result);
@@ -814,8 +1304,8 @@ int32_t soft_ecc_add_jacobian_jacobian(
         }
 
         /* t3 = t2 - X3 = AC^2 - X3 */
-        result = scl->bignum_func.mod_sub(scl, &bignum_ctx, (uint64_t *)t2,
-                                          out->x, (uint64_t *)t3, nb_32b_words);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, (uint64_t *)t2, out->x,
+                                       (uint64_t *)t3, nb_32b_words);
         if (SCL_OK > result)
         {
             return (result);
@@ -903,6 +1393,14 @@ int32_t soft_ecc_double_jacobian(const metal_scl_t *const scl,
         return (SCL_OK);
     }
 
+#if SOFT_ECC_P521_FIELD
+    if (ECC_SECP521R1 == curve_params->curve)
+    {
+        soft_ecc_p521_double_jacobian(in, out);
+        return (SCL_OK);
+    }
+#endif /* SOFT_ECC_P521_FIELD */
+
     {
         uint32_t a[nb_32b_words] __attribute__((aligned(8)));
         uint32_t b[nb_32b_words] __attribute__((aligned(8)));
@@ -926,18 +1424,18 @@ int32_t soft_ecc_double_jacobian(const metal_scl_t *const scl,
         }
 
         /* t1 = 2 * A */
-        result = scl->bignum_func.mod_add(scl, &bignum_ctx, (uint64_t *)a,
-                                          (uint64_t *)a, (uint64_t *)t1,
-                                          nb_32b_words);
+        result = soft_ecc_mod_add_lazy(scl, &bignum_ctx, (uint64_t *)a,
+                                       (uint64_t *)a, (uint64_t *)t1,
+                                       nb_32b_words);
         if (SCL_OK > result)
         {
             return (result);
         }
 
         /* t1 = 2 * t1 = 4*A */
-        result = scl->bignum_func.mod_add(scl, &bignum_ctx, (uint64_t *)t1,
-                                          (uint64_t *)t1, (uint64_t *)t1,
-                                          nb_32b_words);
+        result = soft_ecc_mod_add_lazy(scl, &bignum_ctx, (uint64_t *)t1,
+                                       (uint64_t *)t1, (uint64_t *)t1,
+                                       nb_32b_words);
         if (SCL_OK > result)
         {
             return (result);
@@ -952,17 +1450,16 @@ int32_t soft_ecc_double_jacobian(const metal_scl_t *const scl,
         }
 
         /* d = 2 * X1 */
-        result = scl->bignum_func.mod_add(scl, &bignum_ctx, in->x, in->x,
-                                          (uint64_t *)d, nb_32b_words);
+        result = soft_ecc_mod_add_lazy(scl, &bignum_ctx, in->x, in->x,
+                                       (uint64_t *)d, nb_32b_words);
         if (SCL_OK > result)
         {
             return (result);
         }
 
         /* d = d + X1 = 3* X1*/
-        result =
-            scl->bignum_func.mod_add(scl, &bignum_ctx, in->x, (uint64_t *)d,
-                                     (uint64_t *)d, nb_32b_words);
+        result = soft_ecc_mod_add_lazy(scl, &bignum_ctx, in->x, (uint64_t *)d,
+                                       (uint64_t *)d, nb_32b_words);
         if (SCL_OK > result)
         {
             return (result);
@@ -1004,9 +1501,9 @@ int32_t soft_ecc_double_jacobian(const metal_scl_t *const scl,
         }
 
         /* d = d + t2 = 3* X1^2 + a(curve param) * Z1^4 */
-        result = scl->bignum_func.mod_add(scl, &bignum_ctx, (uint64_t *)t2,
-                                          (uint64_t *)d, (uint64_t *)d,
-                                          nb_32b_words);
+        result = soft_ecc_mod_add_lazy(scl, &bignum_ctx, (uint64_t *)t2,
+                                       (uint64_t *)d, (uint64_t *)d,
+                                       nb_32b_words);
         if (SCL_OK > result)
         {
             return (result);
@@ -1038,8 +1535,8 @@ int32_t soft_ecc_double_jacobian(const metal_scl_t *const scl,
         }
 
         /* X3 = 2 * B */
-        result = scl->bignum_func.mod_add(scl, &bignum_ctx, (uint64_t *)b,
-                                          (uint64_t *)b, out->x, nb_32b_words);
+        result = soft_ecc_mod_add_lazy(scl, &bignum_ctx, (uint64_t *)b,
+                                       (uint64_t *)b, out->x, nb_32b_words);
         if (SCL_OK > result)
         {
             return (result);
@@ -1054,9 +1551,9 @@ int32_t soft_ecc_double_jacobian(const metal_scl_t *const scl,
         }
 
         /* t1 = 2 * t1 = 8*A */
-        result = scl->bignum_func.mod_add(scl, &bignum_ctx, (uint64_t *)t1,
-                                          (uint64_t *)t1, (uint64_t *)t1,
-                                          nb_32b_words);
+        result = soft_ecc_mod_add_lazy(scl, &bignum_ctx, (uint64_t *)t1,
+                                       (uint64_t *)t1, (uint64_t *)t1,
+                                       nb_32b_words);
         if (SCL_OK > result)
         {
             return (result);
@@ -1072,8 +1569,8 @@ int32_t soft_ecc_double_jacobian(const metal_scl_t *const scl,
         }
 
         /* Y3 = B - X3 */
-        result = scl->bignum_func.mod_sub(scl, &bignum_ctx, (uint64_t *)b,
-                                          out->x, out->y, nb_32b_words);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, (uint64_t *)b, out->x,
+                                       out->y, nb_32b_words);
         if (SCL_OK > result)
         {
             return (result);
@@ -1137,6 +1634,14 @@ int32_t soft_ecc_xycz_add(const metal_scl_t *const scl,
         return (SCL_INVALID_INPUT);
     }
 
+#if SOFT_ECC_P521_FIELD
+    if (ECC_SECP521R1 == curve_params->curve)
+    {
+        soft_ecc_p521_xycz_add(in1, in2, out1, out2);
+        return (SCL_OK);
+    }
+#endif /* SOFT_ECC_P521_FIELD */
+
     {
         uint32_t t1[curve_params->curve_wsize] __attribute__((aligned(8)));
         uint32_t t2[curve_params->curve_wsize] __attribute__((aligned(8)));
@@ -1157,9 +1662,9 @@ int32_t soft_ecc_xycz_add(const metal_scl_t *const scl,
         }
 
         /* 1. t5 = t3 - t1 = X2 - X1 */
-        result = scl->bignum_func.mod_sub(
-            scl, &bignum_ctx, (const uint64_t *)t3, (const uint64_t *)t1,
-            (uint64_t *)t5, curve_params->curve_wsize);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, (const uint64_t *)t3,
+                                       (const uint64_t *)t1, (uint64_t *)t5,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
@@ -1193,9 +1698,9 @@ int32_t soft_ecc_xycz_add(const metal_scl_t *const scl,
         }
 
         /* 5. t4 =  t4 - t2 = Y2 - Y1 */
-        result = scl->bignum_func.mod_sub(
-            scl, &bignum_ctx, (const uint64_t *)t4, (const uint64_t *)t2,
-            (uint64_t *)t4, curve_params->curve_wsize);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, (const uint64_t *)t4,
+                                       (const uint64_t *)t2, (uint64_t *)t4,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
@@ -1211,9 +1716,9 @@ int32_t soft_ecc_xycz_add(const metal_scl_t *const scl,
         }
 
         /* 7. t5 = t5 - t1 = D - B */
-        result = scl->bignum_func.mod_sub(
-            scl, &bignum_ctx, (const uint64_t *)t5, (const uint64_t *)t1,
-            (uint64_t *)t5, curve_params->curve_wsize);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, (const uint64_t *)t5,
+                                       (const uint64_t *)t1, (uint64_t *)t5,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
@@ -1229,9 +1734,9 @@ int32_t soft_ecc_xycz_add(const metal_scl_t *const scl,
         }
 
         /* 9. t3 = t3 - t1 = C - B */
-        result = scl->bignum_func.mod_sub(
-            scl, &bignum_ctx, (const uint64_t *)t3, (const uint64_t *)t1,
-            (uint64_t *)t3, curve_params->curve_wsize);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, (const uint64_t *)t3,
+                                       (const uint64_t *)t1, (uint64_t *)t3,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
@@ -1247,9 +1752,9 @@ int32_t soft_ecc_xycz_add(const metal_scl_t *const scl,
         }
 
         /* 11. t3 = t1 - t5 = B - X3 */
-        result = scl->bignum_func.mod_sub(
-            scl, &bignum_ctx, (const uint64_t *)t1, (const uint64_t *)t5,
-            (uint64_t *)t3, curve_params->curve_wsize);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, (const uint64_t *)t1,
+                                       (const uint64_t *)t5, (uint64_t *)t3,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
@@ -1305,6 +1810,14 @@ int32_t soft_ecc_xycz_addc(const metal_scl_t *const scl,
         return (SCL_INVALID_INPUT);
     }
 
+#if SOFT_ECC_P521_FIELD
+    if (ECC_SECP521R1 == curve_params->curve)
+    {
+        soft_ecc_p521_xycz_addc(in1, in2, out1, out2);
+        return (SCL_OK);
+    }
+#endif /* SOFT_ECC_P521_FIELD */
+
     {
         uint32_t t1[curve_params->curve_wsize] __attribute__((aligned(8)));
         uint32_t t2[curve_params->curve_wsize] __attribute__((aligned(8)));
@@ -1327,9 +1840,9 @@ int32_t soft_ecc_xycz_addc(const metal_scl_t *const scl,
         }
 
         /* 1. t5 = t3 - t1 = X2 - X1 */
-        result = scl->bignum_func.mod_sub(
-            scl, &bignum_ctx, (const uint64_t *)t3, (const uint64_t *)t1,
-            (uint64_t *)t5, curve_params->curve_wsize);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, (const uint64_t *)t3,
+                                       (const uint64_t *)t1, (uint64_t *)t5,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
@@ -1363,27 +1876,27 @@ int32_t soft_ecc_xycz_addc(const metal_scl_t *const scl,
         }
 
         /* 5. t5 = t4 + t2 = Y1 + Y2 */
-        result = scl->bignum_func.mod_add(
-            scl, &bignum_ctx, (const uint64_t *)t4, (const uint64_t *)t2,
-            (uint64_t *)t5, curve_params->curve_wsize);
+        result = soft_ecc_mod_add_lazy(scl, &bignum_ctx, (const uint64_t *)t4,
+                                       (const uint64_t *)t2, (uint64_t *)t5,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
         }
 
         /* 6. t4 = t4 - t2 = Y1 - Y2 */
-        result = scl->bignum_func.mod_sub(
-            scl, &bignum_ctx, (const uint64_t *)t4, (const uint64_t *)t2,
-            (uint64_t *)t4, curve_params->curve_wsize);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, (const uint64_t *)t4,
+                                       (const uint64_t *)t2, (uint64_t *)t4,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
         }
 
         /* 7. t6 = t3 - t1 = C - B */
-        result = scl->bignum_func.mod_sub(
-            scl, &bignum_ctx, (const uint64_t *)t3, (const uint64_t *)t1,
-            (uint64_t *)t6, curve_params->curve_wsize);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, (const uint64_t *)t3,
+                                       (const uint64_t *)t1, (uint64_t *)t6,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
@@ -1399,9 +1912,9 @@ int32_t soft_ecc_xycz_addc(const metal_scl_t *const scl,
         }
 
         /* 9. t6 = t3 + t1 = B + C */
-        result = scl->bignum_func.mod_add(
-            scl, &bignum_ctx, (const uint64_t *)t3, (const uint64_t *)t1,
-            (uint64_t *)t6, curve_params->curve_wsize);
+        result = soft_ecc_mod_add_lazy(scl, &bignum_ctx, (const uint64_t *)t3,
+                                       (const uint64_t *)t1, (uint64_t *)t6,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
@@ -1426,9 +1939,9 @@ int32_t soft_ecc_xycz_addc(const metal_scl_t *const scl,
         }
 
         /* 12. t7 = t1 - t3 = B - X3 */
-        result = scl->bignum_func.mod_sub(
-            scl, &bignum_ctx, (const uint64_t *)t1, (const uint64_t *)t3,
-            (uint64_t *)t7, curve_params->curve_wsize);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, (const uint64_t *)t1,
+                                       (const uint64_t *)t3, (uint64_t *)t7,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
@@ -1471,9 +1984,9 @@ int32_t soft_ecc_xycz_addc(const metal_scl_t *const scl,
         }
 
         /* 17. t6 = t7 - t1 = X3' - B */
-        result = scl->bignum_func.mod_sub(
-            scl, &bignum_ctx, (const uint64_t *)t7, (const uint64_t *)t1,
-            (uint64_t *)t6, curve_params->curve_wsize);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, (const uint64_t *)t7,
+                                       (const uint64_t *)t1, (uint64_t *)t6,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
@@ -1527,6 +2040,14 @@ int32_t soft_ecc_xycz_idbl(const metal_scl_t *const scl,
         return (SCL_INVALID_INPUT);
     }
 
+#if SOFT_ECC_P521_FIELD
+    if (ECC_SECP521R1 == curve_params->curve)
+    {
+        soft_ecc_p521_xycz_idbl(in, out1, out2);
+        return (SCL_OK);
+    }
+#endif /* SOFT_ECC_P521_FIELD */
+
     {
         uint32_t t1[curve_params->curve_wsize] __attribute__((aligned(8)));
         uint32_t t2[curve_params->curve_wsize] __attribute__((aligned(8)));
@@ -1555,27 +2076,27 @@ int32_t soft_ecc_xycz_idbl(const metal_scl_t *const scl,
         }
 
         /* 2. t4 = 2 * t3 = 2 * x1^2 */
-        result = scl->bignum_func.mod_add(
-            scl, &bignum_ctx, (const uint64_t *)t3, (const uint64_t *)t3,
-            (uint64_t *)t4, curve_params->curve_wsize);
+        result = soft_ecc_mod_add_lazy(scl, &bignum_ctx, (const uint64_t *)t3,
+                                       (const uint64_t *)t3, (uint64_t *)t4,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
         }
 
         /* 3. t3 = t3 + t4 = 3 * x1^2 */
-        result = scl->bignum_func.mod_add(
-            scl, &bignum_ctx, (const uint64_t *)t3, (const uint64_t *)t4,
-            (uint64_t *)t3, curve_params->curve_wsize);
+        result = soft_ecc_mod_add_lazy(scl, &bignum_ctx, (const uint64_t *)t3,
+                                       (const uint64_t *)t4, (uint64_t *)t3,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
         }
 
         /* 4. t3 = t3 + a(curve_param) = 3 * x1^2 + a(curve_param) = B */
-        result = scl->bignum_func.mod_add(
-            scl, &bignum_ctx, (const uint64_t *)t3, curve_params->a,
-            (uint64_t *)t3, curve_params->curve_wsize);
+        result = soft_ecc_mod_add_lazy(scl, &bignum_ctx, (const uint64_t *)t3,
+                                       curve_params->a, (uint64_t *)t3,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
@@ -1591,18 +2112,18 @@ int32_t soft_ecc_xycz_idbl(const metal_scl_t *const scl,
         }
 
         /* 6. t4 = 2 * t4 = 2 * y1^2 */
-        result = scl->bignum_func.mod_add(
-            scl, &bignum_ctx, (const uint64_t *)t4, (const uint64_t *)t4,
-            (uint64_t *)t4, curve_params->curve_wsize);
+        result = soft_ecc_mod_add_lazy(scl, &bignum_ctx, (const uint64_t *)t4,
+                                       (const uint64_t *)t4, (uint64_t *)t4,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
         }
 
         /* 7. t5 = 2 * t4 = 4 * y1^2 */
-        result = scl->bignum_func.mod_add(
-            scl, &bignum_ctx, (const uint64_t *)t4, (const uint64_t *)t4,
-            (uint64_t *)t5, curve_params->curve_wsize);
+        result = soft_ecc_mod_add_lazy(scl, &bignum_ctx, (const uint64_t *)t4,
+                                       (const uint64_t *)t4, (uint64_t *)t5,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
@@ -1627,9 +2148,9 @@ int32_t soft_ecc_xycz_idbl(const metal_scl_t *const scl,
         }
 
         /* 10. t6 = t6 - t5 = B^2 - A */
-        result = scl->bignum_func.mod_sub(
-            scl, &bignum_ctx, (const uint64_t *)t6, (const uint64_t *)t5,
-            (uint64_t *)t6, curve_params->curve_wsize);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, (const uint64_t *)t6,
+                                       (const uint64_t *)t5, (uint64_t *)t6,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
@@ -1645,9 +2166,9 @@ int32_t soft_ecc_xycz_idbl(const metal_scl_t *const scl,
         }
 
         /* 12. t1 = t5 - t6 = A - X2 */
-        result = scl->bignum_func.mod_sub(
-            scl, &bignum_ctx, (const uint64_t *)t5, (const uint64_t *)t6,
-            (uint64_t *)t1, curve_params->curve_wsize);
+        result = soft_ecc_mod_sub_lazy(scl, &bignum_ctx, (const uint64_t *)t5,
+                                       (const uint64_t *)t6, (uint64_t *)t1,
+                                       curve_params->curve_wsize);
         if (SCL_OK > result)
         {
             return (result);
@@ -1697,36 +2218,240 @@ int32_t soft_ecc_xycz_idbl(const metal_scl_t *const scl,
     return (SCL_OK);
 }
 
-int32_t soft_ecc_mult_coz(const metal_scl_t *const scl,
-                          const ecc_curve_t *const curve_params,
-                          const ecc_bignum_affine_const_point_t *const point,
-                          const uint64_t *const k, size_t k_nb_32bits_words,
-                          ecc_bignum_affine_point_t *const q)
+/**
+ * @brief one iteration of the co-Z Montgomery ladder
+ * @details Fast and Regular Algorithms for Scalar Multiplication over Elliptic
+ * Curves (Rivain) algo 9, steps 4 and 5
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in,out] p             ladder registers (R0, R1)
+ * @param[in] b                 current bit of k
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+static int32_t soft_ecc_mult_coz_iteration(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    ecc_bignum_affine_point_t p[2], size_t b)
+{
+    int32_t result;
+
+    /* 4.(r1-b,rb)=xycz-addc(rb,r1-b) */
+    result = soft_ecc_xycz_addc(
+        scl, curve_params, (ecc_bignum_affine_const_point_t *)&p[b],
+        (ecc_bignum_affine_const_point_t *)&p[1 - b], &p[1 - b], &p[b]);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* 5.(rb,r1-b)=xycz-add(r1-b,rb) */
+    result = soft_ecc_xycz_add(
+        scl, curve_params, (ecc_bignum_affine_const_point_t *)&p[1 - b],
+        (ecc_bignum_affine_const_point_t *)&p[b], &p[b], &p[1 - b]);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    return (SCL_OK);
+}
+
+/**
+ * @brief last bit of the co-Z Montgomery ladder and final inversion
+ * @details Fast and Regular Algorithms for Scalar Multiplication over Elliptic
+ * Curves (Rivain) algo 9, steps 7 to 9
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] point             input point
+ * @param[in] k                 scalar to multiply
+ * @param[in,out] p             ladder registers (R0, R1)
+ * @param[out] lambda           final inverse of Z
+ * @param[out] b                last bit of k
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+static int32_t soft_ecc_mult_coz_final(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_bignum_affine_const_point_t *const point,
+    const uint64_t *const k, ecc_bignum_affine_point_t p[2],
+    uint64_t *const lambda, size_t *const b)
 {
     int32_t result;
-    size_t i, n, b;
     bignum_ctx_t bignum_ctx;
-    ecc_bignum_affine_point_t p[2];
 
-    if ((NULL == scl) || (NULL == curve_params) || (NULL == q) || (NULL == k) ||
-        (NULL == point))
+    /* 7. b=k0 */
+    *b = k[0] & 1;
+
+    /* 8. (r1-b,rb)=xycz-addc(rb,r1-b) */
+    result = soft_ecc_xycz_addc(
+        scl, curve_params, (ecc_bignum_affine_const_point_t *)&p[*b],
+        (ecc_bignum_affine_const_point_t *)&p[1 - *b], &p[1 - *b], &p[*b]);
+    if (SCL_OK > result)
     {
-        return (SCL_INVALID_INPUT);
+        return (result);
     }
 
-    uint32_t xr_0[curve_params->curve_wsize] __attribute__((aligned(8)));
-    uint32_t yr_0[curve_params->curve_wsize] __attribute__((aligned(8)));
-    uint32_t xr_1[curve_params->curve_wsize] __attribute__((aligned(8)));
-    uint32_t yr_1[curve_params->curve_wsize] __attribute__((aligned(8)));
-    uint32_t lambda[curve_params->curve_wsize] __attribute__((aligned(8)));
+    result = scl->bignum_func.set_modulus(scl, &bignum_ctx, curve_params->p,
+                                          curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* 9. lambda=finallnvz(r0,r1,p,b); */
+    result = scl->bignum_func.mod_sub(scl, &bignum_ctx, p[1].x, p[0].x, lambda,
+                                      curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_mult(scl, &bignum_ctx, lambda, p[*b].y,
+                                       lambda, curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_mult(scl, &bignum_ctx, lambda, point->x,
+                                       lambda, curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_inv(scl, &bignum_ctx, lambda, lambda,
+                                      curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_mult(scl, &bignum_ctx, lambda, point->y,
+                                       lambda, curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_mult(scl, &bignum_ctx, lambda, p[*b].x,
+                                       lambda, curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    return (SCL_OK);
+}
+
+/**
+ * @brief co-Z Montgomery ladder output
+ * @details Fast and Regular Algorithms for Scalar Multiplication over Elliptic
+ * Curves (Rivain) algo 9, steps 10 and 11
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in,out] p             ladder registers (R0, R1)
+ * @param[in] lambda            final inverse of Z
+ * @param[in] b                 last bit of k
+ * @param[out] q                output point
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+static int32_t soft_ecc_mult_coz_output(const metal_scl_t *const scl,
+                                        const ecc_curve_t *const curve_params,
+                                        ecc_bignum_affine_point_t p[2],
+                                        const uint64_t *const lambda, size_t b,
+                                        ecc_bignum_affine_point_t *const q)
+{
+    int32_t result;
+    bignum_ctx_t bignum_ctx;
+
     uint32_t lambda2[curve_params->curve_wsize] __attribute__((aligned(8)));
 
-    /* 1. xycz-idbl */
-    p[0].x = (uint64_t *)xr_0;
-    p[0].y = (uint64_t *)yr_0;
-    p[1].x = (uint64_t *)xr_1;
-    p[1].y = (uint64_t *)yr_1;
+    result = scl->bignum_func.set_modulus(scl, &bignum_ctx, curve_params->p,
+                                          curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* 10. (rb,r1-b)=xycz-add(r1-b,rb) */
+    result = soft_ecc_xycz_add(
+        scl, curve_params, (ecc_bignum_affine_const_point_t *)&p[1 - b],
+        (ecc_bignum_affine_const_point_t *)&p[b], &p[b], &p[1 - b]);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* 11. return.. */
+    /* x0.lambda */
+    result = scl->bignum_func.mod_square(scl, &bignum_ctx, lambda,
+                                         (uint64_t *)lambda2,
+                                         curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)lambda2,
+                                       p[0].x, q->x, curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* y0.lambda */
+    result = scl->bignum_func.mod_mult(scl, &bignum_ctx, lambda,
+                                       (uint64_t *)lambda2, (uint64_t *)lambda2,
+                                       curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)lambda2,
+                                       p[0].y, q->y, curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    return (SCL_OK);
+}
 
+/**
+ * @brief Montgomery ladder with (X,Y)-only co-Z addition, used by
+ * soft_ecc_mult_coz()
+ * @details Fast and Regular Algorithms for Scalar Multiplication over Elliptic
+ * Curves (Rivain) algo 9, steps 1 to 9. On return p[0] and p[1] hold the
+ * co-Z points before the last xycz-add and lambda holds the value to
+ * convert them back to affine coordinates.
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] point             input point
+ * @param[in] k                 scalar to multiply
+ * @param[in] k_nb_32bits_words scalar length
+ * @param[in,out] p             ladder registers (R0, R1)
+ * @param[out] lambda           final inverse of Z
+ * @param[out] b                last bit of k
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+static int32_t soft_ecc_mult_coz_ladder(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_bignum_affine_const_point_t *const point,
+    const uint64_t *const k, size_t k_nb_32bits_words,
+    ecc_bignum_affine_point_t p[2], uint64_t *const lambda, size_t *const b)
+{
+    int32_t result;
+    size_t i, n;
+
+    /* 1. xycz-idbl */
     result = soft_ecc_xycz_idbl(scl, curve_params, point, &p[1], &p[0]);
     if (SCL_OK > result)
     {
@@ -1744,138 +2469,1368 @@ int32_t soft_ecc_mult_coz(const metal_scl_t *const scl,
     for (i = n - 2; i >= 1; i--)
     {
         /* 3. b=k_i */
-        b = soft_ecc_bit_extract((const uint32_t *)k, i);
+        *b = soft_ecc_bit_extract((const uint32_t *)k, i);
 
-        /* 4.(r1-b,rb)=xycz-addc(rb,r1-b) */
-        result = soft_ecc_xycz_addc(
-            scl, curve_params, (ecc_bignum_affine_const_point_t *)&p[b],
-            (ecc_bignum_affine_const_point_t *)&p[1 - b], &p[1 - b], &p[b]);
+        /* 4. and 5. */
+        result = soft_ecc_mult_coz_iteration(scl, curve_params, p, *b);
         if (SCL_OK > result)
         {
             return (result);
         }
+    }
 
-        /* 5.(rb,r1-b)=xycz-add(r1-b,rb) */
-        result = soft_ecc_xycz_add(
-            scl, curve_params, (ecc_bignum_affine_const_point_t *)&p[1 - b],
-            (ecc_bignum_affine_const_point_t *)&p[b], &p[b], &p[1 - b]);
-        if (SCL_OK > result)
-        {
-            return (result);
-        }
+    /* 7. to 9. */
+    return (soft_ecc_mult_coz_final(scl, curve_params, point, k, p, lambda, b));
+}
+
+int32_t soft_ecc_mult_coz(const metal_scl_t *const scl,
+                          const ecc_curve_t *const curve_params,
+                          const ecc_bignum_affine_const_point_t *const point,
+                          const uint64_t *const k, size_t k_nb_32bits_words,
+                          ecc_bignum_affine_point_t *const q)
+{
+    int32_t result;
+    size_t b;
+    ecc_bignum_affine_point_t p[2];
+
+    if ((NULL == scl) || (NULL == curve_params) || (NULL == q) || (NULL == k) ||
+        (NULL == point))
+    {
+        return (SCL_INVALID_INPUT);
     }
 
-    /* 7. b=k0 */
-    b = k[0] & 1;
+    uint32_t xr_0[curve_params->curve_wsize] __attribute__((aligned(8)));
+    uint32_t yr_0[curve_params->curve_wsize] __attribute__((aligned(8)));
+    uint32_t xr_1[curve_params->curve_wsize] __attribute__((aligned(8)));
+    uint32_t yr_1[curve_params->curve_wsize] __attribute__((aligned(8)));
+    uint32_t lambda[curve_params->curve_wsize] __attribute__((aligned(8)));
 
-    /* 8. (r1-b,rb)=xycz-addc(rb,r1-b) */
-    result = soft_ecc_xycz_addc(
-        scl, curve_params, (ecc_bignum_affine_const_point_t *)&p[b],
-        (ecc_bignum_affine_const_point_t *)&p[1 - b], &p[1 - b], &p[b]);
+    p[0].x = (uint64_t *)xr_0;
+    p[0].y = (uint64_t *)yr_0;
+    p[1].x = (uint64_t *)xr_1;
+    p[1].y = (uint64_t *)yr_1;
+
+    /* 1. to 9. */
+    result = soft_ecc_mult_coz_ladder(scl, curve_params, point, k,
+                                      k_nb_32bits_words, p, (uint64_t *)lambda,
+                                      &b);
     if (SCL_OK > result)
     {
         return (result);
     }
 
-    result = scl->bignum_func.set_modulus(scl, &bignum_ctx, curve_params->p,
-                                          curve_params->curve_wsize);
+    /* 10. and 11. */
+    return (soft_ecc_mult_coz_output(scl, curve_params, p, (uint64_t *)lambda,
+                                     b, q));
+}
+
+/**
+ * @brief numerator and denominator of x(2.R) from X, ta and tb (see above)
+ * @details x(2.R) = ((x^2 - a)^2 - 8b.x) / 4(x^3 + a.x + b), so
+ * x(2.R) = dbl / (Z^2.v) with dbl = (X^2 - ta)^2 - 4tb.X and
+ * v = 4X(X^2 + ta) + 2tb. 3M + 2S
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] bignum_ctx        bignumber context, modulus p
+ * @param[in] reg               ladder registers
+ * @param[in] x                 X-coordinate of the point to double
+ * @param[out] dbl              numerator
+ * @param[out] v                denominator
+ * @param[out] t                temporary
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+static int32_t soft_ecc_xz_double(const metal_scl_t *const scl,
+                                  const ecc_curve_t *const curve_params,
+                                  bignum_ctx_t *const bignum_ctx,
+                                  uint64_t *const reg[SOFT_ECC_XZ_NB_REGS],
+                                  const uint64_t *const x, uint64_t *const dbl,
+                                  uint64_t *const v, uint64_t *const t)
+{
+    int32_t result;
+    size_t wsize = curve_params->curve_wsize;
+
+    /* dbl = X^2 */
+    result = scl->bignum_func.mod_square(scl, bignum_ctx, x, dbl, wsize);
     if (SCL_OK > result)
     {
         return (result);
     }
 
-    /* 9. lambda=finallnvz(r0,r1,p,b); */
-    result =
-        scl->bignum_func.mod_sub(scl, &bignum_ctx, p[1].x, p[0].x,
-                                 (uint64_t *)lambda, curve_params->curve_wsize);
+    /* v = 4X(X^2 + ta) + 2tb */
+    result = scl->bignum_func.mod_add(scl, bignum_ctx, dbl,
+                                      reg[SOFT_ECC_XZ_TA], v, wsize);
     if (SCL_OK > result)
     {
         return (result);
     }
 
-    result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)lambda,
-                                       p[b].y, (uint64_t *)lambda,
-                                       curve_params->curve_wsize);
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, x, v, v, wsize);
     if (SCL_OK > result)
     {
         return (result);
     }
 
-    result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)lambda,
-                                       point->x, (uint64_t *)lambda,
-                                       curve_params->curve_wsize);
+    result = scl->bignum_func.mod_add(scl, bignum_ctx, v, v, v, wsize);
     if (SCL_OK > result)
     {
         return (result);
     }
 
-    result =
-        scl->bignum_func.mod_inv(scl, &bignum_ctx, (uint64_t *)lambda,
-                                 (uint64_t *)lambda, curve_params->curve_wsize);
+    result = scl->bignum_func.mod_add(scl, bignum_ctx, v, reg[SOFT_ECC_XZ_TB],
+                                      v, wsize);
     if (SCL_OK > result)
     {
         return (result);
     }
 
-    result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)lambda,
-                                       point->y, (uint64_t *)lambda,
-                                       curve_params->curve_wsize);
+    result = scl->bignum_func.mod_add(scl, bignum_ctx, v, v, v, wsize);
     if (SCL_OK > result)
     {
         return (result);
     }
 
-    result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)lambda,
-                                       p[b].x, (uint64_t *)lambda,
-                                       curve_params->curve_wsize);
+    /* dbl = (X^2 - ta)^2 - 4tb.X */
+    result = scl->bignum_func.mod_sub(scl, bignum_ctx, dbl,
+                                      reg[SOFT_ECC_XZ_TA], dbl, wsize);
     if (SCL_OK > result)
     {
         return (result);
     }
 
-    /* 10. (rb,r1-b)=xycz-add(r1-b,rb) */
-    result = soft_ecc_xycz_add(
-        scl, curve_params, (ecc_bignum_affine_const_point_t *)&p[1 - b],
-        (ecc_bignum_affine_const_point_t *)&p[b], &p[b], &p[1 - b]);
+    result = scl->bignum_func.mod_square(scl, bignum_ctx, dbl, dbl, wsize);
     if (SCL_OK > result)
     {
         return (result);
     }
 
-    /* 11. return.. */
-    /* x0.lambda */
-    result = scl->bignum_func.mod_square(scl, &bignum_ctx, (uint64_t *)lambda,
-                                         (uint64_t *)lambda2,
-                                         curve_params->curve_wsize);
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, reg[SOFT_ECC_XZ_TB], x,
+                                       t, wsize);
     if (SCL_OK > result)
     {
         return (result);
     }
 
-    result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)lambda2,
-                                       p[0].x, q->x, curve_params->curve_wsize);
+    result = scl->bignum_func.mod_add(scl, bignum_ctx, t, t, t, wsize);
     if (SCL_OK > result)
     {
         return (result);
     }
 
-    /* y0.lambda */
-    result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)lambda,
-                                       (uint64_t *)lambda2, (uint64_t *)lambda2,
-                                       curve_params->curve_wsize);
+    result = scl->bignum_func.mod_add(scl, bignum_ctx, t, t, t, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    return (scl->bignum_func.mod_sub(scl, bignum_ctx, dbl, t, dbl, wsize));
+}
+
+/**
+ * @brief bring ta, tb, xd and w to the new common Z'^2 = Z^2.s
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] bignum_ctx        bignumber context, modulus p
+ * @param[in,out] reg           ladder registers
+ * @param[in] s                 Z'^2 / Z^2
+ * @param[out] t                temporary
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+static int32_t soft_ecc_xz_update(const metal_scl_t *const scl,
+                                  const ecc_curve_t *const curve_params,
+                                  bignum_ctx_t *const bignum_ctx,
+                                  uint64_t *const reg[SOFT_ECC_XZ_NB_REGS],
+                                  const uint64_t *const s, uint64_t *const t)
+{
+    int32_t result;
+    size_t wsize = curve_params->curve_wsize;
+
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, reg[SOFT_ECC_XZ_W], s,
+                                       reg[SOFT_ECC_XZ_W], wsize);
     if (SCL_OK > result)
     {
         return (result);
     }
 
-    result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)lambda2,
-                                       p[0].y, q->y, curve_params->curve_wsize);
-    if (SCL_OK > result)
-    {
-        return (result);
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, reg[SOFT_ECC_XZ_XD], s,
+                                       reg[SOFT_ECC_XZ_XD], wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_square(scl, bignum_ctx, s, t, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, reg[SOFT_ECC_XZ_TA], t,
+                                       reg[SOFT_ECC_XZ_TA], wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, t, s, t, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    return (scl->bignum_func.mod_mult(scl, bignum_ctx, reg[SOFT_ECC_XZ_TB], t,
+                                      reg[SOFT_ECC_XZ_TB], wsize));
+}
+
+/**
+ * @brief one iteration of the x-only co-Z Montgomery ladder,
+ * (R0, R1) = (2.R0, R0 + R1)
+ * @details Goundar-Joye-Miyaji style XZ formulas, with d = R1 - R0:
+ * x(R0 + R1) = 2((x0 + x1)(x0.x1 + a) + 2b) / (x0 - x1)^2 - x(d), so
+ * x(R0 + R1) = sum / (Z^2.u) with u = (X0 - X1)^2 and
+ * sum = 2((X0 + X1)(X0.X1 + ta) + tb) - xd.u. x(2.R0) = dbl / (Z^2.v), see
+ * soft_ecc_xz_double(), and the new common Z'^2 is Z^2.u.v. 13M + 4S
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] bignum_ctx        bignumber context, modulus p
+ * @param[in,out] reg           ladder registers
+ * @param[out] tmp              5 temporaries
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+static int32_t soft_ecc_xz_iteration(const metal_scl_t *const scl,
+                                     const ecc_curve_t *const curve_params,
+                                     bignum_ctx_t *const bignum_ctx,
+                                     uint64_t *const reg[SOFT_ECC_XZ_NB_REGS],
+                                     uint64_t *const tmp[5])
+{
+    int32_t result;
+    size_t wsize = curve_params->curve_wsize;
+    uint64_t *const u = tmp[0];
+    uint64_t *const v = tmp[1];
+    uint64_t *const sum = tmp[2];
+    uint64_t *const dbl = tmp[3];
+    uint64_t *const t = tmp[4];
+
+#if SOFT_ECC_P521_FIELD
+    if (ECC_SECP521R1 == curve_params->curve)
+    {
+        soft_ecc_p521_xz_iteration(reg);
+        return (SCL_OK);
+    }
+#endif /* SOFT_ECC_P521_FIELD */
+
+    /* u = (X0 - X1)^2 */
+    result = scl->bignum_func.mod_sub(scl, bignum_ctx, reg[SOFT_ECC_XZ_X0],
+                                      reg[SOFT_ECC_XZ_X1], u, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_square(scl, bignum_ctx, u, u, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* sum = 2((X0 + X1)(X0.X1 + ta) + tb) - xd.u */
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, reg[SOFT_ECC_XZ_X0],
+                                       reg[SOFT_ECC_XZ_X1], sum, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_add(scl, bignum_ctx, sum,
+                                      reg[SOFT_ECC_XZ_TA], sum, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_add(scl, bignum_ctx, reg[SOFT_ECC_XZ_X0],
+                                      reg[SOFT_ECC_XZ_X1], t, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, sum, t, sum, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_add(scl, bignum_ctx, sum,
+                                      reg[SOFT_ECC_XZ_TB], sum, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_add(scl, bignum_ctx, sum, sum, sum, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, reg[SOFT_ECC_XZ_XD], u,
+                                       t, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_sub(scl, bignum_ctx, sum, t, sum, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* x(2.R0) = dbl / (Z^2.v) */
+    result = soft_ecc_xz_double(scl, curve_params, bignum_ctx, reg,
+                                reg[SOFT_ECC_XZ_X0], dbl, v, t);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* X0 = dbl.u, X1 = sum.v at Z'^2 = Z^2.u.v */
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, dbl, u,
+                                       reg[SOFT_ECC_XZ_X0], wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, sum, v,
+                                       reg[SOFT_ECC_XZ_X1], wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, u, v, u, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    return (soft_ecc_xz_update(scl, curve_params, bignum_ctx, reg, u, t));
+}
+
+/**
+ * @brief x-only co-Z ladder registers for R0 = P and R1 = 2.P
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] bignum_ctx        bignumber context, modulus p
+ * @param[in] point             input point P
+ * @param[out] reg              ladder registers
+ * @param[out] tmp              5 temporaries
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+static int32_t
+soft_ecc_xz_start(const metal_scl_t *const scl,
+                  const ecc_curve_t *const curve_params,
+                  bignum_ctx_t *const bignum_ctx,
+                  const ecc_bignum_affine_const_point_t *const point,
+                  uint64_t *const reg[SOFT_ECC_XZ_NB_REGS],
+                  uint64_t *const tmp[5])
+{
+    int32_t result;
+    size_t wsize = curve_params->curve_wsize;
+
+#if SOFT_ECC_P521_FIELD
+    if (ECC_SECP521R1 == curve_params->curve)
+    {
+        soft_ecc_p521_xz_start(point->x, curve_params->a, curve_params->b,
+                               reg);
+        return (SCL_OK);
+    }
+#endif /* SOFT_ECC_P521_FIELD */
+
+    /* R0 = P at Z = 1: X0 = xd = x(P), w = 1, ta = a, tb = 2b */
+    memcpy(reg[SOFT_ECC_XZ_X0], point->x, wsize * sizeof(uint32_t));
+    memcpy(reg[SOFT_ECC_XZ_XD], point->x, wsize * sizeof(uint32_t));
+    memcpy(reg[SOFT_ECC_XZ_TA], curve_params->a, wsize * sizeof(uint32_t));
+    memset(reg[SOFT_ECC_XZ_W], 0, wsize * sizeof(uint32_t));
+    ((uint32_t *)reg[SOFT_ECC_XZ_W])[0] = 1;
+
+    result = scl->bignum_func.mod_add(scl, bignum_ctx, curve_params->b,
+                                      curve_params->b, reg[SOFT_ECC_XZ_TB],
+                                      wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* R1 = 2.P, then R0 is brought to the common Z^2 = v */
+    result = soft_ecc_xz_double(scl, curve_params, bignum_ctx, reg,
+                                reg[SOFT_ECC_XZ_X0], reg[SOFT_ECC_XZ_X1],
+                                tmp[0], tmp[1]);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, reg[SOFT_ECC_XZ_X0],
+                                       tmp[0], reg[SOFT_ECC_XZ_X0], wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    return (soft_ecc_xz_update(scl, curve_params, bignum_ctx, reg, tmp[0],
+                               tmp[1]));
+}
+
+/* swap X0 and X1 when mask is all ones, without branch */
+static void soft_ecc_xz_cswap(uint64_t *const reg[SOFT_ECC_XZ_NB_REGS],
+                              uint32_t mask, size_t nb_32b_words)
+{
+    size_t e;
+    uint32_t d;
+    uint32_t *x0 = (uint32_t *)reg[SOFT_ECC_XZ_X0];
+    uint32_t *x1 = (uint32_t *)reg[SOFT_ECC_XZ_X1];
+
+    for (e = 0; e < nb_32b_words; e++)
+    {
+        d = (x0[e] ^ x1[e]) & mask;
+        x0[e] ^= d;
+        x1[e] ^= d;
+    }
+}
+
+int32_t soft_ecc_mult_coz_x(const metal_scl_t *const scl,
+                            const ecc_curve_t *const curve_params,
+                            const ecc_bignum_affine_const_point_t *const point,
+                            const uint64_t *const k, size_t k_nb_32bits_words,
+                            uint64_t *const q_x)
+{
+    int32_t result;
+    size_t wsize, stride, ext_k_size, msb, i, e;
+    uint32_t mask, b, prev_b;
+    bignum_ctx_t bignum_ctx;
+    uint64_t *reg[SOFT_ECC_XZ_NB_REGS];
+    uint64_t *tmp[5];
+
+    if ((NULL == scl) || (NULL == curve_params) || (NULL == point) ||
+        (NULL == k) || (NULL == q_x))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == point->x) || (NULL == curve_params->a) ||
+        (NULL == curve_params->b) || (NULL == curve_params->n))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->bignum_func.add) || (NULL == scl->bignum_func.compare) ||
+        (NULL == scl->bignum_func.is_null) ||
+        (NULL == scl->bignum_func.get_msb_set) ||
+        (NULL == scl->bignum_func.set_modulus) ||
+        (NULL == scl->bignum_func.mod_add) ||
+        (NULL == scl->bignum_func.mod_sub) ||
+        (NULL == scl->bignum_func.mod_mult) ||
+        (NULL == scl->bignum_func.mod_square) ||
+        (NULL == scl->bignum_func.mod_inv))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    if ((0 == k_nb_32bits_words) ||
+        (k_nb_32bits_words > curve_params->curve_wsize))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    wsize = curve_params->curve_wsize;
+    stride = SOFT_ECC_PACKED_COORD_WSIZE(wsize);
+    ext_k_size = wsize + 1;
+
+    {
+        /* ext_k, ext_k2 and ext_n are curve_wsize + 1 ! */
+        uint32_t ext_k[ext_k_size] __attribute__((aligned(8)));
+        uint32_t ext_k2[ext_k_size] __attribute__((aligned(8)));
+        uint32_t ext_n[ext_k_size] __attribute__((aligned(8)));
+        /* fixed stride, each register stays 64 bits aligned */
+        uint32_t reg_data[SOFT_ECC_XZ_NB_REGS * stride]
+            __attribute__((aligned(8)));
+        uint32_t tmp_data[5 * stride] __attribute__((aligned(8)));
+
+        /* the padding words are read as the top of the last 64 bits word */
+        memset(reg_data, 0, sizeof(reg_data));
+        memset(tmp_data, 0, sizeof(tmp_data));
+
+        for (e = 0; e < SOFT_ECC_XZ_NB_REGS; e++)
+        {
+            reg[e] = (uint64_t *)&reg_data[e * stride];
+        }
+
+        for (e = 0; e < 5; e++)
+        {
+            tmp[e] = (uint64_t *)&tmp_data[e * stride];
+        }
+
+        memset(ext_k, 0, sizeof(ext_k));
+        memcpy(ext_k, k, k_nb_32bits_words * sizeof(uint32_t));
+        memcpy(ext_n, curve_params->n, wsize * sizeof(uint32_t));
+        ext_n[wsize] = 0;
+
+        /* k must be in [1, n - 1] */
+        if ((0 <= scl->bignum_func.compare(scl, (uint64_t *)ext_k,
+                                           curve_params->n, wsize)) ||
+            (false != scl->bignum_func.is_null(scl, ext_k, wsize)))
+        {
+            result = SCL_INVALID_INPUT;
+            goto cleanup;
+        }
+
+        /**
+         * 1. the ladder length shall not depend on the k Msb position: as
+         * n.P = 0, (k + n).P = (k + 2n).P = k.P, and with L the bit length of
+         * n, either k + n or k + 2n has its bit L set (and is lower than
+         * 2^(L+1)), this one is used, selected without branch
+         */
+        result = scl->bignum_func.get_msb_set(scl, curve_params->n, wsize);
+        if (SCL_OK > result)
+        {
+            goto cleanup;
+        }
+        else if (0 == result)
+        {
+            result = SCL_ERROR;
+            goto cleanup;
+        }
+
+        msb = (size_t)result;
+
+        result = scl->bignum_func.add(scl, (uint64_t *)ext_k,
+                                      (uint64_t *)ext_n, (uint64_t *)ext_k,
+                                      ext_k_size);
+        if (SCL_OK > result)
+        {
+            goto cleanup;
+        }
+
+        result = scl->bignum_func.add(scl, (uint64_t *)ext_k,
+                                      (uint64_t *)ext_n, (uint64_t *)ext_k2,
+                                      ext_k_size);
+        if (SCL_OK > result)
+        {
+            goto cleanup;
+        }
+
+        mask = (uint32_t)0 - (uint32_t)soft_ecc_bit_extract(ext_k, msb);
+        for (i = 0; i < ext_k_size; i++)
+        {
+            ext_k[i] = (ext_k[i] & mask) | (ext_k2[i] & ~mask);
+        }
+
+        result = scl->bignum_func.set_modulus(scl, &bignum_ctx,
+                                              curve_params->p, wsize);
+        if (SCL_OK > result)
+        {
+            goto cleanup;
+        }
+
+        /* 2. R0 = P, R1 = 2.P */
+        result = soft_ecc_xz_start(scl, curve_params, &bignum_ctx, point, reg,
+                                   tmp);
+        if (SCL_OK > result)
+        {
+            goto cleanup;
+        }
+
+        /**
+         * 3. for i = L - 1 downto 0, (Rb, R1-b) = (2.Rb, R0 + R1): the
+         * registers are swapped when b changes, so that the iteration always
+         * doubles R0
+         */
+        prev_b = 0;
+        for (i = msb; i > 0; i--)
+        {
+            b = (uint32_t)soft_ecc_bit_extract(ext_k, i - 1);
+
+            soft_ecc_xz_cswap(reg, (uint32_t)0 - (b ^ prev_b), wsize);
+            prev_b = b;
+
+            result = soft_ecc_xz_iteration(scl, curve_params, &bignum_ctx, reg,
+                                           tmp);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+        }
+
+        soft_ecc_xz_cswap(reg, (uint32_t)0 - prev_b, wsize);
+
+        /**
+         * 4. R0 or R1 is the point at infinity in the last two iterations
+         * only for ext_k in [2n - 2, 2n + 1], i.e. k = 1, n - 2 or n - 1, and
+         * Z is then null: x(k.P) is x(P) when ext_k is odd, x(2.P) otherwise
+         */
+        result = scl->bignum_func.is_null(scl, (uint32_t *)reg[SOFT_ECC_XZ_W],
+                                          wsize);
+        if (SCL_OK > result)
+        {
+            goto cleanup;
+        }
+        else if ((int32_t) false != result)
+        {
+            result = soft_ecc_xz_start(scl, curve_params, &bignum_ctx, point,
+                                       reg, tmp);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+
+            soft_ecc_xz_cswap(reg, (uint32_t)0 - (1 ^ (ext_k[0] & 1)), wsize);
+        }
+
+        /* 5. x(R0) = X0 / Z^2 */
+#if SOFT_ECC_P521_FIELD
+        if (ECC_SECP521R1 == curve_params->curve)
+        {
+            soft_ecc_p521_xz_affine(reg, q_x);
+            result = SCL_OK;
+            goto cleanup;
+        }
+#endif /* SOFT_ECC_P521_FIELD */
+
+        result = scl->bignum_func.mod_inv(scl, &bignum_ctx, reg[SOFT_ECC_XZ_W],
+                                          tmp[0], wsize);
+        if (SCL_OK > result)
+        {
+            goto cleanup;
+        }
+
+        result = scl->bignum_func.mod_mult(scl, &bignum_ctx,
+                                           reg[SOFT_ECC_XZ_X0], tmp[0], q_x,
+                                           wsize);
+
+    cleanup:
+        memset(ext_k, 0, sizeof(ext_k));
+        memset(ext_k2, 0, sizeof(ext_k2));
+        memset(reg_data, 0, sizeof(reg_data));
+        memset(tmp_data, 0, sizeof(tmp_data));
+    }
+
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    return (SCL_OK);
+}
+
+int32_t
+soft_ecc_ladder_start(const metal_scl_t *const scl, ecc_ladder_ctx_t *const ctx,
+                      const ecc_curve_t *const curve_params,
+                      const ecc_bignum_affine_const_point_t *const point,
+                      const uint64_t *const k, size_t k_nb_32bits_words)
+{
+    int32_t result;
+    size_t n;
+    ecc_bignum_affine_point_t p[2];
+    ecc_bignum_affine_const_point_t point_ctx;
+
+    if ((NULL == scl) || (NULL == ctx) || (NULL == curve_params) ||
+        (NULL == point) || (NULL == k))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == point->x) || (NULL == point->y))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((ECDSA_MAX_32B_WORDSIZE < curve_params->curve_wsize) ||
+        (ECDSA_MIN_32B_WORDSIZE > curve_params->curve_wsize) ||
+        (curve_params->curve_wsize < k_nb_32bits_words))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    memset(ctx, 0, sizeof(*ctx));
+
+    ctx->curve_params = curve_params;
+    memcpy(ctx->k, k, k_nb_32bits_words * sizeof(uint32_t));
+    memcpy(ctx->point_x, point->x,
+           curve_params->curve_wsize * sizeof(uint32_t));
+    memcpy(ctx->point_y, point->y,
+           curve_params->curve_wsize * sizeof(uint32_t));
+
+    /* the ladder needs at least 2 bits */
+    n = k_nb_32bits_words * sizeof(uint32_t) * 8;
+
+    while ((n > 0) &&
+           (soft_ecc_bit_extract((const uint32_t *)ctx->k, n - 1) == 0))
+    {
+        n--;
+    }
+
+    if (2 > n)
+    {
+        memset(ctx, 0, sizeof(*ctx));
+        return (SCL_INVALID_INPUT);
+    }
+
+    point_ctx.x = ctx->point_x;
+    point_ctx.y = ctx->point_y;
+    p[0].x = ctx->r0_x;
+    p[0].y = ctx->r0_y;
+    p[1].x = ctx->r1_x;
+    p[1].y = ctx->r1_y;
+
+    /* 1. xycz-idbl */
+    result = soft_ecc_xycz_idbl(scl, curve_params, &point_ctx, &p[1], &p[0]);
+    if (SCL_OK > result)
+    {
+        memset(ctx, 0, sizeof(*ctx));
+        return (result);
+    }
+
+    /* 2. bits n-2 downto 1 are processed by soft_ecc_ladder_step() */
+    ctx->bit_idx = n - 2;
+
+    return (SCL_OK);
+}
+
+int32_t soft_ecc_ladder_step(const metal_scl_t *const scl,
+                             ecc_ladder_ctx_t *const ctx,
+                             size_t max_iterations)
+{
+    int32_t result;
+    size_t b;
+    ecc_bignum_affine_point_t p[2];
+
+    if ((NULL == scl) || (NULL == ctx) || (NULL == ctx->curve_params))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    p[0].x = ctx->r0_x;
+    p[0].y = ctx->r0_y;
+    p[1].x = ctx->r1_x;
+    p[1].y = ctx->r1_y;
+
+    while ((0 != ctx->bit_idx) && (0 != max_iterations))
+    {
+        /* 3. b=k_i */
+        b = soft_ecc_bit_extract((const uint32_t *)ctx->k, ctx->bit_idx);
+
+        /* 4. and 5. */
+        result = soft_ecc_mult_coz_iteration(scl, ctx->curve_params, p, b);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        ctx->bit_idx--;
+        max_iterations--;
+    }
+
+    return ((int32_t)ctx->bit_idx);
+}
+
+int32_t soft_ecc_ladder_finish(const metal_scl_t *const scl,
+                               ecc_ladder_ctx_t *const ctx,
+                               ecc_bignum_affine_point_t *const q)
+{
+    int32_t result;
+    size_t b;
+    ecc_bignum_affine_point_t p[2];
+    ecc_bignum_affine_const_point_t point_ctx;
+    uint64_t lambda[ECDSA_MAX_64B_WORDSIZE];
+
+    if ((NULL == scl) || (NULL == ctx) || (NULL == ctx->curve_params) ||
+        (NULL == q))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (0 != ctx->bit_idx)
+    {
+        return (SCL_BUSY);
+    }
+
+    point_ctx.x = ctx->point_x;
+    point_ctx.y = ctx->point_y;
+    p[0].x = ctx->r0_x;
+    p[0].y = ctx->r0_y;
+    p[1].x = ctx->r1_x;
+    p[1].y = ctx->r1_y;
+
+    /* 7. to 9. */
+    result = soft_ecc_mult_coz_final(scl, ctx->curve_params, &point_ctx,
+                                     ctx->k, p, lambda, &b);
+    if (SCL_OK == result)
+    {
+        /* 10. and 11. */
+        result = soft_ecc_mult_coz_output(scl, ctx->curve_params, p, lambda, b,
+                                          q);
+    }
+
+    /* the context holds the scalar */
+    memset(ctx, 0, sizeof(*ctx));
+
+    return (result);
+}
+
+/**
+ * @brief extract the (SOFT_ECC_WINDOW_WIDTH + 1)-bit odd window used by the
+ * regular signed recoding
+ * @details with k odd, digit i of the recoding is u - 2^w where u is made of
+ * bits [i.w + 1, i.w + w] of k shifted by one and with bit 0 forced to 1, so
+ * that every digit is odd, non zero and in [-(2^w - 1), 2^w - 1]
+ *
+ * @param[in] k         scalar
+ * @param[in] bit_idx   index of the first bit of the window (i.w)
+ * @return u, odd value in [1, 2^(w+1) - 1]
+ */
+static uint32_t soft_ecc_window_extract(const uint32_t *const k,
+                                        size_t bit_idx)
+{
+    size_t i;
+    uint32_t u = 1;
+
+    for (i = 1; i <= SOFT_ECC_WINDOW_WIDTH; i++)
+    {
+        u |= (uint32_t)soft_ecc_bit_extract(k, bit_idx + i) << i;
+    }
+
+    return (u);
+}
+
+/**
+ * @brief Double a jacobian point on a curve with a = -3
+ * @details dbl-2001-b formulas: 3.X1^2 + a.Z1^4 is computed as
+ * 3.(X1 - Z1^2).(X1 + Z1^2), that saves 2 modular multiplications compared
+ * to soft_ecc_double_jacobian(). The point must not be the infinite one.
+ * Output may alias input.
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      elliptic curve parameters
+ * @param[in] bignum_ctx        bignum context with modulus p
+ * @param[in] in                Input jacobian coordinates
+ * @param[out] out              Output jacobian coordinates
+ * @return = 0 in case of success
+ * @return < 0 otherwise @ref scl_errors_t
+ */
+static int32_t soft_ecc_double_jacobian_a3(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const bignum_ctx_t *const bignum_ctx,
+    const ecc_bignum_jacobian_point_t *const in,
+    ecc_bignum_jacobian_point_t *const out)
+{
+    int32_t result;
+    size_t wsize = curve_params->curve_wsize;
+
+#if SOFT_ECC_P521_FIELD
+    if (ECC_SECP521R1 == curve_params->curve)
+    {
+        soft_ecc_p521_double_jacobian(in, out);
+        return (SCL_OK);
+    }
+#endif /* SOFT_ECC_P521_FIELD */
+
+    uint32_t delta[wsize] __attribute__((aligned(8)));
+    uint32_t gamma[wsize] __attribute__((aligned(8)));
+    uint32_t beta[wsize] __attribute__((aligned(8)));
+    uint32_t alpha[wsize] __attribute__((aligned(8)));
+    uint32_t t1[wsize] __attribute__((aligned(8)));
+
+    /* delta = Z1^2 */
+    result = scl->bignum_func.mod_square(scl, bignum_ctx, in->z,
+                                         (uint64_t *)delta, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* gamma = Y1^2 */
+    result = scl->bignum_func.mod_square(scl, bignum_ctx, in->y,
+                                         (uint64_t *)gamma, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* beta = X1 * gamma */
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, in->x,
+                                       (uint64_t *)gamma, (uint64_t *)beta,
+                                       wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* t1 = X1 - delta, alpha = X1 + delta */
+    result = soft_ecc_mod_sub_lazy(scl, bignum_ctx, in->x, (uint64_t *)delta,
+                                   (uint64_t *)t1, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = soft_ecc_mod_add_lazy(scl, bignum_ctx, in->x, (uint64_t *)delta,
+                                   (uint64_t *)alpha, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* alpha = 3 * (X1 - delta) * (X1 + delta) */
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, (uint64_t *)t1,
+                                       (uint64_t *)alpha, (uint64_t *)alpha,
+                                       wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = soft_ecc_mod_add_lazy(scl, bignum_ctx, (uint64_t *)alpha,
+                                   (uint64_t *)alpha, (uint64_t *)t1, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = soft_ecc_mod_add_lazy(scl, bignum_ctx, (uint64_t *)alpha,
+                                   (uint64_t *)t1, (uint64_t *)alpha, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* Z3 = 2 * Y1 * Z1 (in is no more read for Z after this point) */
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, in->y, in->z,
+                                       (uint64_t *)t1, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_add(scl, bignum_ctx, (uint64_t *)t1,
+                                      (uint64_t *)t1, out->z, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* beta = 4 * beta */
+    result = soft_ecc_mod_add_lazy(scl, bignum_ctx, (uint64_t *)beta,
+                                   (uint64_t *)beta, (uint64_t *)beta, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = soft_ecc_mod_add_lazy(scl, bignum_ctx, (uint64_t *)beta,
+                                   (uint64_t *)beta, (uint64_t *)beta, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* X3 = alpha^2 - 2 * (4 * beta) */
+    result = scl->bignum_func.mod_square(scl, bignum_ctx, (uint64_t *)alpha,
+                                         (uint64_t *)t1, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = soft_ecc_mod_sub_lazy(scl, bignum_ctx, (uint64_t *)t1,
+                                   (uint64_t *)beta, (uint64_t *)t1, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_sub(scl, bignum_ctx, (uint64_t *)t1,
+                                      (uint64_t *)beta, out->x, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* Y3 = alpha * (4 * beta - X3) - 8 * gamma^2 */
+    result = soft_ecc_mod_sub_lazy(scl, bignum_ctx, (uint64_t *)beta, out->x,
+                                   (uint64_t *)beta, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_mult(scl, bignum_ctx, (uint64_t *)alpha,
+                                       (uint64_t *)beta, (uint64_t *)beta,
+                                       wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_square(scl, bignum_ctx, (uint64_t *)gamma,
+                                         (uint64_t *)gamma, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = soft_ecc_mod_add_lazy(scl, bignum_ctx, (uint64_t *)gamma,
+                                   (uint64_t *)gamma, (uint64_t *)gamma, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = soft_ecc_mod_add_lazy(scl, bignum_ctx, (uint64_t *)gamma,
+                                   (uint64_t *)gamma, (uint64_t *)gamma, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = soft_ecc_mod_add_lazy(scl, bignum_ctx, (uint64_t *)gamma,
+                                   (uint64_t *)gamma, (uint64_t *)gamma, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.mod_sub(scl, bignum_ctx, (uint64_t *)beta,
+                                      (uint64_t *)gamma, out->y, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    return (SCL_OK);
+}
+
+int32_t soft_ecc_mult_window_jacobian(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_bignum_affine_const_point_t *const point, const uint64_t *const k,
+    size_t k_nb_32bits_words, ecc_bignum_jacobian_point_t *const q)
+{
+    int32_t result;
+    size_t i, j, e, nb_digits, ext_k_size, wsize, stride;
+    uint32_t u, neg, mask;
+    bool a_is_minus_3;
+    bignum_ctx_t bignum_ctx;
+    ecc_bignum_jacobian_point_t acc, sel, p2;
+    ecc_bignum_jacobian_point_t table[SOFT_ECC_WINDOW_TABLE_SIZE];
+
+    if ((NULL == scl) || (NULL == curve_params) || (NULL == q) || (NULL == k) ||
+        (NULL == point))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == q->x) || (NULL == q->y) || (NULL == q->z))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((0 == k_nb_32bits_words) ||
+        (k_nb_32bits_words > curve_params->curve_wsize))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    wsize = curve_params->curve_wsize;
+    ext_k_size = wsize + 1;
+    stride = SOFT_ECC_JACOBIAN_PACKED_WSIZE(wsize);
+
+    {
+        /* ext_k and ext_n are curve_wsize + 1 ! */
+        uint32_t ext_k[ext_k_size] __attribute__((aligned(8)));
+        uint32_t ext_n[ext_k_size] __attribute__((aligned(8)));
+        uint32_t neg_y[wsize] __attribute__((aligned(8)));
+        /* flat table of packed points, fixed stride */
+        uint32_t table_data[SOFT_ECC_WINDOW_TABLE_SIZE * stride]
+            __attribute__((aligned(8)));
+        uint32_t acc_data[stride] __attribute__((aligned(8)));
+        uint32_t sel_data[stride] __attribute__((aligned(8)));
+        uint32_t p2_data[stride] __attribute__((aligned(8)));
+
+        for (e = 0; e < SOFT_ECC_WINDOW_TABLE_SIZE; e++)
+        {
+            soft_ecc_jacobian_map_packed(&table_data[e * stride], &table[e],
+                                         wsize);
+        }
+        soft_ecc_jacobian_map_packed(acc_data, &acc, wsize);
+        soft_ecc_jacobian_map_packed(sel_data, &sel, wsize);
+        soft_ecc_jacobian_map_packed(p2_data, &p2, wsize);
+
+        /**
+         * 1. the recoding requires an odd scalar: as n.P = 0 and n is odd,
+         * use k + n when k is even, selected without branch
+         */
+        memset(ext_k, 0, sizeof(ext_k));
+        memcpy(ext_k, k, k_nb_32bits_words * sizeof(uint32_t));
+        memcpy(ext_n, curve_params->n, wsize * sizeof(uint32_t));
+        ext_n[wsize] = 0;
+
+        /* k must be in [1, n - 1], this also bounds the number of digits */
+        if ((0 <= scl->bignum_func.compare(scl, (uint64_t *)ext_k,
+                                           curve_params->n, wsize)) ||
+            (false != scl->bignum_func.is_null(scl, ext_k, wsize)))
+        {
+            result = SCL_INVALID_INPUT;
+            goto cleanup;
+        }
+
+        result = scl->bignum_func.add(scl, (uint64_t *)ext_k,
+                                      (uint64_t *)ext_n, (uint64_t *)ext_n,
+                                      ext_k_size);
+        if (SCL_OK > result)
+        {
+            goto cleanup;
+        }
+
+        mask = (uint32_t)0 - (ext_k[0] & 1);
+        for (i = 0; i < ext_k_size; i++)
+        {
+            ext_k[i] = (ext_k[i] & mask) | (ext_n[i] & ~mask);
+        }
+
+        /* all supported curves have a = -3, allowing a faster doubling */
+        result = scl->bignum_func.set_modulus(scl, &bignum_ctx,
+                                              curve_params->p, wsize);
+        if (SCL_OK > result)
+        {
+            goto cleanup;
+        }
+
+        memset(neg_y, 0, sizeof(neg_y));
+        neg_y[0] = 3;
+        result = scl->bignum_func.add(scl, curve_params->a, (uint64_t *)neg_y,
+                                      (uint64_t *)neg_y, wsize);
+        if (SCL_OK > result)
+        {
+            goto cleanup;
+        }
+
+        a_is_minus_3 = (0 == scl->bignum_func.compare(scl, (uint64_t *)neg_y,
+                                                      curve_params->p, wsize));
+
+        /* 2. table[j] = (2j + 1).P */
+        result = soft_ecc_convert_affine_to_jacobian(scl, curve_params, point,
+                                                     &table[0], wsize);
+        if (SCL_OK > result)
+        {
+            goto cleanup;
+        }
+
+        result = soft_ecc_double_jacobian(scl, curve_params, &table[0], &p2,
+                                          wsize);
+        if (SCL_OK > result)
+        {
+            goto cleanup;
+        }
+
+        for (e = 1; e < SOFT_ECC_WINDOW_TABLE_SIZE; e++)
+        {
+            result = soft_ecc_add_jacobian_jacobian(
+                scl, curve_params, &table[e - 1], &p2, &table[e], wsize);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+        }
+
+        /**
+         * 3. number of digits, the scalar is lower than 2^(msb(n) + 1)
+         * (k < n so k + n < 2.n)
+         */
+        result = scl->bignum_func.get_msb_set(scl, curve_params->n, wsize);
+        if (SCL_OK > result)
+        {
+            goto cleanup;
+        }
+        else if (0 == result)
+        {
+            result = SCL_ERROR;
+            goto cleanup;
+        }
+
+        nb_digits = ((size_t)result + SOFT_ECC_WINDOW_WIDTH) /
+                    SOFT_ECC_WINDOW_WIDTH;
+
+        /**
+         * 4. acc = table[top digit], the top digit is not recoded, it is
+         * (k >> (nb_digits - 1).w) | 1, so always positive
+         */
+        u = soft_ecc_window_extract(ext_k,
+                                    (nb_digits - 1) * SOFT_ECC_WINDOW_WIDTH);
+        j = (size_t)(u >> 1);
+
+        soft_ecc_packed_table_select(table_data, SOFT_ECC_WINDOW_TABLE_SIZE,
+                                     stride, j, acc_data);
+
+        /* 5. for each digit from the top, acc = 2^w.acc + digit.P */
+        for (i = nb_digits - 1; i > 0; i--)
+        {
+            for (e = 0; e < SOFT_ECC_WINDOW_WIDTH; e++)
+            {
+                if (false != a_is_minus_3)
+                {
+                    result = soft_ecc_double_jacobian_a3(
+                        scl, curve_params, &bignum_ctx, &acc, &acc);
+                }
+                else
+                {
+                    result = soft_ecc_double_jacobian(scl, curve_params, &acc,
+                                                      &acc, wsize);
+                }
+                if (SCL_OK > result)
+                {
+                    goto cleanup;
+                }
+            }
+
+            /* digit = u - 2^w, |digit| = 2j + 1 */
+            u = soft_ecc_window_extract(ext_k,
+                                        (i - 1) * SOFT_ECC_WINDOW_WIDTH);
+            neg = 1 - (u >> SOFT_ECC_WINDOW_WIDTH);
+            mask = (uint32_t)0 - neg;
+            u = (((1U << SOFT_ECC_WINDOW_WIDTH) - u) & mask) |
+                ((u - (1U << SOFT_ECC_WINDOW_WIDTH)) & ~mask);
+            j = (size_t)(u >> 1);
+
+            /* constant time table lookup, the whole table is read */
+            soft_ecc_packed_table_select(table_data,
+                                         SOFT_ECC_WINDOW_TABLE_SIZE, stride, j,
+                                         sel_data);
+
+            /* negative digit: y = p - y, selected without branch */
+            result = scl->bignum_func.sub(scl, curve_params->p, sel.y,
+                                          (uint64_t *)neg_y, wsize);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+
+            for (e = 0; e < wsize; e++)
+            {
+                ((uint32_t *)sel.y)[e] = (neg_y[e] & mask) |
+                                         (((uint32_t *)sel.y)[e] & ~mask);
+            }
+
+            /**
+             * the last addition can get acc = sel (k = n - 2 on P-256 for
+             * instance), which the jacobian addition does not handle, it
+             * then returns Z = 0: p2 = 2.sel is computed in any case and
+             * selected without branch. acc = -sel would mean k = 0 mod n.
+             * The partial sums of the previous additions are positive and
+             * lower than n / 2, so they cannot reach +/-sel.
+             */
+            if (1 == i)
+            {
+                if (false != a_is_minus_3)
+                {
+                    result = soft_ecc_double_jacobian_a3(
+                        scl, curve_params, &bignum_ctx, &sel, &p2);
+                }
+                else
+                {
+                    result = soft_ecc_double_jacobian(scl, curve_params, &sel,
+                                                      &p2, wsize);
+                }
+                if (SCL_OK > result)
+                {
+                    goto cleanup;
+                }
+            }
+
+            result = soft_ecc_add_jacobian_jacobian(scl, curve_params, &acc,
+                                                    &sel, &acc, wsize);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+        }
+
+        /* acc = p2 when Z = 0 */
+        u = 0;
+        for (e = 0; e < wsize; e++)
+        {
+            u |= ((uint32_t *)acc.z)[e];
+        }
+        mask = (uint32_t)0 - (uint32_t)(0 == u);
+        for (e = 0; e < stride; e++)
+        {
+            acc_data[e] = (p2_data[e] & mask) | (acc_data[e] & ~mask);
+        }
+
+        soft_ecc_jacobian_copy(&acc, q, wsize);
+
+        result = SCL_OK;
+
+    cleanup:
+        memset(ext_k, 0, sizeof(ext_k));
+        memset(ext_n, 0, sizeof(ext_n));
+        memset(neg_y, 0, sizeof(neg_y));
+        memset(sel_data, 0, sizeof(sel_data));
+        memset(acc_data, 0, sizeof(acc_data));
+        memset(p2_data, 0, sizeof(p2_data));
+    }
+
+    return (result);
+}
+
+int32_t soft_ecc_mult_window(const metal_scl_t *const scl,
+                             const ecc_curve_t *const curve_params,
+                             const ecc_bignum_affine_const_point_t *const point,
+                             const uint64_t *const k, size_t k_nb_32bits_words,
+                             ecc_bignum_affine_point_t *const q)
+{
+    int32_t result;
+    ecc_bignum_jacobian_point_t q_jac;
+
+    if ((NULL == curve_params) || (NULL == q))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == q->x) || (NULL == q->y))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    {
+        uint32_t q_data[SOFT_ECC_JACOBIAN_PACKED_WSIZE(
+            curve_params->curve_wsize)] __attribute__((aligned(8)));
+
+        soft_ecc_jacobian_map_packed(q_data, &q_jac, curve_params->curve_wsize);
+
+        result = soft_ecc_mult_window_jacobian(scl, curve_params, point, k,
+                                               k_nb_32bits_words, &q_jac);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        /* back to affine */
+        result = soft_ecc_convert_jacobian_to_affine(
+            scl, curve_params, &q_jac, q, curve_params->curve_wsize);
+
+        soft_ecc_jacobian_zeroize(&q_jac, curve_params->curve_wsize);
     }
 
-    return (SCL_OK);
+    return (result);
 }
 
 /**
@@ -2485,18 +4440,15 @@ int32_t soft_ecc_mod(const metal_scl_t *const scl, const uint64_t *const in,
         return (SCL_INVALID_INPUT);
     }
 
-    if ((NULL == scl->bignum_func.compare_len_diff))
-    {
-        return (SCL_ERROR_API_ENTRY_POINT);
-    }
-
     if ((ecc_p_p256r1 == modulus) &&
         (ECC_SECP256R1_32B_WORDS_SIZE == modulus_nb_32b_words))
     {
-        result = scl->bignum_func.compare_len_diff(
-            scl, in, in_nb_32b_words, ecc_secp256r1.square_p,
-            ECC_SECP256R1_32B_WORDS_SIZE * 2);
-        if (0 <= result)
+        /**
+         * products of lazily reduced operands can exceed p^2, the fast
+         * reduction handles any input up to 2^(2 * bitsize)
+         */
+        if (false == soft_ecc_mod_input_fits(in, in_nb_32b_words,
+                                             2 * ECC_SECP256R1_BITSIZE))
         {
             return (SCL_ERROR);
         }
@@ -2507,10 +4459,12 @@ int32_t soft_ecc_mod(const metal_scl_t *const scl, const uint64_t *const in,
     else if ((ecc_p_p384r1 == modulus) &&
              (ECC_SECP384R1_32B_WORDS_SIZE == modulus_nb_32b_words))
     {
-        result = scl->bignum_func.compare_len_diff(
-            scl, in, in_nb_32b_words, ecc_secp384r1.square_p,
-            ECC_SECP384R1_32B_WORDS_SIZE * 2);
-        if (0 <= result)
+        /**
+         * products of lazily reduced operands can exceed p^2, the fast
+         * reduction handles any input up to 2^(2 * bitsize)
+         */
+        if (false == soft_ecc_mod_input_fits(in, in_nb_32b_words,
+                                             2 * ECC_SECP384R1_BITSIZE))
         {
             return (SCL_ERROR);
         }
@@ -2521,10 +4475,12 @@ int32_t soft_ecc_mod(const metal_scl_t *const scl, const uint64_t *const in,
     else if ((ecc_p_p521r1 == modulus) &&
              (ECC_SECP521R1_32B_WORDS_SIZE == modulus_nb_32b_words))
     {
-        result = scl->bignum_func.compare_len_diff(
-            scl, in, in_nb_32b_words, ecc_secp521r1.square_p,
-            ECC_SECP521R1_32B_WORDS_SIZE * 2);
-        if (0 <= result)
+        /**
+         * products of lazily reduced operands can exceed p^2, the fast
+         * reduction handles any input up to 2^(2 * bitsize)
+         */
+        if (false == soft_ecc_mod_input_fits(in, in_nb_32b_words,
+                                             2 * ECC_SECP521R1_BITSIZE))
         {
             return (SCL_ERROR);
         }
@@ -2540,3 +4496,398 @@ int32_t soft_ecc_mod(const metal_scl_t *const scl, const uint64_t *const in,
 
     return (result);
 }
+
+/**
+ * @brief out = in^(2^nb_squares) * mult mod p
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] bignum_ctx        bignumber context (contain modulus info)
+ * @param[in] in                input big integer
+ * @param[in] nb_squares        number of squarings (> 0)
+ * @param[in] mult              multiplier, no multiplication if NULL
+ * @param[out] out              output big integer (may alias in, not mult)
+ * @param[in] nb_32b_words      number of 32 bits words of the big integers
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+static int32_t soft_ecc_square_n_mult(const metal_scl_t *const scl,
+                                      const bignum_ctx_t *const bignum_ctx,
+                                      const uint64_t *const in,
+                                      size_t nb_squares,
+                                      const uint64_t *const mult,
+                                      uint64_t *const out, size_t nb_32b_words)
+{
+    int32_t result;
+    size_t i;
+
+    result = scl->bignum_func.mod_square(scl, bignum_ctx, in, out,
+                                         nb_32b_words);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    for (i = 1; i < nb_squares; i++)
+    {
+        result = scl->bignum_func.mod_square(scl, bignum_ctx, out, out,
+                                             nb_32b_words);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+    }
+
+    if (NULL != mult)
+    {
+        result = scl->bignum_func.mod_mult(scl, bignum_ctx, out, mult, out,
+                                           nb_32b_words);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+    }
+
+    return (SCL_OK);
+}
+
+/**
+ * @brief compute in^((p + 1) / 4) for secp256r1 with a fixed addition chain
+ * @details (p + 1) / 4 = 2^254 - 2^222 + 2^190 + 2^94, that is 32 ones, 31
+ * zeros, 1 one, 95 zeros, 1 one and 94 zeros
+ */
+static int32_t soft_ecc_sqrt_chain_secp256r1(
+    const metal_scl_t *const scl, const bignum_ctx_t *const bignum_ctx,
+    const uint64_t *const in, uint64_t *const out)
+{
+    int32_t result;
+    uint32_t t[ECC_SECP256R1_32B_WORDS_SIZE] __attribute__((aligned(8)));
+    const size_t wsize = ECC_SECP256R1_32B_WORDS_SIZE;
+
+    /* x^(2^2 - 1) */
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, in, 1, in, out, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* x^(2^4 - 1) */
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, out, 2, out,
+                                    (uint64_t *)t, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* x^(2^8 - 1) */
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, (uint64_t *)t, 4,
+                                    (uint64_t *)t, out, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* x^(2^16 - 1) */
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, out, 8, out,
+                                    (uint64_t *)t, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* x^(2^32 - 1) */
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, (uint64_t *)t, 16,
+                                    (uint64_t *)t, out, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, out, 32, in, out, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, out, 96, in, out, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    return (soft_ecc_square_n_mult(scl, bignum_ctx, out, 94, NULL, out,
+                                   wsize));
+}
+
+/**
+ * @brief compute in^((p + 1) / 4) for secp384r1 with a fixed addition chain
+ * @details (p + 1) / 4 = 2^382 - 2^126 - 2^94 + 2^30, that is 255 ones, 1
+ * zero, 32 ones, 63 zeros, 1 one and 30 zeros
+ */
+static int32_t soft_ecc_sqrt_chain_secp384r1(
+    const metal_scl_t *const scl, const bignum_ctx_t *const bignum_ctx,
+    const uint64_t *const in, uint64_t *const out)
+{
+    int32_t result;
+    uint32_t x2[ECC_SECP384R1_32B_WORDS_SIZE] __attribute__((aligned(8)));
+    uint32_t x32[ECC_SECP384R1_32B_WORDS_SIZE] __attribute__((aligned(8)));
+    uint32_t t1[ECC_SECP384R1_32B_WORDS_SIZE] __attribute__((aligned(8)));
+    uint32_t t2[ECC_SECP384R1_32B_WORDS_SIZE] __attribute__((aligned(8)));
+    const size_t wsize = ECC_SECP384R1_32B_WORDS_SIZE;
+
+    /* x^(2^2 - 1) */
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, in, 1, in, (uint64_t *)x2,
+                                    wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* x^(2^3 - 1) */
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, (uint64_t *)x2, 1, in,
+                                    (uint64_t *)x32, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* x^(2^6 - 1) */
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, (uint64_t *)x32, 3,
+                                    (uint64_t *)x32, (uint64_t *)t1, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* x^(2^12 - 1) */
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, (uint64_t *)t1, 6,
+                                    (uint64_t *)t1, (uint64_t *)t2, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* x^(2^15 - 1) */
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, (uint64_t *)t2, 3,
+                                    (uint64_t *)x32, (uint64_t *)t1, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* x^(2^30 - 1) */
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, (uint64_t *)t1, 15,
+                                    (uint64_t *)t1, (uint64_t *)t2, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* x^(2^32 - 1), kept for the second run of ones */
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, (uint64_t *)t2, 2,
+                                    (uint64_t *)x2, (uint64_t *)x32, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* x^(2^60 - 1) */
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, (uint64_t *)t2, 30,
+                                    (uint64_t *)t2, out, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* x^(2^120 - 1) */
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, out, 60, out,
+                                    (uint64_t *)t2, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* x^(2^240 - 1) */
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, (uint64_t *)t2, 120,
+                                    (uint64_t *)t2, out, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* x^(2^255 - 1) */
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, out, 15, (uint64_t *)t1,
+                                    out, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, out, 33, (uint64_t *)x32,
+                                    out, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = soft_ecc_square_n_mult(scl, bignum_ctx, out, 64, in, out, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    return (soft_ecc_square_n_mult(scl, bignum_ctx, out, 30, NULL, out,
+                                   wsize));
+}
+
+/**
+ * @brief compute in^((p + 1) / 4) by square and multiply, for other curves
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] bignum_ctx        bignumber context (contain modulus info)
+ * @param[in] modulus           curve prime p
+ * @param[in] in                input big integer
+ * @param[out] out              output big integer
+ * @param[in] nb_32b_words      number of 32 bits words of the big integers
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+static int32_t soft_ecc_sqrt_exp(const metal_scl_t *const scl,
+                                 const bignum_ctx_t *const bignum_ctx,
+                                 const uint64_t *const modulus,
+                                 const uint64_t *const in, uint64_t *const out,
+                                 size_t nb_32b_words)
+{
+    int32_t result;
+    size_t i;
+    uint32_t exponent[nb_32b_words] __attribute__((aligned(8)));
+
+    /* bits 2 and above of p + 1 are the ones of (p + 1) / 4 */
+    memcpy(exponent, modulus, sizeof(exponent));
+    result = scl->bignum_func.inc(scl, (uint64_t *)exponent, nb_32b_words);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.get_msb_set(scl, (uint64_t *)exponent,
+                                          nb_32b_words);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    memcpy(out, in, sizeof(exponent));
+
+    for (i = (size_t)result - 1; i > 2; i--)
+    {
+        result = soft_ecc_square_n_mult(
+            scl, bignum_ctx, out, 1,
+            (0 != soft_ecc_bit_extract(exponent, i - 1)) ? in : NULL, out,
+            nb_32b_words);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+    }
+
+    return (SCL_OK);
+}
+
+int32_t soft_ecc_mod_sqrt(const metal_scl_t *const scl,
+                          const ecc_curve_t *const curve_params,
+                          const uint64_t *const in, uint64_t *const out,
+                          size_t nb_32b_words)
+{
+    int32_t result;
+    bignum_ctx_t bignum_ctx;
+
+    if ((NULL == scl) || (NULL == curve_params) || (NULL == in) ||
+        (NULL == out))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->bignum_func.set_modulus) ||
+        (NULL == scl->bignum_func.mod_square) ||
+        (NULL == scl->bignum_func.mod_mult) ||
+        (NULL == scl->bignum_func.compare) || (NULL == scl->bignum_func.inc) ||
+        (NULL == scl->bignum_func.get_msb_set))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    /* check length consistency */
+    if (nb_32b_words != curve_params->curve_wsize)
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    /* only p = 3 mod 4 is supported (all NIST curves) */
+    if (3 != (curve_params->p[0] & 3))
+    {
+        return (SCL_NOT_YET_SUPPORTED);
+    }
+
+    {
+        uint32_t root[nb_32b_words] __attribute__((aligned(8)));
+        uint32_t check[nb_32b_words] __attribute__((aligned(8)));
+
+        result = scl->bignum_func.set_modulus(scl, &bignum_ctx, curve_params->p,
+                                              nb_32b_words);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        if (ECC_SECP256R1 == curve_params->curve)
+        {
+            result = soft_ecc_sqrt_chain_secp256r1(scl, &bignum_ctx, in,
+                                                   (uint64_t *)root);
+        }
+        else if (ECC_SECP384R1 == curve_params->curve)
+        {
+            result = soft_ecc_sqrt_chain_secp384r1(scl, &bignum_ctx, in,
+                                                   (uint64_t *)root);
+        }
+#if SOFT_ECC_P521_FIELD
+        else if (ECC_SECP521R1 == curve_params->curve)
+        {
+            soft_ecc_p521_fe_t fe;
+
+            soft_ecc_p521_from_bignum(in, &fe);
+            soft_ecc_p521_sqrt(&fe, &fe);
+            soft_ecc_p521_to_bignum(&fe, (uint64_t *)root);
+            result = SCL_OK;
+        }
+#endif /* SOFT_ECC_P521_FIELD */
+        else
+        {
+            result = soft_ecc_sqrt_exp(scl, &bignum_ctx, curve_params->p, in,
+                                       (uint64_t *)root, nb_32b_words);
+        }
+
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        /* the candidate is a square root only if in is a quadratic residue */
+        result = scl->bignum_func.mod_square(scl, &bignum_ctx,
+                                             (uint64_t *)root,
+                                             (uint64_t *)check, nb_32b_words);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        if (0 != scl->bignum_func.compare(scl, (uint64_t *)check, in,
+                                          nb_32b_words))
+        {
+            return (SCL_ERROR);
+        }
+
+        memcpy(out, root, sizeof(root));
+    }
+
+    return (SCL_OK);
+}
@@ -41,6 +41,7 @@
 #include <backend/api/asymmetric/ecc/ecdsa.h>
 #include <backend/software/asymmetric/ecc/soft_ecc.h>
 #include <backend/software/asymmetric/ecc/soft_ecc_keygen.h>
+#include <backend/software/asymmetric/ecc/soft_ecc_p521.h>
 
 /**
  * @brief compute public key from private key and curve parameters
@@ -226,6 +227,244 @@ int32_t soft_ecc_point_on_curve(const metal_scl_t *const scl,
     return (result);
 }
 
+/**
+ * @brief curve equation check of a converted point, reduction function and
+ * bignum context are set up by the caller
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] bignum_ctx    bignum context, modulus p
+ * @param[in] reduce        reduction modulo p of a double size product
+ * @param[in] x             x-coordinate (big integer)
+ * @param[in] y             y-coordinate (big integer)
+ * @return 0 if the point is on the curve
+ * @return SCL_ERR_POINT if it is not
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+static int32_t soft_ecc_point_on_curve_eval(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const bignum_ctx_t *const bignum_ctx,
+    int32_t (*reduce)(const metal_scl_t *const scl, const uint64_t *const in,
+                      size_t in_nb_32b_words, const uint64_t *const modulus,
+                      size_t modulus_nb_32b_words, uint64_t *const remainder),
+    const uint64_t *const x, const uint64_t *const y)
+{
+    int32_t result;
+    size_t wsize = curve_params->curve_wsize;
+    uint32_t rhs[wsize] __attribute__((aligned(8)));
+    uint32_t lhs[wsize] __attribute__((aligned(8)));
+    uint32_t product[2 * wsize] __attribute__((aligned(8)));
+
+    /* x and y in [1, p - 1] */
+    if ((0 <= scl->bignum_func.compare(scl, x, curve_params->p, wsize)) ||
+        (0 <= scl->bignum_func.compare(scl, y, curve_params->p, wsize)) ||
+        (false != scl->bignum_func.is_null(scl, (const uint32_t *)x, wsize)) ||
+        (false != scl->bignum_func.is_null(scl, (const uint32_t *)y, wsize)))
+    {
+        return (SCL_ERR_POINT);
+    }
+
+#if SOFT_ECC_P521_FIELD
+    if (ECC_SECP521R1 == curve_params->curve)
+    {
+        soft_ecc_p521_fe_t fe_x, fe_y, fe_t, fe_u;
+
+        soft_ecc_p521_from_bignum(x, &fe_x);
+        soft_ecc_p521_from_bignum(y, &fe_y);
+
+        /* rhs = (x^2 + a).x + b */
+        soft_ecc_p521_square(&fe_x, &fe_t);
+        soft_ecc_p521_from_bignum(curve_params->a, &fe_u);
+        soft_ecc_p521_add(&fe_t, &fe_u, &fe_t);
+        soft_ecc_p521_mult(&fe_t, &fe_x, &fe_t);
+        soft_ecc_p521_from_bignum(curve_params->b, &fe_u);
+        soft_ecc_p521_add(&fe_t, &fe_u, &fe_t);
+        soft_ecc_p521_carry(&fe_t);
+        soft_ecc_p521_to_bignum(&fe_t, (uint64_t *)rhs);
+
+        /* lhs = y^2 */
+        soft_ecc_p521_square(&fe_y, &fe_u);
+        soft_ecc_p521_to_bignum(&fe_u, (uint64_t *)lhs);
+    }
+    else
+#endif /* SOFT_ECC_P521_FIELD */
+    {
+        /* rhs = (x^2 + a).x + b, one multiplication less than x^3 + a.x */
+        result = scl->bignum_func.square(scl, x, (uint64_t *)product, wsize);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        result = reduce(scl, (uint64_t *)product, 2 * wsize, curve_params->p,
+                        wsize, (uint64_t *)rhs);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        result = scl->bignum_func.mod_add(scl, bignum_ctx, (uint64_t *)rhs,
+                                          curve_params->a, (uint64_t *)rhs,
+                                          wsize);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        result = scl->bignum_func.mult(scl, (uint64_t *)rhs, x,
+                                       (uint64_t *)product, wsize);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        result = reduce(scl, (uint64_t *)product, 2 * wsize, curve_params->p,
+                        wsize, (uint64_t *)rhs);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        result = scl->bignum_func.mod_add(scl, bignum_ctx, (uint64_t *)rhs,
+                                          curve_params->b, (uint64_t *)rhs,
+                                          wsize);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        /* lhs = y^2 */
+        result = scl->bignum_func.square(scl, y, (uint64_t *)product, wsize);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        result = reduce(scl, (uint64_t *)product, 2 * wsize, curve_params->p,
+                        wsize, (uint64_t *)lhs);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+    }
+
+    if (0 != scl->bignum_func.compare(scl, (uint64_t *)lhs, (uint64_t *)rhs,
+                                      wsize))
+    {
+        return (SCL_ERR_POINT);
+    }
+
+    return (SCL_OK);
+}
+
+int32_t soft_ecc_point_on_curve_batch(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_affine_const_point_t *const points, size_t count,
+    uint32_t *const valid)
+{
+    int32_t result;
+    size_t i;
+    bool all_valid = true;
+    bignum_ctx_t bignum_ctx;
+    int32_t (*reduce)(const metal_scl_t *const scl, const uint64_t *const in,
+                      size_t in_nb_32b_words, const uint64_t *const modulus,
+                      size_t modulus_nb_32b_words, uint64_t *const remainder);
+
+    if ((NULL == scl) || (NULL == curve_params) || (NULL == points) ||
+        (NULL == valid))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (0 == count)
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    /* Check curve length, to avoid overflow on stack allocation */
+    if ((ECDSA_MAX_32B_WORDSIZE < curve_params->curve_wsize) ||
+        (ECDSA_MIN_32B_WORDSIZE > curve_params->curve_wsize))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    if ((NULL == scl->bignum_func.is_null) ||
+        (NULL == scl->bignum_func.compare) ||
+        (NULL == scl->bignum_func.mult) ||
+        (NULL == scl->bignum_func.square) || (NULL == scl->bignum_func.mod) ||
+        (NULL == scl->bignum_func.mod_add) ||
+        (NULL == scl->bignum_func.set_modulus))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    /* the reduction is selected once for the whole batch */
+    if (ECC_SECP256R1 == curve_params->curve)
+    {
+        reduce = soft_ecc_mod_secp256r1;
+    }
+    else if (ECC_SECP384R1 == curve_params->curve)
+    {
+        reduce = soft_ecc_mod_secp384r1;
+    }
+    else if (ECC_SECP521R1 == curve_params->curve)
+    {
+        reduce = soft_ecc_mod_secp521r1;
+    }
+    else
+    {
+        reduce = scl->bignum_func.mod;
+    }
+
+    result = scl->bignum_func.set_modulus(scl, &bignum_ctx, curve_params->p,
+                                          curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    memset(valid, 0, ((count + 31) / 32) * sizeof(uint32_t));
+
+    {
+        uint32_t point_x[curve_params->curve_wsize] __attribute__((aligned(8)));
+        uint32_t point_y[curve_params->curve_wsize] __attribute__((aligned(8)));
+
+        for (i = 0; i < count; i++)
+        {
+            if ((NULL == points[i].x) || (NULL == points[i].y))
+            {
+                return (SCL_INVALID_INPUT);
+            }
+
+            memset(point_x, 0, sizeof(point_x));
+            memset(point_y, 0, sizeof(point_y));
+
+            copy_swap_array((uint8_t *)point_x, points[i].x,
+                            curve_params->curve_bsize);
+            copy_swap_array((uint8_t *)point_y, points[i].y,
+                            curve_params->curve_bsize);
+
+            result = soft_ecc_point_on_curve_eval(
+                scl, curve_params, &bignum_ctx, reduce, (uint64_t *)point_x,
+                (uint64_t *)point_y);
+            if (SCL_OK == result)
+            {
+                valid[i / 32] |= (uint32_t)1 << (i % 32);
+            }
+            else if (SCL_ERR_POINT == result)
+            {
+                all_valid = false;
+            }
+            else
+            {
+                return (result);
+            }
+        }
+    }
+
+    return ((false != all_valid) ? SCL_OK : SCL_ERR_POINT);
+}
+
 static int32_t soft_ecc_pubkey_generation_internal(
     const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
     const uint64_t *const priv_key, ecc_bignum_affine_point_t *const pub_key)
@@ -238,8 +477,8 @@ static int32_t soft_ecc_pubkey_generation_internal(
         return (SCL_INVALID_INPUT);
     }
 
-    result = soft_ecc_mult_coz(scl, curve_params, curve_params->g, priv_key,
-                               curve_params->curve_wsize, pub_key);
+    result = soft_ecc_mult_window(scl, curve_params, curve_params->g,
+                                  priv_key, curve_params->curve_wsize, pub_key);
     if (SCL_OK != result)
     {
         return (result);
@@ -403,3 +642,457 @@ int32_t soft_ecc_keypair_generation(const metal_scl_t *const scl,
 
     return (SCL_OK);
 }
+
+int32_t soft_ecc_keypair_generation_batch(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    size_t count, uint8_t *const priv_keys, ecc_affine_point_t *const pub_keys)
+{
+    int32_t result;
+    int32_t result_2;
+    size_t i, j, done, nb_keys, wsize, stride;
+    uint32_t *privkey_bn;
+
+    if ((NULL == scl) || (NULL == curve_params) || (NULL == priv_keys) ||
+        (NULL == pub_keys))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (0 == count)
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        if ((NULL == pub_keys[i].x) || (NULL == pub_keys[i].y))
+        {
+            return (SCL_INVALID_INPUT);
+        }
+    }
+
+    /* Check curve length, to avoid overflow on stack allocation */
+    if ((ECDSA_MAX_32B_WORDSIZE < curve_params->curve_wsize) ||
+        (ECDSA_MIN_32B_WORDSIZE > curve_params->curve_wsize))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    if ((NULL == scl->trng_func.get_data) ||
+        (NULL == scl->bignum_func.is_null) ||
+        (NULL == scl->bignum_func.compare))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    wsize = curve_params->curve_wsize;
+    stride = SOFT_ECC_JACOBIAN_PACKED_WSIZE(wsize);
+
+    {
+        uint32_t privkeys_bn[SOFT_ECC_KEYGEN_BATCH_SIZE * wsize]
+            __attribute__((aligned(8)));
+        uint32_t points_data[SOFT_ECC_KEYGEN_BATCH_SIZE * stride]
+            __attribute__((aligned(8)));
+        ecc_bignum_jacobian_point_t points_jac[SOFT_ECC_KEYGEN_BATCH_SIZE];
+        ecc_bignum_affine_point_t points_aff[SOFT_ECC_KEYGEN_BATCH_SIZE];
+
+        for (j = 0; j < SOFT_ECC_KEYGEN_BATCH_SIZE; j++)
+        {
+            soft_ecc_jacobian_map_packed(&points_data[j * stride],
+                                         &points_jac[j], wsize);
+            /* normalized in place, over the jacobian x and y */
+            points_aff[j].x = points_jac[j].x;
+            points_aff[j].y = points_jac[j].y;
+        }
+
+        for (done = 0; done < count; done += nb_keys)
+        {
+            nb_keys = count - done;
+            if (SOFT_ECC_KEYGEN_BATCH_SIZE < nb_keys)
+            {
+                nb_keys = SOFT_ECC_KEYGEN_BATCH_SIZE;
+            }
+
+            /* 1. fetch the entropy of all the private keys in one pass */
+            for (i = 0; i < nb_keys * wsize; i++)
+            {
+                result = scl->trng_func.get_data(scl, &privkeys_bn[i]);
+                if (SCL_OK != result)
+                {
+                    goto cleanup;
+                }
+            }
+
+            /**
+             * 2. priv_key in [1,n-1], only the rejected candidates are drawn
+             * again
+             */
+            for (j = 0; j < nb_keys; j++)
+            {
+                privkey_bn = &privkeys_bn[j * wsize];
+
+                for (;;)
+                {
+                    truncate_array((uint8_t *)privkey_bn,
+                                   wsize * sizeof(uint32_t),
+                                   curve_params->curve_bitsize);
+
+                    result = scl->bignum_func.compare(
+                        scl, (uint64_t *)privkey_bn, curve_params->n, wsize);
+
+                    result_2 = scl->bignum_func.is_null(scl, privkey_bn, wsize);
+
+                    if ((result < 0) && (false == result_2))
+                    {
+                        break;
+                    }
+
+                    for (i = 0; i < wsize; i++)
+                    {
+                        result = scl->trng_func.get_data(scl, &privkey_bn[i]);
+                        if (SCL_OK != result)
+                        {
+                            goto cleanup;
+                        }
+                    }
+                }
+            }
+
+            /* 3. generator multiplications, results kept in jacobian */
+            for (j = 0; j < nb_keys; j++)
+            {
+                result = soft_ecc_mult_window_jacobian(
+                    scl, curve_params, curve_params->g,
+                    (uint64_t *)&privkeys_bn[j * wsize], wsize, &points_jac[j]);
+                if (SCL_OK != result)
+                {
+                    goto cleanup;
+                }
+            }
+
+            /* 4. a single inversion for all the public keys */
+            result = soft_ecc_batch_jacobian_to_affine(
+                scl, curve_params, points_jac, points_aff, nb_keys, wsize);
+            if (SCL_OK != result)
+            {
+                goto cleanup;
+            }
+
+            for (j = 0; j < nb_keys; j++)
+            {
+                result = soft_ecc_point_on_curve_internal(
+                    scl, curve_params,
+                    (ecc_bignum_affine_const_point_t *)&points_aff[j]);
+                if (SCL_OK != result)
+                {
+                    goto cleanup;
+                }
+
+                copy_swap_array(
+                    &priv_keys[(done + j) * curve_params->curve_bsize],
+                    (uint8_t *)&privkeys_bn[j * wsize],
+                    curve_params->curve_bsize);
+                copy_swap_array(pub_keys[done + j].x,
+                                (uint8_t *)points_aff[j].x,
+                                curve_params->curve_bsize);
+                copy_swap_array(pub_keys[done + j].y,
+                                (uint8_t *)points_aff[j].y,
+                                curve_params->curve_bsize);
+            }
+        }
+
+        result = SCL_OK;
+
+    cleanup:
+        memset(privkeys_bn, 0, sizeof(privkeys_bn));
+        memset(points_data, 0, sizeof(points_data));
+
+        /* no partial result, the keypairs of the previous groups included */
+        if (SCL_OK != result)
+        {
+            memset(priv_keys, 0, count * curve_params->curve_bsize);
+            for (i = 0; i < count; i++)
+            {
+                memset(pub_keys[i].x, 0, curve_params->curve_bsize);
+                memset(pub_keys[i].y, 0, curve_params->curve_bsize);
+            }
+        }
+    }
+
+    return (result);
+}
+
+int32_t soft_ecc_point_compress(const metal_scl_t *const scl,
+                                const ecc_curve_t *const curve_params,
+                                const ecc_affine_const_point_t *const point,
+                                uint8_t *const compressed,
+                                size_t *const compressed_len)
+{
+    if ((NULL == scl) || (NULL == curve_params) || (NULL == point) ||
+        (NULL == compressed) || (NULL == compressed_len))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == point->x) || (NULL == point->y))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (ECC_POINT_COMPRESSED_BYTESIZE(curve_params->curve_bsize) >
+        *compressed_len)
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    /* coordinates are big endian, the parity is in the last byte */
+    compressed[0] = (uint8_t)(ECC_POINT_COMPRESSED_EVEN |
+                              (point->y[curve_params->curve_bsize - 1] & 1));
+    memcpy(&compressed[1], point->x, curve_params->curve_bsize);
+
+    *compressed_len = ECC_POINT_COMPRESSED_BYTESIZE(curve_params->curve_bsize);
+
+    return (SCL_OK);
+}
+
+int32_t soft_ecc_point_decompress(const metal_scl_t *const scl,
+                                  const ecc_curve_t *const curve_params,
+                                  const uint8_t *const compressed,
+                                  size_t compressed_len,
+                                  ecc_affine_point_t *const point)
+{
+    int32_t result;
+    bignum_ctx_t bignum_ctx;
+
+    if ((NULL == scl) || (NULL == curve_params) || (NULL == compressed) ||
+        (NULL == point))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == point->x) || (NULL == point->y))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->bignum_func.compare) ||
+        (NULL == scl->bignum_func.is_null) || (NULL == scl->bignum_func.sub) ||
+        (NULL == scl->bignum_func.mod_mult) ||
+        (NULL == scl->bignum_func.mod_add) ||
+        (NULL == scl->bignum_func.set_modulus))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    /* Check curve length, to avoid overflow on stack allocation */
+    if ((ECDSA_MAX_32B_WORDSIZE < curve_params->curve_wsize) ||
+        (ECDSA_MIN_32B_WORDSIZE > curve_params->curve_wsize))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    if (ECC_POINT_COMPRESSED_BYTESIZE(curve_params->curve_bsize) !=
+        compressed_len)
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    if ((ECC_POINT_COMPRESSED_EVEN != compressed[0]) &&
+        (ECC_POINT_COMPRESSED_ODD != compressed[0]))
+    {
+        return (SCL_ERR_POINT);
+    }
+
+    {
+        uint32_t point_x[curve_params->curve_wsize] __attribute__((aligned(8)));
+        uint32_t point_y[curve_params->curve_wsize] __attribute__((aligned(8)));
+        uint32_t temp[curve_params->curve_wsize] __attribute__((aligned(8)));
+
+        memset(point_x, 0, sizeof(point_x));
+
+        copy_swap_array((uint8_t *)point_x, &compressed[1],
+                        curve_params->curve_bsize);
+
+        result = scl->bignum_func.compare(scl, (uint64_t *)point_x,
+                                          curve_params->p,
+                                          curve_params->curve_wsize);
+        if (result >= 0)
+        {
+            return (SCL_ERR_POINT);
+        }
+
+        /* y^2 = x^3 + a.x + b */
+        result = scl->bignum_func.set_modulus(scl, &bignum_ctx, curve_params->p,
+                                              curve_params->curve_wsize);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        result = scl->bignum_func.mod_mult(
+            scl, &bignum_ctx, (uint64_t *)point_x, (uint64_t *)point_x,
+            (uint64_t *)temp, curve_params->curve_wsize);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        result = scl->bignum_func.mod_add(scl, &bignum_ctx, (uint64_t *)temp,
+                                          curve_params->a, (uint64_t *)temp,
+                                          curve_params->curve_wsize);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        result = scl->bignum_func.mod_mult(
+            scl, &bignum_ctx, (uint64_t *)temp, (uint64_t *)point_x,
+            (uint64_t *)temp, curve_params->curve_wsize);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        result = scl->bignum_func.mod_add(scl, &bignum_ctx, (uint64_t *)temp,
+                                          curve_params->b, (uint64_t *)temp,
+                                          curve_params->curve_wsize);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        result = soft_ecc_mod_sqrt(scl, curve_params, (uint64_t *)temp,
+                                   (uint64_t *)point_y,
+                                   curve_params->curve_wsize);
+        if (SCL_ERROR == result)
+        {
+            return (SCL_ERR_POINT);
+        }
+        else if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        /* pick the root with the requested parity, p - y is the other one */
+        if ((point_y[0] & 1) != (compressed[0] & 1))
+        {
+            result = scl->bignum_func.is_null(scl, point_y,
+                                              curve_params->curve_wsize);
+            if (SCL_OK > result)
+            {
+                return (result);
+            }
+            else if (false != result)
+            {
+                return (SCL_ERR_POINT);
+            }
+
+            result = scl->bignum_func.sub(scl, curve_params->p,
+                                          (uint64_t *)point_y,
+                                          (uint64_t *)point_y,
+                                          curve_params->curve_wsize);
+            if (SCL_OK > result)
+            {
+                return (result);
+            }
+        }
+
+        copy_swap_array(point->x, (uint8_t *)point_x,
+                        curve_params->curve_bsize);
+        copy_swap_array(point->y, (uint8_t *)point_y,
+                        curve_params->curve_bsize);
+    }
+
+    return (SCL_OK);
+}
+
+int32_t soft_ecc_pubkey_generation_start(const metal_scl_t *const scl,
+                                         ecc_ladder_ctx_t *const ctx,
+                                         const ecc_curve_t *const curve_params,
+                                         const uint8_t *const priv_key)
+{
+    int32_t result;
+
+    if ((NULL == scl) || (NULL == ctx) || (NULL == curve_params) ||
+        (NULL == priv_key))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    /* Check curve length, to avoid overflow on stack allocation */
+    if ((ECDSA_MAX_32B_WORDSIZE < curve_params->curve_wsize) ||
+        (ECDSA_MIN_32B_WORDSIZE > curve_params->curve_wsize))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    {
+        uint32_t privkey_bn[curve_params->curve_wsize]
+            __attribute__((aligned(8)));
+
+        memset(privkey_bn, 0, sizeof(privkey_bn));
+
+        copy_swap_array((uint8_t *)privkey_bn, priv_key,
+                        curve_params->curve_bsize);
+
+        result = soft_ecc_ladder_start(scl, ctx, curve_params, curve_params->g,
+                                       (uint64_t *)privkey_bn,
+                                       curve_params->curve_wsize);
+
+        memset(privkey_bn, 0, sizeof(privkey_bn));
+    }
+
+    return (result);
+}
+
+int32_t soft_ecc_pubkey_generation_finish(const metal_scl_t *const scl,
+                                          ecc_ladder_ctx_t *const ctx,
+                                          ecc_affine_point_t *const pub_key)
+{
+    int32_t result;
+    const ecc_curve_t *curve_params;
+
+    if ((NULL == scl) || (NULL == ctx) || (NULL == ctx->curve_params) ||
+        (NULL == pub_key))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == pub_key->x) || (NULL == pub_key->y))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    /* ctx is zeroized by soft_ecc_ladder_finish() */
+    curve_params = ctx->curve_params;
+
+    {
+        uint32_t pubkey_bn_x[curve_params->curve_wsize]
+            __attribute__((aligned(8)));
+        uint32_t pubkey_bn_y[curve_params->curve_wsize]
+            __attribute__((aligned(8)));
+
+        ecc_bignum_affine_point_t pub_key_bn = {.x = (uint64_t *)pubkey_bn_x,
+                                                .y = (uint64_t *)pubkey_bn_y};
+
+        result = soft_ecc_ladder_finish(scl, ctx, &pub_key_bn);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+
+        result = soft_ecc_point_on_curve_internal(
+            scl, curve_params, (ecc_bignum_affine_const_point_t *)&pub_key_bn);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+
+        copy_swap_array(pub_key->x, (uint8_t *)pubkey_bn_x,
+                        curve_params->curve_bsize);
+        copy_swap_array(pub_key->y, (uint8_t *)pubkey_bn_y,
+                        curve_params->curve_bsize);
+    }
+
+    return (SCL_OK);
+}
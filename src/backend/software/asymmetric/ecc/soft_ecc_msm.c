@@ -0,0 +1,599 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+
+/**
+ * @file soft_ecc_msm.c
+ * @brief software multi-scalar multiplication q = sum(k_i.P_i)
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include <scl/scl_retdefs.h>
+
+#include <backend/software/asymmetric/ecc/soft_ecc.h>
+#include <backend/software/asymmetric/ecc/soft_ecc_msm.h>
+
+/*! @brief number of multiples in a Straus table (P, 2P, ... (2^w - 1)P) */
+#define SOFT_ECC_MSM_STRAUS_TABLE_SIZE                                         \
+    ((1U << SOFT_ECC_MSM_STRAUS_WIDTH) - 1)
+
+/*! @brief smallest window width of the Pippenger method */
+#define SOFT_ECC_MSM_MIN_WIDTH 2
+
+/**
+ * @brief set a jacobian point to the infinite (x = 1, y = 1, z = 0)
+ *
+ * @param[out] point            jacobian point
+ * @param[in] nb_32b_words      number of 32 bits words per coordinate
+ */
+static void soft_ecc_msm_set_infinite(ecc_bignum_jacobian_point_t *const point,
+                                      size_t nb_32b_words)
+{
+    memset(point->x, 0, nb_32b_words * sizeof(uint32_t));
+    memset(point->y, 0, nb_32b_words * sizeof(uint32_t));
+    memset(point->z, 0, nb_32b_words * sizeof(uint32_t));
+    *((uint32_t *)&point->x[0]) = 1;
+    *((uint32_t *)&point->y[0]) = 1;
+}
+
+/**
+ * @brief complete jacobian addition out = in_a + in_b
+ * @details soft_ecc_add_jacobian_jacobian() handles the infinite inputs but
+ * not in_a = +/-in_b, which does happen when buckets are filled: in that case
+ * it returns Z3 = 0, with X3 = 0 when in_a = in_b, so the doubling or the
+ * infinite is substituted. out may alias in_a or in_b.
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] in_a              first point
+ * @param[in] in_b              second point
+ * @param[out] tmp              scratch point (distinct from the others)
+ * @param[out] out              sum
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+static int32_t soft_ecc_msm_add(const metal_scl_t *const scl,
+                                const ecc_curve_t *const curve_params,
+                                const ecc_bignum_jacobian_point_t *const in_a,
+                                const ecc_bignum_jacobian_point_t *const in_b,
+                                ecc_bignum_jacobian_point_t *const tmp,
+                                ecc_bignum_jacobian_point_t *const out)
+{
+    int32_t result;
+    size_t wsize = curve_params->curve_wsize;
+
+    result = soft_ecc_add_jacobian_jacobian(scl, curve_params, in_a, in_b, tmp,
+                                            wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = scl->bignum_func.is_null(scl, (uint32_t *)tmp->z, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+    else if ((int32_t) false == result)
+    {
+        soft_ecc_jacobian_copy(tmp, out, wsize);
+        return (SCL_OK);
+    }
+
+    /* in_b is the infinite too, or in_a = -in_b */
+    result = scl->bignum_func.is_null(scl, (uint32_t *)tmp->x, wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+    else if ((int32_t) false == result)
+    {
+        soft_ecc_msm_set_infinite(out, wsize);
+        return (SCL_OK);
+    }
+
+    /* in_a = in_b */
+    return (soft_ecc_double_jacobian(scl, curve_params, in_a, out, wsize));
+}
+
+/**
+ * @brief extract an unsigned window of a scalar
+ *
+ * @param[in] k                 scalar
+ * @param[in] k_nb_bits         scalar size in bits
+ * @param[in] bit_idx           index of the window lowest bit
+ * @param[in] width             window width
+ * @return window value in [0, 2^width - 1]
+ */
+static size_t soft_ecc_msm_digit(const uint32_t *const k, size_t k_nb_bits,
+                                 size_t bit_idx, size_t width)
+{
+    size_t i;
+    size_t digit = 0;
+
+    for (i = 0; (i < width) && (bit_idx + i < k_nb_bits); i++)
+    {
+        digit |= soft_ecc_bit_extract(k, bit_idx + i) << i;
+    }
+
+    return (digit);
+}
+
+/**
+ * @brief Pippenger window width for a number of points
+ * @details minimize the number of additions ceil(b / c).(N + 2^(c + 1)),
+ * N to fill the buckets and 2^(c + 1) to sum them up, per window
+ *
+ * @param[in] nb_bits           scalars size in bits
+ * @param[in] nb_points         number of points
+ * @param[in] max_width         largest width allowed
+ * @return window width
+ */
+static size_t soft_ecc_msm_width(size_t nb_bits, size_t nb_points,
+                                 size_t max_width)
+{
+    size_t c, cost;
+    size_t best_c = SOFT_ECC_MSM_MIN_WIDTH;
+    size_t best_cost = SIZE_MAX;
+
+    for (c = SOFT_ECC_MSM_MIN_WIDTH; c <= max_width; c++)
+    {
+        cost = ((nb_bits + c - 1) / c) * (nb_points + ((size_t)2 << c));
+        if (cost < best_cost)
+        {
+            best_cost = cost;
+            best_c = c;
+        }
+    }
+
+    return (best_c);
+}
+
+size_t soft_ecc_msm_workspace_size(const ecc_curve_t *const curve_params,
+                                   size_t nb_points)
+{
+    size_t stride;
+
+    if ((NULL == curve_params) || (0 == nb_points))
+    {
+        return (0);
+    }
+
+    stride = SOFT_ECC_JACOBIAN_PACKED_WSIZE(curve_params->curve_wsize);
+
+    if (SOFT_ECC_MSM_STRAUS_MAX_POINTS >= nb_points)
+    {
+        return (nb_points * SOFT_ECC_MSM_STRAUS_TABLE_SIZE * stride);
+    }
+
+    return (((1U << soft_ecc_msm_width(curve_params->curve_bsize * 8,
+                                       nb_points, SOFT_ECC_MSM_MAX_WIDTH)) -
+             1) *
+            stride);
+}
+
+/**
+ * @brief Straus method, the doublings are shared by all the points
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] points            input points
+ * @param[in] scalars           input scalars
+ * @param[in] k_nb_bits         scalars size in bits
+ * @param[in] nb_bits           number of bits to process
+ * @param[in] nb_points         number of points
+ * @param[in] workspace         workspace, tables of multiples
+ * @param[out] q                output point
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+static int32_t soft_ecc_msm_straus(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_bignum_affine_const_point_t *const points,
+    const uint64_t *const *const scalars, size_t k_nb_bits, size_t nb_bits,
+    size_t nb_points, uint32_t *const workspace,
+    ecc_bignum_jacobian_point_t *const q)
+{
+    int32_t result;
+    size_t i, j, e, digit;
+    size_t wsize = curve_params->curve_wsize;
+    size_t stride = SOFT_ECC_JACOBIAN_PACKED_WSIZE(wsize);
+    bool q_is_infinite = true;
+    ecc_bignum_jacobian_point_t entry, prev, first, tmp;
+    uint32_t tmp_data[stride] __attribute__((aligned(8)));
+
+    soft_ecc_jacobian_map_packed(tmp_data, &tmp, wsize);
+
+    /* table of point i: entry j = (j + 1).P_i */
+    for (i = 0; i < nb_points; i++)
+    {
+        uint32_t *table = &workspace[i * SOFT_ECC_MSM_STRAUS_TABLE_SIZE *
+                                     stride];
+
+        soft_ecc_jacobian_map_packed(table, &first, wsize);
+        result = soft_ecc_convert_affine_to_jacobian(scl, curve_params,
+                                                     &points[i], &first, wsize);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        for (j = 1; j < SOFT_ECC_MSM_STRAUS_TABLE_SIZE; j++)
+        {
+            soft_ecc_jacobian_map_packed(&table[(j - 1) * stride], &prev,
+                                         wsize);
+            soft_ecc_jacobian_map_packed(&table[j * stride], &entry, wsize);
+            result = soft_ecc_msm_add(scl, curve_params, &prev, &first, &tmp,
+                                      &entry);
+            if (SCL_OK > result)
+            {
+                return (result);
+            }
+        }
+    }
+
+    soft_ecc_msm_set_infinite(q, wsize);
+
+    /* from the top window, q = 2^w.q + sum(digit_i.P_i) */
+    e = (nb_bits + SOFT_ECC_MSM_STRAUS_WIDTH - 1) / SOFT_ECC_MSM_STRAUS_WIDTH;
+    while (e > 0)
+    {
+        e--;
+
+        for (j = 0; (false == q_is_infinite) && (j < SOFT_ECC_MSM_STRAUS_WIDTH);
+             j++)
+        {
+            result = soft_ecc_double_jacobian(scl, curve_params, q, q, wsize);
+            if (SCL_OK > result)
+            {
+                return (result);
+            }
+        }
+
+        for (i = 0; i < nb_points; i++)
+        {
+            digit = soft_ecc_msm_digit((const uint32_t *)scalars[i], k_nb_bits,
+                                       e * SOFT_ECC_MSM_STRAUS_WIDTH,
+                                       SOFT_ECC_MSM_STRAUS_WIDTH);
+            if (0 == digit)
+            {
+                continue;
+            }
+
+            soft_ecc_jacobian_map_packed(
+                &workspace[(i * SOFT_ECC_MSM_STRAUS_TABLE_SIZE + digit - 1) *
+                           stride],
+                &entry, wsize);
+            result = soft_ecc_msm_add(scl, curve_params, q, &entry, &tmp, q);
+            if (SCL_OK > result)
+            {
+                return (result);
+            }
+
+            q_is_infinite = false;
+        }
+    }
+
+    return (SCL_OK);
+}
+
+/**
+ * @brief Pippenger (bucket) method
+ * @details for each window of c bits, the points are added to the bucket of
+ * their digit, then sum(d.bucket_d) is obtained with a running sum, so a
+ * window costs N + 2^(c + 1) additions whatever the number of points
+ *
+ * @param[in] scl               metal scl context
+ * @param[in] curve_params      ECC curve parameters
+ * @param[in] points            input points
+ * @param[in] scalars           input scalars
+ * @param[in] k_nb_bits         scalars size in bits
+ * @param[in] nb_bits           number of bits to process
+ * @param[in] nb_points         number of points
+ * @param[in] width             window width c
+ * @param[in] workspace         workspace, 2^c - 1 buckets
+ * @param[out] q                output point
+ * @return 0 success
+ * @return < 0 in case of errors @ref scl_errors_t
+ */
+static int32_t soft_ecc_msm_pippenger(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_bignum_affine_const_point_t *const points,
+    const uint64_t *const *const scalars, size_t k_nb_bits, size_t nb_bits,
+    size_t nb_points, size_t width, uint32_t *const workspace,
+    ecc_bignum_jacobian_point_t *const q)
+{
+    int32_t result;
+    size_t i, j, e, digit;
+    size_t wsize = curve_params->curve_wsize;
+    size_t stride = SOFT_ECC_JACOBIAN_PACKED_WSIZE(wsize);
+    size_t nb_buckets = ((size_t)1 << width) - 1;
+    bool q_is_infinite = true;
+    ecc_bignum_jacobian_point_t bucket, pt, running, sum, tmp;
+    uint32_t pt_data[stride] __attribute__((aligned(8)));
+    uint32_t running_data[stride] __attribute__((aligned(8)));
+    uint32_t sum_data[stride] __attribute__((aligned(8)));
+    uint32_t tmp_data[stride] __attribute__((aligned(8)));
+
+    soft_ecc_jacobian_map_packed(pt_data, &pt, wsize);
+    soft_ecc_jacobian_map_packed(running_data, &running, wsize);
+    soft_ecc_jacobian_map_packed(sum_data, &sum, wsize);
+    soft_ecc_jacobian_map_packed(tmp_data, &tmp, wsize);
+
+    soft_ecc_msm_set_infinite(q, wsize);
+
+    e = (nb_bits + width - 1) / width;
+    while (e > 0)
+    {
+        e--;
+
+        for (j = 0; (false == q_is_infinite) && (j < width); j++)
+        {
+            result = soft_ecc_double_jacobian(scl, curve_params, q, q, wsize);
+            if (SCL_OK > result)
+            {
+                return (result);
+            }
+        }
+
+        /* 1. fill the buckets, bucket j gets the points of digit j + 1 */
+        for (j = 0; j < nb_buckets; j++)
+        {
+            soft_ecc_jacobian_map_packed(&workspace[j * stride], &bucket,
+                                         wsize);
+            soft_ecc_msm_set_infinite(&bucket, wsize);
+        }
+
+        for (i = 0; i < nb_points; i++)
+        {
+            digit = soft_ecc_msm_digit((const uint32_t *)scalars[i], k_nb_bits,
+                                       e * width, width);
+            if (0 == digit)
+            {
+                continue;
+            }
+
+            result = soft_ecc_convert_affine_to_jacobian(
+                scl, curve_params, &points[i], &pt, wsize);
+            if (SCL_OK > result)
+            {
+                return (result);
+            }
+
+            soft_ecc_jacobian_map_packed(&workspace[(digit - 1) * stride],
+                                         &bucket, wsize);
+            result = soft_ecc_msm_add(scl, curve_params, &bucket, &pt, &tmp,
+                                      &bucket);
+            if (SCL_OK > result)
+            {
+                return (result);
+            }
+        }
+
+        /**
+         * 2. sum = sum(d.bucket_(d - 1)): running is the sum of the buckets
+         * above j, and it is added to sum once per bucket
+         */
+        soft_ecc_msm_set_infinite(&running, wsize);
+        soft_ecc_msm_set_infinite(&sum, wsize);
+        j = nb_buckets;
+        while (j > 0)
+        {
+            j--;
+            soft_ecc_jacobian_map_packed(&workspace[j * stride], &bucket,
+                                         wsize);
+            result = soft_ecc_msm_add(scl, curve_params, &running, &bucket,
+                                      &tmp, &running);
+            if (SCL_OK > result)
+            {
+                return (result);
+            }
+
+            result = soft_ecc_msm_add(scl, curve_params, &sum, &running, &tmp,
+                                      &sum);
+            if (SCL_OK > result)
+            {
+                return (result);
+            }
+        }
+
+        /* 3. q = 2^c.q + sum */
+        result = soft_ecc_msm_add(scl, curve_params, q, &sum, &tmp, q);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        result = soft_ecc_infinite_jacobian(scl, q, wsize);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+        q_is_infinite = (false != result);
+    }
+
+    return (SCL_OK);
+}
+
+int32_t soft_ecc_msm_jacobian(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_bignum_affine_const_point_t *const points,
+    const uint64_t *const *const scalars, size_t k_nb_32bits_words,
+    size_t nb_points, uint32_t *const workspace,
+    size_t workspace_nb_32b_words, ecc_bignum_jacobian_point_t *const q)
+{
+    int32_t result;
+    size_t i, stride, width, k_nb_bits;
+    size_t nb_bits = 0;
+
+    if ((NULL == scl) || (NULL == curve_params) || (NULL == points) ||
+        (NULL == scalars) || (NULL == workspace) || (NULL == q))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == q->x) || (NULL == q->y) || (NULL == q->z))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->bignum_func.is_null) ||
+        (NULL == scl->bignum_func.get_msb_set))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    if ((0 == nb_points) || (0 == k_nb_32bits_words) ||
+        (k_nb_32bits_words > curve_params->curve_wsize))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    stride = SOFT_ECC_JACOBIAN_PACKED_WSIZE(curve_params->curve_wsize);
+    k_nb_bits = k_nb_32bits_words * sizeof(uint32_t) * 8;
+
+    /* leading zero windows, common to all scalars, are skipped */
+    for (i = 0; i < nb_points; i++)
+    {
+        if (NULL == scalars[i])
+        {
+            return (SCL_INVALID_INPUT);
+        }
+
+        result = scl->bignum_func.is_null(scl, (const uint32_t *)scalars[i],
+                                          k_nb_32bits_words);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+        else if ((int32_t) false != result)
+        {
+            continue;
+        }
+
+        result = scl->bignum_func.get_msb_set(scl, scalars[i],
+                                              k_nb_32bits_words);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        if ((size_t)result + 1 > nb_bits)
+        {
+            nb_bits = (size_t)result + 1;
+        }
+    }
+
+    if (SOFT_ECC_MSM_STRAUS_MAX_POINTS >= nb_points)
+    {
+        if (workspace_nb_32b_words <
+            nb_points * SOFT_ECC_MSM_STRAUS_TABLE_SIZE * stride)
+        {
+            return (SCL_INVALID_LENGTH);
+        }
+
+        return (soft_ecc_msm_straus(scl, curve_params, points, scalars,
+                                    k_nb_bits, nb_bits, nb_points, workspace,
+                                    q));
+    }
+
+    /* the actual scalars size may allow a narrower window */
+    for (width = SOFT_ECC_MSM_MAX_WIDTH; width > SOFT_ECC_MSM_MIN_WIDTH;
+         width--)
+    {
+        if ((((size_t)1 << width) - 1) * stride <= workspace_nb_32b_words)
+        {
+            break;
+        }
+    }
+
+    if ((((size_t)1 << width) - 1) * stride > workspace_nb_32b_words)
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    width = soft_ecc_msm_width(nb_bits, nb_points, width);
+
+    return (soft_ecc_msm_pippenger(scl, curve_params, points, scalars,
+                                   k_nb_bits, nb_bits, nb_points, width,
+                                   workspace, q));
+}
+
+int32_t soft_ecc_msm(const metal_scl_t *const scl,
+                     const ecc_curve_t *const curve_params,
+                     const ecc_bignum_affine_const_point_t *const points,
+                     const uint64_t *const *const scalars,
+                     size_t k_nb_32bits_words, size_t nb_points,
+                     uint32_t *const workspace, size_t workspace_nb_32b_words,
+                     ecc_bignum_affine_point_t *const q)
+{
+    int32_t result;
+    ecc_bignum_jacobian_point_t q_jac;
+
+    if ((NULL == scl) || (NULL == curve_params) || (NULL == q))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == q->x) || (NULL == q->y))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    {
+        uint32_t q_data[SOFT_ECC_JACOBIAN_PACKED_WSIZE(
+            curve_params->curve_wsize)] __attribute__((aligned(8)));
+
+        soft_ecc_jacobian_map_packed(q_data, &q_jac, curve_params->curve_wsize);
+
+        result = soft_ecc_msm_jacobian(scl, curve_params, points, scalars,
+                                       k_nb_32bits_words, nb_points, workspace,
+                                       workspace_nb_32b_words, &q_jac);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        result = soft_ecc_infinite_jacobian(scl, &q_jac,
+                                            curve_params->curve_wsize);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+        else if ((int32_t) false != result)
+        {
+            return (SCL_ERR_POINT);
+        }
+
+        result = soft_ecc_convert_jacobian_to_affine(
+            scl, curve_params, &q_jac, q, curve_params->curve_wsize);
+    }
+
+    return (result);
+}
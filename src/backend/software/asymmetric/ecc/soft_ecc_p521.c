@@ -0,0 +1,773 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ * @file soft_ecc_p521.c
+ * @brief software SECP521R1 field arithmetic and point formulas on
+ * unsaturated limbs
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include <scl/scl_retdefs.h>
+
+#include <backend/software/asymmetric/ecc/soft_ecc_p521.h>
+
+/*! @brief mask of a limb */
+#define SOFT_ECC_P521_LIMB_MASK                                                \
+    (((soft_ecc_p521_limb_t)1 << SOFT_ECC_P521_LIMB_BITS) - 1)
+/*! @brief mask of the top limb (2^521 = 1 mod p) */
+#define SOFT_ECC_P521_TOP_MASK                                                 \
+    (((soft_ecc_p521_limb_t)1 << (SOFT_ECC_P521_LIMB_BITS - 1)) - 1)
+/*! @brief index of the top limb */
+#define SOFT_ECC_P521_TOP (SOFT_ECC_P521_NB_LIMBS - 1)
+
+void soft_ecc_p521_from_bignum(const uint64_t *const in,
+                               soft_ecc_p521_fe_t *const out)
+{
+    const uint32_t *in_32 = (const uint32_t *)in;
+    soft_ecc_p521_dlimb_t acc = 0;
+    size_t acc_bits = 0;
+    size_t i, w = 0;
+
+    for (i = 0; i < SOFT_ECC_P521_NB_LIMBS; i++)
+    {
+        while ((acc_bits < SOFT_ECC_P521_LIMB_BITS) &&
+               (w < ECC_SECP521R1_32B_WORDS_SIZE))
+        {
+            acc |= (soft_ecc_p521_dlimb_t)in_32[w] << acc_bits;
+            acc_bits += sizeof(uint32_t) * 8;
+            w++;
+        }
+
+        out->limbs[i] = (soft_ecc_p521_limb_t)acc & SOFT_ECC_P521_LIMB_MASK;
+        acc >>= SOFT_ECC_P521_LIMB_BITS;
+        acc_bits -= SOFT_ECC_P521_LIMB_BITS;
+    }
+
+    /* bits above 2^521 */
+    out->limbs[SOFT_ECC_P521_TOP] &= SOFT_ECC_P521_TOP_MASK;
+}
+
+void soft_ecc_p521_carry(soft_ecc_p521_fe_t *const a)
+{
+    size_t i;
+    soft_ecc_p521_limb_t c = 0;
+
+    for (i = 0; i < SOFT_ECC_P521_TOP; i++)
+    {
+        a->limbs[i] += c;
+        c = a->limbs[i] >> SOFT_ECC_P521_LIMB_BITS;
+        a->limbs[i] &= SOFT_ECC_P521_LIMB_MASK;
+    }
+
+    a->limbs[SOFT_ECC_P521_TOP] += c;
+    c = a->limbs[SOFT_ECC_P521_TOP] >> (SOFT_ECC_P521_LIMB_BITS - 1);
+    a->limbs[SOFT_ECC_P521_TOP] &= SOFT_ECC_P521_TOP_MASK;
+
+    /* 2^521 = 1 mod p */
+    a->limbs[0] += c;
+}
+
+void soft_ecc_p521_to_bignum(const soft_ecc_p521_fe_t *const in,
+                             uint64_t *const out)
+{
+    soft_ecc_p521_fe_t t;
+    soft_ecc_p521_fe_t u;
+    soft_ecc_p521_limb_t c, mask;
+    soft_ecc_p521_dlimb_t acc = 0;
+    size_t acc_bits = 0;
+    size_t i, w = 0;
+    uint32_t *out_32 = (uint32_t *)out;
+
+    /* after two passes, t < 2^521 + 2^LIMB_BITS < 2.p */
+    t = *in;
+    soft_ecc_p521_carry(&t);
+    soft_ecc_p521_carry(&t);
+
+    /* strict carry, without the wrap of soft_ecc_p521_carry() */
+    for (i = 0; i < SOFT_ECC_P521_TOP; i++)
+    {
+        t.limbs[i + 1] += t.limbs[i] >> SOFT_ECC_P521_LIMB_BITS;
+        t.limbs[i] &= SOFT_ECC_P521_LIMB_MASK;
+    }
+
+    /* u = t + 1 - 2^521 = t - p, kept when t + 1 reaches 2^521 */
+    c = 1;
+    for (i = 0; i < SOFT_ECC_P521_TOP; i++)
+    {
+        u.limbs[i] = t.limbs[i] + c;
+        c = u.limbs[i] >> SOFT_ECC_P521_LIMB_BITS;
+        u.limbs[i] &= SOFT_ECC_P521_LIMB_MASK;
+    }
+    u.limbs[SOFT_ECC_P521_TOP] = t.limbs[SOFT_ECC_P521_TOP] + c;
+
+    mask = (soft_ecc_p521_limb_t)0 -
+           (u.limbs[SOFT_ECC_P521_TOP] >> (SOFT_ECC_P521_LIMB_BITS - 1));
+    u.limbs[SOFT_ECC_P521_TOP] &= SOFT_ECC_P521_TOP_MASK;
+
+    for (i = 0; i < SOFT_ECC_P521_NB_LIMBS; i++)
+    {
+        t.limbs[i] = (u.limbs[i] & mask) | (t.limbs[i] & ~mask);
+    }
+
+    for (i = 0; i < SOFT_ECC_P521_NB_LIMBS; i++)
+    {
+        acc |= (soft_ecc_p521_dlimb_t)t.limbs[i] << acc_bits;
+        acc_bits += SOFT_ECC_P521_LIMB_BITS;
+
+        while ((acc_bits >= sizeof(uint32_t) * 8) &&
+               (w < ECC_SECP521R1_32B_WORDS_SIZE))
+        {
+            out_32[w] = (uint32_t)acc;
+            acc >>= sizeof(uint32_t) * 8;
+            acc_bits -= sizeof(uint32_t) * 8;
+            w++;
+        }
+    }
+
+    /* last, partial, word */
+    if (w < ECC_SECP521R1_32B_WORDS_SIZE)
+    {
+        out_32[w] = (uint32_t)acc;
+    }
+}
+
+void soft_ecc_p521_add(const soft_ecc_p521_fe_t *const a,
+                       const soft_ecc_p521_fe_t *const b,
+                       soft_ecc_p521_fe_t *const out)
+{
+    size_t i;
+
+    for (i = 0; i < SOFT_ECC_P521_NB_LIMBS; i++)
+    {
+        out->limbs[i] = a->limbs[i] + b->limbs[i];
+    }
+
+#if __riscv_xlen == 32
+    /* no room for lazy carries in the 32 bits products */
+    soft_ecc_p521_carry(out);
+#endif /* __riscv_xlen */
+}
+
+void soft_ecc_p521_sub(const soft_ecc_p521_fe_t *const a,
+                       const soft_ecc_p521_fe_t *const b,
+                       soft_ecc_p521_fe_t *const out)
+{
+    size_t i;
+
+    /* 4.p limb by limb, every limb of b is lower */
+    for (i = 0; i < SOFT_ECC_P521_TOP; i++)
+    {
+        out->limbs[i] =
+            a->limbs[i] + (SOFT_ECC_P521_LIMB_MASK << 2) - b->limbs[i];
+    }
+    out->limbs[SOFT_ECC_P521_TOP] = a->limbs[SOFT_ECC_P521_TOP] +
+                                    (SOFT_ECC_P521_TOP_MASK << 2) -
+                                    b->limbs[SOFT_ECC_P521_TOP];
+
+#if __riscv_xlen == 32
+    /* no room for lazy carries in the 32 bits products */
+    soft_ecc_p521_carry(out);
+#endif /* __riscv_xlen */
+}
+
+/**
+ * @brief fold the product limbs above 2^522 (2^522 = 2 mod p) and propagate
+ * the carries
+ *
+ * @param[in,out] t     2 * SOFT_ECC_P521_NB_LIMBS - 1 product limbs
+ * @param[out] out      carried field element
+ */
+static void soft_ecc_p521_reduce(soft_ecc_p521_dlimb_t *const t,
+                                 soft_ecc_p521_fe_t *const out)
+{
+    size_t i;
+    soft_ecc_p521_dlimb_t c = 0;
+
+    for (i = 0; i < SOFT_ECC_P521_TOP; i++)
+    {
+        t[i] += t[i + SOFT_ECC_P521_NB_LIMBS] << 1;
+    }
+
+    for (i = 0; i < SOFT_ECC_P521_TOP; i++)
+    {
+        t[i] += c;
+        out->limbs[i] = (soft_ecc_p521_limb_t)t[i] & SOFT_ECC_P521_LIMB_MASK;
+        c = t[i] >> SOFT_ECC_P521_LIMB_BITS;
+    }
+
+    t[SOFT_ECC_P521_TOP] += c;
+    out->limbs[SOFT_ECC_P521_TOP] =
+        (soft_ecc_p521_limb_t)t[SOFT_ECC_P521_TOP] & SOFT_ECC_P521_TOP_MASK;
+    c = t[SOFT_ECC_P521_TOP] >> (SOFT_ECC_P521_LIMB_BITS - 1);
+
+    /* 2^521 = 1 mod p, the carry may still be wider than a limb */
+    c += out->limbs[0];
+    out->limbs[0] = (soft_ecc_p521_limb_t)c & SOFT_ECC_P521_LIMB_MASK;
+    out->limbs[1] += (soft_ecc_p521_limb_t)(c >> SOFT_ECC_P521_LIMB_BITS);
+}
+
+void soft_ecc_p521_mult(const soft_ecc_p521_fe_t *const a,
+                        const soft_ecc_p521_fe_t *const b,
+                        soft_ecc_p521_fe_t *const out)
+{
+    size_t i, j;
+    soft_ecc_p521_dlimb_t t[2 * SOFT_ECC_P521_NB_LIMBS - 1];
+
+    memset(t, 0, sizeof(t));
+
+    for (i = 0; i < SOFT_ECC_P521_NB_LIMBS; i++)
+    {
+        for (j = 0; j < SOFT_ECC_P521_NB_LIMBS; j++)
+        {
+            t[i + j] += (soft_ecc_p521_dlimb_t)a->limbs[i] * b->limbs[j];
+        }
+    }
+
+    soft_ecc_p521_reduce(t, out);
+}
+
+void soft_ecc_p521_square(const soft_ecc_p521_fe_t *const a,
+                          soft_ecc_p521_fe_t *const out)
+{
+    size_t i, j;
+    soft_ecc_p521_dlimb_t t[2 * SOFT_ECC_P521_NB_LIMBS - 1];
+    soft_ecc_p521_limb_t a2;
+
+    memset(t, 0, sizeof(t));
+
+    for (i = 0; i < SOFT_ECC_P521_NB_LIMBS; i++)
+    {
+        t[2 * i] += (soft_ecc_p521_dlimb_t)a->limbs[i] * a->limbs[i];
+
+        /* cross products are counted twice */
+        a2 = a->limbs[i] << 1;
+        for (j = i + 1; j < SOFT_ECC_P521_NB_LIMBS; j++)
+        {
+            t[i + j] += (soft_ecc_p521_dlimb_t)a2 * a->limbs[j];
+        }
+    }
+
+    soft_ecc_p521_reduce(t, out);
+}
+
+/**
+ * @brief n successive squarings
+ *
+ * @param[in] a         operand
+ * @param[in] n         number of squarings (> 0)
+ * @param[out] out      a^(2^n)
+ */
+static void soft_ecc_p521_square_n(const soft_ecc_p521_fe_t *const a, size_t n,
+                                   soft_ecc_p521_fe_t *const out)
+{
+    size_t i;
+
+    soft_ecc_p521_square(a, out);
+    for (i = 1; i < n; i++)
+    {
+        soft_ecc_p521_square(out, out);
+    }
+}
+
+void soft_ecc_p521_inv(const soft_ecc_p521_fe_t *const a,
+                       soft_ecc_p521_fe_t *const out)
+{
+    soft_ecc_p521_fe_t x1, x2, x3, x7, xn, t;
+    size_t n;
+
+    /* xn = a^(2^n - 1) */
+    x1 = *a;
+
+    soft_ecc_p521_square(&x1, &t);
+    soft_ecc_p521_mult(&t, &x1, &x2);
+
+    soft_ecc_p521_square(&x2, &t);
+    soft_ecc_p521_mult(&t, &x1, &x3);
+
+    soft_ecc_p521_square_n(&x2, 2, &t);
+    soft_ecc_p521_mult(&t, &x2, &xn);
+
+    soft_ecc_p521_square_n(&xn, 3, &t);
+    soft_ecc_p521_mult(&t, &x3, &x7);
+
+    /* x4 to x512 */
+    for (n = 4; n < 512; n <<= 1)
+    {
+        soft_ecc_p521_square_n(&xn, n, &t);
+        soft_ecc_p521_mult(&t, &xn, &xn);
+    }
+
+    /* x519 */
+    soft_ecc_p521_square_n(&xn, 7, &t);
+    soft_ecc_p521_mult(&t, &x7, &xn);
+
+    /* p - 2 = 2^521 - 3 = (2^519 - 1).2^2 + 1 */
+    soft_ecc_p521_square_n(&xn, 2, &t);
+    soft_ecc_p521_mult(&t, &x1, out);
+}
+
+void soft_ecc_p521_sqrt(const soft_ecc_p521_fe_t *const a,
+                        soft_ecc_p521_fe_t *const out)
+{
+    /* (p + 1) / 4 = 2^519 */
+    soft_ecc_p521_square_n(a, 519, out);
+}
+
+void soft_ecc_p521_double_jacobian(const ecc_bignum_jacobian_point_t *const in,
+                                   ecc_bignum_jacobian_point_t *const out)
+{
+    soft_ecc_p521_fe_t x, y, z;
+    soft_ecc_p521_fe_t delta, gamma, beta, alpha, t1, t2;
+
+    soft_ecc_p521_from_bignum(in->x, &x);
+    soft_ecc_p521_from_bignum(in->y, &y);
+    soft_ecc_p521_from_bignum(in->z, &z);
+
+    /* delta = Z1^2, gamma = Y1^2, beta = X1 * gamma */
+    soft_ecc_p521_square(&z, &delta);
+    soft_ecc_p521_square(&y, &gamma);
+    soft_ecc_p521_mult(&x, &gamma, &beta);
+
+    /* alpha = 3 * (X1 - delta) * (X1 + delta) */
+    soft_ecc_p521_sub(&x, &delta, &t1);
+    soft_ecc_p521_add(&x, &delta, &t2);
+    soft_ecc_p521_mult(&t1, &t2, &t1);
+    soft_ecc_p521_add(&t1, &t1, &alpha);
+    soft_ecc_p521_add(&alpha, &t1, &alpha);
+
+    /* Z3 = (Y1 + Z1)^2 - gamma - delta */
+    soft_ecc_p521_add(&y, &z, &t1);
+    soft_ecc_p521_square(&t1, &t1);
+    soft_ecc_p521_sub(&t1, &gamma, &t1);
+    soft_ecc_p521_sub(&t1, &delta, &z);
+
+    /* X3 = alpha^2 - 8 * beta */
+    soft_ecc_p521_add(&beta, &beta, &beta);
+    soft_ecc_p521_add(&beta, &beta, &beta);
+    soft_ecc_p521_carry(&beta);
+    soft_ecc_p521_add(&beta, &beta, &t2);
+    soft_ecc_p521_square(&alpha, &t1);
+    soft_ecc_p521_sub(&t1, &t2, &x);
+    soft_ecc_p521_carry(&x);
+
+    /* Y3 = alpha * (4 * beta - X3) - 8 * gamma^2 */
+    soft_ecc_p521_sub(&beta, &x, &t1);
+    soft_ecc_p521_mult(&alpha, &t1, &t1);
+    soft_ecc_p521_square(&gamma, &t2);
+    soft_ecc_p521_add(&t2, &t2, &t2);
+    soft_ecc_p521_add(&t2, &t2, &t2);
+    soft_ecc_p521_carry(&t2);
+    soft_ecc_p521_add(&t2, &t2, &t2);
+    soft_ecc_p521_sub(&t1, &t2, &y);
+
+    soft_ecc_p521_to_bignum(&x, out->x);
+    soft_ecc_p521_to_bignum(&y, out->y);
+    soft_ecc_p521_to_bignum(&z, out->z);
+}
+
+void soft_ecc_p521_add_jacobian_jacobian(
+    const ecc_bignum_jacobian_point_t *const in_a,
+    const ecc_bignum_jacobian_point_t *const in_b,
+    ecc_bignum_jacobian_point_t *const out)
+{
+    soft_ecc_p521_fe_t x1, y1, z1, x2, y2, z2;
+    soft_ecc_p521_fe_t a, b, c, d, t1, t2;
+
+    soft_ecc_p521_from_bignum(in_a->x, &x1);
+    soft_ecc_p521_from_bignum(in_a->y, &y1);
+    soft_ecc_p521_from_bignum(in_a->z, &z1);
+    soft_ecc_p521_from_bignum(in_b->x, &x2);
+    soft_ecc_p521_from_bignum(in_b->y, &y2);
+    soft_ecc_p521_from_bignum(in_b->z, &z2);
+
+    /* a = X1 * Z2^2, b = Y1 * Z2^3 */
+    soft_ecc_p521_square(&z2, &t1);
+    soft_ecc_p521_mult(&x1, &t1, &a);
+    soft_ecc_p521_mult(&t1, &z2, &t1);
+    soft_ecc_p521_mult(&y1, &t1, &b);
+
+    /* c = X2 * Z1^2 - a, d = Y2 * Z1^3 - b */
+    soft_ecc_p521_square(&z1, &t1);
+    soft_ecc_p521_mult(&x2, &t1, &c);
+    soft_ecc_p521_sub(&c, &a, &c);
+    soft_ecc_p521_mult(&t1, &z1, &t1);
+    soft_ecc_p521_mult(&y2, &t1, &d);
+    soft_ecc_p521_sub(&d, &b, &d);
+
+    /* t2 = a * c^2, t1 = c^3 */
+    soft_ecc_p521_square(&c, &t1);
+    soft_ecc_p521_mult(&a, &t1, &t2);
+    soft_ecc_p521_mult(&c, &t1, &t1);
+
+    /* Z3 = Z1 * Z2 * c */
+    soft_ecc_p521_mult(&z1, &z2, &z1);
+    soft_ecc_p521_mult(&z1, &c, &z1);
+
+    /* X3 = d^2 - c^3 - 2 * a * c^2 */
+    soft_ecc_p521_square(&d, &x1);
+    soft_ecc_p521_sub(&x1, &t1, &x1);
+    soft_ecc_p521_add(&t2, &t2, &a);
+    soft_ecc_p521_sub(&x1, &a, &x1);
+    soft_ecc_p521_carry(&x1);
+
+    /* Y3 = d * (a * c^2 - X3) - b * c^3 */
+    soft_ecc_p521_sub(&t2, &x1, &t2);
+    soft_ecc_p521_mult(&d, &t2, &t2);
+    soft_ecc_p521_mult(&b, &t1, &t1);
+    soft_ecc_p521_sub(&t2, &t1, &y1);
+
+    soft_ecc_p521_to_bignum(&x1, out->x);
+    soft_ecc_p521_to_bignum(&y1, out->y);
+    soft_ecc_p521_to_bignum(&z1, out->z);
+}
+
+int32_t
+soft_ecc_p521_jacobian_to_affine(const ecc_bignum_jacobian_point_t *const in,
+                                 ecc_bignum_affine_point_t *const out)
+{
+    soft_ecc_p521_fe_t z_inv, z_inv2, t;
+    uint32_t z[ECC_SECP521R1_32B_WORDS_SIZE] __attribute__((aligned(8)));
+    uint32_t acc = 0;
+    size_t i;
+
+    /* the point at the infinite has no affine coordinates */
+    soft_ecc_p521_from_bignum(in->z, &t);
+    soft_ecc_p521_to_bignum(&t, (uint64_t *)z);
+    for (i = 0; i < ECC_SECP521R1_32B_WORDS_SIZE; i++)
+    {
+        acc |= z[i];
+    }
+
+    if (0 == acc)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    soft_ecc_p521_inv(&t, &z_inv);
+
+    /* x:y:z corresponds to x/z^2:y/z^3 */
+    soft_ecc_p521_square(&z_inv, &z_inv2);
+    soft_ecc_p521_from_bignum(in->x, &t);
+    soft_ecc_p521_mult(&t, &z_inv2, &t);
+    soft_ecc_p521_to_bignum(&t, out->x);
+
+    soft_ecc_p521_mult(&z_inv2, &z_inv, &z_inv2);
+    soft_ecc_p521_from_bignum(in->y, &t);
+    soft_ecc_p521_mult(&t, &z_inv2, &t);
+    soft_ecc_p521_to_bignum(&t, out->y);
+
+    return (SCL_OK);
+}
+
+void soft_ecc_p521_xycz_add(const ecc_bignum_affine_const_point_t *const in1,
+                            const ecc_bignum_affine_const_point_t *const in2,
+                            ecc_bignum_affine_point_t *const out1,
+                            ecc_bignum_affine_point_t *const out2)
+{
+    soft_ecc_p521_fe_t x1, y1, x2, y2, a, t;
+
+    soft_ecc_p521_from_bignum(in1->x, &x1);
+    soft_ecc_p521_from_bignum(in1->y, &y1);
+    soft_ecc_p521_from_bignum(in2->x, &x2);
+    soft_ecc_p521_from_bignum(in2->y, &y2);
+
+    /* A = (X2 - X1)^2, B = X1 * A, C = X2 * A */
+    soft_ecc_p521_sub(&x2, &x1, &a);
+    soft_ecc_p521_square(&a, &a);
+    soft_ecc_p521_mult(&x1, &a, &x1);
+    soft_ecc_p521_mult(&x2, &a, &x2);
+
+    /* Y2 - Y1, Y1' = Y1 * (C - B) */
+    soft_ecc_p521_sub(&y2, &y1, &y2);
+    soft_ecc_p521_sub(&x2, &x1, &t);
+    soft_ecc_p521_mult(&y1, &t, &y1);
+
+    /* X3 = (Y2 - Y1)^2 - B - C */
+    soft_ecc_p521_square(&y2, &a);
+    soft_ecc_p521_sub(&a, &x1, &a);
+    soft_ecc_p521_sub(&a, &x2, &a);
+    soft_ecc_p521_carry(&a);
+
+    /* Y3 = (Y2 - Y1) * (B - X3) - Y1' */
+    soft_ecc_p521_sub(&x1, &a, &t);
+    soft_ecc_p521_mult(&y2, &t, &t);
+    soft_ecc_p521_sub(&t, &y1, &t);
+
+    soft_ecc_p521_to_bignum(&a, out1->x);
+    soft_ecc_p521_to_bignum(&t, out1->y);
+    soft_ecc_p521_to_bignum(&x1, out2->x);
+    soft_ecc_p521_to_bignum(&y1, out2->y);
+}
+
+void soft_ecc_p521_xycz_addc(const ecc_bignum_affine_const_point_t *const in1,
+                             const ecc_bignum_affine_const_point_t *const in2,
+                             ecc_bignum_affine_point_t *const out1,
+                             ecc_bignum_affine_point_t *const out2)
+{
+    soft_ecc_p521_fe_t x1, y1, x2, y2, a, s, bc, t;
+
+    soft_ecc_p521_from_bignum(in1->x, &x1);
+    soft_ecc_p521_from_bignum(in1->y, &y1);
+    soft_ecc_p521_from_bignum(in2->x, &x2);
+    soft_ecc_p521_from_bignum(in2->y, &y2);
+
+    /* A = (X2 - X1)^2, B = X1 * A, C = X2 * A */
+    soft_ecc_p521_sub(&x2, &x1, &a);
+    soft_ecc_p521_square(&a, &a);
+    soft_ecc_p521_mult(&x1, &a, &x1);
+    soft_ecc_p521_mult(&x2, &a, &x2);
+
+    /* Y1 + Y2, Y2 - Y1, Y1' = Y1 * (C - B), B + C */
+    soft_ecc_p521_add(&y2, &y1, &s);
+    soft_ecc_p521_sub(&y2, &y1, &y2);
+    soft_ecc_p521_sub(&x2, &x1, &t);
+    soft_ecc_p521_mult(&y1, &t, &y1);
+    soft_ecc_p521_add(&x2, &x1, &bc);
+
+    /* X3 = (Y2 - Y1)^2 - B - C */
+    soft_ecc_p521_square(&y2, &a);
+    soft_ecc_p521_sub(&a, &bc, &a);
+    soft_ecc_p521_carry(&a);
+
+    /* Y3 = (Y2 - Y1) * (B - X3) - Y1' */
+    soft_ecc_p521_sub(&x1, &a, &t);
+    soft_ecc_p521_mult(&y2, &t, &t);
+    soft_ecc_p521_sub(&t, &y1, &t);
+
+    /* X3' = (Y1 + Y2)^2 - B - C */
+    soft_ecc_p521_square(&s, &x2);
+    soft_ecc_p521_sub(&x2, &bc, &x2);
+
+    /* Y3' = (Y1 + Y2) * (X3' - B) - Y1' */
+    soft_ecc_p521_sub(&x2, &x1, &y2);
+    soft_ecc_p521_mult(&y2, &s, &y2);
+    soft_ecc_p521_sub(&y2, &y1, &y2);
+
+    soft_ecc_p521_to_bignum(&a, out1->x);
+    soft_ecc_p521_to_bignum(&t, out1->y);
+    soft_ecc_p521_to_bignum(&x2, out2->x);
+    soft_ecc_p521_to_bignum(&y2, out2->y);
+}
+
+void soft_ecc_p521_xycz_idbl(const ecc_bignum_affine_const_point_t *const in,
+                             ecc_bignum_affine_point_t *const out1,
+                             ecc_bignum_affine_point_t *const out2)
+{
+    soft_ecc_p521_fe_t x, y, a, b, t, one;
+
+    soft_ecc_p521_from_bignum(in->x, &x);
+    soft_ecc_p521_from_bignum(in->y, &y);
+
+    memset(&one, 0, sizeof(one));
+    one.limbs[0] = 1;
+
+    /* B = 3 * x1^2 + a = 3 * (x1^2 - 1) */
+    soft_ecc_p521_square(&x, &t);
+    soft_ecc_p521_sub(&t, &one, &t);
+    soft_ecc_p521_carry(&t);
+    soft_ecc_p521_add(&t, &t, &b);
+    soft_ecc_p521_add(&b, &t, &b);
+
+    /* A = 4 * x1 * y1^2 = X1' */
+    soft_ecc_p521_square(&y, &y);
+    soft_ecc_p521_add(&y, &y, &y);
+    soft_ecc_p521_add(&y, &y, &a);
+    soft_ecc_p521_mult(&a, &x, &a);
+
+    /* X2 = B^2 - 2 * A */
+    soft_ecc_p521_square(&b, &x);
+    soft_ecc_p521_sub(&x, &a, &x);
+    soft_ecc_p521_sub(&x, &a, &x);
+    soft_ecc_p521_carry(&x);
+
+    /* Y1' = 8 * y1^4, Y2 = B * (A - X2) - Y1' */
+    soft_ecc_p521_sub(&a, &x, &t);
+    soft_ecc_p521_mult(&t, &b, &t);
+    soft_ecc_p521_square(&y, &y);
+    soft_ecc_p521_add(&y, &y, &y);
+    soft_ecc_p521_sub(&t, &y, &t);
+
+    soft_ecc_p521_to_bignum(&x, out1->x);
+    soft_ecc_p521_to_bignum(&t, out1->y);
+    soft_ecc_p521_to_bignum(&a, out2->x);
+    soft_ecc_p521_to_bignum(&y, out2->y);
+}
+
+/**
+ * @brief numerator and denominator of x(2.R), see soft_ecc_xz_double():
+ * dbl = (X^2 - ta)^2 - 4tb.X and v = 4X(X^2 + ta) + 2tb
+ *
+ * @param[in] x         X-coordinate of the point to double
+ * @param[in] ta        a.Z^4
+ * @param[in] tb        2b.Z^6
+ * @param[out] dbl      numerator, carried
+ * @param[out] v        denominator, carried
+ */
+static void soft_ecc_p521_xz_double(const soft_ecc_p521_fe_t *const x,
+                                    const soft_ecc_p521_fe_t *const ta,
+                                    const soft_ecc_p521_fe_t *const tb,
+                                    soft_ecc_p521_fe_t *const dbl,
+                                    soft_ecc_p521_fe_t *const v)
+{
+    soft_ecc_p521_fe_t t;
+
+    /* v = 4X(X^2 + ta) + 2tb */
+    soft_ecc_p521_square(x, dbl);
+    soft_ecc_p521_add(dbl, ta, v);
+    soft_ecc_p521_mult(x, v, v);
+    soft_ecc_p521_add(v, v, v);
+    soft_ecc_p521_add(v, tb, v);
+    soft_ecc_p521_carry(v);
+    soft_ecc_p521_add(v, v, v);
+    soft_ecc_p521_carry(v);
+
+    /* dbl = (X^2 - ta)^2 - 4tb.X */
+    soft_ecc_p521_sub(dbl, ta, dbl);
+    soft_ecc_p521_square(dbl, dbl);
+    soft_ecc_p521_mult(tb, x, &t);
+    soft_ecc_p521_add(&t, &t, &t);
+    soft_ecc_p521_add(&t, &t, &t);
+    soft_ecc_p521_carry(&t);
+    soft_ecc_p521_sub(dbl, &t, dbl);
+    soft_ecc_p521_carry(dbl);
+}
+
+/**
+ * @brief bring w, xd, ta and tb to the new common Z'^2 = Z^2.s
+ *
+ * @param[in,out] w     Z^2
+ * @param[in,out] xd    x(R1 - R0).Z^2
+ * @param[in,out] ta    a.Z^4
+ * @param[in,out] tb    2b.Z^6
+ * @param[in] s         Z'^2 / Z^2
+ */
+static void soft_ecc_p521_xz_update(soft_ecc_p521_fe_t *const w,
+                                    soft_ecc_p521_fe_t *const xd,
+                                    soft_ecc_p521_fe_t *const ta,
+                                    soft_ecc_p521_fe_t *const tb,
+                                    const soft_ecc_p521_fe_t *const s)
+{
+    soft_ecc_p521_fe_t t;
+
+    soft_ecc_p521_mult(w, s, w);
+    soft_ecc_p521_mult(xd, s, xd);
+    soft_ecc_p521_square(s, &t);
+    soft_ecc_p521_mult(ta, &t, ta);
+    soft_ecc_p521_mult(&t, s, &t);
+    soft_ecc_p521_mult(tb, &t, tb);
+}
+
+void soft_ecc_p521_xz_start(const uint64_t *const x, const uint64_t *const a,
+                            const uint64_t *const b,
+                            uint64_t *const reg[SOFT_ECC_XZ_NB_REGS])
+{
+    soft_ecc_p521_fe_t x0, x1, w, xd, ta, tb, v;
+
+    /* R0 = P at Z = 1: X0 = xd = x(P), w = 1, ta = a, tb = 2b */
+    soft_ecc_p521_from_bignum(x, &x0);
+    soft_ecc_p521_from_bignum(a, &ta);
+    soft_ecc_p521_from_bignum(b, &tb);
+    soft_ecc_p521_add(&tb, &tb, &tb);
+    soft_ecc_p521_carry(&tb);
+    xd = x0;
+    memset(&w, 0, sizeof(w));
+    w.limbs[0] = 1;
+
+    /* R1 = 2.P, then R0 is brought to the common Z^2 = v */
+    soft_ecc_p521_xz_double(&x0, &ta, &tb, &x1, &v);
+    soft_ecc_p521_mult(&x0, &v, &x0);
+    soft_ecc_p521_xz_update(&w, &xd, &ta, &tb, &v);
+
+    soft_ecc_p521_to_bignum(&x0, reg[SOFT_ECC_XZ_X0]);
+    soft_ecc_p521_to_bignum(&x1, reg[SOFT_ECC_XZ_X1]);
+    soft_ecc_p521_to_bignum(&w, reg[SOFT_ECC_XZ_W]);
+    soft_ecc_p521_to_bignum(&xd, reg[SOFT_ECC_XZ_XD]);
+    soft_ecc_p521_to_bignum(&ta, reg[SOFT_ECC_XZ_TA]);
+    soft_ecc_p521_to_bignum(&tb, reg[SOFT_ECC_XZ_TB]);
+}
+
+void soft_ecc_p521_xz_iteration(uint64_t *const reg[SOFT_ECC_XZ_NB_REGS])
+{
+    soft_ecc_p521_fe_t x0, x1, w, xd, ta, tb;
+    soft_ecc_p521_fe_t u, v, sum, dbl, t;
+
+    soft_ecc_p521_from_bignum(reg[SOFT_ECC_XZ_X0], &x0);
+    soft_ecc_p521_from_bignum(reg[SOFT_ECC_XZ_X1], &x1);
+    soft_ecc_p521_from_bignum(reg[SOFT_ECC_XZ_W], &w);
+    soft_ecc_p521_from_bignum(reg[SOFT_ECC_XZ_XD], &xd);
+    soft_ecc_p521_from_bignum(reg[SOFT_ECC_XZ_TA], &ta);
+    soft_ecc_p521_from_bignum(reg[SOFT_ECC_XZ_TB], &tb);
+
+    /* u = (X0 - X1)^2 */
+    soft_ecc_p521_sub(&x0, &x1, &u);
+    soft_ecc_p521_square(&u, &u);
+
+    /* sum = 2((X0 + X1)(X0.X1 + ta) + tb) - xd.u */
+    soft_ecc_p521_mult(&x0, &x1, &sum);
+    soft_ecc_p521_add(&sum, &ta, &sum);
+    soft_ecc_p521_add(&x0, &x1, &t);
+    soft_ecc_p521_mult(&sum, &t, &sum);
+    soft_ecc_p521_add(&sum, &tb, &sum);
+    soft_ecc_p521_carry(&sum);
+    soft_ecc_p521_add(&sum, &sum, &sum);
+    soft_ecc_p521_mult(&xd, &u, &t);
+    soft_ecc_p521_sub(&sum, &t, &sum);
+    soft_ecc_p521_carry(&sum);
+
+    /* x(2.R0) = dbl / (Z^2.v) */
+    soft_ecc_p521_xz_double(&x0, &ta, &tb, &dbl, &v);
+
+    /* X0 = dbl.u, X1 = sum.v at Z'^2 = Z^2.u.v */
+    soft_ecc_p521_mult(&dbl, &u, &x0);
+    soft_ecc_p521_mult(&sum, &v, &x1);
+    soft_ecc_p521_mult(&u, &v, &u);
+    soft_ecc_p521_xz_update(&w, &xd, &ta, &tb, &u);
+
+    soft_ecc_p521_to_bignum(&x0, reg[SOFT_ECC_XZ_X0]);
+    soft_ecc_p521_to_bignum(&x1, reg[SOFT_ECC_XZ_X1]);
+    soft_ecc_p521_to_bignum(&w, reg[SOFT_ECC_XZ_W]);
+    soft_ecc_p521_to_bignum(&xd, reg[SOFT_ECC_XZ_XD]);
+    soft_ecc_p521_to_bignum(&ta, reg[SOFT_ECC_XZ_TA]);
+    soft_ecc_p521_to_bignum(&tb, reg[SOFT_ECC_XZ_TB]);
+}
+
+void soft_ecc_p521_xz_affine(uint64_t *const reg[SOFT_ECC_XZ_NB_REGS],
+                             uint64_t *const x)
+{
+    soft_ecc_p521_fe_t x0, w;
+
+    soft_ecc_p521_from_bignum(reg[SOFT_ECC_XZ_X0], &x0);
+    soft_ecc_p521_from_bignum(reg[SOFT_ECC_XZ_W], &w);
+
+    soft_ecc_p521_inv(&w, &w);
+    soft_ecc_p521_mult(&x0, &w, &x0);
+
+    soft_ecc_p521_to_bignum(&x0, x);
+}
@@ -0,0 +1,314 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ * @file soft_ecc_scalar.c
+ * @brief software arithmetic modulo the ECC curve order n
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#include <limits.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <scl/scl_retdefs.h>
+
+#include <backend/software/asymmetric/ecc/soft_ecc_scalar.h>
+
+/*! @brief inversion window width (in bits) */
+#define SOFT_ECC_SCALAR_INV_WINDOW 4
+/*! @brief inversion window table size */
+#define SOFT_ECC_SCALAR_INV_TABLE_SIZE (1 << SOFT_ECC_SCALAR_INV_WINDOW)
+
+/**
+ * @brief out = a - n if a >= n, a otherwise
+ * @details constant time, a is curve_wsize words plus a carry word
+ *
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] a             operand (curve_wsize words)
+ * @param[in] a_carry       a carry (0 or 1)
+ * @param[out] out          result (curve_wsize words)
+ */
+static void soft_ecc_scalar_final_sub(const ecc_curve_t *const curve_params,
+                                      const uint32_t *const a, uint32_t a_carry,
+                                      uint32_t *const out)
+{
+    const uint32_t *n = (const uint32_t *)curve_params->n;
+    uint32_t diff[curve_params->curve_wsize];
+    uint64_t borrow = 0;
+    uint32_t mask;
+    size_t i;
+
+    for (i = 0; i < curve_params->curve_wsize; i++)
+    {
+        borrow = (uint64_t)a[i] - n[i] - borrow;
+        diff[i] = (uint32_t)borrow;
+        borrow = (borrow >> (sizeof(uint32_t) * CHAR_BIT)) & 1;
+    }
+
+    /* keep the difference when there is a carry or no borrow */
+    mask = (uint32_t)0 - (uint32_t)((a_carry | (borrow ^ 1)) & 1);
+
+    for (i = 0; i < curve_params->curve_wsize; i++)
+    {
+        out[i] = (diff[i] & mask) | (a[i] & ~mask);
+    }
+
+    memset(diff, 0, sizeof(diff));
+}
+
+bool soft_ecc_scalar_supported(const ecc_curve_t *const curve_params)
+{
+    if ((NULL == curve_params) || (NULL == curve_params->n) ||
+        (NULL == curve_params->n_mont_r2) || (0 == curve_params->n_mont_n0))
+    {
+        return (false);
+    }
+
+    return (true);
+}
+
+void soft_ecc_scalar_mont_mult(const ecc_curve_t *const curve_params,
+                               const uint64_t *const a, const uint64_t *const b,
+                               uint64_t *const out)
+{
+    const uint32_t *a_32 = (const uint32_t *)a;
+    const uint32_t *b_32 = (const uint32_t *)b;
+    const uint32_t *n = (const uint32_t *)curve_params->n;
+    size_t s = curve_params->curve_wsize;
+    uint32_t t[s + 2];
+    uint64_t c;
+    uint32_t m;
+    size_t i, j;
+
+    memset(t, 0, sizeof(t));
+
+    /* CIOS (Coarsely Integrated Operand Scanning) */
+    for (i = 0; i < s; i++)
+    {
+        /* t = t + a.b[i] */
+        c = 0;
+        for (j = 0; j < s; j++)
+        {
+            c += (uint64_t)t[j] + (uint64_t)a_32[j] * b_32[i];
+            t[j] = (uint32_t)c;
+            c >>= sizeof(uint32_t) * CHAR_BIT;
+        }
+        c += t[s];
+        t[s] = (uint32_t)c;
+        t[s + 1] = (uint32_t)(c >> (sizeof(uint32_t) * CHAR_BIT));
+
+        /* t = (t + m.n) / 2^32 */
+        m = t[0] * curve_params->n_mont_n0;
+        c = (uint64_t)t[0] + (uint64_t)m * n[0];
+        c >>= sizeof(uint32_t) * CHAR_BIT;
+        for (j = 1; j < s; j++)
+        {
+            c += (uint64_t)t[j] + (uint64_t)m * n[j];
+            t[j - 1] = (uint32_t)c;
+            c >>= sizeof(uint32_t) * CHAR_BIT;
+        }
+        c += t[s];
+        t[s - 1] = (uint32_t)c;
+        t[s] = t[s + 1] + (uint32_t)(c >> (sizeof(uint32_t) * CHAR_BIT));
+    }
+
+    /* t < 2n */
+    soft_ecc_scalar_final_sub(curve_params, t, t[s], (uint32_t *)out);
+}
+
+void soft_ecc_scalar_mont_square(const ecc_curve_t *const curve_params,
+                                 const uint64_t *const a, uint64_t *const out)
+{
+    soft_ecc_scalar_mont_mult(curve_params, a, a, out);
+}
+
+void soft_ecc_scalar_to_mont(const ecc_curve_t *const curve_params,
+                             const uint64_t *const a, uint64_t *const out)
+{
+    /* R^2 mod n is lower than n, so a can take any value */
+    soft_ecc_scalar_mont_mult(curve_params, a, curve_params->n_mont_r2, out);
+}
+
+void soft_ecc_scalar_from_mont(const ecc_curve_t *const curve_params,
+                               const uint64_t *const a, uint64_t *const out)
+{
+    uint32_t one[curve_params->curve_wsize] __attribute__((aligned(8)));
+
+    memset(one, 0, sizeof(one));
+    one[0] = 1;
+
+    soft_ecc_scalar_mont_mult(curve_params, a, (uint64_t *)one, out);
+}
+
+void soft_ecc_scalar_reduce(const ecc_curve_t *const curve_params,
+                            const uint64_t *const a, uint64_t *const out)
+{
+    /* (a.R^(-1)).R^2.R^(-1) */
+    soft_ecc_scalar_from_mont(curve_params, a, out);
+    soft_ecc_scalar_mont_mult(curve_params, out, curve_params->n_mont_r2, out);
+}
+
+void soft_ecc_scalar_mult(const ecc_curve_t *const curve_params,
+                          const uint64_t *const a, const uint64_t *const b,
+                          uint64_t *const out)
+{
+    /* (a.b.R^(-1)).R^2.R^(-1) */
+    soft_ecc_scalar_mont_mult(curve_params, a, b, out);
+    soft_ecc_scalar_mont_mult(curve_params, out, curve_params->n_mont_r2, out);
+}
+
+void soft_ecc_scalar_add(const ecc_curve_t *const curve_params,
+                         const uint64_t *const a, const uint64_t *const b,
+                         uint64_t *const out)
+{
+    const uint32_t *a_32 = (const uint32_t *)a;
+    const uint32_t *b_32 = (const uint32_t *)b;
+    uint32_t sum[curve_params->curve_wsize];
+    uint64_t c = 0;
+    size_t i;
+
+    for (i = 0; i < curve_params->curve_wsize; i++)
+    {
+        c += (uint64_t)a_32[i] + b_32[i];
+        sum[i] = (uint32_t)c;
+        c >>= sizeof(uint32_t) * CHAR_BIT;
+    }
+
+    /* sum < 2n */
+    soft_ecc_scalar_final_sub(curve_params, sum, (uint32_t)c,
+                              (uint32_t *)out);
+}
+
+void soft_ecc_scalar_sub(const ecc_curve_t *const curve_params,
+                         const uint64_t *const a, const uint64_t *const b,
+                         uint64_t *const out)
+{
+    const uint32_t *a_32 = (const uint32_t *)a;
+    const uint32_t *b_32 = (const uint32_t *)b;
+    const uint32_t *n = (const uint32_t *)curve_params->n;
+    uint32_t *out_32 = (uint32_t *)out;
+    uint64_t borrow = 0;
+    uint64_t c = 0;
+    uint32_t mask;
+    size_t i;
+
+    for (i = 0; i < curve_params->curve_wsize; i++)
+    {
+        borrow = (uint64_t)a_32[i] - b_32[i] - borrow;
+        out_32[i] = (uint32_t)borrow;
+        borrow = (borrow >> (sizeof(uint32_t) * CHAR_BIT)) & 1;
+    }
+
+    /* add n back when a < b */
+    mask = (uint32_t)0 - (uint32_t)borrow;
+
+    for (i = 0; i < curve_params->curve_wsize; i++)
+    {
+        c += (uint64_t)out_32[i] + (n[i] & mask);
+        out_32[i] = (uint32_t)c;
+        c >>= sizeof(uint32_t) * CHAR_BIT;
+    }
+}
+
+int32_t soft_ecc_scalar_inv(const ecc_curve_t *const curve_params,
+                            const uint64_t *const a, uint64_t *const out)
+{
+    uint32_t table[SOFT_ECC_SCALAR_INV_TABLE_SIZE][curve_params->curve_wsize]
+        __attribute__((aligned(8)));
+    uint32_t exponent[curve_params->curve_wsize];
+    uint32_t acc[curve_params->curve_wsize] __attribute__((aligned(8)));
+    const uint32_t *n = (const uint32_t *)curve_params->n;
+    uint64_t borrow = 2;
+    uint32_t not_null = 0;
+    uint32_t window;
+    size_t i, j;
+
+    memset(table, 0, sizeof(table));
+
+    /* table[i] = a^i in Montgomery representation */
+    table[0][0] = 1;
+    soft_ecc_scalar_to_mont(curve_params, (uint64_t *)table[0],
+                            (uint64_t *)table[0]);
+    soft_ecc_scalar_to_mont(curve_params, a, (uint64_t *)table[1]);
+
+    for (i = 0; i < curve_params->curve_wsize; i++)
+    {
+        not_null |= table[1][i];
+    }
+
+    if (0 == not_null)
+    {
+        memset(table, 0, sizeof(table));
+        return (SCL_INVALID_INPUT);
+    }
+
+    for (i = 2; i < SOFT_ECC_SCALAR_INV_TABLE_SIZE; i++)
+    {
+        soft_ecc_scalar_mont_mult(curve_params, (uint64_t *)table[i - 1],
+                                  (uint64_t *)table[1], (uint64_t *)table[i]);
+    }
+
+    /* exponent = n - 2 */
+    for (i = 0; i < curve_params->curve_wsize; i++)
+    {
+        borrow = (uint64_t)n[i] - borrow;
+        exponent[i] = (uint32_t)borrow;
+        borrow = (borrow >> (sizeof(uint32_t) * CHAR_BIT)) & 1;
+    }
+
+    /**
+     * fixed window, left to right: the same squares and multiplications are
+     * performed whatever the value of a
+     */
+    memcpy(acc, table[0], sizeof(acc));
+
+    i = curve_params->curve_wsize * sizeof(uint32_t) * CHAR_BIT;
+    while (0 != i)
+    {
+        i -= SOFT_ECC_SCALAR_INV_WINDOW;
+
+        for (j = 0; j < SOFT_ECC_SCALAR_INV_WINDOW; j++)
+        {
+            soft_ecc_scalar_mont_square(curve_params, (uint64_t *)acc,
+                                        (uint64_t *)acc);
+        }
+
+        window = (exponent[i / (sizeof(uint32_t) * CHAR_BIT)] >>
+                  (i % (sizeof(uint32_t) * CHAR_BIT))) &
+                 (SOFT_ECC_SCALAR_INV_TABLE_SIZE - 1);
+
+        soft_ecc_scalar_mont_mult(curve_params, (uint64_t *)acc,
+                                  (uint64_t *)table[window], (uint64_t *)acc);
+    }
+
+    soft_ecc_scalar_from_mont(curve_params, (uint64_t *)acc, out);
+
+    memset(table, 0, sizeof(table));
+    memset(acc, 0, sizeof(acc));
+
+    return (SCL_OK);
+}
@@ -117,15 +117,22 @@ int32_t soft_ecdh(const metal_scl_t *const scl,
             return (result);
         }
 
-        result = soft_ecc_mult_coz(
+#if SOFT_ECC_X_ONLY_LADDER
+        /* only the x-coordinate makes the shared secret */
+        result = soft_ecc_mult_coz_x(
+            scl, curve_params, (ecc_bignum_affine_const_point_t *)&pub_key_bn,
+            (uint64_t *)priv_key_bn, curve_params->curve_wsize, shared_bn.x);
+#else
+        result = soft_ecc_mult_window(
             scl, curve_params, (ecc_bignum_affine_const_point_t *)&pub_key_bn,
             (uint64_t *)priv_key_bn, curve_params->curve_wsize, &shared_bn);
+#endif /* SOFT_ECC_X_ONLY_LADDER */
         if (SCL_OK != result)
         {
             return (result);
         }
 
-        copy_swap_array(shared_secret, (uint8_t *)shared_bn.x,
+        copy_swap_array(shared_secret, (uint8_t *)shared_x_bn,
                         curve_params->curve_bsize);
 
         *shared_secret_len = curve_params->curve_bsize;
@@ -133,3 +140,114 @@ int32_t soft_ecdh(const metal_scl_t *const scl,
 
     return (SCL_OK);
 }
+
+int32_t soft_ecdh_start(const metal_scl_t *const scl,
+                        ecc_ladder_ctx_t *const ctx,
+                        const ecc_curve_t *const curve_params,
+                        const uint8_t *const priv_key,
+                        const ecc_affine_const_point_t *const peer_pub_key)
+{
+    int32_t result;
+
+    if ((NULL == scl) || (NULL == ctx) || (NULL == curve_params) ||
+        (NULL == priv_key) || (NULL == peer_pub_key))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == peer_pub_key->x) || (NULL == peer_pub_key->y))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    /* Check curve length */
+    if ((ECDSA_MAX_32B_WORDSIZE < curve_params->curve_wsize) ||
+        (ECDSA_MIN_32B_WORDSIZE > curve_params->curve_wsize))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    {
+        uint32_t priv_key_bn[curve_params->curve_wsize]
+            __attribute__((aligned(8)));
+        uint32_t pub_key_x_bn[curve_params->curve_wsize]
+            __attribute__((aligned(8)));
+        uint32_t pub_key_y_bn[curve_params->curve_wsize]
+            __attribute__((aligned(8)));
+
+        ecc_bignum_affine_point_t pub_key_bn = {.x = (uint64_t *)pub_key_x_bn,
+                                                .y = (uint64_t *)pub_key_y_bn};
+
+        memset(priv_key_bn, 0, sizeof(priv_key_bn));
+        memset(pub_key_x_bn, 0, sizeof(pub_key_x_bn));
+        memset(pub_key_y_bn, 0, sizeof(pub_key_y_bn));
+
+        copy_swap_array((uint8_t *)priv_key_bn, priv_key,
+                        curve_params->curve_bsize);
+        copy_swap_array((uint8_t *)pub_key_x_bn, peer_pub_key->x,
+                        curve_params->curve_bsize);
+        copy_swap_array((uint8_t *)pub_key_y_bn, peer_pub_key->y,
+                        curve_params->curve_bsize);
+
+        result = soft_ecc_point_on_curve_internal(
+            scl, curve_params, (ecc_bignum_affine_const_point_t *)&pub_key_bn);
+        if (SCL_OK == result)
+        {
+            result = soft_ecc_ladder_start(
+                scl, ctx, curve_params,
+                (ecc_bignum_affine_const_point_t *)&pub_key_bn,
+                (uint64_t *)priv_key_bn, curve_params->curve_wsize);
+        }
+
+        memset(priv_key_bn, 0, sizeof(priv_key_bn));
+    }
+
+    return (result);
+}
+
+int32_t soft_ecdh_finish(const metal_scl_t *const scl,
+                         ecc_ladder_ctx_t *const ctx,
+                         uint8_t *const shared_secret,
+                         size_t *const shared_secret_len)
+{
+    int32_t result;
+    const ecc_curve_t *curve_params;
+
+    if ((NULL == scl) || (NULL == ctx) || (NULL == ctx->curve_params) ||
+        (NULL == shared_secret) || (NULL == shared_secret_len))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    /* ctx is zeroized by soft_ecc_ladder_finish() */
+    curve_params = ctx->curve_params;
+
+    if (curve_params->curve_bsize > *shared_secret_len)
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    {
+        uint32_t shared_x_bn[curve_params->curve_wsize]
+            __attribute__((aligned(8)));
+        uint32_t shared_y_bn[curve_params->curve_wsize]
+            __attribute__((aligned(8)));
+
+        ecc_bignum_affine_point_t shared_bn = {.x = (uint64_t *)shared_x_bn,
+                                               .y = (uint64_t *)shared_y_bn};
+
+        result = soft_ecc_ladder_finish(scl, ctx, &shared_bn);
+        if (SCL_OK == result)
+        {
+            copy_swap_array(shared_secret, (uint8_t *)shared_x_bn,
+                            curve_params->curve_bsize);
+
+            *shared_secret_len = curve_params->curve_bsize;
+        }
+
+        memset(shared_x_bn, 0, sizeof(shared_x_bn));
+        memset(shared_y_bn, 0, sizeof(shared_y_bn));
+    }
+
+    return (result);
+}
@@ -41,22 +41,616 @@
 
 #include <backend/api/asymmetric/ecc/ecdsa.h>
 #include <backend/software/asymmetric/ecc/soft_ecc.h>
+#include <backend/software/asymmetric/ecc/soft_ecc_scalar.h>
 #include <backend/software/asymmetric/ecc/soft_ecdsa.h>
 
-int32_t soft_ecdsa_signature(const metal_scl_t *const scl,
-                             const ecc_curve_t *const curve_params,
-                             const uint8_t *const priv_key,
-                             const ecdsa_signature_t *const signature,
-                             const uint8_t *const hash, size_t hash_len)
+/*! @brief TRNG seed size used in @ref SCL_ECDSA_NONCE_HEDGED mode */
+#define SOFT_ECDSA_HEDGED_SEED_32B_WORDSIZE 4
+
+/*! @brief HMAC_DRBG state used for RFC 6979 nonce generation */
+typedef struct
+{
+    /*! @brief HMAC key */
+    uint8_t k[SHA512_BYTE_HASHSIZE];
+    /*! @brief chaining value */
+    uint8_t v[SHA512_BYTE_HASHSIZE];
+    /*! @brief hash mode used by HMAC */
+    hash_mode_t hash_mode;
+    /*! @brief HMAC output length */
+    size_t hash_len;
+} soft_ecdsa_drbg_t;
+
+/**
+ * @brief out = a mod n
+ * @details the scalar field module is used when the curve provides the mod n
+ * Montgomery constants, the bignum API otherwise (same for the following
+ * helpers)
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] a             operand (curve_wsize words)
+ * @param[out] out          result
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+static int32_t soft_ecdsa_mod_n(const metal_scl_t *const scl,
+                                const ecc_curve_t *const curve_params,
+                                const uint64_t *const a, uint64_t *const out)
+{
+#if SOFT_ECC_SCALAR_FIELD == 1
+    if (true == soft_ecc_scalar_supported(curve_params))
+    {
+        soft_ecc_scalar_reduce(curve_params, a, out);
+        return (SCL_OK);
+    }
+#endif /* SOFT_ECC_SCALAR_FIELD */
+
+    return (scl->bignum_func.mod(scl, a, curve_params->curve_wsize,
+                                 curve_params->n, curve_params->curve_wsize,
+                                 out));
+}
+
+/**
+ * @brief out = a.b mod n
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] ctx           bignum context (modulus n)
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] a             first operand
+ * @param[in] b             second operand
+ * @param[out] out          result
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+static int32_t soft_ecdsa_mod_n_mult(const metal_scl_t *const scl,
+                                     const bignum_ctx_t *const ctx,
+                                     const ecc_curve_t *const curve_params,
+                                     const uint64_t *const a,
+                                     const uint64_t *const b,
+                                     uint64_t *const out)
+{
+#if SOFT_ECC_SCALAR_FIELD == 1
+    if (true == soft_ecc_scalar_supported(curve_params))
+    {
+        soft_ecc_scalar_mult(curve_params, a, b, out);
+        return (SCL_OK);
+    }
+#endif /* SOFT_ECC_SCALAR_FIELD */
+
+    return (scl->bignum_func.mod_mult(scl, ctx, a, b, out,
+                                      curve_params->curve_wsize));
+}
+
+/**
+ * @brief out = a + b mod n
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] ctx           bignum context (modulus n)
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] a             first operand, lower than n
+ * @param[in] b             second operand, lower than n
+ * @param[out] out          result
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+static int32_t soft_ecdsa_mod_n_add(const metal_scl_t *const scl,
+                                    const bignum_ctx_t *const ctx,
+                                    const ecc_curve_t *const curve_params,
+                                    const uint64_t *const a,
+                                    const uint64_t *const b,
+                                    uint64_t *const out)
+{
+#if SOFT_ECC_SCALAR_FIELD == 1
+    if (true == soft_ecc_scalar_supported(curve_params))
+    {
+        soft_ecc_scalar_add(curve_params, a, b, out);
+        return (SCL_OK);
+    }
+#endif /* SOFT_ECC_SCALAR_FIELD */
+
+    return (scl->bignum_func.mod_add(scl, ctx, a, b, out,
+                                     curve_params->curve_wsize));
+}
+
+/**
+ * @brief out = a - b mod n
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] ctx           bignum context (modulus n)
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] a             first operand, lower or equal to n
+ * @param[in] b             second operand, lower than n
+ * @param[out] out          result
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+static int32_t soft_ecdsa_mod_n_sub(const metal_scl_t *const scl,
+                                    const bignum_ctx_t *const ctx,
+                                    const ecc_curve_t *const curve_params,
+                                    const uint64_t *const a,
+                                    const uint64_t *const b,
+                                    uint64_t *const out)
+{
+#if SOFT_ECC_SCALAR_FIELD == 1
+    if (true == soft_ecc_scalar_supported(curve_params))
+    {
+        soft_ecc_scalar_sub(curve_params, a, b, out);
+        return (SCL_OK);
+    }
+#endif /* SOFT_ECC_SCALAR_FIELD */
+
+    return (scl->bignum_func.mod_sub(scl, ctx, a, b, out,
+                                     curve_params->curve_wsize));
+}
+
+/**
+ * @brief out = a^(-1) mod n
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] ctx           bignum context (modulus n)
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] a             operand
+ * @param[out] out          result
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+static int32_t soft_ecdsa_mod_n_inv(const metal_scl_t *const scl,
+                                    const bignum_ctx_t *const ctx,
+                                    const ecc_curve_t *const curve_params,
+                                    const uint64_t *const a,
+                                    uint64_t *const out)
+{
+#if SOFT_ECC_SCALAR_FIELD == 1
+    if (true == soft_ecc_scalar_supported(curve_params))
+    {
+        return (soft_ecc_scalar_inv(curve_params, a, out));
+    }
+#endif /* SOFT_ECC_SCALAR_FIELD */
+
+    return (scl->bignum_func.mod_inv(scl, ctx, a, out,
+                                     curve_params->curve_wsize));
+}
+
+/**
+ * @brief HMAC_DRBG update: K = HMAC_K(V || sep || data), V = HMAC_K(V)
+ *
+ * @param[in] scl           metal scl context
+ * @param[in,out] drbg      drbg state
+ * @param[in] sep           separator byte
+ * @param[in] data          provided data (may be NULL)
+ * @param[in] data_len      provided data length
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+static int32_t soft_ecdsa_drbg_update(const metal_scl_t *const scl,
+                                      soft_ecdsa_drbg_t *const drbg,
+                                      uint8_t sep, const uint8_t *const data,
+                                      size_t data_len)
+{
+    int32_t result;
+    size_t len;
+    hmac_ctx_t hmac_ctx;
+    sha_ctx_t sha_ctx;
+
+    result = scl->hmac_func.init(scl, &hmac_ctx, &sha_ctx, drbg->hash_mode,
+                                 drbg->k, drbg->hash_len);
+    if (SCL_OK != result)
+    {
+        goto cleanup;
+    }
+
+    result = scl->hmac_func.core(scl, &hmac_ctx, drbg->v, drbg->hash_len);
+    if (SCL_OK != result)
+    {
+        goto cleanup;
+    }
+
+    result = scl->hmac_func.core(scl, &hmac_ctx, &sep, sizeof(sep));
+    if (SCL_OK != result)
+    {
+        goto cleanup;
+    }
+
+    if ((NULL != data) && (0 != data_len))
+    {
+        result = scl->hmac_func.core(scl, &hmac_ctx, data, data_len);
+        if (SCL_OK != result)
+        {
+            goto cleanup;
+        }
+    }
+
+    len = sizeof(drbg->k);
+    result = scl->hmac_func.finish(scl, &hmac_ctx, drbg->k, &len);
+    if (SCL_OK != result)
+    {
+        goto cleanup;
+    }
+
+    result = scl->hmac_func.init(scl, &hmac_ctx, &sha_ctx, drbg->hash_mode,
+                                 drbg->k, drbg->hash_len);
+    if (SCL_OK != result)
+    {
+        goto cleanup;
+    }
+
+    result = scl->hmac_func.core(scl, &hmac_ctx, drbg->v, drbg->hash_len);
+    if (SCL_OK != result)
+    {
+        goto cleanup;
+    }
+
+    len = sizeof(drbg->v);
+    result = scl->hmac_func.finish(scl, &hmac_ctx, drbg->v, &len);
+
+cleanup:
+    memset(&hmac_ctx, 0, sizeof(hmac_ctx));
+    memset(&sha_ctx, 0, sizeof(sha_ctx));
+    return (result);
+}
+
+/**
+ * @brief HMAC_DRBG generate: output successive V = HMAC_K(V)
+ *
+ * @param[in] scl           metal scl context
+ * @param[in,out] drbg      drbg state
+ * @param[out] out          output buffer
+ * @param[in] out_len       output length
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+static int32_t soft_ecdsa_drbg_generate(const metal_scl_t *const scl,
+                                        soft_ecdsa_drbg_t *const drbg,
+                                        uint8_t *const out, size_t out_len)
+{
+    int32_t result = SCL_OK;
+    size_t offset = 0;
+    size_t len;
+    hmac_ctx_t hmac_ctx;
+    sha_ctx_t sha_ctx;
+
+    while (offset < out_len)
+    {
+        result = scl->hmac_func.init(scl, &hmac_ctx, &sha_ctx,
+                                     drbg->hash_mode, drbg->k, drbg->hash_len);
+        if (SCL_OK != result)
+        {
+            break;
+        }
+
+        result = scl->hmac_func.core(scl, &hmac_ctx, drbg->v, drbg->hash_len);
+        if (SCL_OK != result)
+        {
+            break;
+        }
+
+        len = sizeof(drbg->v);
+        result = scl->hmac_func.finish(scl, &hmac_ctx, drbg->v, &len);
+        if (SCL_OK != result)
+        {
+            break;
+        }
+
+        len = MIN(drbg->hash_len, out_len - offset);
+        memcpy(&out[offset], drbg->v, len);
+        offset += len;
+    }
+
+    memset(&hmac_ctx, 0, sizeof(hmac_ctx));
+    memset(&sha_ctx, 0, sizeof(sha_ctx));
+    return (result);
+}
+
+/**
+ * @brief RFC 6979 bits2int: keep the qlen leftmost bits of a big endian
+ * buffer and convert it into a big integer
+ *
+ * @param[in] in            big endian input
+ * @param[in] in_len        input length
+ * @param[in] qlen          bit length of n
+ * @param[out] out          big integer output
+ * @param[in] nb_32b_words  output number of 32 bits words
+ */
+static void soft_ecdsa_bits2int(const uint8_t *const in, size_t in_len,
+                                size_t qlen, uint32_t *const out,
+                                size_t nb_32b_words)
+{
+    size_t i;
+    size_t len;
+    size_t shift;
+    uint8_t *const out_bytes = (uint8_t *)out;
+
+    len = MIN(in_len, (qlen + 7) / 8);
+
+    memset(out, 0, nb_32b_words * sizeof(uint32_t));
+    copy_swap_array(out_bytes, in, len);
+
+    /* only when the input is longer than qlen */
+    if ((len * 8) > qlen)
+    {
+        shift = (len * 8) - qlen;
+        for (i = 0; i < len; i++)
+        {
+            out_bytes[i] = (uint8_t)(out_bytes[i] >> shift);
+            if ((i + 1) < len)
+            {
+                out_bytes[i] |= (uint8_t)(out_bytes[i + 1] << (8 - shift));
+            }
+        }
+    }
+}
+
+/**
+ * @brief instantiate the RFC 6979 HMAC_DRBG
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters
+ * @param[out] drbg         drbg state
+ * @param[in] priv_key      private key (big endian)
+ * @param[in] hash          hash value to sign
+ * @param[in] hash_len      hash value length
+ * @param[in] extra         additional data (may be NULL)
+ * @param[in] extra_len     additional data length
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+static int32_t soft_ecdsa_drbg_instantiate(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    soft_ecdsa_drbg_t *const drbg, const uint8_t *const priv_key,
+    const uint8_t *const hash, size_t hash_len, const uint8_t *const extra,
+    size_t extra_len)
+{
+    int32_t result;
+    size_t qlen;
+    uint32_t h1[curve_params->curve_wsize] __attribute__((aligned(8)));
+    uint32_t tmp[curve_params->curve_wsize] __attribute__((aligned(8)));
+    /* int2octets(x) || bits2octets(h1) || extra */
+    uint8_t seed[2 * ECDSA_MAX_BYTESIZE +
+                 SOFT_ECDSA_HEDGED_SEED_32B_WORDSIZE * sizeof(uint32_t)];
+
+    switch (hash_len)
+    {
+    case SHA224_BYTE_HASHSIZE:
+        drbg->hash_mode = SCL_HASH_SHA224;
+        break;
+    case SHA256_BYTE_HASHSIZE:
+        drbg->hash_mode = SCL_HASH_SHA256;
+        break;
+    case SHA384_BYTE_HASHSIZE:
+        drbg->hash_mode = SCL_HASH_SHA384;
+        break;
+    case SHA512_BYTE_HASHSIZE:
+        drbg->hash_mode = SCL_HASH_SHA512;
+        break;
+    default:
+        return (SCL_ERR_HASH);
+    }
+    drbg->hash_len = hash_len;
+
+    if ((ECDSA_MAX_BYTESIZE < curve_params->curve_bsize) ||
+        ((SOFT_ECDSA_HEDGED_SEED_32B_WORDSIZE * sizeof(uint32_t)) < extra_len))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    result = scl->bignum_func.get_msb_set(scl, curve_params->n,
+                                          curve_params->curve_wsize);
+    if (SCL_OK >= result)
+    {
+        return (SCL_ERROR);
+    }
+    qlen = (size_t)result;
+
+    /* bits2octets(h1) = int2octets(bits2int(h1) mod n) */
+    soft_ecdsa_bits2int(hash, hash_len, qlen, h1, curve_params->curve_wsize);
+
+    result = scl->bignum_func.compare(scl, (uint64_t *)h1, curve_params->n,
+                                      curve_params->curve_wsize);
+    if (0 <= result)
+    {
+        /* bits2int(h1) < 2^qlen < 2.n, so one subtraction is enough */
+        result = scl->bignum_func.sub(scl, (uint64_t *)h1, curve_params->n,
+                                      (uint64_t *)tmp,
+                                      curve_params->curve_wsize);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+        memcpy(h1, tmp, sizeof(h1));
+    }
+
+    memcpy(seed, priv_key, curve_params->curve_bsize);
+    copy_swap_array(&seed[curve_params->curve_bsize], (uint8_t *)h1,
+                    curve_params->curve_bsize);
+    if ((NULL != extra) && (0 != extra_len))
+    {
+        memcpy(&seed[2 * curve_params->curve_bsize], extra, extra_len);
+    }
+    else
+    {
+        extra_len = 0;
+    }
+
+    /* RFC 6979 section 3.2 steps b. to g. */
+    memset(drbg->v, 0x01, sizeof(drbg->v));
+    memset(drbg->k, 0x00, sizeof(drbg->k));
+
+    result = soft_ecdsa_drbg_update(scl, drbg, 0x00, seed,
+                                    2 * curve_params->curve_bsize + extra_len);
+    if (SCL_OK == result)
+    {
+        result =
+            soft_ecdsa_drbg_update(scl, drbg, 0x01, seed,
+                                   2 * curve_params->curve_bsize + extra_len);
+    }
+
+    memset(seed, 0, sizeof(seed));
+    return (result);
+}
+
+/**
+ * @brief generate a random scalar in [1, n-1]
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in,out] drbg      RFC 6979 drbg state, NULL to use the TRNG
+ * @param[in] nbbits        bit position of n msb
+ * @param[out] out          random scalar (curve_params->curve_wsize words)
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+static int32_t soft_ecdsa_random_scalar(const metal_scl_t *const scl,
+                                        const ecc_curve_t *const curve_params,
+                                        soft_ecdsa_drbg_t *const drbg,
+                                        size_t nbbits, uint32_t *const out)
 {
     int32_t result, result_2;
-    size_t nbbits;
     size_t i;
-    ecc_bignum_affine_point_t mp;
+    /* T is at least qlen bits long, made of whole HMAC outputs */
+    uint8_t t[ECDSA_MAX_BYTESIZE + SHA512_BYTE_HASHSIZE];
+
+    do
+    {
+        if (NULL == drbg)
+        {
+            for (i = 0; i < curve_params->curve_wsize; i++)
+            {
+                result = scl->trng_func.get_data(scl, &out[i]);
+                if (SCL_OK != result)
+                {
+                    return (result);
+                }
+            }
+
+            truncate_array((uint8_t *)out,
+                           curve_params->curve_wsize * sizeof(uint32_t),
+                           nbbits + 1);
+        }
+        else
+        {
+            /* RFC 6979 section 3.2 step h. */
+            result = soft_ecdsa_drbg_generate(
+                scl, drbg, t, curve_params->curve_bsize);
+            if (SCL_OK != result)
+            {
+                return (result);
+            }
+
+            soft_ecdsa_bits2int(t, curve_params->curve_bsize, nbbits + 1, out,
+                                curve_params->curve_wsize);
+
+            /* K = HMAC_K(V || 0x00), V = HMAC_K(V) */
+            result = soft_ecdsa_drbg_update(scl, drbg, 0x00, NULL, 0);
+            if (SCL_OK != result)
+            {
+                return (result);
+            }
+        }
+
+        result = scl->bignum_func.compare(scl, (uint64_t *)out, curve_params->n,
+                                          curve_params->curve_wsize);
+
+        result_2 =
+            scl->bignum_func.is_null(scl, out, curve_params->curve_wsize);
+
+    }
+    /**
+     * As a modular reduction is not protected against SCA, we prefer to
+     * loop until the generated value is correct the accepted range is
+     * between 1 and n-1
+     */
+    while ((result >= 0) || (false != result_2));
+
+    return (SCL_OK);
+}
+
+/**
+ * @brief compute r = (k.G).x mod n
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] k             nonce (curve_params->curve_wsize words), 0 < k < n
+ * @param[out] r            result (curve_params->curve_wsize words)
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+static int32_t soft_ecdsa_compute_r(const metal_scl_t *const scl,
+                                    const ecc_curve_t *const curve_params,
+                                    const uint32_t *const k, uint32_t *const r)
+{
+    int32_t result;
+
+    uint32_t x1[curve_params->curve_wsize] __attribute__((aligned(8)));
+#if SOFT_ECC_X_ONLY_LADDER == 0
     ecc_bignum_affine_point_t q;
-    bignum_ctx_t bignum_ctx;
+    uint32_t y1[curve_params->curve_wsize] __attribute__((aligned(8)));
+
+    q.x = (uint64_t *)x1;
+    q.y = (uint64_t *)y1;
+#endif /* SOFT_ECC_X_ONLY_LADDER */
+
+    /**
+     * algorithm for k protection
+     * the lattice attack is about guessing the k Msb position
+     * the regular signed window recoding always processes the same number
+     * of non zero digits, whatever the position of the k Msb, and the table
+     * lookups are masked, so neither the timing nor the memory accesses
+     * depend on k (the x-only ladder runs on k + n or k + 2n, of fixed
+     * length, with branchless swaps)
+     */
+
+#if SOFT_ECC_X_ONLY_LADDER
+    /* 4 x1 = (k.G).x, y1 is not needed */
+    result = soft_ecc_mult_coz_x(scl, curve_params, curve_params->g,
+                                 (const uint64_t *)k,
+                                 curve_params->curve_wsize, (uint64_t *)x1);
+#else
+    /* 4 (x1,y1)=k.G */
+    result = soft_ecc_mult_window(scl, curve_params, curve_params->g,
+                                  (const uint64_t *)k,
+                                  curve_params->curve_wsize, &q);
+#endif /* SOFT_ECC_X_ONLY_LADDER */
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    /* 5. compute r = x1 mod n */
+    result = soft_ecdsa_mod_n(scl, curve_params, (uint64_t *)x1,
+                              (uint64_t *)r);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
 
-    size_t msb, ext_k_size;
+#if SOFT_ECC_X_ONLY_LADDER == 0
+    memset(y1, 0, sizeof(y1));
+#endif /* SOFT_ECC_X_ONLY_LADDER */
+
+    return (SCL_OK);
+}
+
+/**
+ * @brief ECDSA signature
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] priv_key      private key
+ * @param[out] signature    signature structure that will hold results
+ * @param[in] hash          hash value to sign
+ * @param[in] hash_len      hash value length
+ * @param[in,out] drbg      RFC 6979 drbg state, NULL to use the TRNG
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+static int32_t soft_ecdsa_signature_internal(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const uint8_t *const priv_key, const ecdsa_signature_t *const signature,
+    const uint8_t *const hash, size_t hash_len, soft_ecdsa_drbg_t *const drbg)
+{
+    int32_t result, result_2;
+    size_t nbbits;
+    bignum_ctx_t bignum_ctx;
 
     if ((NULL == scl) || (NULL == priv_key) || (NULL == signature) ||
         (NULL == hash) || (NULL == curve_params))
@@ -78,7 +672,7 @@ int32_t soft_ecdsa_signature(const metal_scl_t *const scl,
         return (SCL_INVALID_LENGTH);
     }
 
-    if ((NULL == scl->trng_func.get_data) ||
+    if (((NULL == drbg) && (NULL == scl->trng_func.get_data)) ||
         (NULL == scl->bignum_func.is_null) || (NULL == scl->bignum_func.mod) ||
         (NULL == scl->bignum_func.compare) ||
         (NULL == scl->bignum_func.mod_mult) ||
@@ -101,16 +695,9 @@ int32_t soft_ecdsa_signature(const metal_scl_t *const scl,
         uint32_t u1[curve_params->curve_wsize] __attribute__((aligned(8)));
         uint32_t x1[curve_params->curve_wsize] __attribute__((aligned(8)));
         uint32_t y1[curve_params->curve_wsize] __attribute__((aligned(8)));
-        uint32_t x2[curve_params->curve_wsize] __attribute__((aligned(8)));
-        uint32_t y2[curve_params->curve_wsize] __attribute__((aligned(8)));
         uint32_t w[curve_params->curve_wsize] __attribute__((aligned(8)));
         uint32_t d[curve_params->curve_wsize] __attribute__((aligned(8)));
         uint32_t k[curve_params->curve_wsize] __attribute__((aligned(8)));
-        /* ext_k is curve_wsize + 1 ! */
-        uint32_t ext_k[curve_params->curve_wsize + 1]
-            __attribute__((aligned(8)));
-
-        ext_k_size = curve_params->curve_wsize + 1;
 
         do
         {
@@ -130,182 +717,40 @@ int32_t soft_ecdsa_signature(const metal_scl_t *const scl,
             nbbits = (size_t)result - 1;
 
             /* 3. randomly generate k [1,k-1] */
-            do
+            result = soft_ecdsa_random_scalar(scl, curve_params, drbg,
+                                              nbbits, k);
+            if (SCL_OK != result)
             {
-                for (i = 0; i < curve_params->curve_wsize; i++)
-                {
-                    result = scl->trng_func.get_data(scl, &k[i]);
-                    if (SCL_OK != result)
-                    {
-                        goto cleanup;
-                    }
-                }
-
-                truncate_array((uint8_t *)k,
-                               curve_params->curve_wsize * sizeof(uint32_t),
-                               nbbits + 1);
-
-                result = scl->bignum_func.compare(scl, (uint64_t *)k,
-                                                  curve_params->n,
-                                                  curve_params->curve_wsize);
-
-                result_2 =
-                    scl->bignum_func.is_null(scl, k, curve_params->curve_wsize);
+                goto cleanup;
+            }
 
+            /* 4. (x1,y1)=k.G and 5. r = x1 mod n */
+            result = soft_ecdsa_compute_r(scl, curve_params, k, r);
+            if (SCL_OK != result)
+            {
+                goto cleanup;
             }
-            /**
-             * As a modular reduction is not protected against SCA, we prefer to
-             * loop until the generated value is correct the accepted range is
-             * between 1 and n-1
-             */
-            while ((result >= 0) || (false != result_2));
 
-            /* 4 (x1,y1)=k.G */
-            q.x = (uint64_t *)x1;
-            q.y = (uint64_t *)y1;
+            /* store in signature r */
+            copy_swap_array(signature->r, (uint8_t *)r,
+                            curve_params->curve_bsize);
 
             /**
-             * algorithm for k protection
-             * the lattice attack is about guessing the k Msb position
-             * our countermeasure is then creating a "fake" Msb, i.e. forcing to
-             * 1 a bit at a fixed position (so the bit can not be guessed :-) ),
-             * beyond the real Msb of k, then computing the product of this new
-             * value times p, then removing the contribution of this fake extra
-             * 1-bit, so: 4.1-compute (1|k).p, this new, extended k is named
-             * ext_k, its size being ext_k_size 4.2-compute (1|0...0).P; in
-             * fact, use precomputed values 4.3-substract (2) to (1) the result
-             * will then be (1|k).P-(1|0..0).P => k.P <=> (1|k).P+(-(1|0..0).P)
-             */
-
-            /**
-             * let's start !
-             * 4.1 compute the extended scalar,i.e. scalar with a leading 1
-             * so, determine the modulus msb
-             * depending on the curve, this value may require a new word
-             * a. determine the n msb position
-             */
-
-            result = scl->bignum_func.get_msb_set(scl, curve_params->n,
-                                                  curve_params->curve_wsize);
-            if (SCL_OK > result)
-            {
-                return (result);
-            }
-            else if (0 == result)
-            {
-                /* at least on bit should be set */
-                return (SCL_ERROR);
-            }
-
-            msb = (size_t)result;
-
-            /* b. prepare the new,extended value from k, aligned on n */
-            memcpy(ext_k, k, curve_params->curve_wsize * sizeof(uint32_t));
-            ext_k[curve_params->curve_wsize] = 0;
-
-            result = scl->bignum_func.set_bit(scl, (uint64_t *)ext_k,
-                                              ext_k_size, msb);
-            if (SCL_OK > result)
-            {
-                return (result);
-            }
-
-            /* 4.1-compute (1|k).P, i.e. (ext_k).P, using coZ routines */
-            result = scl->bignum_func.set_modulus(
-                scl, &bignum_ctx, curve_params->p, curve_params->curve_wsize);
-            if (SCL_OK > result)
-            {
-                return (result);
-            }
-
-            result = soft_ecc_mult_coz(scl, curve_params, curve_params->g,
-                                       (uint64_t *)ext_k, ext_k_size, &q);
-            if (SCL_OK != result)
-            {
-                goto cleanup;
-            }
-            mp.x = (uint64_t *)x2;
-            mp.y = (uint64_t *)y2;
-
-            /**
-             * 4.2-compute or copy (1|0..0).P
-             * the curve params should contain precomputed_1_x and
-             * precomputed_1_y that correspond to -(1|0).P, if available !
-             * (should always be available except for size-constrained
-             * platforms)
-             */
-            if (NULL != curve_params->precomputed_1_x &&
-                NULL != curve_params->precomputed_1_y)
-            {
-                memcpy(x2, curve_params->precomputed_1_x,
-                       curve_params->curve_wsize * sizeof(uint32_t));
-                memcpy(y2, curve_params->precomputed_1_y,
-                       curve_params->curve_wsize * sizeof(uint32_t));
-            }
-            else
-            {
-                /* very time consuming but usually not performed */
-                memset(ext_k, 0, sizeof(ext_k));
-                result = scl->bignum_func.set_bit(scl, (uint64_t *)ext_k,
-                                                  ext_k_size, msb);
-                if (SCL_OK > result)
-                {
-                    return (result);
-                }
-
-                result = soft_ecc_mult_coz(scl, curve_params, curve_params->g,
-                                           (uint64_t *)ext_k, ext_k_size, &mp);
-                if (SCL_OK != result)
-                {
-                    goto cleanup;
-                }
-
-                /* compute the opposite:  -(x2,y2)=(x2,-y2) and y2=p-y2=-y2 */
-                result = scl->bignum_func.mod_sub(
-                    scl, &bignum_ctx, curve_params->p, (uint64_t *)y2,
-                    (uint64_t *)y2, curve_params->curve_wsize);
-                if (SCL_OK != result)
-                {
-                    goto cleanup;
-                }
-            }
-            /* 4.3 (1|k).P+ (-(1|0..0).P) */
-            result = soft_ecc_add_affine_affine(scl, curve_params, &q, &mp, &q,
-                                                curve_params->curve_wsize);
-
-            if (SCL_OK != result)
-            {
-                goto cleanup;
-            }
-            /* 5. compute r = x1 mod n = q.x mod n */
-            result = scl->bignum_func.mod(
-                scl, q.x, curve_params->curve_wsize, curve_params->n,
-                curve_params->curve_wsize, (uint64_t *)r);
-            if (SCL_OK != result)
-            {
-                goto cleanup;
-            }
-
-            /* store in signature r */
-            copy_swap_array(signature->r, (uint8_t *)r,
-                            curve_params->curve_bsize);
-
-            /**
-             * algorithm for d protection
-             * 6. s=k^(-1).(h+r.d) mod n
-             * we want to hide the use of d,the secret, by using masks
-             * we have a multiplicative mask, m1 and an additive mask, m2
-             * s=k^(-1).(h+r.d) mod n
-             * is equivalent to
-             * s=k^(-1).(h+r.(n+d)) mod n
-             * equivalent to (add and substract m2, multiply and divide by m1)
-             * s=r.m1.(h/r   +(n-m2) + (d+m2)) /(m1.k)
-             * equivalent to
-             * S=r.m1.(h.r^(-1) +(n-m2) + (d+m2)) .(m1.k)^(-1)
-             * we now develop the expression to have m1 everywhere and still
-             * masking when m2 is not masking s=r.(m1.h/r + m1.(n-m2) +
-             * m1.(d+m2))/(m1.k) s=r.(t1.h.r^(-1)+ m1.(n-m2) +
-             * m1.(d+m2)).(m1.k)^(-1)
+             * algorithm for d protection
+             * 6. s=k^(-1).(h+r.d) mod n
+             * we want to hide the use of d,the secret, by using masks
+             * we have a multiplicative mask, m1 and an additive mask, m2
+             * s=k^(-1).(h+r.d) mod n
+             * is equivalent to
+             * s=k^(-1).(h+r.(n+d)) mod n
+             * equivalent to (add and substract m2, multiply and divide by m1)
+             * s=r.m1.(h/r   +(n-m2) + (d+m2)) /(m1.k)
+             * equivalent to
+             * S=r.m1.(h.r^(-1) +(n-m2) + (d+m2)) .(m1.k)^(-1)
+             * we now develop the expression to have m1 everywhere and still
+             * masking when m2 is not masking s=r.(m1.h/r + m1.(n-m2) +
+             * m1.(d+m2))/(m1.k) s=r.(t1.h.r^(-1)+ m1.(n-m2) +
+             * m1.(d+m2)).(m1.k)^(-1)
              */
 
             /**
@@ -328,78 +773,27 @@ int32_t soft_ecdsa_signature(const metal_scl_t *const scl,
             /**
              * x1 is used for m1,random multiplicative mask, y1 for m2, random
              * additive mask
-             * x1 not used anymore so free to use
              * generate random number x1
              * 6.1 m1=x1
              */
-            memset(x1, 0, sizeof(x1));
-            do
+            result = soft_ecdsa_random_scalar(scl, curve_params, drbg,
+                                              nbbits, x1);
+            if (SCL_OK != result)
             {
-                for (i = 0; i < curve_params->curve_wsize; i++)
-                {
-                    result = scl->trng_func.get_data(scl, &x1[i]);
-                    if (SCL_OK > result)
-                    {
-                        return (result);
-                    }
-                }
-
-                truncate_array((uint8_t *)x1,
-                               curve_params->curve_wsize * sizeof(uint32_t),
-                               nbbits + 1);
-
-                result = scl->bignum_func.compare(scl, (uint64_t *)x1,
-                                                  curve_params->n,
-                                                  curve_params->curve_wsize);
-
-                result_2 = scl->bignum_func.is_null(scl, x1,
-                                                    curve_params->curve_wsize);
-
+                goto cleanup;
             }
 
-            /**
-             * As a modular reduction is not protected against SCA, we prefer to
-             * loop until the generated value is correct the accepted range is
-             * between 1 and n-1
-             */
-            while ((result >= 0) || (false != result_2));
-
             /**
              * generate random number y1
              * m2=y1
              */
-            memset(y1, 0, sizeof(x1));
-            do
+            result = soft_ecdsa_random_scalar(scl, curve_params, drbg,
+                                              nbbits, y1);
+            if (SCL_OK != result)
             {
-                for (i = 0; i < curve_params->curve_wsize; i++)
-                {
-                    result = scl->trng_func.get_data(scl, &y1[i]);
-                    if (SCL_OK > result)
-                    {
-                        return (result);
-                    }
-                }
-
-                truncate_array((uint8_t *)y1,
-                               curve_params->curve_wsize * sizeof(uint32_t),
-                               nbbits + 1);
-
-                result = scl->bignum_func.compare(scl, (uint64_t *)y1,
-                                                  curve_params->n,
-                                                  curve_params->curve_wsize);
-
-                result_2 = scl->bignum_func.is_null(scl, y1,
-                                                    curve_params->curve_wsize);
-
+                goto cleanup;
             }
 
-            /**
-             * As a modular reduction is not protected against SCA, we prefer to
-             * loop until the generated value is correct the accepted range is
-             * between 1 and n-1
-             */
-            while ((result >= 0) || (false != result_2));
-
             result = scl->bignum_func.set_modulus(
                 scl, &bignum_ctx, curve_params->n, curve_params->curve_wsize);
             if (SCL_OK > result)
@@ -408,9 +802,8 @@ int32_t soft_ecdsa_signature(const metal_scl_t *const scl,
             }
 
             /* 6.2 inverting r (r is public so no need for masking) */
-            result = scl->bignum_func.mod_inv(scl, &bignum_ctx, (uint64_t *)r,
-                                              (uint64_t *)w,
-                                              curve_params->curve_wsize);
+            result = soft_ecdsa_mod_n_inv(scl, &bignum_ctx, curve_params,
+                                          (uint64_t *)r, (uint64_t *)w);
             if (SCL_OK > result)
             {
                 return (result);
@@ -422,18 +815,18 @@ int32_t soft_ecdsa_signature(const metal_scl_t *const scl,
             copy_swap_array((uint8_t *)e, hash,
                             MIN(hash_len, curve_params->curve_bsize));
 
-            result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)w,
-                                               (uint64_t *)e, (uint64_t *)w,
-                                               curve_params->curve_wsize);
+            result = soft_ecdsa_mod_n_mult(scl, &bignum_ctx, curve_params,
+                                           (uint64_t *)w, (uint64_t *)e,
+                                           (uint64_t *)w);
             if (SCL_OK > result)
             {
                 goto cleanup;
             }
 
             /* 6.3b m1.h.r^(-1) so x1.w */
-            result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)w,
-                                               (uint64_t *)x1, (uint64_t *)w,
-                                               curve_params->curve_wsize);
+            result = soft_ecdsa_mod_n_mult(scl, &bignum_ctx, curve_params,
+                                           (uint64_t *)w, (uint64_t *)x1,
+                                           (uint64_t *)w);
             if (SCL_OK > result)
             {
                 goto cleanup;
@@ -441,27 +834,27 @@ int32_t soft_ecdsa_signature(const metal_scl_t *const scl,
 
             /* prepare masking for d */
             /* 6.4a n-y1 (=n-m2) */
-            result = scl->bignum_func.mod_sub(scl, &bignum_ctx, curve_params->n,
-                                              (uint64_t *)y1, (uint64_t *)u1,
-                                              curve_params->curve_wsize);
+            result = soft_ecdsa_mod_n_sub(scl, &bignum_ctx, curve_params,
+                                          curve_params->n, (uint64_t *)y1,
+                                          (uint64_t *)u1);
             if (SCL_OK > result)
             {
                 goto cleanup;
             }
 
             /* 6.4b. m1.(n-m2)=x1.(n-y1) */
-            result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)u1,
-                                               (uint64_t *)x1, (uint64_t *)u1,
-                                               curve_params->curve_wsize);
+            result = soft_ecdsa_mod_n_mult(scl, &bignum_ctx, curve_params,
+                                           (uint64_t *)u1, (uint64_t *)x1,
+                                           (uint64_t *)u1);
             if (SCL_OK > result)
             {
                 goto cleanup;
             }
 
             /* 6.5 x1.h.r^(-1) + x1.(n-y1) */
-            result = scl->bignum_func.mod_add(scl, &bignum_ctx, (uint64_t *)w,
-                                              (uint64_t *)u1, (uint64_t *)w,
-                                              curve_params->curve_wsize);
+            result = soft_ecdsa_mod_n_add(scl, &bignum_ctx, curve_params,
+                                          (uint64_t *)w, (uint64_t *)u1,
+                                          (uint64_t *)w);
             if (SCL_OK > result)
             {
                 goto cleanup;
@@ -471,140 +864,931 @@ int32_t soft_ecdsa_signature(const metal_scl_t *const scl,
             memset(d, 0, sizeof(d));
             copy_swap_array((uint8_t *)d, priv_key, curve_params->curve_bsize);
 
-            result = scl->bignum_func.mod_add(scl, &bignum_ctx, (uint64_t *)d,
-                                              (uint64_t *)y1, (uint64_t *)u1,
-                                              curve_params->curve_wsize);
+            result = soft_ecdsa_mod_n_add(scl, &bignum_ctx, curve_params,
+                                          (uint64_t *)d, (uint64_t *)y1,
+                                          (uint64_t *)u1);
             if (SCL_OK > result)
             {
                 goto cleanup;
             }
 
             /* 6.6b m1.(d+m2) (=x1.(d+y1)) */
-            result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)u1,
-                                               (uint64_t *)x1, (uint64_t *)u1,
-                                               curve_params->curve_wsize);
+            result = soft_ecdsa_mod_n_mult(scl, &bignum_ctx, curve_params,
+                                           (uint64_t *)u1, (uint64_t *)x1,
+                                           (uint64_t *)u1);
             if (SCL_OK > result)
             {
                 goto cleanup;
             }
 
             /* 6.7 +m1.(d+m2) */
-            result = scl->bignum_func.mod_add(scl, &bignum_ctx, (uint64_t *)w,
-                                              (uint64_t *)u1, (uint64_t *)w,
-                                              curve_params->curve_wsize);
+            result = soft_ecdsa_mod_n_add(scl, &bignum_ctx, curve_params,
+                                          (uint64_t *)w, (uint64_t *)u1,
+                                          (uint64_t *)w);
             if (SCL_OK > result)
             {
                 goto cleanup;
             }
 
             /* 6.8a. masking k: m1.k (=x1.k) */
-            result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)x1,
-                                               (uint64_t *)k, (uint64_t *)u1,
-                                               curve_params->curve_wsize);
+            result = soft_ecdsa_mod_n_mult(scl, &bignum_ctx, curve_params,
+                                           (uint64_t *)x1, (uint64_t *)k,
+                                           (uint64_t *)u1);
             if (SCL_OK > result)
             {
                 goto cleanup;
             }
 
             /* 6.8b inverting masked k: (m1*k)^(-1) */
-            result = scl->bignum_func.mod_inv(scl, &bignum_ctx, (uint64_t *)u1,
-                                              (uint64_t *)u1,
-                                              curve_params->curve_wsize);
+            result = soft_ecdsa_mod_n_inv(scl, &bignum_ctx, curve_params,
+                                          (uint64_t *)u1, (uint64_t *)u1);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+
+            /* 6.8 (m1.h.r^(-1)+m1.(n-m2)+m1.(d+m2)).(m1.k)^(-1)*/
+            result = soft_ecdsa_mod_n_mult(scl, &bignum_ctx, curve_params,
+                                           (uint64_t *)w, (uint64_t *)u1,
+                                           (uint64_t *)w);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+
+            /* 6.9 final computation */
+            result = soft_ecdsa_mod_n_mult(scl, &bignum_ctx, curve_params,
+                                           (uint64_t *)w, (uint64_t *)r,
+                                           (uint64_t *)s);
             if (SCL_OK > result)
             {
                 goto cleanup;
             }
 
-            /* 6.8 (m1.h.r^(-1)+m1.(n-m2)+m1.(d+m2)).(m1.k)^(-1)*/
-            result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)w,
-                                               (uint64_t *)u1, (uint64_t *)w,
-                                               curve_params->curve_wsize);
-            if (SCL_OK > result)
-            {
-                goto cleanup;
-            }
+            /* check the signature is not null: 5. and 6. */
+            result =
+                scl->bignum_func.is_null(scl, s, curve_params->curve_wsize);
+
+            result_2 =
+                scl->bignum_func.is_null(scl, r, curve_params->curve_wsize);
+        } while ((false != result) && (false != result_2));
+
+        /* 6 result */
+        copy_swap_array(signature->s, (uint8_t *)s, curve_params->curve_bsize);
+    }
+
+    result = SCL_OK;
+cleanup:
+    return (result);
+}
+
+int32_t soft_ecdsa_signature(const metal_scl_t *const scl,
+                             const ecc_curve_t *const curve_params,
+                             const uint8_t *const priv_key,
+                             const ecdsa_signature_t *const signature,
+                             const uint8_t *const hash, size_t hash_len)
+{
+    return (soft_ecdsa_signature_internal(scl, curve_params, priv_key,
+                                          signature, hash, hash_len, NULL));
+}
+
+int32_t soft_ecdsa_signature_with_nonce_mode(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const uint8_t *const priv_key, const ecdsa_signature_t *const signature,
+    const uint8_t *const hash, size_t hash_len, ecdsa_nonce_mode_t mode)
+{
+    int32_t result;
+    size_t i;
+    soft_ecdsa_drbg_t drbg;
+    uint32_t seed[SOFT_ECDSA_HEDGED_SEED_32B_WORDSIZE];
+    size_t seed_len = 0;
+
+    if (SCL_ECDSA_NONCE_RANDOM == mode)
+    {
+        return (soft_ecdsa_signature(scl, curve_params, priv_key, signature,
+                                     hash, hash_len));
+    }
+
+    if ((SCL_ECDSA_NONCE_DETERMINISTIC != mode) &&
+        (SCL_ECDSA_NONCE_HEDGED != mode))
+    {
+        return (SCL_INVALID_MODE);
+    }
+
+    if ((NULL == scl) || (NULL == priv_key) || (NULL == signature) ||
+        (NULL == hash) || (NULL == curve_params))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (NULL == curve_params->n)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    /* Check curve length */
+    if ((ECDSA_MAX_32B_WORDSIZE < curve_params->curve_wsize) ||
+        (ECDSA_MIN_32B_WORDSIZE > curve_params->curve_wsize))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    if ((NULL == scl->hmac_func.init) || (NULL == scl->hmac_func.core) ||
+        (NULL == scl->hmac_func.finish) ||
+        (NULL == scl->bignum_func.get_msb_set) ||
+        (NULL == scl->bignum_func.compare) || (NULL == scl->bignum_func.sub))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    if (SCL_ECDSA_NONCE_HEDGED == mode)
+    {
+        if (NULL == scl->trng_func.get_data)
+        {
+            return (SCL_ERROR_API_ENTRY_POINT);
+        }
+
+        for (i = 0; i < SOFT_ECDSA_HEDGED_SEED_32B_WORDSIZE; i++)
+        {
+            result = scl->trng_func.get_data(scl, &seed[i]);
+            if (SCL_OK != result)
+            {
+                goto cleanup;
+            }
+        }
+        seed_len = sizeof(seed);
+    }
+
+    result = soft_ecdsa_drbg_instantiate(scl, curve_params, &drbg, priv_key,
+                                         hash, hash_len, (uint8_t *)seed,
+                                         seed_len);
+    if (SCL_OK != result)
+    {
+        goto cleanup;
+    }
+
+    /**
+     * k and the masks used to protect d are all derived from the drbg, so
+     * the TRNG is not used anymore
+     */
+    result = soft_ecdsa_signature_internal(scl, curve_params, priv_key,
+                                           signature, hash, hash_len, &drbg);
+
+cleanup:
+    memset(&drbg, 0, sizeof(drbg));
+    memset(seed, 0, sizeof(seed));
+    return (result);
+}
+
+int32_t soft_ecdsa_nonce_pool_fill(const metal_scl_t *const scl,
+                                   ecdsa_nonce_pool_t *const pool,
+                                   size_t nb_nonces)
+{
+    int32_t result;
+    size_t nbbits;
+    bignum_ctx_t bignum_ctx;
+    const ecc_curve_t *curve_params;
+    ecdsa_nonce_t *nonce = NULL;
+
+    if ((NULL == scl) || (NULL == pool))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    curve_params = pool->curve_params;
+
+    if ((NULL == curve_params) || (NULL == pool->nonces) ||
+        (NULL == curve_params->n))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    /* Check curve length */
+    if ((ECDSA_MAX_32B_WORDSIZE < curve_params->curve_wsize) ||
+        (ECDSA_MIN_32B_WORDSIZE > curve_params->curve_wsize))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    if (pool->nb_available > pool->nb_nonces)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->trng_func.get_data) ||
+        (NULL == scl->bignum_func.is_null) || (NULL == scl->bignum_func.mod) ||
+        (NULL == scl->bignum_func.compare) ||
+        (NULL == scl->bignum_func.mod_mult) ||
+        (NULL == scl->bignum_func.mod_sub) ||
+        (NULL == scl->bignum_func.mod_inv) ||
+        (NULL == scl->bignum_func.set_bit) ||
+        (NULL == scl->bignum_func.get_msb_set) ||
+        (NULL == scl->bignum_func.set_modulus))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    /* determine the n msb */
+    result = scl->bignum_func.get_msb_set(scl, curve_params->n,
+                                          curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+    else if (0 == result)
+    {
+        /* at least on bit should be set */
+        return (SCL_ERROR);
+    }
+
+    nbbits = (size_t)result - 1;
+
+    {
+        uint32_t k[curve_params->curve_wsize] __attribute__((aligned(8)));
+        uint32_t m1[curve_params->curve_wsize] __attribute__((aligned(8)));
+        uint32_t u1[curve_params->curve_wsize] __attribute__((aligned(8)));
+
+        while ((pool->nb_available < pool->nb_nonces) && (0 < nb_nonces))
+        {
+            nonce = &pool->nonces[pool->nb_available];
+            memset(nonce, 0, sizeof(*nonce));
+
+            /* 3. randomly generate k [1,k-1] */
+            result = soft_ecdsa_random_scalar(scl, curve_params, NULL,
+                                              nbbits, k);
+            if (SCL_OK != result)
+            {
+                goto cleanup;
+            }
+
+            /* 4. (x1,y1)=k.G and 5. r = x1 mod n */
+            result = soft_ecdsa_compute_r(scl, curve_params, k,
+                                          (uint32_t *)nonce->r);
+            if (SCL_OK != result)
+            {
+                goto cleanup;
+            }
+
+            result = scl->bignum_func.is_null(scl, (uint32_t *)nonce->r,
+                                              curve_params->curve_wsize);
+            if (false != result)
+            {
+                /* r shall not be null, draw another k */
+                continue;
+            }
+
+            /**
+             * k^(-1) is computed as m1.(m1.k)^(-1) so the inversion, which is
+             * not protected against SCA, never handles k directly
+             */
+            result = soft_ecdsa_random_scalar(scl, curve_params, NULL,
+                                              nbbits, m1);
+            if (SCL_OK != result)
+            {
+                goto cleanup;
+            }
+
+            result = scl->bignum_func.set_modulus(
+                scl, &bignum_ctx, curve_params->n, curve_params->curve_wsize);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+
+            /* m1.k */
+            result = soft_ecdsa_mod_n_mult(scl, &bignum_ctx, curve_params,
+                                           (uint64_t *)m1, (uint64_t *)k,
+                                           (uint64_t *)u1);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+
+            /* (m1.k)^(-1) */
+            result = soft_ecdsa_mod_n_inv(scl, &bignum_ctx, curve_params,
+                                          (uint64_t *)u1, (uint64_t *)u1);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+
+            /* k^(-1) = m1.(m1.k)^(-1) */
+            result = soft_ecdsa_mod_n_mult(scl, &bignum_ctx, curve_params,
+                                           (uint64_t *)u1, (uint64_t *)m1,
+                                           nonce->k_inv);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+
+            pool->nb_available++;
+            nb_nonces--;
+        }
+
+        result = (int32_t)pool->nb_available;
+
+    cleanup:
+        if ((SCL_OK > result) && (NULL != nonce))
+        {
+            memset(nonce, 0, sizeof(*nonce));
+        }
+        memset(k, 0, sizeof(k));
+        memset(m1, 0, sizeof(m1));
+        memset(u1, 0, sizeof(u1));
+    }
+
+    return (result);
+}
+
+int32_t soft_ecdsa_signature_with_pool(const metal_scl_t *const scl,
+                                       const ecc_curve_t *const curve_params,
+                                       const uint8_t *const priv_key,
+                                       ecdsa_nonce_pool_t *const pool,
+                                       const ecdsa_signature_t *const signature,
+                                       const uint8_t *const hash,
+                                       size_t hash_len)
+{
+    int32_t result;
+    size_t nbbits;
+    size_t i;
+    uint8_t diff;
+    bignum_ctx_t bignum_ctx;
+    ecdsa_nonce_t *nonce;
+
+    if ((NULL == scl) || (NULL == priv_key) || (NULL == signature) ||
+        (NULL == hash) || (NULL == curve_params) || (NULL == pool))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == signature->r) || (NULL == signature->s) ||
+        (NULL == curve_params->n) || (NULL == pool->nonces))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    /* Check curve length */
+    if ((ECDSA_MAX_32B_WORDSIZE < curve_params->curve_wsize) ||
+        (ECDSA_MIN_32B_WORDSIZE > curve_params->curve_wsize))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    /* the pool shall be bound to this curve and this private key */
+    if ((curve_params != pool->curve_params) ||
+        (pool->nb_available > pool->nb_nonces))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    diff = 0;
+    for (i = 0; i < curve_params->curve_bsize; i++)
+    {
+        diff |= (uint8_t)(pool->priv_key[i] ^ priv_key[i]);
+    }
+
+    if (0 != diff)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->trng_func.get_data) ||
+        (NULL == scl->bignum_func.is_null) ||
+        (NULL == scl->bignum_func.compare) ||
+        (NULL == scl->bignum_func.mod_mult) ||
+        (NULL == scl->bignum_func.mod_add) ||
+        (NULL == scl->bignum_func.mod_sub) ||
+        (NULL == scl->bignum_func.get_msb_set) ||
+        (NULL == scl->bignum_func.set_modulus))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    /* determine the n msb */
+    result = scl->bignum_func.get_msb_set(scl, curve_params->n,
+                                          curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+    else if (0 == result)
+    {
+        /* at least on bit should be set */
+        return (SCL_ERROR);
+    }
+
+    nbbits = (size_t)result - 1;
+
+    result = scl->bignum_func.set_modulus(scl, &bignum_ctx, curve_params->n,
+                                          curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    {
+        uint32_t r[curve_params->curve_wsize] __attribute__((aligned(8)));
+        uint32_t s[curve_params->curve_wsize] __attribute__((aligned(8)));
+        uint32_t e[curve_params->curve_wsize] __attribute__((aligned(8)));
+        uint32_t d[curve_params->curve_wsize] __attribute__((aligned(8)));
+        uint32_t u1[curve_params->curve_wsize] __attribute__((aligned(8)));
+        uint32_t w[curve_params->curve_wsize] __attribute__((aligned(8)));
+        uint32_t k_inv[curve_params->curve_wsize] __attribute__((aligned(8)));
+        uint32_t m2[curve_params->curve_wsize] __attribute__((aligned(8)));
+
+        do
+        {
+            if (0 == pool->nb_available)
+            {
+                /* no (more) precomputed nonce, regular signature */
+                result = soft_ecdsa_signature(scl, curve_params, priv_key,
+                                              signature, hash, hash_len);
+                goto cleanup;
+            }
+
+            /**
+             * a nonce shall never be used twice, so it is removed from the
+             * pool before being used
+             */
+            pool->nb_available--;
+            nonce = &pool->nonces[pool->nb_available];
+            memcpy(k_inv, nonce->k_inv, sizeof(k_inv));
+            memcpy(r, nonce->r, sizeof(r));
+            memset(nonce, 0, sizeof(*nonce));
+
+            /**
+             * algorithm for d protection
+             * s=k^(-1).(h+r.d) mod n
+             * d is hidden by an additive mask m2
+             * s=k^(-1).(h+r.(d+m2)-r.m2) mod n
+             */
+
+            /* 6.1 generate m2 */
+            result = soft_ecdsa_random_scalar(scl, curve_params, NULL,
+                                              nbbits, m2);
+            if (SCL_OK != result)
+            {
+                goto cleanup;
+            }
+
+            /* 6.2 d+m2 */
+            memset(d, 0, sizeof(d));
+            copy_swap_array((uint8_t *)d, priv_key, curve_params->curve_bsize);
+
+            result = soft_ecdsa_mod_n_add(scl, &bignum_ctx, curve_params,
+                                          (uint64_t *)d, (uint64_t *)m2,
+                                          (uint64_t *)u1);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+
+            /* 6.3 r.(d+m2) */
+            result = soft_ecdsa_mod_n_mult(scl, &bignum_ctx, curve_params,
+                                           (uint64_t *)u1, (uint64_t *)r,
+                                           (uint64_t *)u1);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+
+            /* 6.4 r.m2 */
+            result = soft_ecdsa_mod_n_mult(scl, &bignum_ctx, curve_params,
+                                           (uint64_t *)m2, (uint64_t *)r,
+                                           (uint64_t *)w);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+
+            /* 6.5 r.d = r.(d+m2) - r.m2 */
+            result = soft_ecdsa_mod_n_sub(scl, &bignum_ctx, curve_params,
+                                          (uint64_t *)u1, (uint64_t *)w,
+                                          (uint64_t *)u1);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+
+            /* 6.6 h+r.d */
+            memset(e, 0, sizeof(e));
+            copy_swap_array((uint8_t *)e, hash,
+                            MIN(hash_len, curve_params->curve_bsize));
+
+            /* h may be greater than n */
+            result = soft_ecdsa_mod_n(scl, curve_params, (uint64_t *)e,
+                                      (uint64_t *)w);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+
+            result = soft_ecdsa_mod_n_add(scl, &bignum_ctx, curve_params,
+                                          (uint64_t *)w, (uint64_t *)u1,
+                                          (uint64_t *)w);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+
+            /* 6.7 s=k^(-1).(h+r.d) */
+            result = soft_ecdsa_mod_n_mult(scl, &bignum_ctx, curve_params,
+                                           (uint64_t *)k_inv, (uint64_t *)w,
+                                           (uint64_t *)s);
+            if (SCL_OK > result)
+            {
+                goto cleanup;
+            }
+
+            /* check the signature is not null, otherwise use another nonce */
+            result =
+                scl->bignum_func.is_null(scl, s, curve_params->curve_wsize);
+        } while (false != result);
+
+        copy_swap_array(signature->r, (uint8_t *)r, curve_params->curve_bsize);
+        copy_swap_array(signature->s, (uint8_t *)s, curve_params->curve_bsize);
+
+        result = SCL_OK;
+
+    cleanup:
+        memset(k_inv, 0, sizeof(k_inv));
+        memset(d, 0, sizeof(d));
+        memset(u1, 0, sizeof(u1));
+        memset(m2, 0, sizeof(m2));
+    }
+
+    return (result);
+}
+
+/**
+ * @brief check ECDSA verification inputs
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] pub_key       public key
+ * @param[in] signature     signature to check
+ * @param[in] hash          hash value on which the signature has been performed
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+static int32_t soft_ecdsa_verification_check_inputs(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_affine_const_point_t *const pub_key,
+    const ecdsa_signature_const_t *const signature, const uint8_t *const hash)
+{
+    if ((NULL == scl) || (NULL == pub_key) || (NULL == signature) ||
+        (NULL == hash) || (NULL == curve_params))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == pub_key->x) || (NULL == pub_key->y) ||
+        (NULL == signature->r) || (NULL == signature->s) ||
+        (NULL == curve_params->n))
+
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->bignum_func.is_null) || (NULL == scl->bignum_func.mod) ||
+        (NULL == scl->bignum_func.compare) ||
+        (NULL == scl->bignum_func.mod_mult) ||
+        (NULL == scl->bignum_func.mod_inv) ||
+        (NULL == scl->bignum_func.set_modulus))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    /* Check curve length */
+    if ((ECDSA_MAX_32B_WORDSIZE < curve_params->curve_wsize) ||
+        (ECDSA_MIN_32B_WORDSIZE > curve_params->curve_wsize))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    return (SCL_OK);
+}
+
+/**
+ * @brief ECDSA verification setup: check r and s, compute u1 and u2 and the
+ * iP + jQ precomputed table
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] pub_key       public key
+ * @param[in] signature     signature to check
+ * @param[in] hash          hash value on which the signature has been performed
+ * @param[in] hash_len      hash value length
+ * @param[out] r            signature r element (big integer)
+ * @param[out] u1           u1 = e.s^(-1) mod n
+ * @param[out] u2           u2 = r.s^(-1) mod n
+ * @param[out] ip_jq        iP + jQ table (@ref SCL_ECDSA_ARRAY_SIZE points)
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+static int32_t soft_ecdsa_verification_setup(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_affine_const_point_t *const pub_key,
+    const ecdsa_signature_const_t *const signature, const uint8_t *const hash,
+    size_t hash_len, uint32_t *const r, uint32_t *const u1, uint32_t *const u2,
+    ecc_bignum_jacobian_point_t *const ip_jq)
+{
+    int32_t result;
+    bignum_ctx_t bignum_ctx;
+    size_t i, j;
+
+    /* signature intermediate buffer to swap  */
+    uint32_t s[curve_params->curve_wsize] __attribute__((aligned(8)));
+
+    /**
+     * The notation used here follow the ones in ANSI X9-62
+     */
+    uint32_t e[curve_params->curve_wsize] __attribute__((aligned(8)));
+    uint32_t z[curve_params->curve_wsize] __attribute__((aligned(8)));
+
+    /* Public key components */
+    uint32_t xq[curve_params->curve_wsize] __attribute__((aligned(8)));
+    uint32_t yq[curve_params->curve_wsize] __attribute__((aligned(8)));
+
+    ecc_bignum_affine_point_t point_aff;
+
+    /* Copy-swap signature */
+    memset(r, 0, curve_params->curve_wsize * sizeof(uint32_t));
+    memset(s, 0, curve_params->curve_wsize * sizeof(uint32_t));
+    copy_swap_array((uint8_t *)r, signature->r, curve_params->curve_bsize);
+    copy_swap_array((uint8_t *)s, signature->s, curve_params->curve_bsize);
+
+    /* a. Check that r and s are in the interval [1, n-1] */
+    result = scl->bignum_func.compare(scl, (uint64_t *)r, curve_params->n,
+                                      curve_params->curve_wsize);
+    if (result >= 0)
+    {
+        return (SCL_ERR_SIGNATURE);
+    }
+
+    result = scl->bignum_func.compare(scl, (uint64_t *)s, curve_params->n,
+                                      curve_params->curve_wsize);
+    if (result >= 0)
+    {
+        return (SCL_ERR_SIGNATURE);
+    }
+
+    result = scl->bignum_func.is_null(scl, r, curve_params->curve_wsize);
+    if (false != result)
+    {
+        return (SCL_ERR_SIGNATURE);
+    }
+
+    result = scl->bignum_func.is_null(scl, s, curve_params->curve_wsize);
+    if (false != result)
+    {
+        return (SCL_ERR_SIGNATURE);
+    }
+
+    /* c. Copy hash into e */
+    memset(e, 0, curve_params->curve_wsize * sizeof(uint32_t));
+    copy_swap_array((uint8_t *)e, hash,
+                    MIN(hash_len, curve_params->curve_bsize));
+
+    /* set modulus context */
+    result = scl->bignum_func.set_modulus(scl, &bignum_ctx, curve_params->n,
+                                          curve_params->curve_wsize);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* Compute z = s^(-1) mod n */
+    result = soft_ecdsa_mod_n_inv(scl, &bignum_ctx, curve_params, (uint64_t *)s,
+                                  (uint64_t *)z);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* d. Compute u1 = e.z mod n and u2 = r.z mod n */
+    result = soft_ecdsa_mod_n_mult(scl, &bignum_ctx, curve_params,
+                                   (uint64_t *)e, (uint64_t *)z,
+                                   (uint64_t *)u1);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    result = soft_ecdsa_mod_n_mult(scl, &bignum_ctx, curve_params,
+                                   (uint64_t *)r, (uint64_t *)z,
+                                   (uint64_t *)u2);
+    if (SCL_OK > result)
+    {
+        return (result);
+    }
+
+    /* Public key */
+    memset(xq, 0, curve_params->curve_wsize * sizeof(uint32_t));
+    copy_swap_array((uint8_t *)xq, pub_key->x, curve_params->curve_bsize);
+    memset(yq, 0, curve_params->curve_wsize * sizeof(uint32_t));
+    copy_swap_array((uint8_t *)yq, pub_key->y, curve_params->curve_bsize);
+
+    /* Compute 1.P */
+    result = soft_ecc_convert_affine_to_jacobian(scl, curve_params,
+                                                 curve_params->g, &ip_jq[1],
+                                                 curve_params->curve_wsize);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+    /* Compute 2.P */
+    result = soft_ecc_double_jacobian(scl, curve_params, &ip_jq[1], &ip_jq[2],
+                                      curve_params->curve_wsize);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+    /* Compute 3.P */
+    result = soft_ecc_add_jacobian_jacobian(scl, curve_params, &ip_jq[1],
+                                            &ip_jq[2], &ip_jq[3],
+                                            curve_params->curve_wsize);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    /* point contains the public key */
+    point_aff.x = (uint64_t *)xq;
+    point_aff.y = (uint64_t *)yq;
 
-            /* 6.9 final computation */
-            result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)w,
-                                               (uint64_t *)r, (uint64_t *)s,
-                                               curve_params->curve_wsize);
-            if (SCL_OK > result)
+    /* Compute 1.Q */
+    result = soft_ecc_convert_affine_to_jacobian(
+        scl, curve_params, (ecc_bignum_affine_const_point_t *)&point_aff,
+        &ip_jq[4], curve_params->curve_wsize);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+    /* Compute 2.Q */
+    result = soft_ecc_double_jacobian(scl, curve_params, &ip_jq[4], &ip_jq[8],
+                                      curve_params->curve_wsize);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+    /* Compute 3.Q */
+    result = soft_ecc_add_jacobian_jacobian(scl, curve_params, &ip_jq[4],
+                                            &ip_jq[8], &ip_jq[12],
+                                            curve_params->curve_wsize);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    /* computing all the combinations of iP + jQ */
+    for (j = 4; j <= 12; j += 4)
+    {
+        for (i = 0; i < 3; i++)
+        {
+            result = soft_ecc_add_jacobian_jacobian(
+                scl, curve_params, &ip_jq[j], &ip_jq[i + 1], &ip_jq[j + 1 + i],
+                curve_params->curve_wsize);
+            if (SCL_OK != result)
             {
-                goto cleanup;
+                return (result);
             }
+        }
+    }
 
-            /* check the signature is not null: 5. and 6. */
-            result =
-                scl->bignum_func.is_null(scl, s, curve_params->curve_wsize);
+    return (SCL_OK);
+}
 
-            result_2 =
-                scl->bignum_func.is_null(scl, r, curve_params->curve_wsize);
-        } while ((false != result) && (false != result_2));
+/**
+ * @brief process one window of u1.G + u2.Q (algo 3.48 step 4 in GtECC)
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in] ip_jq         iP + jQ table
+ * @param[in] u1            u1 = e.s^(-1) mod n
+ * @param[in] u2            u2 = r.s^(-1) mod n
+ * @param[in] i             window index
+ * @param[in,out] point_jac accumulator
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+static int32_t soft_ecdsa_verification_window(
+    const metal_scl_t *const scl, const ecc_curve_t *const curve_params,
+    const ecc_bignum_jacobian_point_t *const ip_jq, const uint32_t *const u1,
+    const uint32_t *const u2, size_t i,
+    ecc_bignum_jacobian_point_t *const point_jac)
+{
+    int32_t result;
+    size_t j, ki_li;
 
-        /* 6 result */
-        copy_swap_array(signature->s, (uint8_t *)s, curve_params->curve_bsize);
+    /** 4.1 */
+    for (j = 0; j < SCL_ECDSA_WINDOW_WIDTH; j++)
+    {
+        result = soft_ecc_double_jacobian(scl, curve_params, point_jac,
+                                          point_jac, curve_params->curve_wsize);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
     }
 
-    result = SCL_OK;
-cleanup:
-    return (result);
+    /**
+     * 4.2 two-bit (due to windows width : SCL_ECDSA_WINDOW_WIDTH)
+     * wide at a time
+     */
+
+    ki_li = (soft_ecc_bit_extract(u1, i * 2) ^
+             (soft_ecc_bit_extract(u1, i * 2 + 1) << 1)) ^
+            ((soft_ecc_bit_extract(u2, i * 2) ^
+              (soft_ecc_bit_extract(u2, i * 2 + 1) << 1))
+             << 2);
+    if (0 != ki_li)
+    {
+        result = soft_ecc_add_jacobian_jacobian(scl, curve_params,
+                                                &ip_jq[ki_li], point_jac,
+                                                point_jac,
+                                                curve_params->curve_wsize);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+    }
+
+    return (SCL_OK);
 }
 
-int32_t soft_ecdsa_verification(const metal_scl_t *const scl,
-                                const ecc_curve_t *const curve_params,
-                                const ecc_affine_const_point_t *const pub_key,
-                                const ecdsa_signature_const_t *const signature,
-                                const uint8_t *const hash, size_t hash_len)
+/**
+ * @brief ECDSA verification last steps, check x(u1.G + u2.Q) mod n == r
+ *
+ * @param[in] scl           metal scl context
+ * @param[in] curve_params  ECC curve parameters
+ * @param[in,out] point_jac u1.G + u2.Q (destroyed)
+ * @param[in] r             signature r element (big integer)
+ * @return 0 in case of success
+ * @return > 0 in case of failure @ref scl_errors_t
+ */
+static int32_t
+soft_ecdsa_verification_final(const metal_scl_t *const scl,
+                              const ecc_curve_t *const curve_params,
+                              ecc_bignum_jacobian_point_t *const point_jac,
+                              const uint32_t *const r)
 {
     int32_t result;
-    bignum_ctx_t bignum_ctx;
-    size_t i, j, ki_li;
-    size_t nb_64_bits_words_curve;
-    size_t n;
+    ecc_bignum_affine_point_t point_aff;
 
-    if ((NULL == scl) || (NULL == pub_key) || (NULL == signature) ||
-        (NULL == hash) || (NULL == curve_params))
+    /* 4. (x1,y1)=u1.G+u2.Q */
+    point_aff.x = point_jac->x;
+    point_aff.y = point_jac->y;
+
+    /* f. */
+    result = soft_ecc_convert_jacobian_to_affine(scl, curve_params, point_jac,
+                                                 &point_aff,
+                                                 curve_params->curve_wsize);
+    if (SCL_OK != result)
     {
-        return (SCL_INVALID_INPUT);
+        return (result);
     }
 
-    if ((NULL == pub_key->x) || (NULL == pub_key->y) ||
-        (NULL == signature->r) || (NULL == signature->s) ||
-        (NULL == curve_params->n))
-
+    /* g. v=x1 mod n (using z1 as v) */
+    result = soft_ecdsa_mod_n(scl, curve_params, point_aff.x, point_jac->z);
+    if (SCL_OK != result)
     {
-        return (SCL_INVALID_INPUT);
+        return (result);
     }
 
-    if ((NULL == scl->bignum_func.is_null) || (NULL == scl->bignum_func.mod) ||
-        (NULL == scl->bignum_func.compare) ||
-        (NULL == scl->bignum_func.mod_mult) ||
-        (NULL == scl->bignum_func.mod_inv) ||
-        (NULL == scl->bignum_func.set_modulus))
+    /* h. if (r==v) the signature is ok */
+    if (0 !=
+        memcmp(r, point_jac->z, curve_params->curve_wsize * sizeof(uint32_t)))
     {
-        return (SCL_ERROR_API_ENTRY_POINT);
+        return (SCL_ERR_SIGNATURE);
     }
 
-    /* Check curve length */
-    if ((ECDSA_MAX_32B_WORDSIZE < curve_params->curve_wsize) ||
-        (ECDSA_MIN_32B_WORDSIZE > curve_params->curve_wsize))
+    return (SCL_OK);
+}
+
+int32_t soft_ecdsa_verification(const metal_scl_t *const scl,
+                                const ecc_curve_t *const curve_params,
+                                const ecc_affine_const_point_t *const pub_key,
+                                const ecdsa_signature_const_t *const signature,
+                                const uint8_t *const hash, size_t hash_len)
+{
+    int32_t result;
+    size_t i;
+    size_t nb_64_bits_words_curve;
+    size_t n;
+
+    result = soft_ecdsa_verification_check_inputs(scl, curve_params, pub_key,
+                                                  signature, hash);
+    if (SCL_OK != result)
     {
-        return (SCL_INVALID_LENGTH);
+        return (result);
     }
 
     nb_64_bits_words_curve =
         curve_params->curve_wsize / 2 + curve_params->curve_wsize % 2;
 
     {
-        /* signature intermediate buffer to swap  */
         uint32_t r[curve_params->curve_wsize] __attribute__((aligned(8)));
-        uint32_t s[curve_params->curve_wsize] __attribute__((aligned(8)));
-
-        /**
-         * The notation used here follow the ones in ANSI X9-62
-         */
-        uint32_t e[curve_params->curve_wsize] __attribute__((aligned(8)));
-        uint32_t z[curve_params->curve_wsize] __attribute__((aligned(8)));
         uint32_t u1[curve_params->curve_wsize] __attribute__((aligned(8)));
         uint32_t u2[curve_params->curve_wsize] __attribute__((aligned(8)));
 
@@ -612,20 +1796,8 @@ int32_t soft_ecdsa_verification(const metal_scl_t *const scl,
         uint32_t y1[curve_params->curve_wsize] __attribute__((aligned(8)));
         uint32_t z1[curve_params->curve_wsize] __attribute__((aligned(8)));
 
-        /* Public key components */
-        uint32_t xq[curve_params->curve_wsize] __attribute__((aligned(8)));
-        uint32_t yq[curve_params->curve_wsize] __attribute__((aligned(8)));
-
-        ecc_bignum_affine_point_t point_aff;
         ecc_bignum_jacobian_point_t point_jac;
 
-        /** algo 3.48 in GtECC (Guide to Elliptic Curve Cryptography) with w=2,
-         * so 2^w=4, so i=0..3, j=0..3 the array for storing the precomputed
-         * values is 16-point large */
-#define SCL_ECDSA_WINDOW_WIDTH 2
-#define SCL_ECDSA_ARRAY_SIZE                                                   \
-    (1 << SCL_ECDSA_WINDOW_WIDTH) * (1 << SCL_ECDSA_WINDOW_WIDTH)
-
         /**
          * variables that contain the precomputed values
          * iP + jQ window method matrix
@@ -636,88 +1808,6 @@ int32_t soft_ecdsa_verification(const metal_scl_t *const scl,
         uint64_t ip_jq_y[SCL_ECDSA_ARRAY_SIZE][nb_64_bits_words_curve];
         uint64_t ip_jq_z[SCL_ECDSA_ARRAY_SIZE][nb_64_bits_words_curve];
 
-        /* Copy-swap signature */
-        memset(r, 0, curve_params->curve_wsize * sizeof(uint32_t));
-        memset(s, 0, curve_params->curve_wsize * sizeof(uint32_t));
-        copy_swap_array((uint8_t *)r, signature->r, curve_params->curve_bsize);
-        copy_swap_array((uint8_t *)s, signature->s, curve_params->curve_bsize);
-
-        /* a. Check that r and s are in the interval [1, n-1] */
-        result = scl->bignum_func.compare(scl, (uint64_t *)r, curve_params->n,
-                                          curve_params->curve_wsize);
-        if (result >= 0)
-        {
-            result = SCL_ERR_SIGNATURE;
-            goto cleanup;
-        }
-
-        result = scl->bignum_func.compare(scl, (uint64_t *)s, curve_params->n,
-                                          curve_params->curve_wsize);
-        if (result >= 0)
-        {
-            result = SCL_ERR_SIGNATURE;
-            goto cleanup;
-        }
-
-        result = scl->bignum_func.is_null(scl, r, curve_params->curve_wsize);
-        if (false != result)
-        {
-            result = SCL_ERR_SIGNATURE;
-            goto cleanup;
-        }
-
-        result = scl->bignum_func.is_null(scl, s, curve_params->curve_wsize);
-        if (false != result)
-        {
-            result = SCL_ERR_SIGNATURE;
-            goto cleanup;
-        }
-
-        /* c. Copy hash into e */
-        memset(e, 0, curve_params->curve_wsize * sizeof(uint32_t));
-        copy_swap_array((uint8_t *)e, hash,
-                        MIN(hash_len, curve_params->curve_bsize));
-
-        /* set modulus context */
-        result = scl->bignum_func.set_modulus(scl, &bignum_ctx, curve_params->n,
-                                              curve_params->curve_wsize);
-        if (SCL_OK > result)
-        {
-            return (result);
-        }
-
-        /* Compute z = s^(-1) mod n */
-        result =
-            scl->bignum_func.mod_inv(scl, &bignum_ctx, (uint64_t *)s,
-                                     (uint64_t *)z, curve_params->curve_wsize);
-        if (SCL_OK > result)
-        {
-            return (result);
-        }
-
-        /* d. Compute u1 = e.z mod n and u2 = r.z mod n */
-        result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)e,
-                                           (uint64_t *)z, (uint64_t *)u1,
-                                           curve_params->curve_wsize);
-        if (SCL_OK > result)
-        {
-            return (result);
-        }
-
-        result = scl->bignum_func.mod_mult(scl, &bignum_ctx, (uint64_t *)r,
-                                           (uint64_t *)z, (uint64_t *)u2,
-                                           curve_params->curve_wsize);
-        if (SCL_OK > result)
-        {
-            return (result);
-        }
-
-        /* Public key */
-        memset(xq, 0, curve_params->curve_wsize * sizeof(uint32_t));
-        copy_swap_array((uint8_t *)xq, pub_key->x, curve_params->curve_bsize);
-        memset(yq, 0, curve_params->curve_wsize * sizeof(uint32_t));
-        copy_swap_array((uint8_t *)yq, pub_key->y, curve_params->curve_bsize);
-
         /* ip_jq structure adapted to the functions APIs */
         for (i = 0; i < SCL_ECDSA_ARRAY_SIZE; i++)
         {
@@ -726,71 +1816,13 @@ int32_t soft_ecdsa_verification(const metal_scl_t *const scl,
             ip_jq[i].z = &ip_jq_z[i][0];
         }
 
-        /* Compute 1.P */
-        result = soft_ecc_convert_affine_to_jacobian(scl, curve_params,
-                                                     curve_params->g, &ip_jq[1],
-                                                     curve_params->curve_wsize);
-        if (SCL_OK != result)
-        {
-            goto cleanup;
-        }
-        /* Compute 2.P */
-        result = soft_ecc_double_jacobian(scl, curve_params, &ip_jq[1],
-                                          &ip_jq[2], curve_params->curve_wsize);
-        if (SCL_OK != result)
-        {
-            goto cleanup;
-        }
-        /* Compute 3.P */
-        result = soft_ecc_add_jacobian_jacobian(scl, curve_params, &ip_jq[1],
-                                                &ip_jq[2], &ip_jq[3],
-                                                curve_params->curve_wsize);
-        if (SCL_OK != result)
-        {
-            goto cleanup;
-        }
-
-        /* point contains the public key */
-        point_aff.x = (uint64_t *)xq;
-        point_aff.y = (uint64_t *)yq;
-
-        /* Compute 1.Q */
-        result = soft_ecc_convert_affine_to_jacobian(
-            scl, curve_params, (ecc_bignum_affine_const_point_t *)&point_aff,
-            &ip_jq[4], curve_params->curve_wsize);
+        /* a. to d. and precomputation */
+        result = soft_ecdsa_verification_setup(scl, curve_params, pub_key,
+                                               signature, hash, hash_len, r,
+                                               u1, u2, ip_jq);
         if (SCL_OK != result)
         {
-            goto cleanup;
-        }
-        /* Compute 2.Q */
-        result = soft_ecc_double_jacobian(scl, curve_params, &ip_jq[4],
-                                          &ip_jq[8], curve_params->curve_wsize);
-        if (SCL_OK != result)
-        {
-            goto cleanup;
-        }
-        /* Compute 3.Q */
-        result = soft_ecc_add_jacobian_jacobian(scl, curve_params, &ip_jq[4],
-                                                &ip_jq[8], &ip_jq[12],
-                                                curve_params->curve_wsize);
-        if (SCL_OK != result)
-        {
-            goto cleanup;
-        }
-
-        /* computing all the combinations of iP + jQ */
-        for (j = 4; j <= 12; j += 4)
-        {
-            for (i = 0; i < 3; i++)
-            {
-                result = soft_ecc_add_jacobian_jacobian(
-                    scl, curve_params, &ip_jq[j], &ip_jq[i + 1],
-                    &ip_jq[j + 1 + i], curve_params->curve_wsize);
-                if (SCL_OK != result)
-                {
-                    goto cleanup;
-                }
-            }
+            return (result);
         }
 
         n = curve_params->curve_wsize * sizeof(uint32_t) * CHAR_BIT;
@@ -816,71 +1848,144 @@ int32_t soft_ecdsa_verification(const metal_scl_t *const scl,
         {
             i--;
 
-            /** 4.1 */
-            for (j = 0; j < SCL_ECDSA_WINDOW_WIDTH; j++)
+            result = soft_ecdsa_verification_window(scl, curve_params, ip_jq,
+                                                    u1, u2, i, &point_jac);
+            if (SCL_OK != result)
             {
-                result = soft_ecc_double_jacobian(scl, curve_params, &point_jac,
-                                                  &point_jac,
-                                                  curve_params->curve_wsize);
-                if (SCL_OK != result)
-                {
-                    goto cleanup;
-                }
+                return (result);
             }
+        }
 
-            /**
-             * 4.2 two-bit (due to windows width : SCL_ECDSA_WINDOW_WIDTH)
-             * wide at a time
-             */
+        /* f. to h. */
+        result = soft_ecdsa_verification_final(scl, curve_params, &point_jac,
+                                               r);
+    }
 
-            ki_li = (soft_ecc_bit_extract(u1, i * 2) ^
-                     (soft_ecc_bit_extract(u1, i * 2 + 1) << 1)) ^
-                    ((soft_ecc_bit_extract(u2, i * 2) ^
-                      (soft_ecc_bit_extract(u2, i * 2 + 1) << 1))
-                     << 2);
-            if (0 != ki_li)
-            {
-                result = soft_ecc_add_jacobian_jacobian(
-                    scl, curve_params, &ip_jq[ki_li], &point_jac, &point_jac,
-                    curve_params->curve_wsize);
-                if (SCL_OK != result)
-                {
-                    goto cleanup;
-                }
-            }
-        }
+    return (result);
+}
+
+int32_t soft_ecdsa_verification_start(
+    const metal_scl_t *const scl, ecdsa_verification_ctx_t *const ctx,
+    const ecc_curve_t *const curve_params,
+    const ecc_affine_const_point_t *const pub_key,
+    const ecdsa_signature_const_t *const signature, const uint8_t *const hash,
+    size_t hash_len)
+{
+    int32_t result;
+    size_t i;
+    ecc_bignum_jacobian_point_t ip_jq[SCL_ECDSA_ARRAY_SIZE];
 
-        /* 4. (x1,y1)=u1.G+u2.Q */
-        point_aff.x = (uint64_t *)x1;
-        point_aff.y = (uint64_t *)y1;
+    if (NULL == ctx)
+    {
+        return (SCL_INVALID_INPUT);
+    }
 
-        /* f. */
-        result = soft_ecc_convert_jacobian_to_affine(scl, curve_params,
-                                                     &point_jac, &point_aff,
-                                                     curve_params->curve_wsize);
-        if (SCL_OK != result)
-        {
-            goto cleanup;
-        }
+    result = soft_ecdsa_verification_check_inputs(scl, curve_params, pub_key,
+                                                  signature, hash);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    memset(ctx, 0, sizeof(*ctx));
+
+    for (i = 0; i < SCL_ECDSA_ARRAY_SIZE; i++)
+    {
+        ip_jq[i].x = ctx->ip_jq_x[i];
+        ip_jq[i].y = ctx->ip_jq_y[i];
+        ip_jq[i].z = ctx->ip_jq_z[i];
+    }
+
+    /* a. to d. and precomputation */
+    result = soft_ecdsa_verification_setup(
+        scl, curve_params, pub_key, signature, hash, hash_len,
+        (uint32_t *)ctx->r, (uint32_t *)ctx->u1, (uint32_t *)ctx->u2, ip_jq);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    /* 3. r=infinite */
+    ctx->x1[0] = 1;
+    ctx->y1[0] = 1;
+
+    ctx->curve_params = curve_params;
+    ctx->window_idx = (curve_params->curve_wsize * sizeof(uint32_t) *
+                       CHAR_BIT) /
+                      SCL_ECDSA_WINDOW_WIDTH;
+
+    return (SCL_OK);
+}
+
+int32_t soft_ecdsa_verification_step(const metal_scl_t *const scl,
+                                     ecdsa_verification_ctx_t *const ctx,
+                                     size_t max_iterations)
+{
+    int32_t result;
+    size_t i;
+    ecc_bignum_jacobian_point_t point_jac;
+    ecc_bignum_jacobian_point_t ip_jq[SCL_ECDSA_ARRAY_SIZE];
+
+    if ((NULL == scl) || (NULL == ctx) || (NULL == ctx->curve_params))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    for (i = 0; i < SCL_ECDSA_ARRAY_SIZE; i++)
+    {
+        ip_jq[i].x = ctx->ip_jq_x[i];
+        ip_jq[i].y = ctx->ip_jq_y[i];
+        ip_jq[i].z = ctx->ip_jq_z[i];
+    }
 
-        /* g. v=x1 mod n (using z1 as v) */
-        result = scl->bignum_func.mod(
-            scl, (uint64_t *)x1, curve_params->curve_wsize, curve_params->n,
-            curve_params->curve_wsize, (uint64_t *)z1);
+    point_jac.x = ctx->x1;
+    point_jac.y = ctx->y1;
+    point_jac.z = ctx->z1;
+
+    /* 4. */
+    while ((0 != ctx->window_idx) && (0 != max_iterations))
+    {
+        result = soft_ecdsa_verification_window(
+            scl, ctx->curve_params, ip_jq, (uint32_t *)ctx->u1,
+            (uint32_t *)ctx->u2, ctx->window_idx - 1, &point_jac);
         if (SCL_OK != result)
         {
-            goto cleanup;
+            return (result);
         }
 
-        /* h. if (r==v) the signature is ok */
-        if (0 != memcmp(r, z1, curve_params->curve_wsize * sizeof(uint32_t)))
-        {
-            result = SCL_ERR_SIGNATURE;
-            goto cleanup;
-        }
+        ctx->window_idx--;
+        max_iterations--;
     }
 
-    result = SCL_OK;
-cleanup:
+    return ((int32_t)ctx->window_idx);
+}
+
+int32_t soft_ecdsa_verification_finish(const metal_scl_t *const scl,
+                                       ecdsa_verification_ctx_t *const ctx)
+{
+    int32_t result;
+    ecc_bignum_jacobian_point_t point_jac;
+
+    if ((NULL == scl) || (NULL == ctx) || (NULL == ctx->curve_params))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (0 != ctx->window_idx)
+    {
+        return (SCL_BUSY);
+    }
+
+    point_jac.x = ctx->x1;
+    point_jac.y = ctx->y1;
+    point_jac.z = ctx->z1;
+
+    /* f. to h. */
+    result = soft_ecdsa_verification_final(scl, ctx->curve_params, &point_jac,
+                                           (uint32_t *)ctx->r);
+
+    /* the context can not be finished twice */
+    ctx->curve_params = NULL;
+
     return (result);
 }
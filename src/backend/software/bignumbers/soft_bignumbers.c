@@ -1180,6 +1180,108 @@ int32_t soft_bignum_mod_sub(const metal_scl_t *const scl,
     return (SCL_OK);
 }
 
+int32_t soft_bignum_mod_add_lazy(const metal_scl_t *const scl,
+                                 const bignum_ctx_t *const ctx,
+                                 const uint64_t *const in_a,
+                                 const uint64_t *const in_b,
+                                 uint64_t *const out, size_t nb_32b_words)
+{
+    int32_t result;
+    int32_t carry;
+    const uint32_t *modulus32;
+    const uint32_t *out32 = (const uint32_t *)out;
+
+    if ((NULL == scl) || (NULL == ctx) || (NULL == ctx->modulus))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->bignum_func.add) || (NULL == scl->bignum_func.sub))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    /* output should be modulus size */
+    if (nb_32b_words != ctx->modulus_nb_32b_words)
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    modulus32 = (const uint32_t *)ctx->modulus;
+
+    carry = scl->bignum_func.add(scl, in_a, in_b, out, nb_32b_words);
+    if (SCL_OK > carry)
+    {
+        return (carry);
+    }
+
+    /**
+     * only the most significant word is checked, the result is kept lower
+     * than 2 * modulus which is enough to feed a modular multiplication
+     */
+    while ((0 != carry) ||
+           (out32[nb_32b_words - 1] > modulus32[nb_32b_words - 1]))
+    {
+        result =
+            scl->bignum_func.sub(scl, out, ctx->modulus, out, nb_32b_words);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        carry -= result;
+    }
+
+    return (SCL_OK);
+}
+
+int32_t soft_bignum_mod_sub_lazy(const metal_scl_t *const scl,
+                                 const bignum_ctx_t *const ctx,
+                                 const uint64_t *const in_a,
+                                 const uint64_t *const in_b,
+                                 uint64_t *const out, size_t nb_32b_words)
+{
+    int32_t result;
+    int32_t borrow;
+
+    if ((NULL == scl) || (NULL == ctx) || (NULL == ctx->modulus))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->bignum_func.add) || (NULL == scl->bignum_func.sub))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    /* output should be modulus size */
+    if (nb_32b_words != ctx->modulus_nb_32b_words)
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    borrow = scl->bignum_func.sub(scl, in_a, in_b, out, nb_32b_words);
+    if (SCL_OK > borrow)
+    {
+        return (borrow);
+    }
+
+    /* the carry of the addition cancels the borrow */
+    while (0 != borrow)
+    {
+        result =
+            scl->bignum_func.add(scl, out, ctx->modulus, out, nb_32b_words);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        borrow -= result;
+    }
+
+    return (SCL_OK);
+}
+
 int32_t soft_bignum_mod_mult(const metal_scl_t *const scl,
                              const bignum_ctx_t *const ctx,
                              const uint64_t *const in_a,
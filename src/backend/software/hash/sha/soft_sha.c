@@ -30,15 +30,20 @@
  * @copyright SPDX-License-Identifier: MIT
  */
 
+#include <string.h>
+
 #include <scl/scl_retdefs.h>
 
 #include <backend/api/hash/sha/sha.h>
+#include <backend/api/utils.h>
 #include <backend/software/hash/sha/soft_sha.h>
 
 #include <backend/software/hash/sha/soft_sha224.h>
 #include <backend/software/hash/sha/soft_sha256.h>
 #include <backend/software/hash/sha/soft_sha384.h>
 #include <backend/software/hash/sha/soft_sha512.h>
+#include <backend/software/hash/sha/soft_sha512_224.h>
+#include <backend/software/hash/sha/soft_sha512_256.h>
 
 int32_t soft_sha_init(const metal_scl_t *const scl, sha_ctx_t *const ctx,
                       hash_mode_t hash_mode, endianness_t data_endianness)
@@ -51,6 +56,7 @@ int32_t soft_sha_init(const metal_scl_t *const scl, sha_ctx_t *const ctx,
     }
 
     ctx->mode = hash_mode;
+    ctx->soft_resume = false;
 
     switch (ctx->mode)
     {
@@ -62,6 +68,12 @@ int32_t soft_sha_init(const metal_scl_t *const scl, sha_ctx_t *const ctx,
         return (soft_sha384_init(&(ctx->ctx.sha384), data_endianness));
     case SCL_HASH_SHA512:
         return (soft_sha512_init(&(ctx->ctx.sha512), data_endianness));
+    case SCL_HASH_SHA512_224:
+        return (soft_sha512_224_init(&(ctx->ctx.sha512_224),
+                                     data_endianness));
+    case SCL_HASH_SHA512_256:
+        return (soft_sha512_256_init(&(ctx->ctx.sha512_256),
+                                     data_endianness));
     default:
         break;
     }
@@ -89,6 +101,12 @@ int32_t soft_sha_core(const metal_scl_t *const scl, sha_ctx_t *const ctx,
         return (soft_sha384_core(&(ctx->ctx.sha384), data, data_byte_len));
     case SCL_HASH_SHA512:
         return (soft_sha512_core(&(ctx->ctx.sha512), data, data_byte_len));
+    case SCL_HASH_SHA512_224:
+        return (soft_sha512_224_core(&(ctx->ctx.sha512_224), data,
+                                     data_byte_len));
+    case SCL_HASH_SHA512_256:
+        return (soft_sha512_256_core(&(ctx->ctx.sha512_256), data,
+                                     data_byte_len));
     default:
         break;
     }
@@ -116,9 +134,266 @@ int32_t soft_sha_finish(const metal_scl_t *const scl, sha_ctx_t *const ctx,
         return (soft_sha384_finish(&(ctx->ctx.sha384), hash, hash_len));
     case SCL_HASH_SHA512:
         return (soft_sha512_finish(&(ctx->ctx.sha512), hash, hash_len));
+    case SCL_HASH_SHA512_224:
+        return (soft_sha512_224_finish(&(ctx->ctx.sha512_224), hash,
+                                       hash_len));
+    case SCL_HASH_SHA512_256:
+        return (soft_sha512_256_finish(&(ctx->ctx.sha512_256), hash,
+                                       hash_len));
     default:
         break;
     }
 
     return (SCL_ERROR);
 }
+
+int32_t soft_sha_export_state(const metal_scl_t *const scl,
+                              const sha_ctx_t *const ctx,
+                              sha_state_t *const state)
+{
+    (void)scl;
+
+    if (NULL == ctx)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (NULL == state)
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    switch (ctx->mode)
+    {
+    case SCL_HASH_SHA224:
+    case SCL_HASH_SHA256:
+        // same context for sha224 and sha256, the full state is exported
+        copy_u32_2_u8_be(state->digest, ctx->ctx.sha256.h,
+                         SHA256_BYTE_HASHSIZE);
+        state->bitlen = ctx->ctx.sha256.bitlen;
+        memcpy(state->block_buffer, ctx->ctx.sha256.block_buffer,
+               SHA256_BYTE_BLOCKSIZE);
+        break;
+    case SCL_HASH_SHA384:
+    case SCL_HASH_SHA512:
+    case SCL_HASH_SHA512_224:
+    case SCL_HASH_SHA512_256:
+        copy_u64_2_u8_be(state->digest, ctx->ctx.sha512.h,
+                         SHA512_BYTE_HASHSIZE);
+        state->bitlen = ctx->ctx.sha512.bitlen;
+        memcpy(state->block_buffer, ctx->ctx.sha512.block_buffer,
+               SHA512_BYTE_BLOCKSIZE);
+        break;
+    default:
+        return (SCL_ERROR);
+    }
+
+    state->mode = ctx->mode;
+
+    return (SCL_OK);
+}
+
+int32_t soft_sha_import_state(const metal_scl_t *const scl,
+                              sha_ctx_t *const ctx,
+                              const sha_state_t *const state)
+{
+    (void)scl;
+
+    if ((NULL == ctx) || (NULL == state))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    switch (state->mode)
+    {
+    case SCL_HASH_SHA224:
+    case SCL_HASH_SHA256:
+        copy_u8_2_u32_be(ctx->ctx.sha256.h, state->digest,
+                         SHA256_BYTE_HASHSIZE);
+        ctx->ctx.sha256.bitlen = state->bitlen;
+        memcpy(ctx->ctx.sha256.block_buffer, state->block_buffer,
+               SHA256_BYTE_BLOCKSIZE);
+        break;
+    case SCL_HASH_SHA384:
+    case SCL_HASH_SHA512:
+    case SCL_HASH_SHA512_224:
+    case SCL_HASH_SHA512_256:
+        copy_u8_2_u64_be(ctx->ctx.sha512.h, state->digest,
+                         SHA512_BYTE_HASHSIZE);
+        ctx->ctx.sha512.bitlen = state->bitlen;
+        memcpy(ctx->ctx.sha512.block_buffer, state->block_buffer,
+               SHA512_BYTE_BLOCKSIZE);
+        break;
+    default:
+        return (SCL_ERROR);
+    }
+
+    ctx->mode = state->mode;
+    ctx->soft_resume = false;
+
+    return (SCL_OK);
+}
+
+int32_t soft_sha_multi(const metal_scl_t *const scl, hash_mode_t hash_mode,
+                       const uint8_t *const *const msgs,
+                       const size_t *const lens, size_t count,
+                       uint8_t *const *const digests, size_t *const hash_len)
+{
+    int32_t result;
+    size_t n;
+    size_t hash_size;
+    size_t digest_len;
+    sha_ctx_t ctx;
+
+    if ((NULL == msgs) || (NULL == lens))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == digests) || (NULL == hash_len))
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    switch (hash_mode)
+    {
+    case SCL_HASH_SHA224:
+        hash_size = SHA224_BYTE_HASHSIZE;
+        break;
+    case SCL_HASH_SHA256:
+        hash_size = SHA256_BYTE_HASHSIZE;
+        break;
+    case SCL_HASH_SHA384:
+        hash_size = SHA384_BYTE_HASHSIZE;
+        break;
+    case SCL_HASH_SHA512:
+        hash_size = SHA512_BYTE_HASHSIZE;
+        break;
+    case SCL_HASH_SHA512_224:
+        hash_size = SHA512_224_BYTE_HASHSIZE;
+        break;
+    case SCL_HASH_SHA512_256:
+        hash_size = SHA512_256_BYTE_HASHSIZE;
+        break;
+    default:
+        return (SCL_ERROR);
+    }
+
+    if (*hash_len < hash_size)
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    for (n = 0; n < count; n++)
+    {
+        if (NULL == digests[n])
+        {
+            return (SCL_INVALID_OUTPUT);
+        }
+
+        if ((NULL == msgs[n]) && (0 != lens[n]))
+        {
+            return (SCL_INVALID_INPUT);
+        }
+    }
+
+    for (n = 0; n < count; n++)
+    {
+        // SHA256 of a digest or of two digests: padding is precomputed
+        if ((SCL_HASH_SHA256 == hash_mode) &&
+            ((SHA256_BYTE_HASHSIZE == lens[n]) ||
+             (SHA256_BYTE_BLOCKSIZE == lens[n])))
+        {
+            result = soft_sha256_fixed(scl, msgs[n], lens[n], digests[n]);
+            if (SCL_OK > result)
+            {
+                return (result);
+            }
+            continue;
+        }
+
+        result = soft_sha_init(scl, &ctx, hash_mode, SCL_BIG_ENDIAN_MODE);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+
+        if (0 != lens[n])
+        {
+            result = soft_sha_core(scl, &ctx, msgs[n], lens[n]);
+            if (SCL_OK > result)
+            {
+                return (result);
+            }
+        }
+
+        digest_len = hash_size;
+        result = soft_sha_finish(scl, &ctx, digests[n], &digest_len);
+        if (SCL_OK > result)
+        {
+            return (result);
+        }
+    }
+
+    *hash_len = hash_size;
+
+    return (SCL_OK);
+}
+
+int32_t soft_sha256_fixed(const metal_scl_t *const scl,
+                          const uint8_t *const in, size_t in_len,
+                          uint8_t *const digest)
+{
+    (void)scl;
+
+    switch (in_len)
+    {
+    case SHA256_BYTE_HASHSIZE:
+        return (soft_sha256_32B(in, digest));
+    case SHA256_BYTE_BLOCKSIZE:
+        return (soft_sha256_64B(in, digest));
+    default:
+        break;
+    }
+
+    return (SCL_INVALID_LENGTH);
+}
+
+int32_t soft_sha256_merkle_level(const metal_scl_t *const scl,
+                                 const uint8_t *const nodes, size_t nb_nodes,
+                                 uint8_t *const parents)
+{
+    int32_t result;
+    size_t i;
+
+    (void)scl;
+
+    if ((NULL == nodes) && (0 != nb_nodes))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == parents) && (0 != nb_nodes))
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    // parent i only overwrites nodes that have already been read
+    for (i = 0; i < nb_nodes / 2; i++)
+    {
+        result = soft_sha256_64B(&nodes[i * SHA256_BYTE_BLOCKSIZE],
+                                 &parents[i * SHA256_BYTE_HASHSIZE]);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+    }
+
+    if (0 != (nb_nodes & 1))
+    {
+        memmove(&parents[i * SHA256_BYTE_HASHSIZE],
+                &nodes[i * SHA256_BYTE_BLOCKSIZE], SHA256_BYTE_HASHSIZE);
+    }
+
+    return (SCL_OK);
+}
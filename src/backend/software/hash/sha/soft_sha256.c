@@ -271,3 +271,135 @@ void soft_sha256_append_bit_len(uint8_t *const buffer, uint64_t *const length)
         buffer[SHA256_BYTE_SIZE_BLOCKSIZE - i - 1] = p_length[i];
     }
 }
+
+/*
+ * K[t] + W[t] of the padding block of a 64 bytes message (0x80, zeros and a
+ * 512 bits length). This block is always the same, so is its schedule.
+ */
+static const uint32_t pad_64B_wk[SHA256_ROUNDS_NUMBER] = {
+    0xc28a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf374, 0x649b69c1, 0xf0fe4786,
+    0x0fe1edc6, 0x240cf254, 0x4fe9346f, 0x6cc984be, 0x61b9411e, 0x16f988fa,
+    0xf2c65152, 0xa88e5a6d, 0xb019fc65, 0xb9d99ec7, 0x9a1231c3, 0xe70eeaa0,
+    0xfdb1232b, 0xc7353eb0, 0x3069bad5, 0xcb976d5f, 0x5a0f118f, 0xdc1eeefd,
+    0x0a35b689, 0xde0b7a04, 0x58f4ca9d, 0xe15d5b16, 0x007f3e86, 0x37088980,
+    0xa507ea32, 0x6fab9537, 0x17406110, 0x0d8cd6f1, 0xcdaa3b6d, 0xc0bbbe37,
+    0x83613bda, 0xdb48a363, 0x0b02e931, 0x6fd15ca7, 0x521afaca, 0x31338431,
+    0x6ed41a95, 0x6d437890, 0xc39c91f2, 0x9eccabbd, 0xb5c9a0e6, 0x532fb63c,
+    0xd2c741c6, 0x07237ea3, 0xa4954b68, 0x4c191d76
+};
+
+/* expand the 16 first words of wk, then add the round constants */
+static void soft_sha256_schedule(uint32_t *const wk)
+{
+    size_t i;
+
+    for (i = SHA256_BLOCK_WORDS; i < SHA256_ROUNDS_NUMBER; i++)
+    {
+        wk[i] =
+            GAMMA1(wk[i - 2]) + wk[i - 7] + GAMMA0(wk[i - 15]) + wk[i - 16];
+    }
+
+    for (i = 0; i < SHA256_ROUNDS_NUMBER; i++)
+    {
+        wk[i] += k[i];
+    }
+}
+
+static void soft_sha256_rounds(uint32_t *const state, const uint32_t *const wk)
+{
+    size_t i;
+    uint32_t a, b, c, d, e, f, g, h, t1, t2;
+
+    a = state[0];
+    b = state[1];
+    c = state[2];
+    d = state[3];
+    e = state[4];
+    f = state[5];
+    g = state[6];
+    h = state[7];
+
+    for (i = 0; i < SHA256_ROUNDS_NUMBER; i++)
+    {
+        t1 = h + SIGMA1(e) + CH(e, f, g) + wk[i];
+        t2 = SIGMA0(a) + MAJ(a, b, c);
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+int32_t soft_sha256_32B(const uint8_t *const in, uint8_t *const out)
+{
+    uint32_t state[SHA256_SIZE_WORDS];
+    uint32_t wk[SHA256_ROUNDS_NUMBER];
+
+    if (NULL == in)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (NULL == out)
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    copy_u8_2_u32_be(wk, in, SHA256_BYTE_HASHSIZE);
+
+    // padding: 0x80, zeros and a 256 bits length
+    wk[8] = 0x80000000;
+    memset(&wk[9], 0, 6 * sizeof(wk[0]));
+    wk[15] = SHA256_BYTE_HASHSIZE * 8;
+
+    soft_sha256_schedule(wk);
+
+    memcpy(state, h_init, sizeof(state));
+    soft_sha256_rounds(state, wk);
+
+    copy_u32_2_u8_be(out, state, SHA256_BYTE_HASHSIZE);
+
+    return (SCL_OK);
+}
+
+int32_t soft_sha256_64B(const uint8_t *const in, uint8_t *const out)
+{
+    uint32_t state[SHA256_SIZE_WORDS];
+    uint32_t wk[SHA256_ROUNDS_NUMBER];
+
+    if (NULL == in)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (NULL == out)
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    copy_u8_2_u32_be(wk, in, SHA256_BYTE_BLOCKSIZE);
+    soft_sha256_schedule(wk);
+
+    memcpy(state, h_init, sizeof(state));
+    soft_sha256_rounds(state, wk);
+    soft_sha256_rounds(state, pad_64B_wk);
+
+    copy_u32_2_u8_be(out, state, SHA256_BYTE_HASHSIZE);
+
+    return (SCL_OK);
+}
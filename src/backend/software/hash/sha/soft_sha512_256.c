@@ -0,0 +1,116 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+
+/**
+ * @file soft_sha512_256.c
+ * @brief software sha512/256 implementation
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#include <string.h>
+
+#include <scl/scl_retdefs.h>
+
+#include <backend/api/macro.h>
+#include <backend/api/utils.h>
+
+#include <backend/software/hash/sha/soft_sha512.h>
+#include <backend/software/hash/sha/soft_sha512_256.h>
+
+/* FIPS 180-4 section 5.3.6 */
+static const uint64_t h_init[SHA512_SIZE_WORDS] = {
+    0x22312194FC2BF72CULL, 0x9F555FA3C84C64C2ULL, 0x2393B86B6F53B151ULL,
+    0x963877195940EABDULL, 0x96283EE2A88EFFE3ULL, 0xBE5E1E2553863992ULL,
+    0x2B0199FC2C85B8AAULL, 0x0EB72DDC81C52CA2ULL};
+
+int32_t soft_sha512_256_init(sha512_256_ctx_t *const ctx,
+                             endianness_t data_endianness)
+{
+    size_t i = 0;
+
+    if (NULL == ctx)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    // for the moment only big endian mode is supported
+    if (SCL_BIG_ENDIAN_MODE != data_endianness)
+    {
+        return (SCL_INVALID_MODE);
+    }
+
+    ctx->bitlen = 0;
+
+    for (i = 0; i < SHA512_SIZE_WORDS; i++)
+    {
+        ctx->h[i] = h_init[i];
+    }
+
+    return (SCL_OK);
+}
+
+int32_t soft_sha512_256_core(sha512_256_ctx_t *const ctx,
+                             const uint8_t *const data, size_t data_byte_len)
+{
+    return (soft_sha512_core(ctx, data, data_byte_len));
+}
+
+int32_t soft_sha512_256_finish(sha512_256_ctx_t *const ctx,
+                               uint8_t *const hash, size_t *const hash_len)
+{
+    int32_t result;
+    uint8_t digest[SHA512_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    size_t digest_len = sizeof(digest);
+
+    if ((NULL == hash) || (NULL == hash_len))
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    if (NULL == ctx)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (*hash_len < SHA512_256_BYTE_HASHSIZE)
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    // padding is the sha512 one, only the output is truncated
+    result = soft_sha512_finish(ctx, digest, &digest_len);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    memcpy(hash, digest, SHA512_256_BYTE_HASHSIZE);
+    memset(digest, 0, sizeof(digest));
+    *hash_len = SHA512_256_BYTE_HASHSIZE;
+
+    return (SCL_OK);
+}
@@ -0,0 +1,414 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+
+/**
+ * @file soft_kdf_pbkdf2.c
+ * @brief software PBKDF2 implementation
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#include <limits.h>
+#include <string.h>
+
+#include <backend/software/key_derivation_functions/soft_kdf_pbkdf2.h>
+
+#include <backend/api/macro.h>
+#include <backend/api/utils.h>
+
+#include <backend/software/hash/sha/soft_sha.h>
+#include <backend/software/hash/sha/soft_sha256.h>
+#include <backend/software/hash/sha/soft_sha512.h>
+
+/*! @brief HMAC inner padding byte */
+#define SOFT_KDF_PBKDF2_IPAD_BYTE ((uint8_t)0x36)
+
+/*! @brief HMAC outer padding byte */
+#define SOFT_KDF_PBKDF2_OPAD_BYTE ((uint8_t)0x5C)
+
+static int32_t soft_kdf_pbkdf2_hash_length(hash_mode_t hash_mode);
+
+static int32_t soft_kdf_pbkdf2_pad_state(hash_mode_t hash_mode,
+                                         const uint8_t *const k0, uint8_t pad,
+                                         sha_state_t *const state);
+
+static void soft_kdf_pbkdf2_iterate_256(const sha_state_t *const inner,
+                                        const sha_state_t *const outer,
+                                        size_t hash_len, uint32_t iterations,
+                                        uint8_t *const u_t);
+
+static void soft_kdf_pbkdf2_iterate_512(const sha_state_t *const inner,
+                                        const sha_state_t *const outer,
+                                        size_t hash_len, uint32_t iterations,
+                                        uint8_t *const u_t);
+
+static int32_t soft_kdf_pbkdf2_hash_length(hash_mode_t hash_mode)
+{
+    switch (hash_mode)
+    {
+    case SCL_HASH_SHA224:
+        return (SHA224_BYTE_HASHSIZE);
+    case SCL_HASH_SHA256:
+        return (SHA256_BYTE_HASHSIZE);
+    case SCL_HASH_SHA384:
+        return (SHA384_BYTE_HASHSIZE);
+    case SCL_HASH_SHA512:
+        return (SHA512_BYTE_HASHSIZE);
+    case SCL_HASH_SHA512_224:
+        return (SHA512_224_BYTE_HASHSIZE);
+    case SCL_HASH_SHA512_256:
+        return (SHA512_256_BYTE_HASHSIZE);
+    default:
+        break;
+    }
+
+    return (SCL_INVALID_INPUT);
+}
+
+/**
+ * The iterations below always hash in software. When the key context only
+ * holds k0 (see hmac_key_ctx_t), the states they start from are computed here.
+ */
+static int32_t soft_kdf_pbkdf2_pad_state(hash_mode_t hash_mode,
+                                         const uint8_t *const k0, uint8_t pad,
+                                         sha_state_t *const state)
+{
+    int32_t result;
+    size_t blocksize;
+    size_t i;
+    sha_ctx_t ctx;
+    uint8_t block[SHA512_BYTE_BLOCKSIZE] __attribute__((aligned(8)));
+
+    if ((SCL_HASH_SHA224 == hash_mode) || (SCL_HASH_SHA256 == hash_mode))
+    {
+        blocksize = SHA256_BYTE_BLOCKSIZE;
+    }
+    else
+    {
+        blocksize = SHA512_BYTE_BLOCKSIZE;
+    }
+
+    for (i = 0; i < blocksize; i++)
+    {
+        block[i] = k0[i] ^ pad;
+    }
+
+    result = soft_sha_init(NULL, &ctx, hash_mode, SCL_BIG_ENDIAN_MODE);
+    if (SCL_OK == result)
+    {
+        result = soft_sha_core(NULL, &ctx, block, blocksize);
+    }
+
+    if (SCL_OK == result)
+    {
+        result = soft_sha_export_state(NULL, &ctx, state);
+    }
+
+    memset(block, 0, sizeof(block));
+    memset(&ctx, 0, sizeof(ctx));
+
+    return (result);
+}
+
+/**
+ * u_t holds U_1 on input and T = U_1 ^ ... ^ U_c on output. Each U_j is
+ * hash_len bytes long, hashed after one block of k0 ^ pad: the padding and
+ * the bit length of the single remaining block never change.
+ */
+static void soft_kdf_pbkdf2_iterate_256(const sha_state_t *const inner,
+                                        const sha_state_t *const outer,
+                                        size_t hash_len, uint32_t iterations,
+                                        uint8_t *const u_t)
+{
+    uint32_t j;
+    uint32_t t[SHA256_SIZE_WORDS];
+    uint32_t inner_h[SHA256_SIZE_WORDS];
+    uint32_t outer_h[SHA256_SIZE_WORDS];
+    sha256_ctx_t ctx;
+    uint8_t block[SHA256_BYTE_BLOCKSIZE] __attribute__((aligned(8)));
+    uint64_t bitlen = (uint64_t)(SHA256_BYTE_BLOCKSIZE + hash_len) << 3;
+
+    copy_u8_2_u32_be(inner_h, inner->digest, SHA256_BYTE_HASHSIZE);
+    copy_u8_2_u32_be(outer_h, outer->digest, SHA256_BYTE_HASHSIZE);
+
+    memset(block, 0, sizeof(block));
+    memcpy(block, u_t, hash_len);
+    block[hash_len] = 0x80;
+    soft_sha256_append_bit_len(
+        &block[SHA256_BYTE_BLOCKSIZE - SHA256_BYTE_SIZE_BLOCKSIZE], &bitlen);
+
+    // words beyond hash_len are not part of the output
+    copy_u8_2_u32_be(t, block, SHA256_BYTE_HASHSIZE);
+
+    for (j = 1; j < iterations; j++)
+    {
+        memcpy(ctx.h, inner_h, sizeof(ctx.h));
+        soft_sha256_block(&ctx, block);
+        copy_u32_2_u8_be(block, ctx.h, hash_len);
+
+        memcpy(ctx.h, outer_h, sizeof(ctx.h));
+        soft_sha256_block(&ctx, block);
+        copy_u32_2_u8_be(block, ctx.h, hash_len);
+
+        t[0] ^= ctx.h[0];
+        t[1] ^= ctx.h[1];
+        t[2] ^= ctx.h[2];
+        t[3] ^= ctx.h[3];
+        t[4] ^= ctx.h[4];
+        t[5] ^= ctx.h[5];
+        t[6] ^= ctx.h[6];
+        t[7] ^= ctx.h[7];
+    }
+
+    copy_u32_2_u8_be(u_t, t, hash_len);
+
+    memset(t, 0, sizeof(t));
+    memset(block, 0, sizeof(block));
+    memset(&ctx, 0, sizeof(ctx));
+}
+
+/* SHA512/224 output ends in the middle of a 64 bits word */
+static void soft_kdf_pbkdf2_u64_2_u8_be(uint8_t *const dest,
+                                        const uint64_t *const src,
+                                        size_t hash_len)
+{
+    size_t words = hash_len >> 3;
+
+    copy_u64_2_u8_be(dest, src, words << 3);
+
+    if (0 != (hash_len & 0x7))
+    {
+        dest[hash_len - 4] = (uint8_t)(src[words] >> 56);
+        dest[hash_len - 3] = (uint8_t)(src[words] >> 48);
+        dest[hash_len - 2] = (uint8_t)(src[words] >> 40);
+        dest[hash_len - 1] = (uint8_t)(src[words] >> 32);
+    }
+}
+
+/* same as soft_kdf_pbkdf2_iterate_256() on sha512 blocks */
+static void soft_kdf_pbkdf2_iterate_512(const sha_state_t *const inner,
+                                        const sha_state_t *const outer,
+                                        size_t hash_len, uint32_t iterations,
+                                        uint8_t *const u_t)
+{
+    uint32_t j;
+    uint64_t t[SHA512_SIZE_WORDS];
+    uint64_t inner_h[SHA512_SIZE_WORDS];
+    uint64_t outer_h[SHA512_SIZE_WORDS];
+    sha512_ctx_t ctx;
+    uint8_t block[SHA512_BYTE_BLOCKSIZE] __attribute__((aligned(8)));
+    uint64_t bitlen = (uint64_t)(SHA512_BYTE_BLOCKSIZE + hash_len) << 3;
+
+    copy_u8_2_u64_be(inner_h, inner->digest, SHA512_BYTE_HASHSIZE);
+    copy_u8_2_u64_be(outer_h, outer->digest, SHA512_BYTE_HASHSIZE);
+
+    memset(block, 0, sizeof(block));
+    memcpy(block, u_t, hash_len);
+    block[hash_len] = 0x80;
+    soft_sha512_append_bit_len(
+        &block[SHA512_BYTE_BLOCKSIZE - SHA512_BYTE_SIZE_BLOCKSIZE], &bitlen);
+
+    // words beyond hash_len are not part of the output
+    copy_u8_2_u64_be(t, block, SHA512_BYTE_HASHSIZE);
+
+    for (j = 1; j < iterations; j++)
+    {
+        memcpy(ctx.h, inner_h, sizeof(ctx.h));
+        soft_sha512_block(&ctx, block);
+        soft_kdf_pbkdf2_u64_2_u8_be(block, ctx.h, hash_len);
+
+        memcpy(ctx.h, outer_h, sizeof(ctx.h));
+        soft_sha512_block(&ctx, block);
+        soft_kdf_pbkdf2_u64_2_u8_be(block, ctx.h, hash_len);
+
+        t[0] ^= ctx.h[0];
+        t[1] ^= ctx.h[1];
+        t[2] ^= ctx.h[2];
+        t[3] ^= ctx.h[3];
+        t[4] ^= ctx.h[4];
+        t[5] ^= ctx.h[5];
+        t[6] ^= ctx.h[6];
+        t[7] ^= ctx.h[7];
+    }
+
+    soft_kdf_pbkdf2_u64_2_u8_be(u_t, t, hash_len);
+
+    memset(t, 0, sizeof(t));
+    memset(block, 0, sizeof(block));
+    memset(&ctx, 0, sizeof(ctx));
+}
+
+int32_t soft_kdf_pbkdf2(const metal_scl_t *const scl, hash_mode_t hash_mode,
+                        const uint8_t *const password, size_t password_len,
+                        const uint8_t *const salt, size_t salt_len,
+                        uint32_t iterations, uint8_t *const derivated_key,
+                        size_t derivated_key_length)
+{
+    int32_t result = SCL_OK;
+    size_t hash_len;
+    size_t u_len;
+    size_t chunk_size;
+    size_t derivated_key_index;
+    uint32_t block_index;
+    uint8_t block_index_be[sizeof(block_index)];
+    hmac_key_ctx_t key_ctx;
+    hmac_ctx_t hmac_ctx;
+    sha_ctx_t sha_ctx;
+    sha_state_t inner;
+    sha_state_t outer;
+    uint8_t u_t[SHA512_BYTE_HASHSIZE] __attribute__((aligned(8)));
+
+    if ((NULL == scl) || (NULL == password) ||
+        ((NULL == salt) && (0 != salt_len)) || (0 == iterations))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (NULL == derivated_key)
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    if ((NULL == scl->hmac_func.key_init) ||
+        (NULL == scl->hmac_func.init_with_key) ||
+        (NULL == scl->hmac_func.core) || (NULL == scl->hmac_func.finish))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    if (0 == derivated_key_length)
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    result = soft_kdf_pbkdf2_hash_length(hash_mode);
+    if (0 > result)
+    {
+        return (result);
+    }
+
+    hash_len = (size_t)result;
+
+    ASSERT_COMPILE(sizeof(size_t) == (__riscv_xlen / CHAR_BIT));
+
+#if __riscv_xlen > 32
+    /* dkLen shall not exceed (2^32 - 1) * hLen */
+    if (derivated_key_length > hash_len * 0xFFFFFFFFUL)
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+#endif
+
+    /* ipad and opad blocks of the password are hashed only once */
+    result = scl->hmac_func.key_init(scl, &key_ctx, &sha_ctx, hash_mode,
+                                     password, password_len);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    if (true == key_ctx.resume_state)
+    {
+        memcpy(&inner, &key_ctx.inner, sizeof(inner));
+        memcpy(&outer, &key_ctx.outer, sizeof(outer));
+    }
+    else
+    {
+        result = soft_kdf_pbkdf2_pad_state(hash_mode, key_ctx.k0,
+                                           SOFT_KDF_PBKDF2_IPAD_BYTE, &inner);
+        if (SCL_OK == result)
+        {
+            result = soft_kdf_pbkdf2_pad_state(
+                hash_mode, key_ctx.k0, SOFT_KDF_PBKDF2_OPAD_BYTE, &outer);
+        }
+    }
+
+    derivated_key_index = 0;
+    block_index = 1;
+
+    while ((SCL_OK == result) && (derivated_key_index < derivated_key_length))
+    {
+        /* U_1 = PRF(P, S || INT(i)) */
+        block_index_be[0] = (uint8_t)(block_index >> 24);
+        block_index_be[1] = (uint8_t)(block_index >> 16);
+        block_index_be[2] = (uint8_t)(block_index >> 8);
+        block_index_be[3] = (uint8_t)block_index;
+
+        result =
+            scl->hmac_func.init_with_key(scl, &hmac_ctx, &sha_ctx, &key_ctx);
+        if ((SCL_OK == result) && (0 != salt_len))
+        {
+            result = scl->hmac_func.core(scl, &hmac_ctx, salt, salt_len);
+        }
+
+        if (SCL_OK == result)
+        {
+            result = scl->hmac_func.core(scl, &hmac_ctx, block_index_be,
+                                         sizeof(block_index_be));
+        }
+
+        if (SCL_OK == result)
+        {
+            u_len = sizeof(u_t);
+            result = scl->hmac_func.finish(scl, &hmac_ctx, u_t, &u_len);
+        }
+
+        if (SCL_OK != result)
+        {
+            break;
+        }
+
+        /* T_i = U_1 ^ U_2 ^ ... ^ U_c */
+        if ((SCL_HASH_SHA224 == hash_mode) || (SCL_HASH_SHA256 == hash_mode))
+        {
+            soft_kdf_pbkdf2_iterate_256(&inner, &outer, hash_len, iterations,
+                                        u_t);
+        }
+        else
+        {
+            soft_kdf_pbkdf2_iterate_512(&inner, &outer, hash_len, iterations,
+                                        u_t);
+        }
+
+        chunk_size = derivated_key_length - derivated_key_index;
+        if (chunk_size > hash_len)
+        {
+            chunk_size = hash_len;
+        }
+
+        memcpy(&derivated_key[derivated_key_index], u_t, chunk_size);
+        derivated_key_index += chunk_size;
+        block_index++;
+    }
+
+    /* the key context and T_i are derived from the password */
+    memset(&key_ctx, 0, sizeof(key_ctx));
+    memset(&inner, 0, sizeof(inner));
+    memset(&outer, 0, sizeof(outer));
+    memset(u_t, 0, sizeof(u_t));
+
+    return (result);
+}
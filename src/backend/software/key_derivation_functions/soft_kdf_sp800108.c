@@ -0,0 +1,501 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+
+/**
+ * @file soft_kdf_sp800108.c
+ * @brief software SP 800-108 counter mode kdf implementation
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#include <string.h>
+
+#include <backend/software/key_derivation_functions/soft_kdf_sp800108.h>
+
+/*! @brief size of the counter and length fields (in byte) */
+#define SP800108_FIELD_SIZE 4
+
+/*! @brief CMAC subkey generation constant for 128 bits blocks */
+#define CMAC_RB 0x87
+
+/*! @brief running CMAC computation */
+typedef struct
+{
+    /*! @brief chaining value */
+    uint8_t x[AES_BLOCKSIZE_NB_BYTE] __attribute__((aligned(8)));
+    /*! @brief pending block, only processed once more data comes */
+    uint8_t buf[AES_BLOCKSIZE_NB_BYTE] __attribute__((aligned(8)));
+    /*! @brief pending block length (in byte) */
+    size_t buf_len;
+} soft_kdf_cmac_state_t;
+
+static void soft_kdf_sp800108_u32_be(uint8_t *const dst, uint32_t value);
+
+static void soft_kdf_cmac_dbl(uint8_t *const dst, const uint8_t *const src);
+
+static int32_t soft_kdf_cmac_encrypt(const metal_scl_t *const scl,
+                                     uint8_t *const block);
+
+static int32_t soft_kdf_cmac_update(const metal_scl_t *const scl,
+                                    soft_kdf_cmac_state_t *const state,
+                                    const uint8_t *const data,
+                                    size_t data_len);
+
+static int32_t soft_kdf_sp800108_prf_cmac(
+    const metal_scl_t *const scl,
+    const sp800108kdf_ctx_t *const sp800108kdf_ctx,
+    const sp800108kdf_request_t *const request, const uint8_t *const counter,
+    const uint8_t *const length, uint8_t *const output);
+
+static int32_t soft_kdf_sp800108_prf_hmac(
+    const metal_scl_t *const scl,
+    const sp800108kdf_ctx_t *const sp800108kdf_ctx,
+    const sp800108kdf_request_t *const request, const uint8_t *const counter,
+    const uint8_t *const length, uint8_t *const output);
+
+static void soft_kdf_sp800108_u32_be(uint8_t *const dst, uint32_t value)
+{
+    dst[0] = (uint8_t)(value >> 24);
+    dst[1] = (uint8_t)(value >> 16);
+    dst[2] = (uint8_t)(value >> 8);
+    dst[3] = (uint8_t)value;
+}
+
+/* multiplication by x in GF(2^128), as defined in SP 800-38B */
+static void soft_kdf_cmac_dbl(uint8_t *const dst, const uint8_t *const src)
+{
+    size_t i;
+    uint8_t msb = src[0] >> 7;
+
+    for (i = 0; i < AES_BLOCKSIZE_NB_BYTE - 1; i++)
+    {
+        dst[i] = (uint8_t)((src[i] << 1) | (src[i + 1] >> 7));
+    }
+
+    dst[AES_BLOCKSIZE_NB_BYTE - 1] =
+        (uint8_t)((src[AES_BLOCKSIZE_NB_BYTE - 1] << 1) ^ (CMAC_RB * msb));
+}
+
+/* encrypt one block in place, with the key currently loaded */
+static int32_t soft_kdf_cmac_encrypt(const metal_scl_t *const scl,
+                                     uint8_t *const block)
+{
+    int32_t result;
+    uint8_t tmp[AES_BLOCKSIZE_NB_BYTE] __attribute__((aligned(8)));
+
+    result = scl->aes_func.cipher(scl, SCL_AES_ECB, SCL_ENCRYPT,
+                                  SCL_BIG_ENDIAN_MODE, block,
+                                  AES_BLOCKSIZE_NB_BYTE, tmp);
+    if (SCL_OK == result)
+    {
+        memcpy(block, tmp, AES_BLOCKSIZE_NB_BYTE);
+    }
+
+    return (result);
+}
+
+static int32_t soft_kdf_cmac_update(const metal_scl_t *const scl,
+                                    soft_kdf_cmac_state_t *const state,
+                                    const uint8_t *const data, size_t data_len)
+{
+    int32_t result;
+    size_t i;
+    size_t chunk_size;
+    size_t index = 0;
+
+    while (index < data_len)
+    {
+        /* the last block is processed by the finalization */
+        if (AES_BLOCKSIZE_NB_BYTE == state->buf_len)
+        {
+            for (i = 0; i < AES_BLOCKSIZE_NB_BYTE; i++)
+            {
+                state->x[i] ^= state->buf[i];
+            }
+
+            result = soft_kdf_cmac_encrypt(scl, state->x);
+            if (SCL_OK != result)
+            {
+                return (result);
+            }
+
+            state->buf_len = 0;
+        }
+
+        chunk_size = AES_BLOCKSIZE_NB_BYTE - state->buf_len;
+        if (chunk_size > data_len - index)
+        {
+            chunk_size = data_len - index;
+        }
+
+        memcpy(&state->buf[state->buf_len], &data[index], chunk_size);
+        state->buf_len += chunk_size;
+        index += chunk_size;
+    }
+
+    return (SCL_OK);
+}
+
+static int32_t soft_kdf_sp800108_prf_cmac(
+    const metal_scl_t *const scl,
+    const sp800108kdf_ctx_t *const sp800108kdf_ctx,
+    const sp800108kdf_request_t *const request, const uint8_t *const counter,
+    const uint8_t *const length, uint8_t *const output)
+{
+    int32_t result;
+    size_t i;
+    const uint8_t *subkey;
+    static const uint8_t separator = 0;
+    soft_kdf_cmac_state_t state;
+
+    memset(&state, 0, sizeof(state));
+
+    result = soft_kdf_cmac_update(scl, &state, counter, SP800108_FIELD_SIZE);
+    if (SCL_OK == result)
+    {
+        result = soft_kdf_cmac_update(scl, &state, request->label,
+                                      request->label_len);
+    }
+
+    if (SCL_OK == result)
+    {
+        result = soft_kdf_cmac_update(scl, &state, &separator, 1);
+    }
+
+    if (SCL_OK == result)
+    {
+        result = soft_kdf_cmac_update(scl, &state, request->context,
+                                      request->context_len);
+    }
+
+    if (SCL_OK == result)
+    {
+        result =
+            soft_kdf_cmac_update(scl, &state, length, SP800108_FIELD_SIZE);
+    }
+
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    /* the message is never empty, so the last block is never empty either */
+    if (AES_BLOCKSIZE_NB_BYTE == state.buf_len)
+    {
+        subkey = sp800108kdf_ctx->cmac_k1;
+    }
+    else
+    {
+        subkey = sp800108kdf_ctx->cmac_k2;
+        state.buf[state.buf_len] = 0x80;
+        memset(&state.buf[state.buf_len + 1], 0,
+               AES_BLOCKSIZE_NB_BYTE - state.buf_len - 1);
+    }
+
+    for (i = 0; i < AES_BLOCKSIZE_NB_BYTE; i++)
+    {
+        state.x[i] ^= state.buf[i] ^ subkey[i];
+    }
+
+    result = soft_kdf_cmac_encrypt(scl, state.x);
+    if (SCL_OK == result)
+    {
+        memcpy(output, state.x, AES_BLOCKSIZE_NB_BYTE);
+    }
+
+    memset(&state, 0, sizeof(state));
+
+    return (result);
+}
+
+static int32_t soft_kdf_sp800108_prf_hmac(
+    const metal_scl_t *const scl,
+    const sp800108kdf_ctx_t *const sp800108kdf_ctx,
+    const sp800108kdf_request_t *const request, const uint8_t *const counter,
+    const uint8_t *const length, uint8_t *const output)
+{
+    int32_t result;
+    size_t output_len;
+    static const uint8_t separator = 0;
+    hmac_ctx_t hmac_ctx;
+
+    result = scl->hmac_func.init_with_key(scl, &hmac_ctx,
+                                          sp800108kdf_ctx->sha_ctx,
+                                          &sp800108kdf_ctx->hmac_key_ctx);
+    if (SCL_OK == result)
+    {
+        result =
+            scl->hmac_func.core(scl, &hmac_ctx, counter, SP800108_FIELD_SIZE);
+    }
+
+    if ((SCL_OK == result) && (0 != request->label_len))
+    {
+        result = scl->hmac_func.core(scl, &hmac_ctx, request->label,
+                                     request->label_len);
+    }
+
+    if (SCL_OK == result)
+    {
+        result = scl->hmac_func.core(scl, &hmac_ctx, &separator, 1);
+    }
+
+    if ((SCL_OK == result) && (0 != request->context_len))
+    {
+        result = scl->hmac_func.core(scl, &hmac_ctx, request->context,
+                                     request->context_len);
+    }
+
+    if (SCL_OK == result)
+    {
+        result =
+            scl->hmac_func.core(scl, &hmac_ctx, length, SP800108_FIELD_SIZE);
+    }
+
+    if (SCL_OK == result)
+    {
+        output_len = sp800108kdf_ctx->prf_len;
+        result = scl->hmac_func.finish(scl, &hmac_ctx, output, &output_len);
+    }
+
+    return (result);
+}
+
+int32_t soft_kdf_sp800108_hmac_init(const metal_scl_t *const scl,
+                                    sp800108kdf_ctx_t *const sp800108kdf_ctx,
+                                    sha_ctx_t *const sha_ctx,
+                                    hash_mode_t hash_mode,
+                                    const uint8_t *const key, size_t key_len)
+{
+    int32_t result;
+
+    if ((NULL == scl) || (NULL == sp800108kdf_ctx) || (NULL == sha_ctx) ||
+        (NULL == key))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->hmac_func.key_init) ||
+        (NULL == scl->hmac_func.init_with_key) ||
+        (NULL == scl->hmac_func.core) || (NULL == scl->hmac_func.finish))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    switch (hash_mode)
+    {
+    case SCL_HASH_SHA224:
+        sp800108kdf_ctx->prf_len = SHA224_BYTE_HASHSIZE;
+        break;
+    case SCL_HASH_SHA256:
+        sp800108kdf_ctx->prf_len = SHA256_BYTE_HASHSIZE;
+        break;
+    case SCL_HASH_SHA384:
+        sp800108kdf_ctx->prf_len = SHA384_BYTE_HASHSIZE;
+        break;
+    case SCL_HASH_SHA512:
+        sp800108kdf_ctx->prf_len = SHA512_BYTE_HASHSIZE;
+        break;
+    case SCL_HASH_SHA512_224:
+        sp800108kdf_ctx->prf_len = SHA512_224_BYTE_HASHSIZE;
+        break;
+    case SCL_HASH_SHA512_256:
+        sp800108kdf_ctx->prf_len = SHA512_256_BYTE_HASHSIZE;
+        break;
+    default:
+        return (SCL_INVALID_INPUT);
+    }
+
+    result = scl->hmac_func.key_init(scl, &sp800108kdf_ctx->hmac_key_ctx,
+                                     sha_ctx, hash_mode, key, key_len);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    sp800108kdf_ctx->prf = SCL_KDF_PRF_HMAC;
+    sp800108kdf_ctx->sha_ctx = sha_ctx;
+
+    return (SCL_OK);
+}
+
+int32_t soft_kdf_sp800108_cmac_init(const metal_scl_t *const scl,
+                                    sp800108kdf_ctx_t *const sp800108kdf_ctx,
+                                    scl_aes_key_type_t key_type,
+                                    const uint64_t *const key)
+{
+    int32_t result;
+    uint8_t l[AES_BLOCKSIZE_NB_BYTE] __attribute__((aligned(8))) = {0};
+
+    if ((NULL == scl) || (NULL == sp800108kdf_ctx) || (NULL == key))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->aes_func.setkey) || (NULL == scl->aes_func.cipher))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    result = scl->aes_func.setkey(scl, key_type, key, SCL_ENCRYPT);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    /* L = AES(K, 0^128), K1 = dbl(L), K2 = dbl(K1) */
+    result = soft_kdf_cmac_encrypt(scl, l);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    soft_kdf_cmac_dbl(sp800108kdf_ctx->cmac_k1, l);
+    soft_kdf_cmac_dbl(sp800108kdf_ctx->cmac_k2, sp800108kdf_ctx->cmac_k1);
+
+    memset(l, 0, sizeof(l));
+
+    memcpy(sp800108kdf_ctx->aes_key, key, sizeof(sp800108kdf_ctx->aes_key));
+    sp800108kdf_ctx->aes_key_type = key_type;
+    sp800108kdf_ctx->prf = SCL_KDF_PRF_CMAC;
+    sp800108kdf_ctx->prf_len = AES_BLOCKSIZE_NB_BYTE;
+    sp800108kdf_ctx->sha_ctx = NULL;
+
+    return (SCL_OK);
+}
+
+int32_t soft_kdf_sp800108_derive(
+    const metal_scl_t *const scl,
+    const sp800108kdf_ctx_t *const sp800108kdf_ctx,
+    const sp800108kdf_request_t *const requests, size_t nb_requests)
+{
+    int32_t result = SCL_OK;
+    size_t request_index;
+    size_t derivated_key_index;
+    size_t chunk_size;
+    uint32_t counter;
+    uint8_t counter_be[SP800108_FIELD_SIZE];
+    uint8_t length_be[SP800108_FIELD_SIZE];
+    uint8_t output[SHA512_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    const sp800108kdf_request_t *request;
+
+    if ((NULL == scl) || (NULL == sp800108kdf_ctx) ||
+        ((NULL == requests) && (0 != nb_requests)))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    for (request_index = 0; request_index < nb_requests; request_index++)
+    {
+        request = &requests[request_index];
+
+        if (((NULL == request->label) && (0 != request->label_len)) ||
+            ((NULL == request->context) && (0 != request->context_len)))
+        {
+            return (SCL_INVALID_INPUT);
+        }
+
+        if (NULL == request->derivated_key)
+        {
+            return (SCL_INVALID_OUTPUT);
+        }
+
+        /* L is encoded on 32 bits */
+        if ((0 == request->derivated_key_length) ||
+            (request->derivated_key_length > (UINT32_MAX >> 3)))
+        {
+            return (SCL_INVALID_LENGTH);
+        }
+    }
+
+    if (SCL_KDF_PRF_CMAC == sp800108kdf_ctx->prf)
+    {
+        /* the key stays loaded for the whole batch */
+        result = scl->aes_func.setkey(scl, sp800108kdf_ctx->aes_key_type,
+                                      sp800108kdf_ctx->aes_key, SCL_ENCRYPT);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+    }
+    else if (SCL_KDF_PRF_HMAC != sp800108kdf_ctx->prf)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    for (request_index = 0; request_index < nb_requests; request_index++)
+    {
+        request = &requests[request_index];
+
+        soft_kdf_sp800108_u32_be(
+            length_be, (uint32_t)(request->derivated_key_length << 3));
+
+        derivated_key_index = 0;
+        counter = 1;
+
+        while (derivated_key_index < request->derivated_key_length)
+        {
+            soft_kdf_sp800108_u32_be(counter_be, counter);
+
+            if (SCL_KDF_PRF_CMAC == sp800108kdf_ctx->prf)
+            {
+                result = soft_kdf_sp800108_prf_cmac(
+                    scl, sp800108kdf_ctx, request, counter_be, length_be,
+                    output);
+            }
+            else
+            {
+                result = soft_kdf_sp800108_prf_hmac(
+                    scl, sp800108kdf_ctx, request, counter_be, length_be,
+                    output);
+            }
+
+            if (SCL_OK != result)
+            {
+                break;
+            }
+
+            chunk_size = request->derivated_key_length - derivated_key_index;
+            if (chunk_size > sp800108kdf_ctx->prf_len)
+            {
+                chunk_size = sp800108kdf_ctx->prf_len;
+            }
+
+            memcpy(&request->derivated_key[derivated_key_index], output,
+                   chunk_size);
+            derivated_key_index += chunk_size;
+            counter++;
+        }
+
+        if (SCL_OK != result)
+        {
+            break;
+        }
+    }
+
+    memset(output, 0, sizeof(output));
+
+    return (result);
+}
@@ -39,6 +39,8 @@
 
 static int32_t soft_kdf_x963_hash_length(hash_mode_t hash_mode);
 
+static size_t soft_kdf_x963_block_size(hash_mode_t hash_mode);
+
 static int32_t soft_kdf_x963_hash_length(hash_mode_t hash_mode)
 {
     int32_t hashsize;
@@ -57,6 +59,12 @@ static int32_t soft_kdf_x963_hash_length(hash_mode_t hash_mode)
     case SCL_HASH_SHA512:
         hashsize = SHA512_BYTE_HASHSIZE;
         break;
+    case SCL_HASH_SHA512_224:
+        hashsize = SHA512_224_BYTE_HASHSIZE;
+        break;
+    case SCL_HASH_SHA512_256:
+        hashsize = SHA512_256_BYTE_HASHSIZE;
+        break;
     default:
         return (SCL_INVALID_INPUT);
     }
@@ -64,6 +72,22 @@ static int32_t soft_kdf_x963_hash_length(hash_mode_t hash_mode)
     return (hashsize);
 }
 
+static size_t soft_kdf_x963_block_size(hash_mode_t hash_mode)
+{
+    switch (hash_mode)
+    {
+    case SCL_HASH_SHA384:
+    case SCL_HASH_SHA512:
+    case SCL_HASH_SHA512_224:
+    case SCL_HASH_SHA512_256:
+        return (SHA512_BYTE_BLOCKSIZE);
+    default:
+        break;
+    }
+
+    return (SHA256_BYTE_BLOCKSIZE);
+}
+
 int32_t soft_kdf_x963_init(const metal_scl_t *const scl,
                            x963kdf_ctx_t *const x963kdf_ctx,
                            sha_ctx_t *const sha_ctx, hash_mode_t hash_mode,
@@ -95,6 +119,10 @@ int32_t soft_kdf_x963_derive(const metal_scl_t *const scl,
     size_t chunk_size;
     size_t derivated_key_index;
     size_t remaining_len;
+    bool use_prefix_state;
+    bool prefix_absorbed;
+    sha_state_t prefix_state;
+    sha_ctx_t probe_ctx;
 
     /**
      * step 3 : Initialized at 0x00000001 big endian, it will be swap at hash
@@ -164,23 +192,100 @@ int32_t soft_kdf_x963_derive(const metal_scl_t *const scl,
     remaining_len = derivated_key_length;
     i = 0;
 
-    /* step 4 : */
-    do
+    /**
+     * Z is the common prefix of all the hashed messages: when it fills at
+     * least one block and several counter blocks are needed, it is absorbed
+     * once and each iteration resumes from the resulting state. Otherwise
+     * every compressed block depends on the counter, there is nothing to
+     * share.
+     */
+    use_prefix_state =
+        (input_key_len >= soft_kdf_x963_block_size(x963kdf_ctx->hash_mode)) &&
+        (derivated_key_length > hashsize) &&
+        (NULL != scl->hash_func.sha_export_state) &&
+        (NULL != scl->hash_func.sha_import_state);
+
+    /* set while the context already holds Z for the current counter */
+    prefix_absorbed = false;
+
+    if (true == use_prefix_state)
     {
-        /* step 4.1 : */
         result = scl->hash_func.sha_init(scl, x963kdf_ctx->sha_ctx,
                                          x963kdf_ctx->hash_mode,
                                          SCL_BIG_ENDIAN_MODE);
         if (SCL_OK != result)
         {
-            return (result);
+            goto cleanup;
         }
 
         result = scl->hash_func.sha_core(scl, x963kdf_ctx->sha_ctx, input_key,
                                          input_key_len);
         if (SCL_OK != result)
         {
-            return (result);
+            goto cleanup;
+        }
+
+        prefix_absorbed = true;
+
+        result = scl->hash_func.sha_export_state(scl, x963kdf_ctx->sha_ctx,
+                                                 &prefix_state);
+        if (SCL_OK != result)
+        {
+            goto cleanup;
+        }
+
+        /**
+         * Resuming from the midstate only pays off when the backend keeps the
+         * imported state where it was computed. A backend that can only
+         * resume in software (HCA 0.5.x) would run every counter block off
+         * the accelerator, so hash Z again for each counter instead, unless
+         * the context already runs in software.
+         */
+        result = scl->hash_func.sha_import_state(scl, &probe_ctx,
+                                                 &prefix_state);
+        if (SCL_OK != result)
+        {
+            goto cleanup;
+        }
+
+        use_prefix_state = (false == probe_ctx.soft_resume) ||
+                           (true == x963kdf_ctx->sha_ctx->soft_resume);
+    }
+
+    /* step 4 : */
+    do
+    {
+        /* step 4.1 : */
+        if (true == prefix_absorbed)
+        {
+            /* first counter, Z was absorbed while computing the midstate */
+            prefix_absorbed = false;
+        }
+        else if (true == use_prefix_state)
+        {
+            result = scl->hash_func.sha_import_state(scl, x963kdf_ctx->sha_ctx,
+                                                     &prefix_state);
+            if (SCL_OK != result)
+            {
+                goto cleanup;
+            }
+        }
+        else
+        {
+            result = scl->hash_func.sha_init(scl, x963kdf_ctx->sha_ctx,
+                                             x963kdf_ctx->hash_mode,
+                                             SCL_BIG_ENDIAN_MODE);
+            if (SCL_OK != result)
+            {
+                goto cleanup;
+            }
+
+            result = scl->hash_func.sha_core(scl, x963kdf_ctx->sha_ctx,
+                                             input_key, input_key_len);
+            if (SCL_OK != result)
+            {
+                goto cleanup;
+            }
         }
 
         counter = bswap32(counter);
@@ -189,7 +294,7 @@ int32_t soft_kdf_x963_derive(const metal_scl_t *const scl,
                                          (uint8_t *)&counter, sizeof(counter));
         if (SCL_OK != result)
         {
-            return (result);
+            goto cleanup;
         }
 
         counter = bswap32(counter);
@@ -199,7 +304,7 @@ int32_t soft_kdf_x963_derive(const metal_scl_t *const scl,
                                          x963kdf_ctx->shared_info_len);
         if (SCL_OK != result)
         {
-            return (result);
+            goto cleanup;
         }
 
         derivated_key_index = i * hashsize;
@@ -212,7 +317,7 @@ int32_t soft_kdf_x963_derive(const metal_scl_t *const scl,
                 &chunk_size);
             if (SCL_OK != result)
             {
-                return (result);
+                goto cleanup;
             }
 
             remaining_len -= chunk_size;
@@ -224,7 +329,7 @@ int32_t soft_kdf_x963_derive(const metal_scl_t *const scl,
                                                digest, &chunk_size);
             if (SCL_OK != result)
             {
-                return (result);
+                goto cleanup;
             }
 
             memcpy(&derivated_key[derivated_key_index], digest, remaining_len);
@@ -237,5 +342,12 @@ int32_t soft_kdf_x963_derive(const metal_scl_t *const scl,
         i++;
     } while (0 != remaining_len);
 
-    return (SCL_OK);
+    result = SCL_OK;
+
+cleanup:
+    /* both states are derived from the secret Z */
+    memset(&prefix_state, 0, sizeof(prefix_state));
+    memset(&probe_ctx, 0, sizeof(probe_ctx));
+
+    return (result);
 }
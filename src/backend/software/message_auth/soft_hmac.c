@@ -42,6 +42,22 @@
 
 static int32_t soft_hmac_block_size(hash_mode_t hash_mode);
 
+static int32_t soft_hmac_k0(const metal_scl_t *const scl,
+                            sha_ctx_t *const sha_ctx, hash_mode_t hash_mode,
+                            const uint8_t *const key, size_t key_len,
+                            uint8_t *const k0, size_t blocksize);
+
+static int32_t soft_hmac_pad_state(const metal_scl_t *const scl,
+                                   sha_ctx_t *const sha_ctx,
+                                   hash_mode_t hash_mode, uint8_t *const k0,
+                                   size_t blocksize, uint8_t pad,
+                                   sha_state_t *const state);
+
+static int32_t soft_hmac_start(const metal_scl_t *const scl,
+                               hmac_ctx_t *const hmac_ctx,
+                               sha_ctx_t *const sha_ctx, hash_mode_t hash_mode,
+                               size_t blocksize);
+
 static int32_t soft_hmac_block_size(hash_mode_t hash_mode)
 {
     int32_t blocksize;
@@ -54,6 +70,8 @@ static int32_t soft_hmac_block_size(hash_mode_t hash_mode)
         break;
     case SCL_HASH_SHA384:
     case SCL_HASH_SHA512:
+    case SCL_HASH_SHA512_224:
+    case SCL_HASH_SHA512_256:
         blocksize = SHA512_BYTE_BLOCKSIZE;
         break;
     default:
@@ -63,42 +81,19 @@ static int32_t soft_hmac_block_size(hash_mode_t hash_mode)
     return (blocksize);
 }
 
-int32_t soft_hmac_init(const metal_scl_t *const scl, hmac_ctx_t *const hmac_ctx,
-                       sha_ctx_t *const sha_ctx, hash_mode_t hash_mode,
-                       const uint8_t *const key, size_t key_len)
+/* steps 1, 2 and 3 */
+static int32_t soft_hmac_k0(const metal_scl_t *const scl,
+                            sha_ctx_t *const sha_ctx, hash_mode_t hash_mode,
+                            const uint8_t *const key, size_t key_len,
+                            uint8_t *const k0, size_t blocksize)
 {
     int32_t result;
-    size_t blocksize;
     size_t hashsize;
-    size_t i;
-
-    if ((NULL == scl) || (NULL == hmac_ctx) || (NULL == sha_ctx) ||
-        (NULL == key))
-    {
-        return (SCL_INVALID_INPUT);
-    }
-
-    if ((NULL == scl->hash_func.sha_init) ||
-        (NULL == scl->hash_func.sha_core) ||
-        (NULL == scl->hash_func.sha_finish))
-    {
-        return (SCL_ERROR_API_ENTRY_POINT);
-    }
-
-    result = soft_hmac_block_size(hash_mode);
-    if (0 > result)
-    {
-        return (result);
-    }
-    else
-    {
-        blocksize = (size_t)result;
-    }
 
     /* step 1 */
     if (key_len == blocksize)
     {
-        memcpy(hmac_ctx->k0, key, blocksize);
+        memcpy(k0, key, blocksize);
     }
     /* step 2 */
     else if (key_len > blocksize)
@@ -116,23 +111,69 @@ int32_t soft_hmac_init(const metal_scl_t *const scl, hmac_ctx_t *const hmac_ctx,
             return (result);
         }
 
-        hashsize = sizeof(hmac_ctx->k0);
-        result =
-            scl->hash_func.sha_finish(scl, sha_ctx, hmac_ctx->k0, &hashsize);
+        hashsize = blocksize;
+        result = scl->hash_func.sha_finish(scl, sha_ctx, k0, &hashsize);
         if (SCL_OK != result)
         {
             return (result);
         }
 
-        memset(&hmac_ctx->k0[hashsize], 0, blocksize - hashsize);
+        memset(&k0[hashsize], 0, blocksize - hashsize);
     }
     /* step 3 */
     else
     {
-        memcpy(hmac_ctx->k0, key, key_len);
-        memset(&hmac_ctx->k0[key_len], 0, blocksize - key_len);
+        memcpy(k0, key, key_len);
+        memset(&k0[key_len], 0, blocksize - key_len);
+    }
+
+    return (SCL_OK);
+}
+
+/* hash k0 ^ pad and export the resulting state, k0 is left unchanged */
+static int32_t soft_hmac_pad_state(const metal_scl_t *const scl,
+                                   sha_ctx_t *const sha_ctx,
+                                   hash_mode_t hash_mode, uint8_t *const k0,
+                                   size_t blocksize, uint8_t pad,
+                                   sha_state_t *const state)
+{
+    int32_t result;
+    size_t i;
+
+    for (i = 0; i < blocksize; i++)
+    {
+        k0[i] ^= pad;
+    }
+
+    result =
+        scl->hash_func.sha_init(scl, sha_ctx, hash_mode, SCL_BIG_ENDIAN_MODE);
+    if (SCL_OK == result)
+    {
+        result = scl->hash_func.sha_core(scl, sha_ctx, k0, blocksize);
+    }
+
+    for (i = 0; i < blocksize; i++)
+    {
+        k0[i] ^= pad;
+    }
+
+    if (SCL_OK != result)
+    {
+        return (result);
     }
 
+    return (scl->hash_func.sha_export_state(scl, sha_ctx, state));
+}
+
+/* steps 4 to 6 from hmac_ctx->k0, which is left unchanged */
+static int32_t soft_hmac_start(const metal_scl_t *const scl,
+                               hmac_ctx_t *const hmac_ctx,
+                               sha_ctx_t *const sha_ctx, hash_mode_t hash_mode,
+                               size_t blocksize)
+{
+    int32_t result;
+    size_t i;
+
     /* step 4 */
     for (i = 0; i < blocksize; i++)
     {
@@ -142,25 +183,212 @@ int32_t soft_hmac_init(const metal_scl_t *const scl, hmac_ctx_t *const hmac_ctx,
     /* part of steps 5 & 6, the sha_core will ensure the concatenation */
     result =
         scl->hash_func.sha_init(scl, sha_ctx, hash_mode, SCL_BIG_ENDIAN_MODE);
+    if (SCL_OK == result)
+    {
+        result =
+            scl->hash_func.sha_core(scl, sha_ctx, hmac_ctx->k0, blocksize);
+    }
+
+    /* undo step 4 for steps 7, 8, 9 */
+    for (i = 0; i < blocksize; i++)
+    {
+        hmac_ctx->k0[i] ^= SOFT_HMAC_IPAD_BYTE;
+    }
+
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    hmac_ctx->sha_ctx = sha_ctx;
+    hmac_ctx->key_ctx = NULL;
+    hmac_ctx->hash_mode = hash_mode;
+
+    return (SCL_OK);
+}
+
+int32_t soft_hmac_init(const metal_scl_t *const scl, hmac_ctx_t *const hmac_ctx,
+                       sha_ctx_t *const sha_ctx, hash_mode_t hash_mode,
+                       const uint8_t *const key, size_t key_len)
+{
+    int32_t result;
+    size_t blocksize;
+
+    if ((NULL == scl) || (NULL == hmac_ctx) || (NULL == sha_ctx) ||
+        (NULL == key))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->hash_func.sha_init) ||
+        (NULL == scl->hash_func.sha_core) ||
+        (NULL == scl->hash_func.sha_finish))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    result = soft_hmac_block_size(hash_mode);
+    if (0 > result)
+    {
+        return (result);
+    }
+    else
+    {
+        blocksize = (size_t)result;
+    }
+
+    result = soft_hmac_k0(scl, sha_ctx, hash_mode, key, key_len, hmac_ctx->k0,
+                          blocksize);
     if (SCL_OK != result)
     {
         return (result);
     }
 
-    result = scl->hash_func.sha_core(scl, sha_ctx, hmac_ctx->k0, blocksize);
+    return (soft_hmac_start(scl, hmac_ctx, sha_ctx, hash_mode, blocksize));
+}
+
+int32_t soft_hmac_key_init(const metal_scl_t *const scl,
+                           hmac_key_ctx_t *const key_ctx,
+                           sha_ctx_t *const sha_ctx, hash_mode_t hash_mode,
+                           const uint8_t *const key, size_t key_len)
+{
+    int32_t result;
+    size_t blocksize;
+    uint8_t k0[SHA512_BYTE_BLOCKSIZE] __attribute__((aligned(8)));
+    sha_ctx_t probe_ctx;
+
+    if ((NULL == scl) || (NULL == key_ctx) || (NULL == sha_ctx) ||
+        (NULL == key))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl->hash_func.sha_init) ||
+        (NULL == scl->hash_func.sha_core) ||
+        (NULL == scl->hash_func.sha_finish) ||
+        (NULL == scl->hash_func.sha_export_state) ||
+        (NULL == scl->hash_func.sha_import_state))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    result = soft_hmac_block_size(hash_mode);
+    if (0 > result)
+    {
+        return (result);
+    }
+    else
+    {
+        blocksize = (size_t)result;
+    }
+
+    memset(key_ctx, 0, sizeof(hmac_key_ctx_t));
+
+    result = soft_hmac_k0(scl, sha_ctx, hash_mode, key, key_len, k0,
+                          blocksize);
+
+    /* beginning of steps 5 and 8 */
+    if (SCL_OK == result)
+    {
+        result = soft_hmac_pad_state(scl, sha_ctx, hash_mode, k0, blocksize,
+                                     SOFT_HMAC_IPAD_BYTE, &key_ctx->inner);
+    }
+
+    /**
+     * Resuming from the states only pays off when the backend keeps an
+     * imported state where it was computed. A backend that can only resume
+     * in software (HCA 0.5.x) would run every MAC off the accelerator, so
+     * keep k0 and hash k0 ^ ipad and k0 ^ opad again for each MAC instead,
+     * unless the hash already runs in software.
+     */
+    if (SCL_OK == result)
+    {
+        result = scl->hash_func.sha_import_state(scl, &probe_ctx,
+                                                 &key_ctx->inner);
+    }
+
+    if (SCL_OK == result)
+    {
+        key_ctx->resume_state = (false == probe_ctx.soft_resume) ||
+                                (true == sha_ctx->soft_resume);
+
+        if (true == key_ctx->resume_state)
+        {
+            result =
+                soft_hmac_pad_state(scl, sha_ctx, hash_mode, k0, blocksize,
+                                    SOFT_HMAC_OPAD_BYTE, &key_ctx->outer);
+        }
+        else
+        {
+            memset(&key_ctx->inner, 0, sizeof(key_ctx->inner));
+            memcpy(key_ctx->k0, k0, blocksize);
+        }
+    }
+
+    /* the key material shall not stay on the stack */
+    memset(k0, 0, sizeof(k0));
+    memset(&probe_ctx, 0, sizeof(probe_ctx));
+
     if (SCL_OK != result)
     {
+        memset(key_ctx, 0, sizeof(hmac_key_ctx_t));
         return (result);
     }
 
-    /* undo step 4 for steps 7, 8, 9 */
-    for (i = 0; i < blocksize; i++)
+    key_ctx->hash_mode = hash_mode;
+
+    return (SCL_OK);
+}
+
+int32_t soft_hmac_init_with_key(const metal_scl_t *const scl,
+                                hmac_ctx_t *const hmac_ctx,
+                                sha_ctx_t *const sha_ctx,
+                                const hmac_key_ctx_t *const key_ctx)
+{
+    int32_t result;
+
+    if ((NULL == scl) || (NULL == hmac_ctx) || (NULL == sha_ctx) ||
+        (NULL == key_ctx))
     {
-        hmac_ctx->k0[i] ^= SOFT_HMAC_IPAD_BYTE;
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (false == key_ctx->resume_state)
+    {
+        if ((NULL == scl->hash_func.sha_init) ||
+            (NULL == scl->hash_func.sha_core))
+        {
+            return (SCL_ERROR_API_ENTRY_POINT);
+        }
+
+        result = soft_hmac_block_size(key_ctx->hash_mode);
+        if (0 > result)
+        {
+            return (result);
+        }
+
+        /* same as soft_hmac_init() with a raw key, k0 is already computed */
+        memcpy(hmac_ctx->k0, key_ctx->k0, sizeof(hmac_ctx->k0));
+
+        return (soft_hmac_start(scl, hmac_ctx, sha_ctx, key_ctx->hash_mode,
+                                (size_t)result));
+    }
+
+    if (NULL == scl->hash_func.sha_import_state)
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    /* steps 5 and 6 resume after k0 ^ ipad */
+    result = scl->hash_func.sha_import_state(scl, sha_ctx, &key_ctx->inner);
+    if (SCL_OK != result)
+    {
+        return (result);
     }
 
     hmac_ctx->sha_ctx = sha_ctx;
-    hmac_ctx->hash_mode = hash_mode;
+    hmac_ctx->key_ctx = key_ctx;
+    hmac_ctx->hash_mode = key_ctx->hash_mode;
 
     return (SCL_OK);
 }
@@ -231,6 +459,40 @@ int32_t soft_hmac_finish(const metal_scl_t *const scl,
         return (result);
     }
 
+    if (NULL != hmac_ctx->key_ctx)
+    {
+        if (NULL == scl->hash_func.sha_import_state)
+        {
+            return (SCL_ERROR_API_ENTRY_POINT);
+        }
+
+        /* steps 7 to 9, resuming after k0 ^ opad */
+        result = scl->hash_func.sha_import_state(scl, hmac_ctx->sha_ctx,
+                                                 &hmac_ctx->key_ctx->outer);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+
+        result = scl->hash_func.sha_core(scl, hmac_ctx->sha_ctx, mac, hashsize);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+
+        result =
+            scl->hash_func.sha_finish(scl, hmac_ctx->sha_ctx, mac, mac_len);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+
+        /* clear context */
+        memset(hmac_ctx, 0, sizeof(hmac_ctx_t));
+
+        return (SCL_OK);
+    }
+
     /* step 7 */
     for (i = 0; i < blocksize; i++)
     {
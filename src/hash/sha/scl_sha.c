@@ -31,6 +31,8 @@
  * @copyright SPDX-License-Identifier: MIT
  */
 
+#include <string.h>
+
 #include <scl/scl_retdefs.h>
 #include <scl/scl_sha.h>
 
@@ -127,6 +129,103 @@ int32_t scl_sha_finish(const metal_scl_t *const scl_ctx,
     return (scl_ctx->hash_func.sha_finish(scl_ctx, ctx, hash, hash_len));
 }
 
+int32_t scl_sha_export_state(const metal_scl_t *const scl_ctx,
+                             const scl_sha_ctx_t *const ctx,
+                             scl_sha_state_t *const state)
+{
+    if (NULL == scl_ctx)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl_ctx->hash_func.sha_export_state))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl_ctx->hash_func.sha_export_state(scl_ctx, ctx, state));
+}
+
+int32_t scl_sha_import_state(const metal_scl_t *const scl_ctx,
+                             scl_sha_ctx_t *const ctx,
+                             const scl_sha_state_t *const state)
+{
+    if (NULL == scl_ctx)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl_ctx->hash_func.sha_import_state))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl_ctx->hash_func.sha_import_state(scl_ctx, ctx, state));
+}
+
+int32_t scl_sha_ctx_clone(const metal_scl_t *const scl_ctx,
+                          const scl_sha_ctx_t *const src,
+                          scl_sha_ctx_t *const dst)
+{
+    int32_t result;
+    scl_sha_state_t state;
+
+    // a hardware context may keep its state in the accelerator, so the clone
+    // goes through the backend export/import
+    result = scl_sha_export_state(scl_ctx, src, &state);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    return (scl_sha_import_state(scl_ctx, dst, &state));
+}
+
+int32_t scl_sha_multi(const metal_scl_t *const scl_ctx, scl_hash_mode_t algo,
+                      const uint8_t *const *const msgs,
+                      const size_t *const lens, size_t count,
+                      uint8_t *const *const digests, size_t *const hash_len)
+{
+    int32_t result;
+    size_t i;
+    size_t digest_len = 0;
+
+    if ((NULL == scl_ctx) || (NULL == msgs) || (NULL == lens))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == digests) || (NULL == hash_len))
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    if (NULL != scl_ctx->hash_func.sha_multi)
+    {
+        return (scl_ctx->hash_func.sha_multi(scl_ctx, algo, msgs, lens, count,
+                                             digests, hash_len));
+    }
+
+    // no multi-buffer entry point (e.g. hardware backend), hash one by one
+    for (i = 0; i < count; i++)
+    {
+        digest_len = *hash_len;
+        result = scl_sha(scl_ctx, algo, msgs[i], lens[i], digests[i],
+                         &digest_len);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+    }
+
+    if (0 != count)
+    {
+        *hash_len = digest_len;
+    }
+
+    return (SCL_OK);
+}
+
 /**
  * this function is used to determine if a proposed integer is a valide hash
  * digest length it is used in ECDSA for checking
@@ -145,3 +244,76 @@ int32_t scl_valid_hash_digest_length(size_t inputlength)
 
     return (SCL_INVALID_INPUT);
 }
+
+static int32_t scl_sha256_fixed(const metal_scl_t *const scl_ctx,
+                                const uint8_t *const in, size_t in_len,
+                                uint8_t *const out)
+{
+    size_t hash_len = SHA256_BYTE_HASHSIZE;
+
+    if (NULL == scl_ctx)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (NULL != scl_ctx->hash_func.sha256_fixed)
+    {
+        return (scl_ctx->hash_func.sha256_fixed(scl_ctx, in, in_len, out));
+    }
+
+    // no fixed length entry point (e.g. hardware backend)
+    return (scl_sha(scl_ctx, SCL_HASH_SHA256, in, in_len, out, &hash_len));
+}
+
+int32_t scl_sha256_32B(const metal_scl_t *const scl_ctx,
+                       const uint8_t *const in, uint8_t *const out)
+{
+    return (scl_sha256_fixed(scl_ctx, in, SHA256_BYTE_HASHSIZE, out));
+}
+
+int32_t scl_sha256_64B(const metal_scl_t *const scl_ctx,
+                       const uint8_t *const in, uint8_t *const out)
+{
+    return (scl_sha256_fixed(scl_ctx, in, SHA256_BYTE_BLOCKSIZE, out));
+}
+
+int32_t scl_sha256_merkle_level(const metal_scl_t *const scl_ctx,
+                                const uint8_t *const in, size_t n,
+                                uint8_t *const out)
+{
+    int32_t result;
+    size_t i;
+
+    if ((NULL == scl_ctx) || ((NULL == in) && (0 != n)))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == out) && (0 != n))
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    if (NULL != scl_ctx->hash_func.sha256_merkle_level)
+    {
+        return (scl_ctx->hash_func.sha256_merkle_level(scl_ctx, in, n, out));
+    }
+
+    for (i = 0; i < n / 2; i++)
+    {
+        result = scl_sha256_64B(scl_ctx, &in[i * SHA256_BYTE_BLOCKSIZE],
+                                &out[i * SHA256_BYTE_HASHSIZE]);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+    }
+
+    if (0 != (n & 1))
+    {
+        memmove(&out[i * SHA256_BYTE_HASHSIZE], &in[i * SHA256_BYTE_BLOCKSIZE],
+                SHA256_BYTE_HASHSIZE);
+    }
+
+    return (SCL_OK);
+}
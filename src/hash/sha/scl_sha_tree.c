@@ -0,0 +1,616 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+
+/**
+ * @file scl_sha_tree.c
+ * @brief Merkle tree hashing of large images, split in fixed size chunks
+ * @details leaves are hashed by rounds, split between several threads when
+ * SCL_SHA_TREE_PTHREAD is defined (host build): each round is a fork/join,
+ * its threads are created and joined within the round. Leaves are then folded
+ * into a stack of subtree roots, so the memory needed does not depend on the
+ * image size.
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#if defined(SCL_SHA_TREE_PTHREAD)
+#include <pthread.h>
+#endif
+
+#include <scl/scl_retdefs.h>
+#include <scl/scl_sha_tree.h>
+
+#include <backend/api/scl_backend_api.h>
+
+#if defined(SCL_SHA_TREE_PTHREAD)
+#define SCL_SHA_TREE_ROUND_LEAVES                                              \
+    (SCL_SHA_TREE_THREADS * SCL_SHA_TREE_THREAD_LEAVES)
+#else
+#define SCL_SHA_TREE_ROUND_LEAVES SCL_SHA_TREE_BATCH
+#endif
+
+/*! @brief first byte hashed in a leaf (RFC 6962 domain separation) */
+#define SCL_SHA_TREE_LEAF_PREFIX 0x00
+/*! @brief first byte hashed in a node (RFC 6962 domain separation) */
+#define SCL_SHA_TREE_NODE_PREFIX 0x01
+
+/*! @brief leaves hashing job (a whole round, or the slice of one thread) */
+typedef struct
+{
+    const metal_scl_t *scl_ctx;
+    scl_hash_mode_t algo;
+    const uint8_t *data;
+    size_t len;
+    size_t chunk_size;
+    /*! @brief index of the first leaf */
+    size_t first;
+    /*! @brief number of leaves */
+    size_t nb;
+    /*! @brief concatenated leaves */
+    uint8_t *leaves;
+    size_t hash_len;
+    int32_t result;
+} scl_sha_tree_job_t;
+
+/*! @brief stack of the roots of complete subtrees */
+typedef struct
+{
+    const metal_scl_t *scl_ctx;
+    scl_hash_mode_t algo;
+    size_t hash_len;
+    /*! @brief adjacent nodes, so that two siblings are one message */
+    uint8_t *nodes;
+    size_t top;
+    size_t count;
+} scl_sha_tree_fold_t;
+
+static size_t scl_sha_tree_hash_len(scl_hash_mode_t algo);
+
+static int32_t scl_sha_tree_hash(const metal_scl_t *const scl_ctx,
+                                 scl_hash_mode_t algo, uint8_t prefix,
+                                 const uint8_t *const data, size_t len,
+                                 uint8_t *const hash, size_t hash_len);
+
+static int32_t scl_sha_tree_hash_leaves(scl_sha_tree_job_t *const job);
+
+static int32_t scl_sha_tree_round(scl_sha_tree_job_t *const job);
+
+static int32_t scl_sha_tree_merge(scl_sha_tree_fold_t *const fold);
+
+static int32_t scl_sha_tree_push(scl_sha_tree_fold_t *const fold,
+                                 const uint8_t *const leaf);
+
+static int32_t scl_sha_tree_root(scl_sha_tree_fold_t *const fold);
+
+static size_t scl_sha_tree_depth(size_t nb_leaves);
+
+static size_t scl_sha_tree_hash_len(scl_hash_mode_t algo)
+{
+    switch (algo)
+    {
+    case SCL_HASH_SHA224:
+        return (SHA224_BYTE_HASHSIZE);
+    case SCL_HASH_SHA256:
+        return (SHA256_BYTE_HASHSIZE);
+    case SCL_HASH_SHA384:
+        return (SHA384_BYTE_HASHSIZE);
+    case SCL_HASH_SHA512:
+        return (SHA512_BYTE_HASHSIZE);
+    case SCL_HASH_SHA512_224:
+        return (SHA512_224_BYTE_HASHSIZE);
+    case SCL_HASH_SHA512_256:
+        return (SHA512_256_BYTE_HASHSIZE);
+    default:
+        break;
+    }
+
+    return (0);
+}
+
+/* hash of prefix || data */
+static int32_t scl_sha_tree_hash(const metal_scl_t *const scl_ctx,
+                                 scl_hash_mode_t algo, uint8_t prefix,
+                                 const uint8_t *const data, size_t len,
+                                 uint8_t *const hash, size_t hash_len)
+{
+    int32_t result;
+    scl_sha_ctx_t ctx;
+
+    result = scl_sha_init(scl_ctx, &ctx, algo);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    result = scl_sha_core(scl_ctx, &ctx, &prefix, sizeof(prefix));
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    if (0 != len)
+    {
+        result = scl_sha_core(scl_ctx, &ctx, data, len);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+    }
+
+    return (scl_sha_finish(scl_ctx, &ctx, hash, &hash_len));
+}
+
+static int32_t scl_sha_tree_hash_leaves(scl_sha_tree_job_t *const job)
+{
+    int32_t result;
+    size_t i;
+    size_t offset;
+    size_t len;
+
+    for (i = 0; i < job->nb; i++)
+    {
+        offset = (job->first + i) * job->chunk_size;
+        len = job->len - offset;
+        if (len > job->chunk_size)
+        {
+            len = job->chunk_size;
+        }
+
+        result = scl_sha_tree_hash(job->scl_ctx, job->algo,
+                                   SCL_SHA_TREE_LEAF_PREFIX, &job->data[offset],
+                                   len, &job->leaves[i * job->hash_len],
+                                   job->hash_len);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+    }
+
+    return (SCL_OK);
+}
+
+#if defined(SCL_SHA_TREE_PTHREAD)
+static void *scl_sha_tree_worker(void *arg);
+
+static void *scl_sha_tree_worker(void *arg)
+{
+    scl_sha_tree_job_t *job = (scl_sha_tree_job_t *)arg;
+
+    job->result = scl_sha_tree_hash_leaves(job);
+
+    return (NULL);
+}
+
+/*
+ * fork/join: split the round in slices, the calling thread hashes the first
+ * one, the others are hashed by threads created for this round and joined
+ * before it returns. A round is SCL_SHA_TREE_THREAD_LEAVES leaves per thread,
+ * which amortizes the thread creation; no worker outlives the call.
+ */
+static int32_t scl_sha_tree_round(scl_sha_tree_job_t *const job)
+{
+    int32_t result;
+    size_t i;
+    size_t slice;
+    size_t nb_threads = 0;
+    bool started[SCL_SHA_TREE_THREADS] = {false};
+    pthread_t threads[SCL_SHA_TREE_THREADS];
+    scl_sha_tree_job_t jobs[SCL_SHA_TREE_THREADS];
+
+    slice = (job->nb + SCL_SHA_TREE_THREADS - 1) / SCL_SHA_TREE_THREADS;
+
+    for (i = 0; (i < SCL_SHA_TREE_THREADS) && (i * slice < job->nb); i++)
+    {
+        jobs[i] = *job;
+        jobs[i].first = job->first + i * slice;
+        jobs[i].nb = job->nb - i * slice;
+        if (jobs[i].nb > slice)
+        {
+            jobs[i].nb = slice;
+        }
+
+        jobs[i].leaves = &job->leaves[i * slice * job->hash_len];
+        jobs[i].result = SCL_OK;
+        nb_threads++;
+    }
+
+    for (i = 1; i < nb_threads; i++)
+    {
+        started[i] = (0 == pthread_create(&threads[i], NULL,
+                                          scl_sha_tree_worker, &jobs[i]));
+        if (false == started[i])
+        {
+            // no more threads available, hash the slice here
+            jobs[i].result = scl_sha_tree_hash_leaves(&jobs[i]);
+        }
+    }
+
+    result = scl_sha_tree_hash_leaves(&jobs[0]);
+
+    for (i = 1; i < nb_threads; i++)
+    {
+        if (true == started[i])
+        {
+            (void)pthread_join(threads[i], NULL);
+        }
+
+        if ((SCL_OK == result) && (SCL_OK != jobs[i].result))
+        {
+            result = jobs[i].result;
+        }
+    }
+
+    return (result);
+}
+#else
+static int32_t scl_sha_tree_round(scl_sha_tree_job_t *const job)
+{
+    return (scl_sha_tree_hash_leaves(job));
+}
+#endif
+
+/* replace the two nodes on top of the stack by their parent */
+static int32_t scl_sha_tree_merge(scl_sha_tree_fold_t *const fold)
+{
+    uint8_t *left = &fold->nodes[(fold->top - 2) * fold->hash_len];
+
+    fold->top--;
+
+    return (scl_sha_tree_hash(fold->scl_ctx, fold->algo,
+                              SCL_SHA_TREE_NODE_PREFIX, left,
+                              2 * fold->hash_len, left, fold->hash_len));
+}
+
+/* leaf n completes one subtree per trailing one of n */
+static int32_t scl_sha_tree_push(scl_sha_tree_fold_t *const fold,
+                                 const uint8_t *const leaf)
+{
+    int32_t result;
+    size_t n;
+
+    memcpy(&fold->nodes[fold->top * fold->hash_len], leaf, fold->hash_len);
+    fold->top++;
+    fold->count++;
+
+    for (n = fold->count; 0 == (n & 1); n >>= 1)
+    {
+        result = scl_sha_tree_merge(fold);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+    }
+
+    return (SCL_OK);
+}
+
+/*
+ * the remaining subtrees have decreasing sizes, promoting odd nodes level by
+ * level amounts to merging them from the smallest one
+ */
+static int32_t scl_sha_tree_root(scl_sha_tree_fold_t *const fold)
+{
+    int32_t result;
+
+    while (fold->top > 1)
+    {
+        result = scl_sha_tree_merge(fold);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+    }
+
+    return (SCL_OK);
+}
+
+/* the stack holds at most one node per bit of the number of leaves */
+static size_t scl_sha_tree_depth(size_t nb_leaves)
+{
+    size_t depth = 0;
+
+    while (0 != nb_leaves)
+    {
+        depth++;
+        nb_leaves >>= 1;
+    }
+
+    return (depth);
+}
+
+size_t scl_sha_tree_nb_chunks(size_t len, size_t chunk_size)
+{
+    if (0 == chunk_size)
+    {
+        return (0);
+    }
+
+    if (0 == len)
+    {
+        return (1);
+    }
+
+    return ((len - 1) / chunk_size + 1);
+}
+
+int32_t scl_sha_tree(const metal_scl_t *const scl_ctx, scl_hash_mode_t algo,
+                     const uint8_t *const data, size_t len, size_t chunk_size,
+                     uint8_t *const root, size_t *const root_len)
+{
+    int32_t result = SCL_OK;
+    size_t i;
+    size_t nb_leaves;
+    size_t hash_len = scl_sha_tree_hash_len(algo);
+    scl_sha_tree_job_t job;
+    scl_sha_tree_fold_t fold;
+
+    if ((NULL == scl_ctx) || (NULL == data) || (0 == hash_len))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == root) || (NULL == root_len) || (*root_len < hash_len))
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    if (0 == chunk_size)
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    nb_leaves = scl_sha_tree_nb_chunks(len, chunk_size);
+
+    {
+        uint8_t leaves[SCL_SHA_TREE_ROUND_LEAVES * hash_len]
+            __attribute__((aligned(8)));
+        uint8_t nodes[scl_sha_tree_depth(nb_leaves) * hash_len]
+            __attribute__((aligned(8)));
+
+        job.scl_ctx = scl_ctx;
+        job.algo = algo;
+        job.data = data;
+        job.len = len;
+        job.chunk_size = chunk_size;
+        job.leaves = leaves;
+        job.hash_len = hash_len;
+
+        fold.scl_ctx = scl_ctx;
+        fold.algo = algo;
+        fold.hash_len = hash_len;
+        fold.nodes = nodes;
+        fold.top = 0;
+        fold.count = 0;
+
+        for (job.first = 0; job.first < nb_leaves; job.first += job.nb)
+        {
+            job.nb = nb_leaves - job.first;
+            if (job.nb > SCL_SHA_TREE_ROUND_LEAVES)
+            {
+                job.nb = SCL_SHA_TREE_ROUND_LEAVES;
+            }
+
+            result = scl_sha_tree_round(&job);
+
+            for (i = 0; (SCL_OK == result) && (i < job.nb); i++)
+            {
+                result = scl_sha_tree_push(&fold, &leaves[i * hash_len]);
+            }
+
+            if (SCL_OK != result)
+            {
+                return (result);
+            }
+        }
+
+        result = scl_sha_tree_root(&fold);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+
+        memcpy(root, nodes, hash_len);
+        *root_len = hash_len;
+
+        return (SCL_OK);
+    }
+}
+
+int32_t scl_sha_tree_leaves(const metal_scl_t *const scl_ctx,
+                            scl_hash_mode_t algo, const uint8_t *const data,
+                            size_t len, size_t chunk_size,
+                            uint8_t *const leaves, size_t leaves_len)
+{
+    int32_t result;
+    size_t nb_leaves;
+    size_t hash_len = scl_sha_tree_hash_len(algo);
+    scl_sha_tree_job_t job;
+
+    if ((NULL == scl_ctx) || (NULL == data) || (0 == hash_len))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (0 == chunk_size)
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    nb_leaves = scl_sha_tree_nb_chunks(len, chunk_size);
+
+    if ((NULL == leaves) || (leaves_len / hash_len < nb_leaves))
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    job.scl_ctx = scl_ctx;
+    job.algo = algo;
+    job.data = data;
+    job.len = len;
+    job.chunk_size = chunk_size;
+    job.hash_len = hash_len;
+
+    // leaves go straight to the output buffer
+    for (job.first = 0; job.first < nb_leaves; job.first += job.nb)
+    {
+        job.nb = nb_leaves - job.first;
+        if (job.nb > SCL_SHA_TREE_ROUND_LEAVES)
+        {
+            job.nb = SCL_SHA_TREE_ROUND_LEAVES;
+        }
+
+        job.leaves = &leaves[job.first * hash_len];
+
+        result = scl_sha_tree_round(&job);
+        if (SCL_OK != result)
+        {
+            return (result);
+        }
+    }
+
+    return (SCL_OK);
+}
+
+int32_t scl_sha_tree_verify(const metal_scl_t *const scl_ctx,
+                            scl_hash_mode_t algo, const uint8_t *const data,
+                            size_t len, size_t chunk_size,
+                            const uint8_t *const expected_leaves,
+                            const uint8_t *const expected_root,
+                            uint32_t *const bad_chunks, size_t bad_chunks_len)
+{
+    int32_t result = SCL_OK;
+    size_t i;
+    size_t index;
+    size_t nb_leaves;
+    bool all_match = true;
+    size_t hash_len = scl_sha_tree_hash_len(algo);
+    scl_sha_tree_job_t job;
+    scl_sha_tree_fold_t fold;
+
+    if ((NULL == scl_ctx) || (NULL == data) || (NULL == expected_leaves) ||
+        (0 == hash_len))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (0 == chunk_size)
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    nb_leaves = scl_sha_tree_nb_chunks(len, chunk_size);
+
+    if ((NULL == bad_chunks) ||
+        (bad_chunks_len / sizeof(uint32_t) < (nb_leaves + 31) / 32))
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    {
+        uint8_t leaves[SCL_SHA_TREE_ROUND_LEAVES * hash_len]
+            __attribute__((aligned(8)));
+        uint8_t nodes[scl_sha_tree_depth(nb_leaves) * hash_len]
+            __attribute__((aligned(8)));
+
+        // only chunks that match an authenticated leaf are known to be good
+        if (NULL != expected_root)
+        {
+            fold.scl_ctx = scl_ctx;
+            fold.algo = algo;
+            fold.hash_len = hash_len;
+            fold.nodes = nodes;
+            fold.top = 0;
+            fold.count = 0;
+
+            for (i = 0; (SCL_OK == result) && (i < nb_leaves); i++)
+            {
+                result =
+                    scl_sha_tree_push(&fold, &expected_leaves[i * hash_len]);
+            }
+
+            if (SCL_OK == result)
+            {
+                result = scl_sha_tree_root(&fold);
+            }
+
+            if (SCL_OK != result)
+            {
+                return (result);
+            }
+
+            if (0 != memcmp(nodes, expected_root, hash_len))
+            {
+                return (SCL_INVALID_INPUT);
+            }
+        }
+
+        memset(bad_chunks, 0, ((nb_leaves + 31) / 32) * sizeof(uint32_t));
+
+        job.scl_ctx = scl_ctx;
+        job.algo = algo;
+        job.data = data;
+        job.len = len;
+        job.chunk_size = chunk_size;
+        job.leaves = leaves;
+        job.hash_len = hash_len;
+
+        for (job.first = 0; job.first < nb_leaves; job.first += job.nb)
+        {
+            job.nb = nb_leaves - job.first;
+            if (job.nb > SCL_SHA_TREE_ROUND_LEAVES)
+            {
+                job.nb = SCL_SHA_TREE_ROUND_LEAVES;
+            }
+
+            result = scl_sha_tree_round(&job);
+            if (SCL_OK != result)
+            {
+                return (result);
+            }
+
+            for (i = 0; i < job.nb; i++)
+            {
+                index = job.first + i;
+                if (0 != memcmp(&leaves[i * hash_len],
+                                &expected_leaves[index * hash_len], hash_len))
+                {
+                    bad_chunks[index / 32] |= (uint32_t)1 << (index % 32);
+                    all_match = false;
+                }
+            }
+        }
+
+        if (false == all_match)
+        {
+            return (SCL_ERR_HASH);
+        }
+
+        return (SCL_OK);
+    }
+}
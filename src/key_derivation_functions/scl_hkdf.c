@@ -0,0 +1,248 @@
+/******************************************************************************
+ *
+ * SiFive Cryptographic Library (SCL)
+ *
+ ******************************************************************************
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+
+
+/**
+ * @file scl_hkdf.c
+ * @brief HMAC-based key derivation function (RFC 5869), built on the HMAC
+ * interface
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ */
+
+#include <string.h>
+
+#include <scl/scl_retdefs.h>
+
+#include <scl/scl_hkdf.h>
+
+static int32_t scl_hkdf_hash_length(scl_hash_mode_t hash_mode);
+
+static int32_t scl_hkdf_hash_length(scl_hash_mode_t hash_mode)
+{
+    switch (hash_mode)
+    {
+    case SCL_HASH_SHA224:
+        return (SHA224_BYTE_HASHSIZE);
+    case SCL_HASH_SHA256:
+        return (SHA256_BYTE_HASHSIZE);
+    case SCL_HASH_SHA384:
+        return (SHA384_BYTE_HASHSIZE);
+    case SCL_HASH_SHA512:
+        return (SHA512_BYTE_HASHSIZE);
+    case SCL_HASH_SHA512_224:
+        return (SHA512_224_BYTE_HASHSIZE);
+    case SCL_HASH_SHA512_256:
+        return (SHA512_256_BYTE_HASHSIZE);
+    default:
+        break;
+    }
+
+    return (SCL_INVALID_INPUT);
+}
+
+int32_t scl_hkdf_extract(const metal_scl_t *const scl_ctx,
+                         scl_hash_mode_t hash_mode, const uint8_t *const salt,
+                         size_t salt_len, const uint8_t *const ikm,
+                         size_t ikm_len, uint8_t *const prk,
+                         size_t *const prk_len)
+{
+    int32_t result;
+    size_t hash_len;
+    const uint8_t *key;
+    size_t key_len;
+    scl_hmac_ctx_t hmac_ctx;
+    scl_sha_ctx_t sha_ctx;
+    uint8_t zero_salt[SHA512_BYTE_HASHSIZE] __attribute__((aligned(8)));
+
+    if ((NULL == scl_ctx) || (NULL == ikm))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == prk) || (NULL == prk_len))
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    result = scl_hkdf_hash_length(hash_mode);
+    if (0 > result)
+    {
+        return (result);
+    }
+
+    hash_len = (size_t)result;
+
+    if (*prk_len < hash_len)
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    if ((NULL == salt) || (0 == salt_len))
+    {
+        /* salt not provided: HashLen zeros */
+        memset(zero_salt, 0, hash_len);
+        key = zero_salt;
+        key_len = hash_len;
+    }
+    else
+    {
+        key = salt;
+        key_len = salt_len;
+    }
+
+    result = scl_hmac_init(scl_ctx, &hmac_ctx, &sha_ctx, hash_mode, key,
+                           key_len);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    result = scl_hmac_core(scl_ctx, &hmac_ctx, ikm, ikm_len);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    return (scl_hmac_finish(scl_ctx, &hmac_ctx, prk, prk_len));
+}
+
+int32_t scl_hkdf_expand_init(const metal_scl_t *const scl_ctx,
+                             scl_hkdf_ctx_t *const hkdf_ctx,
+                             scl_hash_mode_t hash_mode,
+                             const uint8_t *const prk, size_t prk_len)
+{
+    int32_t result;
+    size_t hash_len;
+    scl_sha_ctx_t sha_ctx;
+
+    if ((NULL == scl_ctx) || (NULL == hkdf_ctx) || (NULL == prk))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    result = scl_hkdf_hash_length(hash_mode);
+    if (0 > result)
+    {
+        return (result);
+    }
+
+    hash_len = (size_t)result;
+
+    if (prk_len < hash_len)
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    result = scl_hmac_key_init(scl_ctx, &hkdf_ctx->prk_ctx, &sha_ctx,
+                               hash_mode, prk, prk_len);
+    if (SCL_OK != result)
+    {
+        return (result);
+    }
+
+    hkdf_ctx->hash_len = hash_len;
+
+    return (SCL_OK);
+}
+
+int32_t scl_hkdf_expand(const metal_scl_t *const scl_ctx,
+                        const scl_hkdf_ctx_t *const hkdf_ctx,
+                        const uint8_t *const info, size_t info_len,
+                        uint8_t *const okm, size_t okm_len)
+{
+    int32_t result = SCL_OK;
+    size_t okm_index;
+    size_t chunk_size;
+    size_t t_len = 0;
+    uint8_t counter;
+    scl_hmac_ctx_t hmac_ctx;
+    scl_sha_ctx_t sha_ctx;
+    uint8_t t[SHA512_BYTE_HASHSIZE] __attribute__((aligned(8)));
+
+    if ((NULL == scl_ctx) || (NULL == hkdf_ctx) ||
+        ((NULL == info) && (0 != info_len)))
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if (NULL == okm)
+    {
+        return (SCL_INVALID_OUTPUT);
+    }
+
+    if ((0 == okm_len) ||
+        (okm_len > SCL_HKDF_MAX_BLOCKS * hkdf_ctx->hash_len))
+    {
+        return (SCL_INVALID_LENGTH);
+    }
+
+    /* T(i) = HMAC-Hash(PRK, T(i - 1) | info | i), T(0) being empty */
+    for (okm_index = 0, counter = 1; okm_index < okm_len; counter++)
+    {
+        result = scl_hmac_init_with_key(scl_ctx, &hmac_ctx, &sha_ctx,
+                                        &hkdf_ctx->prk_ctx);
+        if ((SCL_OK == result) && (0 != t_len))
+        {
+            result = scl_hmac_core(scl_ctx, &hmac_ctx, t, t_len);
+        }
+
+        if ((SCL_OK == result) && (0 != info_len))
+        {
+            result = scl_hmac_core(scl_ctx, &hmac_ctx, info, info_len);
+        }
+
+        if (SCL_OK == result)
+        {
+            result = scl_hmac_core(scl_ctx, &hmac_ctx, &counter,
+                                   sizeof(counter));
+        }
+
+        if (SCL_OK == result)
+        {
+            t_len = sizeof(t);
+            result = scl_hmac_finish(scl_ctx, &hmac_ctx, t, &t_len);
+        }
+
+        if (SCL_OK != result)
+        {
+            break;
+        }
+
+        chunk_size = okm_len - okm_index;
+        if (chunk_size > t_len)
+        {
+            chunk_size = t_len;
+        }
+
+        memcpy(&okm[okm_index], t, chunk_size);
+        okm_index += chunk_size;
+    }
+
+    /* T(i) is part of the output keying material */
+    memset(t, 0, sizeof(t));
+
+    return (result);
+}
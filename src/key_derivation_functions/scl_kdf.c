@@ -31,7 +31,10 @@
  * @copyright SPDX-License-Identifier: MIT
  */
 
+#include <string.h>
+
 #include <scl/scl_retdefs.h>
+#include <scl/scl_utils.h>
 
 #include <scl/scl_kdf.h>
 
@@ -77,3 +80,130 @@ int32_t scl_kdf_x963_derive(const metal_scl_t *const scl_ctx,
                                           input_key_len, derivated_key,
                                           derivated_key_length));
 }
+
+int32_t scl_pbkdf2(const metal_scl_t *const scl_ctx, scl_hash_mode_t hash_mode,
+                   const uint8_t *const password, size_t password_len,
+                   const uint8_t *const salt, size_t salt_len,
+                   uint32_t iterations, uint8_t *const derivated_key,
+                   size_t derivated_key_length)
+{
+    if (NULL == scl_ctx)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl_ctx->kdf_func.pbkdf2))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl_ctx->kdf_func.pbkdf2(scl_ctx, hash_mode, password,
+                                     password_len, salt, salt_len, iterations,
+                                     derivated_key, derivated_key_length));
+}
+
+int32_t scl_kdf_sp800108_hmac_init(const metal_scl_t *const scl_ctx,
+                                   scl_sp800108kdf_ctx_t *const sp800108kdf_ctx,
+                                   scl_sha_ctx_t *const sha_ctx,
+                                   scl_hash_mode_t hash_mode,
+                                   const uint8_t *const key, size_t key_len)
+{
+    if (NULL == scl_ctx)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl_ctx->kdf_func.sp800108_hmac_init))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl_ctx->kdf_func.sp800108_hmac_init(
+        scl_ctx, sp800108kdf_ctx, sha_ctx, hash_mode, key, key_len));
+}
+
+int32_t scl_kdf_sp800108_cmac_init(const metal_scl_t *const scl_ctx,
+                                   scl_sp800108kdf_ctx_t *const sp800108kdf_ctx,
+                                   const uint8_t *const key, size_t key_len)
+{
+    int32_t ret;
+    scl_aes_key_type_t key_type;
+    uint64_t key_formated[4] = {0};
+
+    if (NULL == scl_ctx)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl_ctx->kdf_func.sp800108_cmac_init))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    switch (key_len)
+    {
+    case SCL_KEY128:
+        key_type = SCL_AES_KEY128;
+        break;
+    case SCL_KEY192:
+        key_type = SCL_AES_KEY192;
+        break;
+    case SCL_KEY256:
+        key_type = SCL_AES_KEY256;
+        break;
+    default:
+        return (SCL_INVALID_INPUT);
+    }
+
+    ret = scl_format_key(key, key_len, key_formated);
+    if (SCL_OK != ret)
+    {
+        return (ret);
+    }
+
+    ret = scl_ctx->kdf_func.sp800108_cmac_init(scl_ctx, sp800108kdf_ctx,
+                                               key_type, key_formated);
+
+    memset(key_formated, 0, sizeof(key_formated));
+
+    return (ret);
+}
+
+int32_t scl_kdf_sp800108_derive(
+    const metal_scl_t *const scl_ctx,
+    const scl_sp800108kdf_ctx_t *const sp800108kdf_ctx,
+    const uint8_t *const label, size_t label_len, const uint8_t *const context,
+    size_t context_len, uint8_t *const derivated_key,
+    size_t derivated_key_length)
+{
+    scl_sp800108kdf_request_t request = {
+        .label = label,
+        .label_len = label_len,
+        .context = context,
+        .context_len = context_len,
+        .derivated_key = derivated_key,
+        .derivated_key_length = derivated_key_length,
+    };
+
+    return (
+        scl_kdf_sp800108_derive_batch(scl_ctx, sp800108kdf_ctx, &request, 1));
+}
+
+int32_t scl_kdf_sp800108_derive_batch(
+    const metal_scl_t *const scl_ctx,
+    const scl_sp800108kdf_ctx_t *const sp800108kdf_ctx,
+    const scl_sp800108kdf_request_t *const requests, size_t nb_requests)
+{
+    if (NULL == scl_ctx)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl_ctx->kdf_func.sp800108_derive))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl_ctx->kdf_func.sp800108_derive(scl_ctx, sp800108kdf_ctx,
+                                              requests, nb_requests));
+}
@@ -89,3 +89,42 @@ int32_t scl_hmac_finish(const metal_scl_t *const scl_ctx,
 
     return (scl_ctx->hmac_func.finish(scl_ctx, hmac_ctx, mac, mac_len));
 }
+
+int32_t scl_hmac_key_init(const metal_scl_t *const scl_ctx,
+                          scl_hmac_key_ctx_t *const key_ctx,
+                          scl_sha_ctx_t *const sha_ctx,
+                          scl_hash_mode_t hash_mode, const uint8_t *const key,
+                          size_t key_len)
+{
+    if (NULL == scl_ctx)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl_ctx->hmac_func.key_init))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (scl_ctx->hmac_func.key_init(scl_ctx, key_ctx, sha_ctx, hash_mode,
+                                        key, key_len));
+}
+
+int32_t scl_hmac_init_with_key(const metal_scl_t *const scl_ctx,
+                               scl_hmac_ctx_t *const hmac_ctx,
+                               scl_sha_ctx_t *const sha_ctx,
+                               const scl_hmac_key_ctx_t *const key_ctx)
+{
+    if (NULL == scl_ctx)
+    {
+        return (SCL_INVALID_INPUT);
+    }
+
+    if ((NULL == scl_ctx->hmac_func.init_with_key))
+    {
+        return (SCL_ERROR_API_ENTRY_POINT);
+    }
+
+    return (
+        scl_ctx->hmac_func.init_with_key(scl_ctx, hmac_ctx, sha_ctx, key_ctx));
+}
@@ -61,6 +61,9 @@ CRYPTO_CONST_DATA static const metal_scl_t scl = {
     .ecc_func =
         {
             .ecdh = soft_ecdh,
+            .ecdh_start = soft_ecdh_start,
+            .ecdh_finish = soft_ecdh_finish,
+            .ladder_step = soft_ecc_ladder_step,
         },
 };
 
@@ -515,3 +518,55 @@ TEST(scl_ecdh, secp_p521r1_curve_not_on_curve)
 
     TEST_ASSERT_TRUE(SCL_ERR_POINT == result);
 }
+
+TEST(scl_ecdh, secp_p256r1_curve_resumable)
+{
+    int32_t result = 0;
+    ecc_ladder_ctx_t ctx;
+
+    static const uint8_t pub_key_2_x[ECC_SECP256R1_BYTESIZE] = {
+        0x27, 0x7A, 0xA0, 0xB4, 0x67, 0x2D, 0x52, 0xA5, 0xD6, 0xAD, 0xF4,
+        0x6E, 0x3F, 0xAD, 0xF5, 0x6C, 0x9B, 0x64, 0xC0, 0x18, 0x75, 0xF3,
+        0x60, 0xDE, 0x21, 0x2E, 0x2D, 0xDE, 0x6D, 0x73, 0x49, 0xCA};
+
+    static const uint8_t pub_key_2_y[ECC_SECP256R1_BYTESIZE] = {
+        0xB7, 0xB1, 0x2D, 0xA7, 0x99, 0x6B, 0xF1, 0x2F, 0x31, 0xD4, 0x4C,
+        0x93, 0x78, 0x9E, 0x83, 0x97, 0xCD, 0xFA, 0xD8, 0x62, 0x0D, 0x3C,
+        0xF4, 0xBA, 0x11, 0x99, 0x6F, 0xE4, 0x9C, 0x48, 0x04, 0x0E};
+
+    static const uint8_t priv_key_1[ECC_SECP256R1_BYTESIZE] = {
+        0xEE, 0x2F, 0x1E, 0xB5, 0x06, 0x0D, 0x57, 0x5D, 0x86, 0x92, 0x8A,
+        0x56, 0x10, 0x14, 0xD8, 0x6E, 0xDB, 0xD5, 0x76, 0xFE, 0xBD, 0x68,
+        0x8A, 0x87, 0xF6, 0x40, 0xAF, 0x86, 0x98, 0x04, 0x2E, 0x17};
+
+    const ecc_affine_const_point_t pub_key_2 = {.x = pub_key_2_x,
+                                                .y = pub_key_2_y};
+
+    uint8_t shared_secret[ECC_SECP256R1_BYTESIZE] = {0};
+
+    size_t shared_secret_len = sizeof(shared_secret);
+
+    static const uint8_t expected_shared_secret[ECC_SECP256R1_BYTESIZE] = {
+        0xE7, 0xD5, 0x29, 0x41, 0x21, 0x04, 0x05, 0xD5, 0x46, 0xBD, 0x7D,
+        0xDD, 0x66, 0x1A, 0x13, 0x79, 0xDB, 0xD2, 0x0A, 0x10, 0xDC, 0xDC,
+        0xBF, 0xCA, 0xFD, 0x72, 0x8F, 0xA3, 0xE8, 0xD2, 0x54, 0x1E};
+
+    result = scl_ecdh_start(&scl, &ctx, &ecc_secp256r1, priv_key_1, &pub_key_2);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = scl_ecdh_finish(&scl, &ctx, shared_secret, &shared_secret_len);
+    TEST_ASSERT_TRUE(SCL_BUSY == result);
+
+    do
+    {
+        result = scl_ecdh_step(&scl, &ctx, 7);
+    } while (result > 0);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = scl_ecdh_finish(&scl, &ctx, shared_secret, &shared_secret_len);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(ECC_SECP256R1_BYTESIZE == shared_secret_len);
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_shared_secret, shared_secret,
+                                 ECC_SECP256R1_BYTESIZE);
+}
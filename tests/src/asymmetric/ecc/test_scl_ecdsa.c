@@ -58,10 +58,29 @@ CRYPTO_CONST_DATA static const metal_scl_t scl = {
             .mod_square = soft_bignum_mod_square,
         },
 
+    .hash_func =
+        {
+            .sha_init = soft_sha_init,
+            .sha_core = soft_sha_core,
+            .sha_finish = soft_sha_finish,
+        },
+    .hmac_func =
+        {
+            .init = soft_hmac_init,
+            .core = soft_hmac_core,
+            .finish = soft_hmac_finish,
+        },
+
     .ecdsa_func =
         {
             .signature = soft_ecdsa_signature,
             .verification = soft_ecdsa_verification,
+            .signature_with_nonce_mode = soft_ecdsa_signature_with_nonce_mode,
+            .nonce_pool_fill = soft_ecdsa_nonce_pool_fill,
+            .signature_with_pool = soft_ecdsa_signature_with_pool,
+            .verification_start = soft_ecdsa_verification_start,
+            .verification_step = soft_ecdsa_verification_step,
+            .verification_finish = soft_ecdsa_verification_finish,
         },
 };
 
@@ -1154,3 +1173,222 @@ TEST(scl_ecdsa, test_p521r1_curve_input_216B_sign)
 
     TEST_ASSERT_TRUE(SCL_ERR_HASH == result);
 }
+
+/* Signature with precomputed nonces */
+TEST(scl_ecdsa, test_p256r1_curve_input_256B_sign_with_pool)
+{
+    int32_t result = 0;
+    ecdsa_nonce_t nonces[4];
+    ecdsa_nonce_pool_t pool;
+
+    static const uint8_t hash[SHA256_BYTE_HASHSIZE] = {
+        0xC0, 0xFD, 0x8D, 0x84, 0x7A, 0x77, 0xEE, 0x19, 0xC8, 0xFC, 0x93,
+        0x4A, 0x40, 0xE7, 0x72, 0x14, 0x68, 0x7D, 0x76, 0x4F, 0x18, 0x70,
+        0x54, 0x55, 0xA4, 0x20, 0x46, 0xAB, 0x35, 0x50, 0xB7, 0x44};
+
+    uint8_t signature_r[ECC_SECP256R1_BYTESIZE] = {0};
+    uint8_t signature_s[ECC_SECP256R1_BYTESIZE] = {0};
+
+    static const uint8_t expected_signature_r[ECC_SECP256R1_BYTESIZE] = {
+        0x7E, 0x44, 0xE9, 0x6E, 0x91, 0x23, 0x4B, 0xD1, 0xAE, 0xA4, 0x03,
+        0x46, 0xAE, 0x03, 0x15, 0x88, 0xEA, 0x33, 0xE6, 0x4E, 0x73, 0x4F,
+        0xE6, 0x41, 0x65, 0x1F, 0x46, 0xD4, 0x43, 0xFD, 0xEE, 0x3C};
+
+    static const uint8_t expected_signature_s[ECC_SECP256R1_BYTESIZE] = {
+        0xA7, 0xD9, 0x2A, 0xF9, 0x61, 0xB8, 0x50, 0x7B, 0xFA, 0x44, 0x0B,
+        0xD0, 0x26, 0x0F, 0x6A, 0x88, 0x1D, 0xB7, 0x0A, 0x7D, 0xA6, 0x41,
+        0x18, 0x90, 0xC6, 0x05, 0x1E, 0xD9, 0xBF, 0x3E, 0x90, 0x32};
+
+    static const uint8_t priv_key[ECC_SECP256R1_BYTESIZE] = {
+        0xD1, 0xCD, 0x56, 0x34, 0x1B, 0x55, 0x61, 0x9B, 0x32, 0x98, 0x67,
+        0xE3, 0x44, 0xF4, 0xF5, 0xD9, 0x7E, 0xEF, 0x63, 0x67, 0x92, 0x00,
+        0x2C, 0xA0, 0x47, 0x4B, 0x08, 0x27, 0x6B, 0x84, 0x76, 0x6F};
+
+    static const uint8_t pub_key_x[ECC_SECP256R1_BYTESIZE] = {
+        0x9E, 0x65, 0x9B, 0x34, 0x1E, 0x56, 0xCA, 0xE7, 0x07, 0xED, 0x7D,
+        0x6A, 0x6B, 0x05, 0x1E, 0x71, 0x53, 0xF2, 0x30, 0x72, 0x54, 0xDD,
+        0x1D, 0x39, 0x2F, 0xA9, 0xC5, 0xF6, 0xEC, 0x9A, 0x77, 0x2E};
+
+    static const uint8_t pub_key_y[ECC_SECP256R1_BYTESIZE] = {
+        0x2B, 0x2C, 0xF4, 0x82, 0x0F, 0xAF, 0xBF, 0x4E, 0x5A, 0xD8, 0x82,
+        0xFC, 0x88, 0x86, 0x3A, 0xEA, 0x07, 0x22, 0x96, 0x6D, 0x98, 0x4A,
+        0xB3, 0x6A, 0xD5, 0xE1, 0x98, 0xF3, 0x9A, 0x9C, 0xD3, 0x06};
+
+    ecdsa_signature_t signature = {.r = signature_r, .s = signature_s};
+    const ecc_affine_const_point_t pub_key = {.x = pub_key_x, .y = pub_key_y};
+
+    result = scl_ecdsa_nonce_pool_init(&pool, &ecc_secp256r1, priv_key, nonces,
+                                       sizeof(nonces) / sizeof(nonces[0]));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    /* partial fill then complete it */
+    result = scl_ecdsa_nonce_pool_fill(&scl, &pool, 1);
+
+    TEST_ASSERT_TRUE(1 == result);
+
+    result = scl_ecdsa_nonce_pool_fill(&scl, &pool, 10);
+
+    TEST_ASSERT_TRUE(4 == result);
+
+    result = scl_ecdsa_signature_with_pool(&scl, &ecc_secp256r1, priv_key,
+                                           &pool, &signature, hash,
+                                           sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_r, signature_r,
+                                 ECC_SECP256R1_BYTESIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_s, signature_s,
+                                 ECC_SECP256R1_BYTESIZE);
+
+    result = scl_ecdsa_verification(&scl, &ecc_secp256r1, &pub_key,
+                                    (ecdsa_signature_const_t *)&signature, hash,
+                                    sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    TEST_ASSERT_TRUE(3 == pool.nb_available);
+
+    result = scl_ecdsa_nonce_pool_zeroize(&pool);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(0 == pool.nb_available);
+    TEST_ASSERT_TRUE(NULL == pool.nonces);
+    TEST_ASSERT_EACH_EQUAL_HEX8(0, (uint8_t *)nonces, sizeof(nonces));
+}
+
+/* Signature with deterministic nonces */
+TEST(scl_ecdsa, test_p384r1_sign_deterministic_rfc6979)
+{
+    int32_t result = 0;
+
+    /* RFC 6979 A.2 with message "sample" */
+    static const uint8_t hash[SHA384_BYTE_HASHSIZE] = {
+        0x9A, 0x90, 0x83, 0x50, 0x5B, 0xC9, 0x22, 0x76, 0xAE, 0xC4, 0xBE, 0x31,
+        0x26, 0x96, 0xEF, 0x7B, 0xF3, 0xBF, 0x60, 0x3F, 0x4B, 0xBD, 0x38, 0x11,
+        0x96, 0xA0, 0x29, 0xF3, 0x40, 0x58, 0x53, 0x12, 0x31, 0x3B, 0xCA, 0x4A,
+        0x9B, 0x5B, 0x89, 0x0E, 0xFE, 0xE4, 0x2C, 0x77, 0xB1, 0xEE, 0x25, 0xFE};
+
+    uint8_t signature_r[ECC_SECP384R1_BYTESIZE] = {0};
+    uint8_t signature_s[ECC_SECP384R1_BYTESIZE] = {0};
+
+    static const uint8_t expected_signature_r[ECC_SECP384R1_BYTESIZE] = {
+        0x94, 0xED, 0xBB, 0x92, 0xA5, 0xEC, 0xB8, 0xAA, 0xD4, 0x73, 0x6E, 0x56,
+        0xC6, 0x91, 0x91, 0x6B, 0x3F, 0x88, 0x14, 0x06, 0x66, 0xCE, 0x9F, 0xA7,
+        0x3D, 0x64, 0xC4, 0xEA, 0x95, 0xAD, 0x13, 0x3C, 0x81, 0xA6, 0x48, 0x15,
+        0x2E, 0x44, 0xAC, 0xF9, 0x6E, 0x36, 0xDD, 0x1E, 0x80, 0xFA, 0xBE, 0x46};
+
+    static const uint8_t expected_signature_s[ECC_SECP384R1_BYTESIZE] = {
+        0x99, 0xEF, 0x4A, 0xEB, 0x15, 0xF1, 0x78, 0xCE, 0xA1, 0xFE, 0x40, 0xDB,
+        0x26, 0x03, 0x13, 0x8F, 0x13, 0x0E, 0x74, 0x0A, 0x19, 0x62, 0x45, 0x26,
+        0x20, 0x3B, 0x63, 0x51, 0xD0, 0xA3, 0xA9, 0x4F, 0xA3, 0x29, 0xC1, 0x45,
+        0x78, 0x6E, 0x67, 0x9E, 0x7B, 0x82, 0xC7, 0x1A, 0x38, 0x62, 0x8A, 0xC8};
+
+    static const uint8_t priv_key[ECC_SECP384R1_BYTESIZE] = {
+        0x6B, 0x9D, 0x3D, 0xAD, 0x2E, 0x1B, 0x8C, 0x1C, 0x05, 0xB1, 0x98, 0x75,
+        0xB6, 0x65, 0x9F, 0x4D, 0xE2, 0x3C, 0x3B, 0x66, 0x7B, 0xF2, 0x97, 0xBA,
+        0x9A, 0xA4, 0x77, 0x40, 0x78, 0x71, 0x37, 0xD8, 0x96, 0xD5, 0x72, 0x4E,
+        0x4C, 0x70, 0xA8, 0x25, 0xF8, 0x72, 0xC9, 0xEA, 0x60, 0xD2, 0xED, 0xF5};
+
+    static const uint8_t pub_key_x[ECC_SECP384R1_BYTESIZE] = {
+        0xEC, 0x3A, 0x4E, 0x41, 0x5B, 0x4E, 0x19, 0xA4, 0x56, 0x86, 0x18, 0x02,
+        0x9F, 0x42, 0x7F, 0xA5, 0xDA, 0x9A, 0x8B, 0xC4, 0xAE, 0x92, 0xE0, 0x2E,
+        0x06, 0xAA, 0xE5, 0x28, 0x6B, 0x30, 0x0C, 0x64, 0xDE, 0xF8, 0xF0, 0xEA,
+        0x90, 0x55, 0x86, 0x60, 0x64, 0xA2, 0x54, 0x51, 0x54, 0x80, 0xBC, 0x13};
+
+    static const uint8_t pub_key_y[ECC_SECP384R1_BYTESIZE] = {
+        0x80, 0x15, 0xD9, 0xB7, 0x2D, 0x7D, 0x57, 0x24, 0x4E, 0xA8, 0xEF, 0x9A,
+        0xC0, 0xC6, 0x21, 0x89, 0x67, 0x08, 0xA5, 0x93, 0x67, 0xF9, 0xDF, 0xB9,
+        0xF5, 0x4C, 0xA8, 0x4B, 0x3F, 0x1C, 0x9D, 0xB1, 0x28, 0x8B, 0x23, 0x1C,
+        0x3A, 0xE0, 0xD4, 0xFE, 0x73, 0x44, 0xFD, 0x25, 0x33, 0x26, 0x47, 0x20};
+
+    ecdsa_signature_t signature = {.r = signature_r, .s = signature_s};
+    const ecc_affine_const_point_t pub_key = {.x = pub_key_x, .y = pub_key_y};
+
+    result = scl_ecdsa_signature_with_nonce_mode(
+        &scl, &ecc_secp384r1, priv_key, &signature, hash, sizeof(hash),
+        SCL_ECDSA_NONCE_DETERMINISTIC);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_r, signature_r,
+                                 ECC_SECP384R1_BYTESIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_s, signature_s,
+                                 ECC_SECP384R1_BYTESIZE);
+
+    result = scl_ecdsa_verification(&scl, &ecc_secp384r1, &pub_key,
+                                    (ecdsa_signature_const_t *)&signature, hash,
+                                    sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+}
+
+TEST(scl_ecdsa, test_p256r1_curve_input_256B_verif_resumable)
+{
+    int32_t result = 0;
+    ecdsa_verification_ctx_t ctx;
+
+    static const uint8_t hash[SHA256_BYTE_HASHSIZE] = {
+        0xC0, 0xFD, 0x8D, 0x84, 0x7A, 0x77, 0xEE, 0x19, 0xC8, 0xFC, 0x93,
+        0x4A, 0x40, 0xE7, 0x72, 0x14, 0x68, 0x7D, 0x76, 0x4F, 0x18, 0x70,
+        0x54, 0x55, 0xA4, 0x20, 0x46, 0xAB, 0x35, 0x50, 0xB7, 0x44};
+
+    static const uint8_t signature_r[ECC_SECP256R1_BYTESIZE] = {
+        0xC5, 0xE0, 0x62, 0x88, 0x75, 0xAE, 0xE7, 0xD3, 0x4A, 0xF0, 0x64,
+        0x51, 0x08, 0x3C, 0xF3, 0xAA, 0x10, 0x45, 0x1B, 0x96, 0x53, 0x6C,
+        0x3D, 0xAD, 0xB6, 0x67, 0xCF, 0x70, 0x23, 0x6D, 0x04, 0xB8};
+    static const uint8_t signature_s[ECC_SECP256R1_BYTESIZE] = {
+        0x6F, 0x49, 0x62, 0x17, 0x97, 0x6B, 0xA4, 0x8E, 0xAD, 0xE5, 0x38,
+        0x03, 0xD7, 0xF4, 0xBC, 0xBD, 0x9B, 0xFE, 0xFE, 0xF9, 0x0A, 0x28,
+        0xD3, 0x0E, 0x3E, 0xBC, 0xAD, 0xFF, 0x79, 0x49, 0x6E, 0xC3};
+
+    static const uint8_t pub_key_x[ECC_SECP256R1_BYTESIZE] = {
+        0x9E, 0x65, 0x9B, 0x34, 0x1E, 0x56, 0xCA, 0xE7, 0x07, 0xED, 0x7D,
+        0x6A, 0x6B, 0x05, 0x1E, 0x71, 0x53, 0xF2, 0x30, 0x72, 0x54, 0xDD,
+        0x1D, 0x39, 0x2F, 0xA9, 0xC5, 0xF6, 0xEC, 0x9A, 0x77, 0x2E};
+
+    static const uint8_t pub_key_y[ECC_SECP256R1_BYTESIZE] = {
+        0x2B, 0x2C, 0xF4, 0x82, 0x0F, 0xAF, 0xBF, 0x4E, 0x5A, 0xD8, 0x82,
+        0xFC, 0x88, 0x86, 0x3A, 0xEA, 0x07, 0x22, 0x96, 0x6D, 0x98, 0x4A,
+        0xB3, 0x6A, 0xD5, 0xE1, 0x98, 0xF3, 0x9A, 0x9C, 0xD3, 0x06};
+
+    uint8_t bad_signature_s[ECC_SECP256R1_BYTESIZE];
+
+    const ecdsa_signature_const_t signature = {.r = signature_r,
+                                               .s = signature_s};
+    const ecdsa_signature_const_t bad_signature = {.r = signature_r,
+                                                   .s = bad_signature_s};
+    const ecc_affine_const_point_t pub_key = {.x = pub_key_x, .y = pub_key_y};
+
+    result = scl_ecdsa_verification_start(&scl, &ctx, &ecc_secp256r1, &pub_key,
+                                          &signature, hash, sizeof(hash));
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    /* 256 bits, SCL_ECDSA_WINDOW_WIDTH bits per iteration */
+    result = scl_ecdsa_verification_step(&scl, &ctx, 7);
+    TEST_ASSERT_EQUAL_INT32(128 - 7, result);
+
+    result = scl_ecdsa_verification_finish(&scl, &ctx);
+    TEST_ASSERT_TRUE(SCL_BUSY == result);
+
+    do
+    {
+        result = scl_ecdsa_verification_step(&scl, &ctx, 7);
+    } while (result > 0);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = scl_ecdsa_verification_finish(&scl, &ctx);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    memcpy(bad_signature_s, signature_s, sizeof(bad_signature_s));
+    bad_signature_s[ECC_SECP256R1_BYTESIZE - 1] ^= 0x01;
+
+    result = scl_ecdsa_verification_start(&scl, &ctx, &ecc_secp256r1, &pub_key,
+                                          &bad_signature, hash, sizeof(hash));
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = scl_ecdsa_verification_step(&scl, &ctx, SIZE_MAX);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = scl_ecdsa_verification_finish(&scl, &ctx);
+    TEST_ASSERT_TRUE(SCL_ERR_SIGNATURE == result);
+}
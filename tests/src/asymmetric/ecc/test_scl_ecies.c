@@ -0,0 +1,261 @@
+/**
+ * @file test_scl_ecies.c
+ * @brief test suite for scl_ecies.c
+ * @details ECIES on SECP256r1 with x9.63 KDF (SHA-256) and AES-128-GCM
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include <backend/software/scl_soft.h>
+
+#include <scl/scl_ecies.h>
+
+#include <backend/hardware/scl_hca.h>
+
+#include <metal/machine/platform.h>
+
+#if METAL_SIFIVE_HCA_VERSION >= HCA_VERSION(0, 5, 0)
+
+static int32_t get_data_for_test(const metal_scl_t *const scl,
+                                 uint32_t *data_out);
+
+static const metal_scl_t scl = {
+    .hca_base = METAL_SIFIVE_HCA_0_BASE_ADDRESS,
+    .aes_func = {.setkey = hca_aes_setkey,
+                 .setiv = hca_aes_setiv,
+                 .cipher = hca_aes_cipher,
+                 .auth_init = hca_aes_auth_init,
+                 .auth_core = hca_aes_auth_core,
+                 .auth_finish = hca_aes_auth_finish},
+    .hash_func =
+        {
+            .sha_init = soft_sha_init,
+            .sha_core = soft_sha_core,
+            .sha_finish = soft_sha_finish,
+        },
+    .trng_func =
+        {
+            .get_data = get_data_for_test,
+        },
+    .bignum_func =
+        {
+            .compare = soft_bignum_compare,
+            .compare_len_diff = soft_bignum_compare_len_diff,
+            .is_null = soft_bignum_is_null,
+            .negate = soft_bignum_negate,
+            .inc = soft_bignum_inc,
+            .add = soft_bignum_add,
+            .sub = soft_bignum_sub,
+            .mult = soft_bignum_mult,
+            .square = soft_bignum_square_with_mult,
+            .leftshift = soft_bignum_leftshift,
+            .rightshift = soft_bignum_rightshift,
+            .msb_set_in_word = soft_bignum_msb_set_in_word,
+            .get_msb_set = soft_bignum_get_msb_set,
+            .set_bit = soft_bignum_set_bit,
+            .div = soft_bignum_div,
+            .mod = soft_ecc_mod,
+            .set_modulus = soft_bignum_set_modulus,
+            .mod_add = soft_bignum_mod_add,
+            .mod_sub = soft_bignum_mod_sub,
+            .mod_add_lazy = soft_bignum_mod_add_lazy,
+            .mod_sub_lazy = soft_bignum_mod_sub_lazy,
+            .mod_mult = soft_bignum_mod_mult,
+            .mod_inv = soft_bignum_mod_inv,
+            .mod_square = soft_bignum_mod_square,
+        },
+    .ecc_func =
+        {
+            .keypair_generation = soft_ecc_keypair_generation,
+            .ecdh = soft_ecdh,
+        },
+    .kdf_func =
+        {
+            .x963_init = soft_kdf_x963_init,
+            .x963_derive = soft_kdf_x963_derive,
+        },
+};
+
+int32_t get_data_for_test(const metal_scl_t *const scl_ctx, uint32_t *data_out)
+{
+    (void)scl_ctx;
+    *data_out = 0xA5A5A5A5;
+    return (SCL_OK);
+}
+
+/* recipient key pair */
+static const uint8_t recipient_priv_key[ECC_SECP256R1_BYTESIZE] = {
+    0x66, 0x5D, 0x06, 0x98, 0xDB, 0xC8, 0xFB, 0x95, 0xAF, 0xC2, 0x5C,
+    0x3A, 0x4D, 0x9C, 0xF2, 0x80, 0xD8, 0x7A, 0x58, 0x5B, 0x79, 0x99,
+    0x24, 0x3C, 0xA6, 0x00, 0x8F, 0xD0, 0x32, 0x58, 0x97, 0x5F};
+static const uint8_t recipient_pub_x[ECC_SECP256R1_BYTESIZE] = {
+    0x9F, 0xEE, 0xED, 0xA9, 0x03, 0xD8, 0x3D, 0x01, 0xF8, 0x85, 0x9D,
+    0x5C, 0x11, 0x71, 0xD7, 0x2F, 0xF9, 0xCE, 0x5F, 0xF2, 0x21, 0xB4,
+    0x80, 0xA4, 0x60, 0x68, 0xD9, 0x7E, 0x3D, 0x40, 0xDE, 0x9E};
+static const uint8_t recipient_pub_y[ECC_SECP256R1_BYTESIZE] = {
+    0xCD, 0x84, 0x5D, 0x81, 0x29, 0x79, 0x1C, 0x24, 0x85, 0x32, 0x99,
+    0x1B, 0x46, 0x2A, 0xE9, 0xE3, 0xBE, 0xA3, 0x54, 0xF2, 0xA7, 0xAC,
+    0xBC, 0x6E, 0x0D, 0x6E, 0x15, 0x78, 0x3B, 0x9B, 0x02, 0xFB};
+
+/* sender ephemeral public key */
+static const uint8_t ephemeral_pub_x[ECC_SECP256R1_BYTESIZE] = {
+    0x9A, 0x78, 0x1C, 0xA6, 0xD0, 0x55, 0xA7, 0xF3, 0x0D, 0x0C, 0x9F,
+    0xF8, 0x79, 0x36, 0xC7, 0x39, 0xF6, 0x81, 0x6E, 0xF5, 0xF5, 0xE7,
+    0x2B, 0x4B, 0x94, 0x64, 0x04, 0xB0, 0xA1, 0xA8, 0x3B, 0x2A};
+static const uint8_t ephemeral_pub_y[ECC_SECP256R1_BYTESIZE] = {
+    0xC1, 0x9F, 0x84, 0x29, 0x45, 0xEA, 0x2B, 0xF6, 0x5A, 0xA1, 0x64,
+    0x9B, 0x2B, 0x02, 0xFF, 0x79, 0x85, 0x4C, 0x8D, 0x5E, 0xCF, 0xCD,
+    0x40, 0x38, 0x62, 0xE8, 0xA9, 0x7E, 0xA6, 0x6C, 0x71, 0xC1};
+
+/* "scl ecies" */
+static const uint8_t shared_info[] = {0x73, 0x63, 0x6C, 0x20, 0x65,
+                                      0x63, 0x69, 0x65, 0x73};
+
+/* "firmware v1" */
+static const uint8_t aad[] = {0x66, 0x69, 0x72, 0x6D, 0x77, 0x61,
+                              0x72, 0x65, 0x20, 0x76, 0x31};
+
+static const uint8_t plaintext[40] __attribute__((aligned(8))) = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13,
+    0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+    0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27};
+
+static const uint8_t ciphertext[40] __attribute__((aligned(8))) = {
+    0x54, 0x7E, 0x9C, 0x4B, 0x49, 0xE0, 0x34, 0xDD, 0x40, 0xA1,
+    0x79, 0x40, 0x33, 0xF0, 0xFA, 0x2D, 0x13, 0x7E, 0x34, 0xE1,
+    0xC0, 0x28, 0xC7, 0x95, 0x82, 0x61, 0x82, 0x91, 0x50, 0x0E,
+    0xFC, 0x8A, 0x39, 0x67, 0x63, 0x18, 0x99, 0xEC, 0x6D, 0xC7};
+
+static const uint8_t tag[16] __attribute__((aligned(8))) = {
+    0x3C, 0x3B, 0xE4, 0x93, 0x1F, 0xDF, 0x70, 0x52,
+    0x99, 0x32, 0x63, 0xC6, 0xFF, 0x20, 0x14, 0xC8};
+
+TEST_GROUP(scl_ecies);
+
+TEST_SETUP(scl_ecies) {}
+
+TEST_TEAR_DOWN(scl_ecies) {}
+
+TEST(scl_ecies, decrypt_secp256r1_success)
+{
+    int32_t result;
+    uint8_t tmp[sizeof(plaintext)] __attribute__((aligned(8))) = {0};
+
+    ecc_affine_const_point_t ephemeral_pub_key = {.x = ephemeral_pub_x,
+                                                  .y = ephemeral_pub_y};
+
+    result = scl_ecies_decrypt(&scl, &ecc_secp256r1, recipient_priv_key,
+                               &ephemeral_pub_key, SCL_HASH_SHA256,
+                               shared_info, sizeof(shared_info), SCL_KEY128,
+                               aad, sizeof(aad), tmp, ciphertext,
+                               sizeof(ciphertext), tag, sizeof(tag));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(plaintext, tmp, sizeof(plaintext));
+}
+
+TEST(scl_ecies, decrypt_secp256r1_bad_tag)
+{
+    int32_t result;
+    uint8_t tmp[sizeof(plaintext)] __attribute__((aligned(8))) = {0};
+    uint8_t bad_tag[sizeof(tag)] __attribute__((aligned(8)));
+    static const uint8_t zero[sizeof(plaintext)] = {0};
+
+    ecc_affine_const_point_t ephemeral_pub_key = {.x = ephemeral_pub_x,
+                                                  .y = ephemeral_pub_y};
+
+    memcpy(bad_tag, tag, sizeof(tag));
+    bad_tag[sizeof(bad_tag) - 1] ^= 0x01;
+
+    result = scl_ecies_decrypt(&scl, &ecc_secp256r1, recipient_priv_key,
+                               &ephemeral_pub_key, SCL_HASH_SHA256,
+                               shared_info, sizeof(shared_info), SCL_KEY128,
+                               aad, sizeof(aad), tmp, ciphertext,
+                               sizeof(ciphertext), bad_tag, sizeof(bad_tag));
+
+    TEST_ASSERT_TRUE(SCL_ERR_TAG == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(zero, tmp, sizeof(tmp));
+}
+
+TEST(scl_ecies, decrypt_secp256r1_streaming)
+{
+    int32_t result;
+    size_t len = 0;
+    scl_ecies_ctx_t ctx;
+    uint8_t tmp[sizeof(plaintext)] __attribute__((aligned(8))) = {0};
+
+    ecc_affine_const_point_t ephemeral_pub_key = {.x = ephemeral_pub_x,
+                                                  .y = ephemeral_pub_y};
+
+    result = scl_ecies_decrypt_init(&scl, &ctx, &ecc_secp256r1,
+                                    recipient_priv_key, &ephemeral_pub_key,
+                                    SCL_HASH_SHA256, shared_info,
+                                    sizeof(shared_info), SCL_KEY128, aad,
+                                    sizeof(aad), sizeof(ciphertext));
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = scl_ecies_core(&scl, &ctx, tmp, &len, ciphertext, 16);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = scl_ecies_decrypt_finish(&scl, &ctx, tag, sizeof(tag), &tmp[len],
+                                      &ciphertext[16], sizeof(ciphertext) - 16);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(plaintext, tmp, sizeof(plaintext));
+}
+
+TEST(scl_ecies, encrypt_decrypt_secp256r1)
+{
+    int32_t result;
+    uint8_t eph_x[ECC_SECP256R1_BYTESIZE] = {0};
+    uint8_t eph_y[ECC_SECP256R1_BYTESIZE] = {0};
+    uint8_t ct[sizeof(plaintext)] __attribute__((aligned(8))) = {0};
+    uint8_t pt[sizeof(plaintext)] __attribute__((aligned(8))) = {0};
+    uint8_t tag_c[sizeof(tag)] __attribute__((aligned(8))) = {0};
+
+    ecc_affine_const_point_t recipient_pub_key = {.x = recipient_pub_x,
+                                                  .y = recipient_pub_y};
+    ecc_affine_point_t eph_pub_key = {.x = eph_x, .y = eph_y};
+    ecc_affine_const_point_t eph_pub_key_const = {.x = eph_x, .y = eph_y};
+
+    result = scl_ecies_encrypt(&scl, &ecc_secp256r1, &recipient_pub_key,
+                               &eph_pub_key, SCL_HASH_SHA256, shared_info,
+                               sizeof(shared_info), SCL_KEY128, aad,
+                               sizeof(aad), ct, plaintext, sizeof(plaintext),
+                               tag_c, sizeof(tag_c));
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = scl_ecies_decrypt(&scl, &ecc_secp256r1, recipient_priv_key,
+                               &eph_pub_key_const, SCL_HASH_SHA256,
+                               shared_info, sizeof(shared_info), SCL_KEY128,
+                               aad, sizeof(aad), pt, ct, sizeof(ct), tag_c,
+                               sizeof(tag_c));
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(plaintext, pt, sizeof(plaintext));
+}
+
+TEST(scl_ecies, init_invalid_key_length)
+{
+    int32_t result;
+    scl_ecies_ctx_t ctx;
+
+    ecc_affine_const_point_t ephemeral_pub_key = {.x = ephemeral_pub_x,
+                                                  .y = ephemeral_pub_y};
+
+    result = scl_ecies_decrypt_init(&scl, &ctx, &ecc_secp256r1,
+                                    recipient_priv_key, &ephemeral_pub_key,
+                                    SCL_HASH_SHA256, shared_info,
+                                    sizeof(shared_info), 20, aad, sizeof(aad),
+                                    sizeof(ciphertext));
+    TEST_ASSERT_TRUE(SCL_INVALID_LENGTH == result);
+}
+
+#endif
@@ -689,4 +689,68 @@ TEST(hca_sha_256, msg_1_block_in_3_pieces_digest_aligned)
                      memcmp(expected_digest, digest, sizeof(expected_digest)));
 }
 
+TEST(hca_sha_256, msg_export_import_soft_resume)
+{
+    int32_t result = 0;
+    sha_ctx_t sha_ctx;
+    sha_ctx_t resumed_ctx;
+    sha_state_t state;
+
+    static const uint8_t message[] __attribute__((aligned(8))) =
+        "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+
+    uint8_t digest[SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    uint8_t resumed_digest[SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    size_t digest_len = sizeof(digest);
+
+    static const uint8_t expected_digest[SHA256_BYTE_HASHSIZE] = {
+        0x24, 0x8D, 0x6A, 0x61, 0xD2, 0x06, 0x38, 0xB8, 0xE5, 0xC0, 0x26,
+        0x93, 0x0C, 0x3E, 0x60, 0x39, 0xA3, 0x3C, 0xE4, 0x59, 0x64, 0xFF,
+        0x21, 0x67, 0xF6, 0xEC, 0xED, 0xD4, 0x19, 0xDB, 0x06, 0xC1};
+
+    static const uint8_t expected_iv[SHA256_BYTE_HASHSIZE] = {
+        0x6A, 0x09, 0xE6, 0x67, 0xBB, 0x67, 0xAE, 0x85, 0x3C, 0x6E, 0xF3,
+        0x72, 0xA5, 0x4F, 0xF5, 0x3A, 0x51, 0x0E, 0x52, 0x7F, 0x9B, 0x05,
+        0x68, 0x8C, 0x1F, 0x83, 0xD9, 0xAB, 0x5B, 0xE0, 0xCD, 0x19};
+
+    result = hca_sha_init(&scl, &sha_ctx, SCL_HASH_SHA256, SCL_BIG_ENDIAN_MODE);
+    TEST_ASSERT_TRUE(0 == result);
+
+    result = hca_sha_core(&scl, &sha_ctx, message, 20);
+    TEST_ASSERT_TRUE(0 == result);
+
+    result = hca_sha_export_state(&scl, &sha_ctx, &state);
+    TEST_ASSERT_TRUE(0 == result);
+
+    // less than one block was hashed, the HASH registers are not read
+    TEST_ASSERT_TRUE(20 * 8 == state.bitlen);
+    TEST_ASSERT_TRUE(0 ==
+                     memcmp(expected_iv, state.digest, sizeof(expected_iv)));
+
+    // HCA can not load the state back, the hash goes on in software
+    result = hca_sha_import_state(&scl, &resumed_ctx, &state);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_TRUE(true == resumed_ctx.soft_resume);
+
+    result = hca_sha_core(&scl, &resumed_ctx, &message[20],
+                          sizeof(message) - 1 - 20);
+    TEST_ASSERT_TRUE(0 == result);
+
+    result = hca_sha_finish(&scl, &resumed_ctx, resumed_digest, &digest_len);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_TRUE(SHA256_BYTE_HASHSIZE == digest_len);
+    TEST_ASSERT_TRUE(0 == memcmp(expected_digest, resumed_digest,
+                                 sizeof(expected_digest)));
+
+    result = hca_sha_core(&scl, &sha_ctx, &message[20],
+                          sizeof(message) - 1 - 20);
+    TEST_ASSERT_TRUE(0 == result);
+
+    result = hca_sha_finish(&scl, &sha_ctx, digest, &digest_len);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_TRUE(false == sha_ctx.soft_resume);
+    TEST_ASSERT_TRUE(0 ==
+                     memcmp(expected_digest, digest, sizeof(expected_digest)));
+}
+
 #endif
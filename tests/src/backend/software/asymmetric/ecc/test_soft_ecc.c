@@ -43,6 +43,8 @@ CRYPTO_CONST_DATA static const metal_scl_t scl = {
             .set_modulus = soft_bignum_set_modulus,
             .mod_add = soft_bignum_mod_add,
             .mod_sub = soft_bignum_mod_sub,
+            .mod_add_lazy = soft_bignum_mod_add_lazy,
+            .mod_sub_lazy = soft_bignum_mod_sub_lazy,
             .mod_mult = soft_bignum_mod_mult,
             .mod_inv = soft_bignum_mod_inv,
             .mod_square = soft_bignum_mod_square,
@@ -221,6 +223,91 @@ TEST(soft_ecc, test_p384r1_add_affine_point_via_jacobian)
                                  ECC_SECP384R1_BYTESIZE);
 }
 
+/* test packed point layouts */
+
+TEST(soft_ecc, test_soft_ecc_jacobian_pack_unpack)
+{
+    uint32_t packed[SOFT_ECC_JACOBIAN_PACKED_WSIZE(
+        ECC_SECP256R1_32B_WORDS_SIZE)] __attribute__((aligned(8))) = {0};
+    uint32_t packed_copy[SOFT_ECC_JACOBIAN_PACKED_WSIZE(
+        ECC_SECP256R1_32B_WORDS_SIZE)] __attribute__((aligned(8))) = {0};
+
+    uint64_t point_x[ECC_SECP256R1_64B_WORDS_SIZE] = {
+        0xF4A13945D898C296, 0x77037D812DEB33A0, 0xF8BCE6E563A440F2,
+        0x6B17D1F2E12C4247};
+    uint64_t point_y[ECC_SECP256R1_64B_WORDS_SIZE] = {
+        0xCBB6406837BF51F5, 0x2BCE33576B315ECE, 0x8EE7EB4A7C0F9E16,
+        0x4FE342E2FE1A7F9B};
+    uint64_t point_z[ECC_SECP256R1_64B_WORDS_SIZE] = {1, 0, 0, 0};
+
+    uint64_t out_x[ECC_SECP256R1_64B_WORDS_SIZE] = {0};
+    uint64_t out_y[ECC_SECP256R1_64B_WORDS_SIZE] = {0};
+    uint64_t out_z[ECC_SECP256R1_64B_WORDS_SIZE] = {0};
+
+    static const uint32_t zero[SOFT_ECC_JACOBIAN_PACKED_WSIZE(
+        ECC_SECP256R1_32B_WORDS_SIZE)] = {0};
+
+    ecc_bignum_jacobian_point_t point = {
+        .x = point_x, .y = point_y, .z = point_z};
+    ecc_bignum_jacobian_point_t out = {.x = out_x, .y = out_y, .z = out_z};
+    ecc_bignum_jacobian_point_t packed_point;
+    ecc_bignum_jacobian_point_t packed_point_copy;
+
+    soft_ecc_jacobian_pack(&point, packed, ECC_SECP256R1_32B_WORDS_SIZE);
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_x, &packed[0], ECC_SECP256R1_BYTESIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(
+        point_y, &packed[ECC_SECP256R1_32B_WORDS_SIZE], ECC_SECP256R1_BYTESIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_z,
+                                 &packed[2 * ECC_SECP256R1_32B_WORDS_SIZE],
+                                 ECC_SECP256R1_BYTESIZE);
+
+    /* packed to packed copy */
+    soft_ecc_jacobian_map_packed(packed, &packed_point,
+                                 ECC_SECP256R1_32B_WORDS_SIZE);
+    soft_ecc_jacobian_map_packed(packed_copy, &packed_point_copy,
+                                 ECC_SECP256R1_32B_WORDS_SIZE);
+    soft_ecc_jacobian_copy(&packed_point, &packed_point_copy,
+                           ECC_SECP256R1_32B_WORDS_SIZE);
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(packed, packed_copy, sizeof(packed));
+
+    soft_ecc_jacobian_unpack(packed_copy, &out, ECC_SECP256R1_32B_WORDS_SIZE);
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_x, out_x, ECC_SECP256R1_BYTESIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_y, out_y, ECC_SECP256R1_BYTESIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_z, out_z, ECC_SECP256R1_BYTESIZE);
+
+    soft_ecc_jacobian_zeroize(&packed_point_copy, ECC_SECP256R1_32B_WORDS_SIZE);
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(zero, packed_copy, sizeof(packed_copy));
+}
+
+TEST(soft_ecc, test_soft_ecc_packed_table_select)
+{
+    size_t e, i;
+    uint32_t table[4 * 6] __attribute__((aligned(8)));
+    uint32_t out[6] __attribute__((aligned(8)));
+
+    for (e = 0; e < 4; e++)
+    {
+        for (i = 0; i < 6; i++)
+        {
+            table[e * 6 + i] = (uint32_t)(0x01010101 * (e + 1) + i);
+        }
+    }
+
+    for (e = 0; e < 4; e++)
+    {
+        soft_ecc_packed_table_select(table, 4, 6, e, out);
+        TEST_ASSERT_EQUAL_HEX32_ARRAY(&table[e * 6], out, 6);
+    }
+
+    /* out of range index gives a null entry */
+    soft_ecc_packed_table_select(table, 4, 6, 4, out);
+    TEST_ASSERT_EACH_EQUAL_HEX32(0, out, 6);
+}
+
 /* test co-Z multiplication */
 
 TEST(soft_ecc, test_soft_ecc_mult_coz)
@@ -261,6 +348,549 @@ TEST(soft_ecc, test_soft_ecc_mult_coz)
                                  ECC_SECP384R1_BYTESIZE);
 }
 
+/* test signed window multiplication, odd scalar */
+
+TEST(soft_ecc, test_soft_ecc_mult_window_odd)
+{
+    int32_t result = 0;
+
+    uint32_t point_x[ECC_SECP384R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {0};
+
+    uint32_t point_y[ECC_SECP384R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {0};
+
+    uint32_t k[ECC_SECP384R1_32B_WORDS_SIZE] __attribute__((aligned(8))) = {
+        0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5,
+        0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5};
+
+    static const uint32_t point_expected_x[ECC_SECP384R1_32B_WORDS_SIZE] = {
+        0x562f8219, 0x29fb9018, 0x745ca957, 0x86af60f2, 0x67f353a6, 0x571dbe72,
+        0x37c344f9, 0xe2e564ed, 0xe3523c1d, 0x8d2a9784, 0x574972a3, 0xa040f478};
+
+    static const uint32_t point_expected_y[ECC_SECP384R1_32B_WORDS_SIZE] = {
+        0x5f380db7, 0x8e212a7e, 0xcbe2c166, 0xe317aaca, 0xd441d484, 0x89579859,
+        0x9611011e, 0x980ab7d8, 0x484e285b, 0x4b16badd, 0x1117d9f1, 0x3d724d19};
+
+    ecc_bignum_affine_point_t output_aff_pnt = {.x = (uint64_t *)point_x,
+                                                .y = (uint64_t *)point_y};
+
+    result = soft_ecc_mult_window(&scl, &ecc_secp384r1, ecc_secp384r1.g,
+                                  (uint64_t *)k, ECC_SECP384R1_32B_WORDS_SIZE,
+                                  &output_aff_pnt);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_expected_x, point_x,
+                                 ECC_SECP384R1_BYTESIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_expected_y, point_y,
+                                 ECC_SECP384R1_BYTESIZE);
+}
+
+/* test signed window multiplication, even scalar (k + n is used) */
+
+TEST(soft_ecc, test_soft_ecc_mult_window_even)
+{
+    int32_t result = 0;
+
+    uint32_t point_x[ECC_SECP384R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {0};
+
+    uint32_t point_y[ECC_SECP384R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {0};
+
+    uint32_t k[ECC_SECP384R1_32B_WORDS_SIZE] __attribute__((aligned(8))) = {
+        0xa5a5a5a4, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5,
+        0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5};
+
+    static const uint32_t point_expected_x[ECC_SECP384R1_32B_WORDS_SIZE] = {
+        0x5102cdf0, 0x25b7a344, 0xca73d91c, 0x946c138e, 0x12a56fc1, 0x4aebabd6,
+        0x3f76bcb5, 0x4f3e33b6, 0xf52b49e2, 0x5d36fccd, 0x1c09c2a9, 0xc795c193};
+
+    static const uint32_t point_expected_y[ECC_SECP384R1_32B_WORDS_SIZE] = {
+        0x1ee0850c, 0x50674ca6, 0x7cacd246, 0x657b523b, 0x486ceb22, 0x097b7240,
+        0x733955ad, 0x6f56f64c, 0x8339ba4b, 0xf30db4d7, 0xc0224dfa, 0x05323d1d};
+
+    ecc_bignum_affine_point_t output_aff_pnt = {.x = (uint64_t *)point_x,
+                                                .y = (uint64_t *)point_y};
+
+    result = soft_ecc_mult_window(&scl, &ecc_secp384r1, ecc_secp384r1.g,
+                                  (uint64_t *)k, ECC_SECP384R1_32B_WORDS_SIZE,
+                                  &output_aff_pnt);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_expected_x, point_x,
+                                 ECC_SECP384R1_BYTESIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_expected_y, point_y,
+                                 ECC_SECP384R1_BYTESIZE);
+}
+
+/* test signed window multiplication, scalar not lower than n */
+
+TEST(soft_ecc, test_soft_ecc_mult_window_k_equal_n)
+{
+    int32_t result = 0;
+
+    uint32_t point_x[ECC_SECP384R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {0};
+
+    uint32_t point_y[ECC_SECP384R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {0};
+
+    ecc_bignum_affine_point_t output_aff_pnt = {.x = (uint64_t *)point_x,
+                                                .y = (uint64_t *)point_y};
+
+    result = soft_ecc_mult_window(&scl, &ecc_secp384r1, ecc_secp384r1.g,
+                                  ecc_secp384r1.n, ECC_SECP384R1_32B_WORDS_SIZE,
+                                  &output_aff_pnt);
+
+    TEST_ASSERT_TRUE(SCL_INVALID_INPUT == result);
+}
+
+/* test x-only co-Z multiplication, same scalars as the window tests */
+
+TEST(soft_ecc, test_soft_ecc_mult_coz_x)
+{
+    int32_t result = 0;
+
+    uint32_t point_x[ECC_SECP384R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {0};
+
+    uint32_t k_odd[ECC_SECP384R1_32B_WORDS_SIZE] __attribute__((aligned(8))) = {
+        0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5,
+        0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5};
+
+    uint32_t k_even[ECC_SECP384R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {
+        0xa5a5a5a4, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5,
+        0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5, 0xa5a5a5a5};
+
+    static const uint32_t point_expected_x_odd[ECC_SECP384R1_32B_WORDS_SIZE] = {
+        0x562f8219, 0x29fb9018, 0x745ca957, 0x86af60f2, 0x67f353a6, 0x571dbe72,
+        0x37c344f9, 0xe2e564ed, 0xe3523c1d, 0x8d2a9784, 0x574972a3, 0xa040f478};
+
+    static const uint32_t point_expected_x_even[ECC_SECP384R1_32B_WORDS_SIZE] =
+        {0x5102cdf0, 0x25b7a344, 0xca73d91c, 0x946c138e,
+         0x12a56fc1, 0x4aebabd6, 0x3f76bcb5, 0x4f3e33b6,
+         0xf52b49e2, 0x5d36fccd, 0x1c09c2a9, 0xc795c193};
+
+    result = soft_ecc_mult_coz_x(&scl, &ecc_secp384r1, ecc_secp384r1.g,
+                                 (uint64_t *)k_odd,
+                                 ECC_SECP384R1_32B_WORDS_SIZE,
+                                 (uint64_t *)point_x);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_expected_x_odd, point_x,
+                                 ECC_SECP384R1_BYTESIZE);
+
+    result = soft_ecc_mult_coz_x(&scl, &ecc_secp384r1, ecc_secp384r1.g,
+                                 (uint64_t *)k_even,
+                                 ECC_SECP384R1_32B_WORDS_SIZE,
+                                 (uint64_t *)point_x);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_expected_x_even, point_x,
+                                 ECC_SECP384R1_BYTESIZE);
+
+    /* k shall be in [1, n - 1] */
+    result = soft_ecc_mult_coz_x(&scl, &ecc_secp384r1, ecc_secp384r1.g,
+                                 ecc_secp384r1.n, ECC_SECP384R1_32B_WORDS_SIZE,
+                                 (uint64_t *)point_x);
+
+    TEST_ASSERT_TRUE(SCL_INVALID_INPUT == result);
+}
+
+/**
+ * test signed window multiplication with edge scalars: the additions of the
+ * last window must handle acc = +/-digit.P. The x-only ladder shall give the
+ * same x-coordinate.
+ */
+
+static void test_soft_ecc_mult_window_check(const ecc_curve_t *const curve,
+                                            const uint32_t *const k,
+                                            const uint32_t *const expected_x,
+                                            const uint32_t *const expected_y)
+{
+    int32_t result = 0;
+
+    uint32_t point_x[ECC_SECP521R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {0};
+
+    uint32_t ladder_x[ECC_SECP521R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {0};
+
+    uint32_t point_y[ECC_SECP521R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {0};
+
+    ecc_bignum_affine_point_t output_aff_pnt = {.x = (uint64_t *)point_x,
+                                                .y = (uint64_t *)point_y};
+
+    result = soft_ecc_mult_window(&scl, curve, curve->g, (const uint64_t *)k,
+                                  curve->curve_wsize, &output_aff_pnt);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(expected_x, point_x, curve->curve_wsize);
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(expected_y, point_y, curve->curve_wsize);
+
+    result = soft_ecc_mult_coz_x(&scl, curve, curve->g, (const uint64_t *)k,
+                                 curve->curve_wsize, (uint64_t *)ladder_x);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(expected_x, ladder_x, curve->curve_wsize);
+}
+
+TEST(soft_ecc, test_soft_ecc_mult_window_edge_p256r1)
+{
+    static const uint32_t k_1[ECC_SECP256R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {1};
+    static const uint32_t k_2[ECC_SECP256R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {2};
+    static const uint32_t k_14[ECC_SECP256R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {14};
+    static const uint32_t k_n_minus_6[ECC_SECP256R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {
+        0xfc63254b, 0xf3b9cac2, 0xa7179e84, 0xbce6faad, 0xffffffff, 0xffffffff,
+        0x00000000, 0xffffffff};
+    static const uint32_t k_n_minus_2[ECC_SECP256R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {
+        0xfc63254f, 0xf3b9cac2, 0xa7179e84, 0xbce6faad, 0xffffffff, 0xffffffff,
+        0x00000000, 0xffffffff};
+    static const uint32_t k_n_minus_1[ECC_SECP256R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {
+        0xfc632550, 0xf3b9cac2, 0xa7179e84, 0xbce6faad, 0xffffffff, 0xffffffff,
+        0x00000000, 0xffffffff};
+
+    static const uint32_t x_2[ECC_SECP256R1_32B_WORDS_SIZE] = {
+        0x47669978, 0xa60b48fc, 0x77f21b35, 0xc08969e2, 0x04b51ac3, 0x8a523803,
+        0x8d034f7e, 0x7cf27b18};
+    static const uint32_t y_2[ECC_SECP256R1_32B_WORDS_SIZE] = {
+        0x227873d1, 0x9e04b79d, 0x3ce98229, 0xba7dade6, 0x9f7430db, 0x293d9ac6,
+        0xdb8ed040, 0x07775510};
+    static const uint32_t x_14[ECC_SECP256R1_32B_WORDS_SIZE] = {
+        0x24d2920b, 0x57092773, 0x7a069c5e, 0xf126acbe, 0x4336df3c, 0x7a76647f,
+        0x1c3862b9, 0x54e77a00};
+    static const uint32_t y_14[ECC_SECP256R1_32B_WORDS_SIZE] = {
+        0x60d0b375, 0x1ba7c82f, 0x73509008, 0x7171ea77, 0x05a2e7c3, 0x42121f8c,
+        0x29f43175, 0xf599f1bb};
+    static const uint32_t x_n_minus_6[ECC_SECP256R1_32B_WORDS_SIZE] = {
+        0x3c2291a9, 0xc6b0aae9, 0xebb215b4, 0x024c740d, 0xb897dde3, 0x92d3242c,
+        0x76a4602c, 0xb01a172a};
+    static const uint32_t y_n_minus_6[ECC_SECP256R1_32B_WORDS_SIZE] = {
+        0x7038801d, 0x0283b7ac, 0xe381e942, 0xe3ff0890, 0x0458fc86, 0x9013f1d2,
+        0xcdc8252b, 0x17a3ef8a};
+    static const uint32_t x_n_minus_2[ECC_SECP256R1_32B_WORDS_SIZE] = {
+        0x47669978, 0xa60b48fc, 0x77f21b35, 0xc08969e2, 0x04b51ac3, 0x8a523803,
+        0x8d034f7e, 0x7cf27b18};
+    static const uint32_t y_n_minus_2[ECC_SECP256R1_32B_WORDS_SIZE] = {
+        0xdd878c2e, 0x61fb4862, 0xc3167dd6, 0x4582521a, 0x608bcf24, 0xd6c26539,
+        0x24712fc0, 0xf888aaee};
+    static const uint32_t x_n_minus_1[ECC_SECP256R1_32B_WORDS_SIZE] = {
+        0xd898c296, 0xf4a13945, 0x2deb33a0, 0x77037d81, 0x63a440f2, 0xf8bce6e5,
+        0xe12c4247, 0x6b17d1f2};
+    static const uint32_t y_n_minus_1[ECC_SECP256R1_32B_WORDS_SIZE] = {
+        0xc840ae0a, 0x3449bf97, 0x94cea131, 0xd431cca9, 0x83f061e9, 0x711814b5,
+        0x01e58065, 0xb01cbd1c};
+
+    test_soft_ecc_mult_window_check(&ecc_secp256r1, k_1,
+                                    (const uint32_t *)ecc_secp256r1.g->x,
+                                    (const uint32_t *)ecc_secp256r1.g->y);
+    test_soft_ecc_mult_window_check(&ecc_secp256r1, k_2, x_2, y_2);
+    test_soft_ecc_mult_window_check(&ecc_secp256r1, k_14, x_14, y_14);
+    test_soft_ecc_mult_window_check(&ecc_secp256r1, k_n_minus_6, x_n_minus_6,
+                                    y_n_minus_6);
+    test_soft_ecc_mult_window_check(&ecc_secp256r1, k_n_minus_2, x_n_minus_2,
+                                    y_n_minus_2);
+    test_soft_ecc_mult_window_check(&ecc_secp256r1, k_n_minus_1, x_n_minus_1,
+                                    y_n_minus_1);
+}
+
+TEST(soft_ecc, test_soft_ecc_mult_window_edge_p384r1)
+{
+    static const uint32_t k_1[ECC_SECP384R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {1};
+    static const uint32_t k_2[ECC_SECP384R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {2};
+    static const uint32_t k_14[ECC_SECP384R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {14};
+    static const uint32_t k_n_minus_6[ECC_SECP384R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {
+        0xccc5296d, 0xecec196a, 0x48b0a77a, 0x581a0db2, 0xf4372ddf, 0xc7634d81,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff};
+    static const uint32_t k_n_minus_2[ECC_SECP384R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {
+        0xccc52971, 0xecec196a, 0x48b0a77a, 0x581a0db2, 0xf4372ddf, 0xc7634d81,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff};
+    static const uint32_t k_n_minus_1[ECC_SECP384R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {
+        0xccc52972, 0xecec196a, 0x48b0a77a, 0x581a0db2, 0xf4372ddf, 0xc7634d81,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff};
+
+    static const uint32_t x_2[ECC_SECP384R1_32B_WORDS_SIZE] = {
+        0x5295df61, 0x5b96a9c7, 0xbe0e64f8, 0x4fe0e86e, 0x9fb96e9e, 0x51d207d1,
+        0xa6f434d6, 0x89025959, 0xc55b97f0, 0x69260045, 0x7ba3d2d9, 0x08d99905};
+    static const uint32_t y_2[ECC_SECP384R1_32B_WORDS_SIZE] = {
+        0x0a940e80, 0x61501e70, 0x4d39e22d, 0x5ffd43e9, 0x256ab425, 0x904e505f,
+        0xbc6cc43e, 0xb275d875, 0xfd6dba74, 0xb7bfe8df, 0x5b1b3ced, 0x8e80f1fa};
+    static const uint32_t x_14[ECC_SECP384R1_32B_WORDS_SIZE] = {
+        0xf0f59ea0, 0x37209acc, 0xbc02de66, 0x41aba24d, 0x651cca2c, 0x5de541eb,
+        0xd23e7dc9, 0x877b1dff, 0x1b89d2b0, 0x6bbeac48, 0x44fbc239, 0xe8c8f94d};
+    static const uint32_t y_14[ECC_SECP384R1_32B_WORDS_SIZE] = {
+        0x1b67b888, 0xd7ee5c9e, 0x5509de22, 0xfc468ba0, 0xa09d0f48, 0xc8319413,
+        0xe7728d79, 0x33b86191, 0xde52c8a9, 0x932bcbf6, 0x56fc8ae0, 0x891ae443};
+    static const uint32_t x_n_minus_6[ECC_SECP384R1_32B_WORDS_SIZE] = {
+        0x4e35c5df, 0x0937f085, 0x02ff30e5, 0x21317d72, 0x62573830, 0x1cbd41f2,
+        0x7f0f5da5, 0xc33ebcbb, 0x6f2d15d3, 0x226fe0d2, 0xd064d2b2, 0x627be1ac};
+    static const uint32_t y_n_minus_6[ECC_SECP384R1_32B_WORDS_SIZE] = {
+        0x2c0f06cb, 0xe8cc5bf8, 0x7b1e9ace, 0xfb3ba471, 0xc8eabbe8, 0x6679b09e,
+        0x9bb088b3, 0x4d36acad, 0x3eb0ea8a, 0xe4192259, 0x4c074e3d, 0xf68995b3};
+    static const uint32_t x_n_minus_2[ECC_SECP384R1_32B_WORDS_SIZE] = {
+        0x5295df61, 0x5b96a9c7, 0xbe0e64f8, 0x4fe0e86e, 0x9fb96e9e, 0x51d207d1,
+        0xa6f434d6, 0x89025959, 0xc55b97f0, 0x69260045, 0x7ba3d2d9, 0x08d99905};
+    static const uint32_t y_n_minus_2[ECC_SECP384R1_32B_WORDS_SIZE] = {
+        0xf56bf17f, 0x9eafe190, 0xb2c61dd2, 0xa002bc15, 0xda954bd9, 0x6fb1afa0,
+        0x43933bc1, 0x4d8a278a, 0x0292458b, 0x48401720, 0xa4e4c312, 0x717f0e05};
+    static const uint32_t x_n_minus_1[ECC_SECP384R1_32B_WORDS_SIZE] = {
+        0x72760ab7, 0x3a545e38, 0xbf55296c, 0x5502f25d, 0x82542a38, 0x59f741e0,
+        0x8ba79b98, 0x6e1d3b62, 0xf320ad74, 0x8eb1c71e, 0xbe8b0537, 0xaa87ca22};
+    static const uint32_t y_n_minus_1[ECC_SECP384R1_32B_WORDS_SIZE] = {
+        0x6f15f1a0, 0x85bce284, 0xe2817e62, 0xf59f4e30, 0x4a0f473e, 0x1625ceec,
+        0xd765eb83, 0x070be242, 0x6d6d23d6, 0xa2616740, 0x69d9d390, 0xc9e821b5};
+
+    test_soft_ecc_mult_window_check(&ecc_secp384r1, k_1,
+                                    (const uint32_t *)ecc_secp384r1.g->x,
+                                    (const uint32_t *)ecc_secp384r1.g->y);
+    test_soft_ecc_mult_window_check(&ecc_secp384r1, k_2, x_2, y_2);
+    test_soft_ecc_mult_window_check(&ecc_secp384r1, k_14, x_14, y_14);
+    test_soft_ecc_mult_window_check(&ecc_secp384r1, k_n_minus_6, x_n_minus_6,
+                                    y_n_minus_6);
+    test_soft_ecc_mult_window_check(&ecc_secp384r1, k_n_minus_2, x_n_minus_2,
+                                    y_n_minus_2);
+    test_soft_ecc_mult_window_check(&ecc_secp384r1, k_n_minus_1, x_n_minus_1,
+                                    y_n_minus_1);
+}
+
+TEST(soft_ecc, test_soft_ecc_mult_window_edge_p521r1)
+{
+    static const uint32_t k_1[ECC_SECP521R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {1};
+    static const uint32_t k_2[ECC_SECP521R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {2};
+    static const uint32_t k_14[ECC_SECP521R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {14};
+    static const uint32_t k_n_minus_6[ECC_SECP521R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {
+        0x91386403, 0xbb6fb71e, 0x899c47ae, 0x3bb5c9b8, 0xf709a5d0, 0x7fcc0148,
+        0xbf2f966b, 0x51868783, 0xfffffffa, 0xffffffff, 0xffffffff, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000001ff};
+    static const uint32_t k_n_minus_2[ECC_SECP521R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {
+        0x91386407, 0xbb6fb71e, 0x899c47ae, 0x3bb5c9b8, 0xf709a5d0, 0x7fcc0148,
+        0xbf2f966b, 0x51868783, 0xfffffffa, 0xffffffff, 0xffffffff, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000001ff};
+    static const uint32_t k_n_minus_1[ECC_SECP521R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8))) = {
+        0x91386408, 0xbb6fb71e, 0x899c47ae, 0x3bb5c9b8, 0xf709a5d0, 0x7fcc0148,
+        0xbf2f966b, 0x51868783, 0xfffffffa, 0xffffffff, 0xffffffff, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000001ff};
+
+    static const uint32_t x_2[ECC_SECP521R1_32B_WORDS_SIZE] = {
+        0xba6d783d, 0xf43e3933, 0xd60fd967, 0xcf2fa364, 0x35c5af41, 0xaa104a3a,
+        0x6ef55507, 0xb3b204da, 0xd769be97, 0x2c6e5505, 0x1ccc0635, 0x7403279b,
+        0x48c28274, 0x2fcb2881, 0x277e7e68, 0x3c219024, 0x00000043};
+    static const uint32_t y_2[ECC_SECP521R1_32B_WORDS_SIZE] = {
+        0x61f41b02, 0x1be356d6, 0xedc0f4f7, 0xeafcbe95, 0x9a3248f4, 0x93937fa9,
+        0x9f251f6b, 0xb3e377de, 0x06c42dbb, 0xab21a299, 0x4da97740, 0xc6b5107c,
+        0xeed3f0b5, 0xa7f3ecee, 0x6db26700, 0xbb8cc7f8, 0x000000f4};
+    static const uint32_t x_14[ECC_SECP521R1_32B_WORDS_SIZE] = {
+        0xd3432d74, 0x2c9e682d, 0x12efbf5d, 0x6767f6b8, 0x7bc744aa, 0x79df3e4b,
+        0xb897222d, 0x74fc06c8, 0xe0b31999, 0xd4fb0bab, 0x94116a2f, 0x958b4014,
+        0xaf84ded1, 0xe1b8ccfa, 0x1b1b65a9, 0x5bc7dc55, 0x00000187};
+    static const uint32_t y_14[ECC_SECP521R1_32B_WORDS_SIZE] = {
+        0x2700d54a, 0x41669f85, 0xa87c84be, 0x5b690f53, 0xd133dc0d, 0x11e89bf1,
+        0xb4f3584c, 0xd07781b1, 0x86d7ed62, 0x0847ce9b, 0x8e51826a, 0x8470122b,
+        0xabb4bdfb, 0xd66290bb, 0xdacb5bd2, 0xa4923575, 0x0000005c};
+    static const uint32_t x_n_minus_6[ECC_SECP521R1_32B_WORDS_SIZE] = {
+        0xf79206b9, 0x23731bed, 0x57f380ae, 0x2f66e956, 0x9531be8c, 0xe0727a23,
+        0x153f7394, 0x5fbcca16, 0xe4ab0152, 0x981506ad, 0x7fd71cf3, 0x623d3097,
+        0x4480d195, 0x2eff34f9, 0xb5921953, 0x4569d6cd, 0x000001ee};
+    static const uint32_t y_n_minus_6[ECC_SECP521R1_32B_WORDS_SIZE] = {
+        0xa72bb0e8, 0xe1533287, 0xa35f2521, 0xc238474a, 0x1d8b0ddf, 0x069367b2,
+        0xa99b7362, 0x3548d2f1, 0xdfe57569, 0x8dbf56d9, 0x25a57f71, 0xd554448c,
+        0xb91c4eee, 0x1d22d8fa, 0x39b0a795, 0xfdaa52f3, 0x00000021};
+    static const uint32_t x_n_minus_2[ECC_SECP521R1_32B_WORDS_SIZE] = {
+        0xba6d783d, 0xf43e3933, 0xd60fd967, 0xcf2fa364, 0x35c5af41, 0xaa104a3a,
+        0x6ef55507, 0xb3b204da, 0xd769be97, 0x2c6e5505, 0x1ccc0635, 0x7403279b,
+        0x48c28274, 0x2fcb2881, 0x277e7e68, 0x3c219024, 0x00000043};
+    static const uint32_t y_n_minus_2[ECC_SECP521R1_32B_WORDS_SIZE] = {
+        0x9e0be4fd, 0xe41ca929, 0x123f0b08, 0x1503416a, 0x65cdb70b, 0x6c6c8056,
+        0x60dae094, 0x4c1c8821, 0xf93bd244, 0x54de5d66, 0xb25688bf, 0x394aef83,
+        0x112c0f4a, 0x580c1311, 0x924d98ff, 0x44733807, 0x0000010b};
+    static const uint32_t x_n_minus_1[ECC_SECP521R1_32B_WORDS_SIZE] = {
+        0xc2e5bd66, 0xf97e7e31, 0x856a429b, 0x3348b3c1, 0xa2ffa8de, 0xfe1dc127,
+        0xefe75928, 0xa14b5e77, 0x6b4d3dba, 0xf828af60, 0x053fb521, 0x9c648139,
+        0x2395b442, 0x9e3ecb66, 0x0404e9cd, 0x858e06b7, 0x000000c6};
+    static const uint32_t y_n_minus_1[ECC_SECP521R1_32B_WORDS_SIZE] = {
+        0x602e99af, 0x77416b89, 0x5d8d3dbf, 0xcac38f79, 0xc052f89e, 0x3aaf46fe,
+        0xa10bd9bf, 0x68118d66, 0xd8c199d3, 0xe85042e8, 0xa864bb97, 0x670abbb6,
+        0xd382e426, 0xa375a04b, 0x65c43ffb, 0xc6d69587, 0x000000e7};
+
+    test_soft_ecc_mult_window_check(&ecc_secp521r1, k_1,
+                                    (const uint32_t *)ecc_secp521r1.g->x,
+                                    (const uint32_t *)ecc_secp521r1.g->y);
+    test_soft_ecc_mult_window_check(&ecc_secp521r1, k_2, x_2, y_2);
+    test_soft_ecc_mult_window_check(&ecc_secp521r1, k_14, x_14, y_14);
+    test_soft_ecc_mult_window_check(&ecc_secp521r1, k_n_minus_6, x_n_minus_6,
+                                    y_n_minus_6);
+    test_soft_ecc_mult_window_check(&ecc_secp521r1, k_n_minus_2, x_n_minus_2,
+                                    y_n_minus_2);
+    test_soft_ecc_mult_window_check(&ecc_secp521r1, k_n_minus_1, x_n_minus_1,
+                                    y_n_minus_1);
+}
+
+/* test batch conversion against the point by point conversion */
+
+/* more points than a group, the last group is partial */
+#define TEST_SOFT_ECC_BATCH_COUNT (SOFT_ECC_BATCH_AFFINE_GROUP_SIZE + 3)
+
+TEST(soft_ecc, test_soft_ecc_batch_jacobian_to_affine)
+{
+    int32_t result = 0;
+    size_t i;
+
+    uint64_t point_x[ECC_SECP384R1_64B_WORDS_SIZE] = {
+        0xE8239FC890BC6894, 0xC61EF3EF31AE0D87, 0xC5AD236CA59684BE,
+        0xBABCE4EB75047E7A, 0xA75A8848900CC063, 0xA011B3C98CCC2720};
+
+    uint64_t point_y[ECC_SECP384R1_64B_WORDS_SIZE] = {
+        0x96455AEE5D3E8912, 0xA0DA7CBF700931A6, 0xF8BDABFB61F95731,
+        0x9A2708BE527AE3C9, 0x024C8F69D35F423E, 0xE03D61232DEDE896};
+
+    uint64_t jac_data[TEST_SOFT_ECC_BATCH_COUNT]
+              [3 * ECC_SECP384R1_64B_WORDS_SIZE] = {{0}};
+    uint64_t aff_data[TEST_SOFT_ECC_BATCH_COUNT]
+              [2 * ECC_SECP384R1_64B_WORDS_SIZE] = {{0}};
+    uint64_t expected_data[TEST_SOFT_ECC_BATCH_COUNT]
+              [2 * ECC_SECP384R1_64B_WORDS_SIZE] = {{0}};
+
+    ecc_bignum_affine_point_t point = {.x = point_x, .y = point_y};
+    ecc_bignum_jacobian_point_t points_jac[TEST_SOFT_ECC_BATCH_COUNT];
+    ecc_bignum_affine_point_t points_aff[TEST_SOFT_ECC_BATCH_COUNT];
+    ecc_bignum_affine_point_t points_expected[TEST_SOFT_ECC_BATCH_COUNT];
+
+    for (i = 0; i < TEST_SOFT_ECC_BATCH_COUNT; i++)
+    {
+        soft_ecc_jacobian_map_packed((uint32_t *)jac_data[i], &points_jac[i],
+                                     ECC_SECP384R1_32B_WORDS_SIZE);
+        soft_ecc_affine_map_packed((uint32_t *)aff_data[i], &points_aff[i],
+                                   ECC_SECP384R1_32B_WORDS_SIZE);
+        soft_ecc_affine_map_packed((uint32_t *)expected_data[i],
+                                   &points_expected[i],
+                                   ECC_SECP384R1_32B_WORDS_SIZE);
+    }
+
+    /* P (z = 1), 2P, 4P, 8P, ... */
+    result = soft_ecc_convert_affine_to_jacobian(
+        &scl, &ecc_secp384r1, (ecc_bignum_affine_const_point_t *)&point,
+        &points_jac[0], ECC_SECP384R1_32B_WORDS_SIZE);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    for (i = 1; i < TEST_SOFT_ECC_BATCH_COUNT; i++)
+    {
+        result = soft_ecc_double_jacobian(&scl, &ecc_secp384r1,
+                                          &points_jac[i - 1], &points_jac[i],
+                                          ECC_SECP384R1_32B_WORDS_SIZE);
+        TEST_ASSERT_TRUE(SCL_OK == result);
+    }
+
+    for (i = 0; i < TEST_SOFT_ECC_BATCH_COUNT; i++)
+    {
+        result = soft_ecc_convert_jacobian_to_affine(
+            &scl, &ecc_secp384r1, &points_jac[i], &points_expected[i],
+            ECC_SECP384R1_32B_WORDS_SIZE);
+        TEST_ASSERT_TRUE(SCL_OK == result);
+    }
+
+    result = soft_ecc_batch_jacobian_to_affine(&scl, &ecc_secp384r1,
+                                               points_jac, points_aff,
+                                               TEST_SOFT_ECC_BATCH_COUNT,
+                                               ECC_SECP384R1_32B_WORDS_SIZE);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_data, aff_data,
+                                 sizeof(expected_data));
+
+    /* in place, the affine coordinates overwrite the jacobian ones */
+    for (i = 0; i < TEST_SOFT_ECC_BATCH_COUNT; i++)
+    {
+        points_aff[i].x = points_jac[i].x;
+        points_aff[i].y = points_jac[i].y;
+    }
+
+    result = soft_ecc_batch_jacobian_to_affine(&scl, &ecc_secp384r1,
+                                               points_jac, points_aff,
+                                               TEST_SOFT_ECC_BATCH_COUNT,
+                                               ECC_SECP384R1_32B_WORDS_SIZE);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    for (i = 0; i < TEST_SOFT_ECC_BATCH_COUNT; i++)
+    {
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(points_expected[i].x, points_jac[i].x,
+                                     ECC_SECP384R1_BYTESIZE);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(points_expected[i].y, points_jac[i].y,
+                                     ECC_SECP384R1_BYTESIZE);
+    }
+}
+
+/* test batch conversion with a point at the infinite */
+
+TEST(soft_ecc, test_soft_ecc_batch_jacobian_to_affine_infinite)
+{
+    int32_t result = 0;
+
+    uint64_t jac_data[2][3 * ECC_SECP384R1_64B_WORDS_SIZE] = {{0}};
+    uint64_t aff_data[2][2 * ECC_SECP384R1_64B_WORDS_SIZE] = {{0}};
+
+    ecc_bignum_jacobian_point_t points_jac[2];
+    ecc_bignum_affine_point_t points_aff[2];
+
+    soft_ecc_jacobian_map_packed((uint32_t *)jac_data[0], &points_jac[0],
+                                 ECC_SECP384R1_32B_WORDS_SIZE);
+    soft_ecc_jacobian_map_packed((uint32_t *)jac_data[1], &points_jac[1],
+                                 ECC_SECP384R1_32B_WORDS_SIZE);
+    soft_ecc_affine_map_packed((uint32_t *)aff_data[0], &points_aff[0],
+                               ECC_SECP384R1_32B_WORDS_SIZE);
+    soft_ecc_affine_map_packed((uint32_t *)aff_data[1], &points_aff[1],
+                               ECC_SECP384R1_32B_WORDS_SIZE);
+
+    /* first point is G, second one is the infinite (1:1:0) */
+    result = soft_ecc_convert_affine_to_jacobian(&scl, &ecc_secp384r1,
+                                                 ecc_secp384r1.g,
+                                                 &points_jac[0],
+                                                 ECC_SECP384R1_32B_WORDS_SIZE);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    points_jac[1].x[0] = 1;
+    points_jac[1].y[0] = 1;
+
+    result = soft_ecc_batch_jacobian_to_affine(&scl, &ecc_secp384r1,
+                                               points_jac, points_aff, 2,
+                                               ECC_SECP384R1_32B_WORDS_SIZE);
+    TEST_ASSERT_TRUE(SCL_INVALID_INPUT == result);
+
+    /* nothing is written, not even the conversion of the first point */
+    TEST_ASSERT_EACH_EQUAL_HEX8(0, (uint8_t *)aff_data, sizeof(aff_data));
+
+    result = soft_ecc_batch_jacobian_to_affine(&scl, &ecc_secp384r1,
+                                               points_jac, points_aff, 0,
+                                               ECC_SECP384R1_32B_WORDS_SIZE);
+    TEST_ASSERT_TRUE(SCL_INVALID_LENGTH == result);
+}
+
 /* test co-Z add c */
 
 TEST(soft_ecc, test_soft_ecc_xycz_addc)
@@ -330,3 +960,123 @@ TEST(soft_ecc, test_soft_ecc_xycz_addc)
     TEST_ASSERT_EQUAL_HEX8_ARRAY(point_2_expected_y, point_2_y,
                                  ECC_SECP384R1_BYTESIZE);
 }
+
+/* enough for the Straus tables of 16 secp256r1 points */
+#define TEST_SOFT_ECC_MSM_WORKSPACE_SIZE                                       \
+    (16 * 7 * 3 * ECC_SECP256R1_32B_WORDS_SIZE)
+#define TEST_SOFT_ECC_MSM_MAX_POINTS 40
+
+/**
+ * P_i = a_i.G with a_i in [1, 5] (so that some points are equal) and k_i
+ * pseudo random, the multi-scalar multiplication must be equal to
+ * (sum(k_i.a_i) mod n).G
+ */
+static void test_soft_ecc_msm_check(size_t nb_points)
+{
+    int32_t result;
+    size_t i, j;
+    uint32_t seed = 0x12345678;
+
+    static uint32_t workspace[TEST_SOFT_ECC_MSM_WORKSPACE_SIZE]
+        __attribute__((aligned(8)));
+    static uint64_t points_data[TEST_SOFT_ECC_MSM_MAX_POINTS]
+                               [2 * ECC_SECP256R1_64B_WORDS_SIZE];
+    static uint64_t k_data[TEST_SOFT_ECC_MSM_MAX_POINTS]
+                          [ECC_SECP256R1_64B_WORDS_SIZE];
+    ecc_bignum_affine_point_t points[TEST_SOFT_ECC_MSM_MAX_POINTS];
+    const uint64_t *scalars[TEST_SOFT_ECC_MSM_MAX_POINTS];
+
+    uint64_t a[ECC_SECP256R1_64B_WORDS_SIZE];
+    uint64_t s[ECC_SECP256R1_64B_WORDS_SIZE] = {0};
+    uint64_t t[ECC_SECP256R1_64B_WORDS_SIZE];
+    uint64_t q_data[2 * ECC_SECP256R1_64B_WORDS_SIZE] = {0};
+    uint64_t expected_data[2 * ECC_SECP256R1_64B_WORDS_SIZE] = {0};
+    ecc_bignum_affine_point_t q, expected;
+
+    TEST_ASSERT_TRUE(nb_points <= TEST_SOFT_ECC_MSM_MAX_POINTS);
+    TEST_ASSERT_TRUE(soft_ecc_msm_workspace_size(&ecc_secp256r1, nb_points) <=
+                     TEST_SOFT_ECC_MSM_WORKSPACE_SIZE);
+
+    soft_ecc_affine_map_packed((uint32_t *)q_data, &q,
+                               ECC_SECP256R1_32B_WORDS_SIZE);
+    soft_ecc_affine_map_packed((uint32_t *)expected_data, &expected,
+                               ECC_SECP256R1_32B_WORDS_SIZE);
+
+    for (i = 0; i < nb_points; i++)
+    {
+        soft_ecc_affine_map_packed((uint32_t *)points_data[i], &points[i],
+                                   ECC_SECP256R1_32B_WORDS_SIZE);
+
+        memset(a, 0, sizeof(a));
+        a[0] = (i % 5) + 1;
+        result = soft_ecc_mult_window(&scl, &ecc_secp256r1, ecc_secp256r1.g,
+                                      a, ECC_SECP256R1_32B_WORDS_SIZE,
+                                      &points[i]);
+        TEST_ASSERT_TRUE(SCL_OK == result);
+
+        for (j = 0; j < ECC_SECP256R1_64B_WORDS_SIZE; j++)
+        {
+            seed = seed * 1103515245 + 12345;
+            k_data[i][j] = (uint64_t)seed << 32;
+            seed = seed * 1103515245 + 12345;
+            k_data[i][j] |= seed;
+        }
+        scalars[i] = k_data[i];
+
+        /* s = s + k_i.a_i mod n */
+        soft_ecc_scalar_mult(&ecc_secp256r1, a, k_data[i], t);
+        soft_ecc_scalar_add(&ecc_secp256r1, s, t, s);
+    }
+
+    result = soft_ecc_mult_window(&scl, &ecc_secp256r1, ecc_secp256r1.g, s,
+                                  ECC_SECP256R1_32B_WORDS_SIZE, &expected);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = soft_ecc_msm(&scl, &ecc_secp256r1,
+                          (const ecc_bignum_affine_const_point_t *)points,
+                          scalars, ECC_SECP256R1_32B_WORDS_SIZE, nb_points,
+                          workspace, TEST_SOFT_ECC_MSM_WORKSPACE_SIZE, &q);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_data, q_data, sizeof(q_data));
+}
+
+TEST(soft_ecc, test_soft_ecc_msm_straus) { test_soft_ecc_msm_check(7); }
+
+TEST(soft_ecc, test_soft_ecc_msm_pippenger)
+{
+    test_soft_ecc_msm_check(TEST_SOFT_ECC_MSM_MAX_POINTS);
+}
+
+TEST(soft_ecc, test_soft_ecc_msm_infinite)
+{
+    int32_t result;
+    uint32_t workspace[2 * 7 * 3 * ECC_SECP256R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8)));
+    uint64_t k[ECC_SECP256R1_64B_WORDS_SIZE] = {5};
+    uint64_t n_minus_k[ECC_SECP256R1_64B_WORDS_SIZE];
+    uint64_t q_data[2 * ECC_SECP256R1_64B_WORDS_SIZE] = {0};
+    ecc_bignum_affine_point_t q;
+    const ecc_bignum_affine_const_point_t points[2] = {*ecc_secp256r1.g,
+                                                       *ecc_secp256r1.g};
+    const uint64_t *scalars[2] = {k, n_minus_k};
+
+    soft_ecc_affine_map_packed((uint32_t *)q_data, &q,
+                               ECC_SECP256R1_32B_WORDS_SIZE);
+
+    result = soft_bignum_sub(&scl, ecc_secp256r1.n, k, n_minus_k,
+                             ECC_SECP256R1_32B_WORDS_SIZE);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    /* k.G + (n - k).G is the infinite */
+    result = soft_ecc_msm(&scl, &ecc_secp256r1, points, scalars,
+                          ECC_SECP256R1_32B_WORDS_SIZE, 2, workspace,
+                          sizeof(workspace) / sizeof(uint32_t), &q);
+    TEST_ASSERT_TRUE(SCL_ERR_POINT == result);
+
+    /* workspace too small */
+    result = soft_ecc_msm(&scl, &ecc_secp256r1, points, scalars,
+                          ECC_SECP256R1_32B_WORDS_SIZE, 2, workspace,
+                          sizeof(workspace) / sizeof(uint32_t) - 1, &q);
+    TEST_ASSERT_TRUE(SCL_INVALID_LENGTH == result);
+}
@@ -11,6 +11,7 @@
 #include "unity_fixture.h"
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
 #include <backend/software/scl_soft.h>
@@ -18,6 +19,14 @@
 static int32_t get_data_for_test(const metal_scl_t *const scl,
                                  uint32_t *data_out);
 
+/**
+ * when trng_counter_mode is set, get_data_for_test() returns a counter and
+ * fails once trng_budget words have been returned
+ */
+static bool trng_counter_mode;
+static uint32_t trng_counter;
+static size_t trng_budget;
+
 /**
  * We use CRYPTO_CONST_DATA qualifier to allow relocation in RAM to speed up
  * test
@@ -60,15 +69,28 @@ CRYPTO_CONST_DATA static const metal_scl_t scl = {
 int32_t get_data_for_test(const metal_scl_t *const scl_ctx, uint32_t *data_out)
 {
     (void)scl_ctx;
-    *data_out = 0xA5A5A5A5;
+
+    if (false == trng_counter_mode)
+    {
+        *data_out = 0xA5A5A5A5;
+        return (SCL_OK);
+    }
+
+    if (0 == trng_budget)
+    {
+        return (SCL_ERROR);
+    }
+
+    trng_budget--;
+    *data_out = trng_counter++;
     return (SCL_OK);
 }
 
 TEST_GROUP(soft_ecc_keygen);
 
-TEST_SETUP(soft_ecc_keygen) {}
+TEST_SETUP(soft_ecc_keygen) { trng_counter_mode = false; }
 
-TEST_TEAR_DOWN(soft_ecc_keygen) {}
+TEST_TEAR_DOWN(soft_ecc_keygen) { trng_counter_mode = false; }
 
 TEST(soft_ecc_keygen, test_p384r1_) {}
 
@@ -438,3 +460,390 @@ TEST(soft_ecc_keygen, soft_ecc_keypair_generation_secp521r1_success)
     TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_priv_key, priv_key,
                                  ECC_SECP521R1_BYTESIZE);
 }
+
+TEST(soft_ecc_keygen, soft_ecc_keypair_generation_batch_secp256r1_success)
+{
+    int32_t result;
+    size_t i;
+
+    /* one more than a group, to cover a partial group */
+    uint8_t priv_keys[SOFT_ECC_KEYGEN_BATCH_SIZE + 1][ECC_SECP256R1_BYTESIZE];
+    uint8_t points_x[SOFT_ECC_KEYGEN_BATCH_SIZE + 1][ECC_SECP256R1_BYTESIZE];
+    uint8_t points_y[SOFT_ECC_KEYGEN_BATCH_SIZE + 1][ECC_SECP256R1_BYTESIZE];
+    ecc_affine_point_t pub_keys[SOFT_ECC_KEYGEN_BATCH_SIZE + 1];
+
+    uint8_t expected_x[ECC_SECP256R1_BYTESIZE] __attribute__((aligned(8)));
+    uint8_t expected_y[ECC_SECP256R1_BYTESIZE] __attribute__((aligned(8)));
+    ecc_affine_point_t expected = {.x = expected_x, .y = expected_y};
+
+    memset(priv_keys, 0, sizeof(priv_keys));
+    memset(points_x, 0, sizeof(points_x));
+    memset(points_y, 0, sizeof(points_y));
+
+    for (i = 0; i < SOFT_ECC_KEYGEN_BATCH_SIZE + 1; i++)
+    {
+        pub_keys[i].x = points_x[i];
+        pub_keys[i].y = points_y[i];
+    }
+
+    /* a constant TRNG would hide a mix up between the keypairs */
+    trng_counter_mode = true;
+    trng_counter = 1;
+    trng_budget = SIZE_MAX;
+
+    result = soft_ecc_keypair_generation_batch(
+        &scl, &ecc_secp256r1, SOFT_ECC_KEYGEN_BATCH_SIZE + 1,
+        (uint8_t *)priv_keys, pub_keys);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    /* each public key matches its own private key */
+    for (i = 0; i < SOFT_ECC_KEYGEN_BATCH_SIZE + 1; i++)
+    {
+        if (0 != i)
+        {
+            TEST_ASSERT_TRUE(0 != memcmp(priv_keys[i - 1], priv_keys[i],
+                                         ECC_SECP256R1_BYTESIZE));
+        }
+
+        result = soft_ecc_pubkey_generation(&scl, &ecc_secp256r1,
+                                            priv_keys[i], &expected);
+        TEST_ASSERT_TRUE(SCL_OK == result);
+
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_x, points_x[i],
+                                     ECC_SECP256R1_BYTESIZE);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_y, points_y[i],
+                                     ECC_SECP256R1_BYTESIZE);
+    }
+
+    /**
+     * the TRNG fails in the second group: the keypairs of the first one
+     * are not returned either
+     */
+    trng_budget = SOFT_ECC_KEYGEN_BATCH_SIZE * ECC_SECP256R1_32B_WORDS_SIZE + 1;
+
+    result = soft_ecc_keypair_generation_batch(
+        &scl, &ecc_secp256r1, SOFT_ECC_KEYGEN_BATCH_SIZE + 1,
+        (uint8_t *)priv_keys, pub_keys);
+
+    TEST_ASSERT_TRUE(SCL_ERROR == result);
+    TEST_ASSERT_EACH_EQUAL_HEX8(0, (uint8_t *)priv_keys, sizeof(priv_keys));
+    TEST_ASSERT_EACH_EQUAL_HEX8(0, (uint8_t *)points_x, sizeof(points_x));
+    TEST_ASSERT_EACH_EQUAL_HEX8(0, (uint8_t *)points_y, sizeof(points_y));
+
+    result = soft_ecc_keypair_generation_batch(
+        &scl, &ecc_secp256r1, 0, (uint8_t *)priv_keys, pub_keys);
+    TEST_ASSERT_TRUE(SCL_INVALID_LENGTH == result);
+}
+
+TEST(soft_ecc_keygen, soft_ecc_point_compress_secp256r1_success)
+{
+    int32_t result;
+
+    uint8_t point_x[ECC_SECP256R1_BYTESIZE] __attribute__((aligned(8))) = {
+        0x8E, 0x86, 0xD5, 0x64, 0x37, 0x7A, 0x28, 0xB6, 0x84, 0xC4, 0x62,
+        0x03, 0x42, 0xAF, 0xD8, 0x3B, 0x89, 0x4A, 0x05, 0xB9, 0x15, 0x6F,
+        0xF7, 0x21, 0xA2, 0x41, 0x00, 0x4F, 0xDE, 0x78, 0x69, 0x41};
+    uint8_t point_y[ECC_SECP256R1_BYTESIZE] __attribute__((aligned(8))) = {
+        0xE0, 0x1A, 0x7C, 0xE3, 0xE9, 0x19, 0x86, 0x12, 0xD9, 0xAA, 0x43,
+        0xC2, 0x1E, 0x3A, 0xB4, 0x00, 0x6C, 0x62, 0x3C, 0x93, 0x61, 0xBC,
+        0xE8, 0xC6, 0xA9, 0xBF, 0x27, 0x8F, 0x07, 0xE8, 0x9C, 0x31};
+    uint8_t out_x[ECC_SECP256R1_BYTESIZE] __attribute__((aligned(8)));
+    uint8_t out_y[ECC_SECP256R1_BYTESIZE] __attribute__((aligned(8)));
+    uint8_t compressed[ECC_POINT_COMPRESSED_BYTESIZE(ECC_SECP256R1_BYTESIZE)];
+    size_t compressed_len = sizeof(compressed);
+
+    ecc_affine_const_point_t point = {.x = point_x, .y = point_y};
+    ecc_affine_point_t out = {.x = out_x, .y = out_y};
+
+    result = soft_ecc_point_compress(&scl, &ecc_secp256r1, &point, compressed,
+                                     &compressed_len);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(sizeof(compressed) == compressed_len);
+    TEST_ASSERT_TRUE(ECC_POINT_COMPRESSED_ODD == compressed[0]);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_x, &compressed[1], sizeof(point_x));
+
+    result = soft_ecc_point_decompress(&scl, &ecc_secp256r1, compressed,
+                                       compressed_len, &out);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_x, out_x, sizeof(point_x));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_y, out_y, sizeof(point_y));
+}
+
+TEST(soft_ecc_keygen, soft_ecc_point_compress_secp384r1_success)
+{
+    int32_t result;
+
+    uint8_t point_x[ECC_SECP384R1_BYTESIZE] __attribute__((aligned(8))) = {
+        0x9F, 0xEB, 0x83, 0x1B, 0xD0, 0x37, 0x7E, 0xD4, 0x73, 0x78, 0x14, 0x6D,
+        0xF3, 0x64, 0x02, 0xCA, 0x77, 0x97, 0xBF, 0x39, 0x15, 0xF5, 0x43, 0x49,
+        0x3B, 0x28, 0x17, 0x6D, 0x69, 0x33, 0xCF, 0xE9, 0x61, 0xA2, 0xA3, 0xB3,
+        0xEC, 0x03, 0xE4, 0x88, 0xEC, 0x2C, 0xAB, 0x7B, 0x3C, 0xD4, 0x9B, 0xC0};
+    uint8_t point_y[ECC_SECP384R1_BYTESIZE] __attribute__((aligned(8))) = {
+        0x81, 0xC4, 0x0F, 0x80, 0xB9, 0x12, 0xCE, 0x62, 0x0F, 0x49, 0x1A, 0xC2,
+        0x7A, 0x2F, 0x47, 0xFF, 0x7C, 0xB9, 0xE5, 0xA7, 0x14, 0x81, 0xEF, 0x0F,
+        0xC5, 0xF3, 0xFD, 0x0C, 0x1E, 0xBE, 0x47, 0x41, 0x45, 0xD0, 0xE7, 0x55,
+        0x6E, 0x0D, 0x58, 0xF8, 0xC3, 0xB5, 0x5B, 0x34, 0xFD, 0xE7, 0x0D, 0x29};
+    /* p - y, the other point with the same x */
+    uint8_t point_y_even[ECC_SECP384R1_BYTESIZE] __attribute__((aligned(8))) = {
+        0x7E, 0x3B, 0xF0, 0x7F, 0x46, 0xED, 0x31, 0x9D, 0xF0, 0xB6, 0xE5, 0x3D,
+        0x85, 0xD0, 0xB8, 0x00, 0x83, 0x46, 0x1A, 0x58, 0xEB, 0x7E, 0x10, 0xF0,
+        0x3A, 0x0C, 0x02, 0xF3, 0xE1, 0x41, 0xB8, 0xBD, 0xBA, 0x2F, 0x18, 0xA9,
+        0x91, 0xF2, 0xA7, 0x07, 0x3C, 0x4A, 0xA4, 0xCC, 0x02, 0x18, 0xF2, 0xD6};
+    uint8_t out_x[ECC_SECP384R1_BYTESIZE] __attribute__((aligned(8)));
+    uint8_t out_y[ECC_SECP384R1_BYTESIZE] __attribute__((aligned(8)));
+    uint8_t compressed[ECC_POINT_COMPRESSED_BYTESIZE(ECC_SECP384R1_BYTESIZE)];
+    size_t compressed_len = sizeof(compressed);
+
+    ecc_affine_const_point_t point = {.x = point_x, .y = point_y};
+    ecc_affine_point_t out = {.x = out_x, .y = out_y};
+
+    result = soft_ecc_point_compress(&scl, &ecc_secp384r1, &point, compressed,
+                                     &compressed_len);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(sizeof(compressed) == compressed_len);
+    TEST_ASSERT_TRUE(ECC_POINT_COMPRESSED_ODD == compressed[0]);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_x, &compressed[1], sizeof(point_x));
+
+    result = soft_ecc_point_decompress(&scl, &ecc_secp384r1, compressed,
+                                       compressed_len, &out);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_x, out_x, sizeof(point_x));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_y, out_y, sizeof(point_y));
+
+    /* round trip of the even point */
+    point.y = point_y_even;
+    compressed_len = sizeof(compressed);
+
+    result = soft_ecc_point_compress(&scl, &ecc_secp384r1, &point, compressed,
+                                     &compressed_len);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(ECC_POINT_COMPRESSED_EVEN == compressed[0]);
+
+    result = soft_ecc_point_decompress(&scl, &ecc_secp384r1, compressed,
+                                       compressed_len, &out);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_x, out_x, sizeof(point_x));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_y_even, out_y, sizeof(point_y_even));
+}
+
+TEST(soft_ecc_keygen, soft_ecc_point_compress_secp521r1_success)
+{
+    int32_t result;
+
+    uint8_t point_x[ECC_SECP521R1_BYTESIZE] __attribute__((aligned(8))) = {
+        0x01, 0x7C, 0x09, 0xB9, 0xEC, 0x25, 0xDF, 0x1C, 0x12, 0xD1, 0x6F,
+        0xD3, 0xA9, 0x1D, 0xDF, 0x22, 0xA8, 0xD0, 0x5D, 0x82, 0xC1, 0x23,
+        0xCE, 0x0C, 0x13, 0x5A, 0x45, 0xE1, 0x8C, 0x35, 0x75, 0xA8, 0xEC,
+        0xA2, 0x47, 0x73, 0x51, 0x35, 0x0B, 0x00, 0x9E, 0xBC, 0xD3, 0x50,
+        0x98, 0x4D, 0xBE, 0xEE, 0x9F, 0x0F, 0xA9, 0x41, 0xF5, 0x63, 0x17,
+        0x32, 0x09, 0x86, 0xDC, 0x12, 0x3C, 0xBB, 0x9C, 0x4E, 0x45, 0x95};
+    uint8_t point_y[ECC_SECP521R1_BYTESIZE] __attribute__((aligned(8))) = {
+        0x01, 0xD1, 0xDC, 0xAC, 0x57, 0x82, 0xC0, 0xC4, 0xEC, 0x4B, 0x50,
+        0x81, 0x26, 0x69, 0x06, 0xE0, 0x4D, 0x5A, 0x40, 0xD1, 0xFF, 0x18,
+        0xB2, 0x48, 0xA0, 0xE6, 0xAA, 0xA8, 0x1F, 0xC8, 0xE7, 0xD0, 0x29,
+        0x85, 0x2F, 0x17, 0x7E, 0xA0, 0xEE, 0xD2, 0x68, 0xCB, 0x52, 0x5D,
+        0xFC, 0x1B, 0xE6, 0x7F, 0x58, 0x31, 0xE0, 0x6F, 0x01, 0xD6, 0xC3,
+        0x79, 0x39, 0xE4, 0x3B, 0xA8, 0xC7, 0x86, 0x51, 0x13, 0x12, 0x2F};
+    /* p - y, the other point with the same x */
+    uint8_t point_y_even[ECC_SECP521R1_BYTESIZE] __attribute__((aligned(8))) = {
+        0x00, 0x2E, 0x23, 0x53, 0xA8, 0x7D, 0x3F, 0x3B, 0x13, 0xB4, 0xAF,
+        0x7E, 0xD9, 0x96, 0xF9, 0x1F, 0xB2, 0xA5, 0xBF, 0x2E, 0x00, 0xE7,
+        0x4D, 0xB7, 0x5F, 0x19, 0x55, 0x57, 0xE0, 0x37, 0x18, 0x2F, 0xD6,
+        0x7A, 0xD0, 0xE8, 0x81, 0x5F, 0x11, 0x2D, 0x97, 0x34, 0xAD, 0xA2,
+        0x03, 0xE4, 0x19, 0x80, 0xA7, 0xCE, 0x1F, 0x90, 0xFE, 0x29, 0x3C,
+        0x86, 0xC6, 0x1B, 0xC4, 0x57, 0x38, 0x79, 0xAE, 0xEC, 0xED, 0xD0};
+    uint8_t out_x[ECC_SECP521R1_BYTESIZE] __attribute__((aligned(8)));
+    uint8_t out_y[ECC_SECP521R1_BYTESIZE] __attribute__((aligned(8)));
+    uint8_t compressed[ECC_POINT_COMPRESSED_BYTESIZE(ECC_SECP521R1_BYTESIZE)];
+    size_t compressed_len = sizeof(compressed);
+
+    ecc_affine_const_point_t point = {.x = point_x, .y = point_y};
+    ecc_affine_point_t out = {.x = out_x, .y = out_y};
+
+    result = soft_ecc_point_compress(&scl, &ecc_secp521r1, &point, compressed,
+                                     &compressed_len);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(sizeof(compressed) == compressed_len);
+    TEST_ASSERT_TRUE(ECC_POINT_COMPRESSED_ODD == compressed[0]);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_x, &compressed[1], sizeof(point_x));
+
+    result = soft_ecc_point_decompress(&scl, &ecc_secp521r1, compressed,
+                                       compressed_len, &out);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_x, out_x, sizeof(point_x));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_y, out_y, sizeof(point_y));
+
+    /* round trip of the even point */
+    point.y = point_y_even;
+    compressed_len = sizeof(compressed);
+
+    result = soft_ecc_point_compress(&scl, &ecc_secp521r1, &point, compressed,
+                                     &compressed_len);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(ECC_POINT_COMPRESSED_EVEN == compressed[0]);
+
+    result = soft_ecc_point_decompress(&scl, &ecc_secp521r1, compressed,
+                                       compressed_len, &out);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_x, out_x, sizeof(point_x));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(point_y_even, out_y, sizeof(point_y_even));
+}
+
+TEST(soft_ecc_keygen, soft_ecc_point_decompress_secp256r1_even)
+{
+    int32_t result;
+
+    uint8_t compressed[ECC_POINT_COMPRESSED_BYTESIZE(ECC_SECP256R1_BYTESIZE)] =
+        {ECC_POINT_COMPRESSED_EVEN,
+         0x8E, 0x86, 0xD5, 0x64, 0x37, 0x7A, 0x28, 0xB6, 0x84, 0xC4, 0x62,
+         0x03, 0x42, 0xAF, 0xD8, 0x3B, 0x89, 0x4A, 0x05, 0xB9, 0x15, 0x6F,
+         0xF7, 0x21, 0xA2, 0x41, 0x00, 0x4F, 0xDE, 0x78, 0x69, 0x41};
+    static const uint8_t expected_y[ECC_SECP256R1_BYTESIZE] = {
+        0x1F, 0xE5, 0x83, 0x1B, 0x16, 0xE6, 0x79, 0xEE, 0x26, 0x55, 0xBC,
+        0x3D, 0xE1, 0xC5, 0x4B, 0xFF, 0x93, 0x9D, 0xC3, 0x6D, 0x9E, 0x43,
+        0x17, 0x39, 0x56, 0x40, 0xD8, 0x70, 0xF8, 0x17, 0x63, 0xCE};
+    uint8_t out_x[ECC_SECP256R1_BYTESIZE] __attribute__((aligned(8)));
+    uint8_t out_y[ECC_SECP256R1_BYTESIZE] __attribute__((aligned(8)));
+
+    ecc_affine_point_t out = {.x = out_x, .y = out_y};
+
+    result = soft_ecc_point_decompress(&scl, &ecc_secp256r1, compressed,
+                                       sizeof(compressed), &out);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(&compressed[1], out_x, sizeof(out_x));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_y, out_y, sizeof(expected_y));
+}
+
+TEST(soft_ecc_keygen, soft_ecc_point_decompress_custom_curve)
+{
+    int32_t result;
+
+    /* secp384r1 parameters, but not identified as such */
+    ecc_curve_t curve = ecc_secp384r1;
+
+    uint8_t compressed[ECC_POINT_COMPRESSED_BYTESIZE(ECC_SECP384R1_BYTESIZE)] =
+        {ECC_POINT_COMPRESSED_ODD,
+         0x9F, 0xEB, 0x83, 0x1B, 0xD0, 0x37, 0x7E, 0xD4, 0x73, 0x78, 0x14, 0x6D,
+         0xF3, 0x64, 0x02, 0xCA, 0x77, 0x97, 0xBF, 0x39, 0x15, 0xF5, 0x43, 0x49,
+         0x3B, 0x28, 0x17, 0x6D, 0x69, 0x33, 0xCF, 0xE9, 0x61, 0xA2, 0xA3, 0xB3,
+         0xEC, 0x03, 0xE4, 0x88, 0xEC, 0x2C, 0xAB, 0x7B, 0x3C, 0xD4, 0x9B, 0xC0,
+        };
+    static const uint8_t expected_y[ECC_SECP384R1_BYTESIZE] = {
+        0x81, 0xC4, 0x0F, 0x80, 0xB9, 0x12, 0xCE, 0x62, 0x0F, 0x49, 0x1A, 0xC2,
+        0x7A, 0x2F, 0x47, 0xFF, 0x7C, 0xB9, 0xE5, 0xA7, 0x14, 0x81, 0xEF, 0x0F,
+        0xC5, 0xF3, 0xFD, 0x0C, 0x1E, 0xBE, 0x47, 0x41, 0x45, 0xD0, 0xE7, 0x55,
+        0x6E, 0x0D, 0x58, 0xF8, 0xC3, 0xB5, 0x5B, 0x34, 0xFD, 0xE7, 0x0D, 0x29};
+    uint8_t out_x[ECC_SECP384R1_BYTESIZE] __attribute__((aligned(8)));
+    uint8_t out_y[ECC_SECP384R1_BYTESIZE] __attribute__((aligned(8)));
+
+    ecc_affine_point_t out = {.x = out_x, .y = out_y};
+
+    curve.curve = ECC_UNKNOWN_CURVE;
+
+    result = soft_ecc_point_decompress(&scl, &curve, compressed,
+                                       sizeof(compressed), &out);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_y, out_y, sizeof(expected_y));
+}
+
+TEST(soft_ecc_keygen, soft_ecc_point_decompress_secp256r1_failure)
+{
+    int32_t result;
+
+    uint8_t compressed[ECC_POINT_COMPRESSED_BYTESIZE(ECC_SECP256R1_BYTESIZE)] =
+        {0};
+    uint8_t out_x[ECC_SECP256R1_BYTESIZE] __attribute__((aligned(8)));
+    uint8_t out_y[ECC_SECP256R1_BYTESIZE] __attribute__((aligned(8)));
+
+    ecc_affine_point_t out = {.x = out_x, .y = out_y};
+
+    compressed[ECC_SECP256R1_BYTESIZE] = 1;
+
+    /* invalid prefix */
+    result = soft_ecc_point_decompress(&scl, &ecc_secp256r1, compressed,
+                                       sizeof(compressed), &out);
+
+    TEST_ASSERT_TRUE(SCL_ERR_POINT == result);
+
+    /* x = 1 is not the abscissa of a point of secp256r1 */
+    compressed[0] = ECC_POINT_COMPRESSED_EVEN;
+
+    result = soft_ecc_point_decompress(&scl, &ecc_secp256r1, compressed,
+                                       sizeof(compressed), &out);
+
+    TEST_ASSERT_TRUE(SCL_ERR_POINT == result);
+
+    result = soft_ecc_point_decompress(&scl, &ecc_secp256r1, compressed,
+                                       sizeof(compressed) - 1, &out);
+
+    TEST_ASSERT_TRUE(SCL_INVALID_LENGTH == result);
+}
+
+TEST(soft_ecc_keygen, soft_ecc_point_decompress_secp384r1_failure)
+{
+    int32_t result;
+
+    uint8_t compressed[ECC_POINT_COMPRESSED_BYTESIZE(ECC_SECP384R1_BYTESIZE)] =
+        {0};
+    uint8_t out_x[ECC_SECP384R1_BYTESIZE] __attribute__((aligned(8)));
+    uint8_t out_y[ECC_SECP384R1_BYTESIZE] __attribute__((aligned(8)));
+
+    ecc_affine_point_t out = {.x = out_x, .y = out_y};
+
+    /* x = 1: x^3 - 3x + b is not a quadratic residue mod p */
+    compressed[0] = ECC_POINT_COMPRESSED_ODD;
+    compressed[ECC_SECP384R1_BYTESIZE] = 1;
+
+    result = soft_ecc_point_decompress(&scl, &ecc_secp384r1, compressed,
+                                       sizeof(compressed), &out);
+
+    TEST_ASSERT_TRUE(SCL_ERR_POINT == result);
+
+    compressed[0] = ECC_POINT_COMPRESSED_EVEN;
+
+    result = soft_ecc_point_decompress(&scl, &ecc_secp384r1, compressed,
+                                       sizeof(compressed), &out);
+
+    TEST_ASSERT_TRUE(SCL_ERR_POINT == result);
+}
+
+TEST(soft_ecc_keygen, soft_ecc_point_decompress_secp521r1_failure)
+{
+    int32_t result;
+
+    uint8_t compressed[ECC_POINT_COMPRESSED_BYTESIZE(ECC_SECP521R1_BYTESIZE)] =
+        {0};
+    uint8_t out_x[ECC_SECP521R1_BYTESIZE] __attribute__((aligned(8)));
+    uint8_t out_y[ECC_SECP521R1_BYTESIZE] __attribute__((aligned(8)));
+
+    ecc_affine_point_t out = {.x = out_x, .y = out_y};
+
+    /* x = 3: x^3 - 3x + b is not a quadratic residue mod p */
+    compressed[0] = ECC_POINT_COMPRESSED_ODD;
+    compressed[ECC_SECP521R1_BYTESIZE] = 3;
+
+    result = soft_ecc_point_decompress(&scl, &ecc_secp521r1, compressed,
+                                       sizeof(compressed), &out);
+
+    TEST_ASSERT_TRUE(SCL_ERR_POINT == result);
+
+    compressed[0] = ECC_POINT_COMPRESSED_EVEN;
+
+    result = soft_ecc_point_decompress(&scl, &ecc_secp521r1, compressed,
+                                       sizeof(compressed), &out);
+
+    TEST_ASSERT_TRUE(SCL_ERR_POINT == result);
+}
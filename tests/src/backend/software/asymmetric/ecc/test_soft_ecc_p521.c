@@ -0,0 +1,135 @@
+/**
+ * @file test_soft_ecc_p521.c
+ * @brief test suite for soft_ecc_p521.c
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include <backend/software/scl_soft.h>
+
+TEST_GROUP(soft_ecc_p521);
+
+TEST_SETUP(soft_ecc_p521) {}
+
+TEST_TEAR_DOWN(soft_ecc_p521) {}
+
+TEST(soft_ecc_p521, soft_ecc_p521_mult)
+{
+    uint32_t a[ECC_SECP521R1_32B_WORDS_SIZE] __attribute__((aligned(8))) = {
+        0x9abcdef0, 0x02345678, 0x89abcdef, 0xf0234567, 0x789abcde, 0xef023456,
+        0x6789abcd, 0xdef02345, 0x56789abc, 0xcdef0234, 0x456789ab, 0xbcdef023,
+        0x3456789a, 0xabcdef02, 0x23456789, 0x00000001, 0x00000000};
+
+    uint32_t b[ECC_SECP521R1_32B_WORDS_SIZE] __attribute__((aligned(8))) = {
+        0x87654321, 0x0fedcba9, 0x87654321, 0x0fedcba9, 0x87654321, 0x0fedcba9,
+        0x87654321, 0x0fedcba9, 0x87654321, 0x0fedcba9, 0x87654321, 0x0fedcba9,
+        0x87654321, 0x0fedcba9, 0x87654321, 0x0fedcba9, 0x00000000};
+
+    static const uint32_t expected[ECC_SECP521R1_32B_WORDS_SIZE] = {
+        0x5bc7e8fb, 0x51a059d9, 0x0795d90c, 0x63ee4163, 0xa252b80d, 0x75131fdb,
+        0x2bfe85fd, 0x76256dc3, 0xa49942dc, 0x663692a1, 0x8c22eeaa, 0x4537a4ef,
+        0x6a9b8967, 0x1327b614, 0xa0031313, 0xe5396b7c, 0x0000005d};
+
+    uint32_t out[ECC_SECP521R1_32B_WORDS_SIZE] __attribute__((aligned(8)));
+
+    soft_ecc_p521_fe_t fe_a, fe_b;
+
+    soft_ecc_p521_from_bignum((uint64_t *)a, &fe_a);
+    soft_ecc_p521_from_bignum((uint64_t *)b, &fe_b);
+
+    soft_ecc_p521_mult(&fe_a, &fe_b, &fe_a);
+    soft_ecc_p521_to_bignum(&fe_a, (uint64_t *)out);
+
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(expected, out, ECC_SECP521R1_32B_WORDS_SIZE);
+
+    /* a * a^-1 = 1 */
+    soft_ecc_p521_inv(&fe_a, &fe_b);
+    soft_ecc_p521_mult(&fe_a, &fe_b, &fe_b);
+    soft_ecc_p521_to_bignum(&fe_b, (uint64_t *)out);
+
+    TEST_ASSERT_EQUAL_HEX32(1, out[0]);
+    TEST_ASSERT_EACH_EQUAL_HEX32(0, &out[1], ECC_SECP521R1_32B_WORDS_SIZE - 1);
+}
+
+TEST(soft_ecc_p521, soft_ecc_p521_full_reduction)
+{
+    uint32_t p_minus_1[ECC_SECP521R1_32B_WORDS_SIZE]
+        __attribute__((aligned(8)));
+    uint32_t out[ECC_SECP521R1_32B_WORDS_SIZE] __attribute__((aligned(8)));
+
+    soft_ecc_p521_fe_t fe_a, fe_b;
+
+    memcpy(p_minus_1, ecc_secp521r1.p, sizeof(p_minus_1));
+    p_minus_1[0]--;
+
+    soft_ecc_p521_from_bignum((uint64_t *)p_minus_1, &fe_a);
+
+    /* (p - 1) + (p - 1) = p - 2 */
+    soft_ecc_p521_add(&fe_a, &fe_a, &fe_b);
+    soft_ecc_p521_to_bignum(&fe_b, (uint64_t *)out);
+    p_minus_1[0]--;
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(p_minus_1, out,
+                                  ECC_SECP521R1_32B_WORDS_SIZE);
+
+    /* (p - 1) - (p - 1) = 0, from a non reduced 4.p */
+    soft_ecc_p521_sub(&fe_a, &fe_a, &fe_b);
+    soft_ecc_p521_to_bignum(&fe_b, (uint64_t *)out);
+    TEST_ASSERT_EACH_EQUAL_HEX32(0, out, ECC_SECP521R1_32B_WORDS_SIZE);
+
+    /* (p - 1)^2 = 1 */
+    soft_ecc_p521_square(&fe_a, &fe_b);
+    soft_ecc_p521_to_bignum(&fe_b, (uint64_t *)out);
+    TEST_ASSERT_EQUAL_HEX32(1, out[0]);
+    TEST_ASSERT_EACH_EQUAL_HEX32(0, &out[1], ECC_SECP521R1_32B_WORDS_SIZE - 1);
+}
+
+TEST(soft_ecc_p521, soft_ecc_p521_double_generator)
+{
+    int32_t result;
+
+    uint32_t x[ECC_SECP521R1_32B_WORDS_SIZE] __attribute__((aligned(8)));
+    uint32_t y[ECC_SECP521R1_32B_WORDS_SIZE] __attribute__((aligned(8)));
+    uint32_t z[ECC_SECP521R1_32B_WORDS_SIZE] __attribute__((aligned(8)));
+
+    static const uint32_t expected_x[ECC_SECP521R1_32B_WORDS_SIZE] = {
+        0xba6d783d, 0xf43e3933, 0xd60fd967, 0xcf2fa364, 0x35c5af41, 0xaa104a3a,
+        0x6ef55507, 0xb3b204da, 0xd769be97, 0x2c6e5505, 0x1ccc0635, 0x7403279b,
+        0x48c28274, 0x2fcb2881, 0x277e7e68, 0x3c219024, 0x00000043};
+
+    static const uint32_t expected_y[ECC_SECP521R1_32B_WORDS_SIZE] = {
+        0x61f41b02, 0x1be356d6, 0xedc0f4f7, 0xeafcbe95, 0x9a3248f4, 0x93937fa9,
+        0x9f251f6b, 0xb3e377de, 0x06c42dbb, 0xab21a299, 0x4da97740, 0xc6b5107c,
+        0xeed3f0b5, 0xa7f3ecee, 0x6db26700, 0xbb8cc7f8, 0x000000f4};
+
+    ecc_bignum_jacobian_point_t point = {
+        .x = (uint64_t *)x, .y = (uint64_t *)y, .z = (uint64_t *)z};
+    ecc_bignum_affine_point_t point_aff = {.x = (uint64_t *)x,
+                                           .y = (uint64_t *)y};
+
+    memcpy(x, ecc_secp521r1.g->x, sizeof(x));
+    memcpy(y, ecc_secp521r1.g->y, sizeof(y));
+    memset(z, 0, sizeof(z));
+    z[0] = 1;
+
+    /* 2.G */
+    soft_ecc_p521_double_jacobian(&point, &point);
+
+    result = soft_ecc_p521_jacobian_to_affine(&point, &point_aff);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(expected_x, x, ECC_SECP521R1_32B_WORDS_SIZE);
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(expected_y, y, ECC_SECP521R1_32B_WORDS_SIZE);
+
+    /* the infinite has no affine coordinates */
+    memset(z, 0, sizeof(z));
+    result = soft_ecc_p521_jacobian_to_affine(&point, &point_aff);
+    TEST_ASSERT_TRUE(SCL_INVALID_INPUT == result);
+}
@@ -0,0 +1,111 @@
+/**
+ * @file test_soft_ecc_scalar.c
+ * @brief test suite for soft_ecc_scalar.c
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include <backend/software/scl_soft.h>
+
+TEST_GROUP(soft_ecc_scalar);
+
+TEST_SETUP(soft_ecc_scalar) {}
+
+TEST_TEAR_DOWN(soft_ecc_scalar) {}
+
+TEST(soft_ecc_scalar, soft_ecc_scalar_secp256r1)
+{
+    int32_t result;
+
+    /* 2^256 - 1, greater than n */
+    uint32_t a[ECC_SECP256R1_32B_WORDS_SIZE] __attribute__((aligned(8))) = {
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff};
+
+    uint32_t b[ECC_SECP256R1_32B_WORDS_SIZE] __attribute__((aligned(8))) = {
+        0xbd69fe29, 0xa6eb8c9e, 0xec1d7da0, 0x87b0b125,
+        0x076ce2ef, 0xd7210dff, 0x77330bdb, 0x63529c3b};
+
+    static const uint32_t expected_a_mod_n[ECC_SECP256R1_32B_WORDS_SIZE] = {
+        0x039cdaae, 0x0c46353d, 0x58e8617b, 0x43190552,
+        0x00000000, 0x00000000, 0xffffffff, 0x00000000};
+
+    static const uint32_t expected_ab[ECC_SECP256R1_32B_WORDS_SIZE] = {
+        0x718d8d0b, 0x3f843771, 0x208f152d, 0x2047a4a7,
+        0x8b68f032, 0x6004dc45, 0xa66bdc9c, 0x0491b30a};
+
+    static const uint32_t expected_b_inv[ECC_SECP256R1_32B_WORDS_SIZE] = {
+        0x6a76d8a6, 0x0effcf88, 0xe992f147, 0xa8d66f98,
+        0xf209332e, 0x3d0e5f5b, 0x8e732e1a, 0xbb866eac};
+
+    uint32_t out[ECC_SECP256R1_32B_WORDS_SIZE] __attribute__((aligned(8)));
+    uint32_t out_2[ECC_SECP256R1_32B_WORDS_SIZE] __attribute__((aligned(8)));
+
+    TEST_ASSERT_TRUE(soft_ecc_scalar_supported(&ecc_secp256r1));
+
+    soft_ecc_scalar_reduce(&ecc_secp256r1, (uint64_t *)a, (uint64_t *)out);
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(expected_a_mod_n, out,
+                                  ECC_SECP256R1_32B_WORDS_SIZE);
+
+    soft_ecc_scalar_mult(&ecc_secp256r1, (uint64_t *)a, (uint64_t *)b,
+                         (uint64_t *)out);
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(expected_ab, out,
+                                  ECC_SECP256R1_32B_WORDS_SIZE);
+
+    result = soft_ecc_scalar_inv(&ecc_secp256r1, (uint64_t *)b,
+                                 (uint64_t *)out);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(expected_b_inv, out,
+                                  ECC_SECP256R1_32B_WORDS_SIZE);
+
+    /* (b - a mod n) + a mod n = b */
+    soft_ecc_scalar_sub(&ecc_secp256r1, (uint64_t *)b,
+                        (const uint64_t *)expected_a_mod_n, (uint64_t *)out);
+    soft_ecc_scalar_add(&ecc_secp256r1, (uint64_t *)out,
+                        (const uint64_t *)expected_a_mod_n, (uint64_t *)out_2);
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(b, out_2, ECC_SECP256R1_32B_WORDS_SIZE);
+
+    /* 0 is not invertible */
+    memset(a, 0, sizeof(a));
+    result = soft_ecc_scalar_inv(&ecc_secp256r1, (uint64_t *)a,
+                                 (uint64_t *)out);
+    TEST_ASSERT_TRUE(SCL_INVALID_INPUT == result);
+}
+
+TEST(soft_ecc_scalar, soft_ecc_scalar_secp521r1_inv)
+{
+    int32_t result;
+
+    uint32_t a[ECC_SECP521R1_32B_WORDS_SIZE] __attribute__((aligned(8))) = {
+        0x3dd6a759, 0x0d72c4db, 0x094e5b49, 0x5a24e40f, 0x018478ca, 0xa8c364b3,
+        0xdf6c4db3, 0x6a9a42f3, 0x7814e8b3, 0xde527100, 0x3f1f65a8, 0x617959ce,
+        0x8b33e968, 0x1a1afe87, 0x92edcf45, 0x3fd42359, 0x00000000};
+
+    static const uint32_t expected[ECC_SECP521R1_32B_WORDS_SIZE] = {
+        0xbacde32f, 0x9de89aa7, 0x4262f3fc, 0x4be59a16, 0x3a7323b1, 0xae3035c5,
+        0x417107fb, 0xf4fa2dbf, 0xf8ba5915, 0xb5ae198f, 0x401c5b1a, 0xf140471c,
+        0x4cbed6e6, 0x67396f11, 0x64daf778, 0xd470b895, 0x00000183};
+
+    uint32_t out[ECC_SECP521R1_32B_WORDS_SIZE] __attribute__((aligned(8)));
+
+    TEST_ASSERT_TRUE(soft_ecc_scalar_supported(&ecc_secp521r1));
+
+    result = soft_ecc_scalar_inv(&ecc_secp521r1, (uint64_t *)a,
+                                 (uint64_t *)out);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(expected, out, ECC_SECP521R1_32B_WORDS_SIZE);
+
+    /* a * a^-1 = 1 */
+    soft_ecc_scalar_mult(&ecc_secp521r1, (uint64_t *)a, (uint64_t *)out,
+                         (uint64_t *)out);
+    TEST_ASSERT_EQUAL_HEX32(1, out[0]);
+    TEST_ASSERT_EACH_EQUAL_HEX32(0, &out[1], ECC_SECP521R1_32B_WORDS_SIZE - 1);
+}
@@ -53,11 +53,66 @@ CRYPTO_CONST_DATA static const metal_scl_t scl = {
             .set_modulus = soft_bignum_set_modulus,
             .mod_add = soft_bignum_mod_add,
             .mod_sub = soft_bignum_mod_sub,
+            .mod_add_lazy = soft_bignum_mod_add_lazy,
+            .mod_sub_lazy = soft_bignum_mod_sub_lazy,
             // .mod_sub = soft_ecc_mod_sub,
             .mod_mult = soft_bignum_mod_mult,
             .mod_inv = soft_bignum_mod_inv,
             .mod_square = soft_bignum_mod_square,
         },
+    .hash_func =
+        {
+            .sha_init = soft_sha_init,
+            .sha_core = soft_sha_core,
+            .sha_finish = soft_sha_finish,
+        },
+    .hmac_func =
+        {
+            .init = soft_hmac_init,
+            .core = soft_hmac_core,
+            .finish = soft_hmac_finish,
+        },
+};
+
+/* scl context without TRNG, for deterministic signatures */
+CRYPTO_CONST_DATA static const metal_scl_t scl_no_trng = {
+    .bignum_func =
+        {
+            .compare = soft_bignum_compare,
+            .compare_len_diff = soft_bignum_compare_len_diff,
+            .is_null = soft_bignum_is_null,
+            .negate = soft_bignum_negate,
+            .inc = soft_bignum_inc,
+            .add = soft_bignum_add,
+            .sub = soft_bignum_sub,
+            .mult = soft_bignum_mult,
+            .square = soft_bignum_square_with_mult,
+            .leftshift = soft_bignum_leftshift,
+            .rightshift = soft_bignum_rightshift,
+            .msb_set_in_word = soft_bignum_msb_set_in_word,
+            .get_msb_set = soft_bignum_get_msb_set,
+            .set_bit = soft_bignum_set_bit,
+            .div = soft_bignum_div,
+            .mod = soft_ecc_mod,
+            .set_modulus = soft_bignum_set_modulus,
+            .mod_add = soft_bignum_mod_add,
+            .mod_sub = soft_bignum_mod_sub,
+            .mod_mult = soft_bignum_mod_mult,
+            .mod_inv = soft_bignum_mod_inv,
+            .mod_square = soft_bignum_mod_square,
+        },
+    .hash_func =
+        {
+            .sha_init = soft_sha_init,
+            .sha_core = soft_sha_core,
+            .sha_finish = soft_sha_finish,
+        },
+    .hmac_func =
+        {
+            .init = soft_hmac_init,
+            .core = soft_hmac_core,
+            .finish = soft_hmac_finish,
+        },
 };
 
 int32_t get_data_for_test(const metal_scl_t *const scl_ctx, uint32_t *data_out)
@@ -1228,3 +1283,644 @@ TEST(soft_ecdsa, test_p521r1_curve_input_216B_sign)
 
     TEST_ASSERT_TRUE(SCL_OK == result);
 }
+
+/* Signature with precomputed nonces */
+
+TEST(soft_ecdsa, test_p256r1_curve_input_256B_sign_with_pool)
+{
+    int32_t result = 0;
+    ecdsa_nonce_t nonces[2];
+    ecdsa_nonce_pool_t pool;
+
+    static const uint8_t hash[SHA256_BYTE_HASHSIZE] = {
+        0xC0, 0xFD, 0x8D, 0x84, 0x7A, 0x77, 0xEE, 0x19, 0xC8, 0xFC, 0x93,
+        0x4A, 0x40, 0xE7, 0x72, 0x14, 0x68, 0x7D, 0x76, 0x4F, 0x18, 0x70,
+        0x54, 0x55, 0xA4, 0x20, 0x46, 0xAB, 0x35, 0x50, 0xB7, 0x44};
+
+    uint8_t signature_r[ECC_SECP256R1_BYTESIZE] = {0};
+    uint8_t signature_s[ECC_SECP256R1_BYTESIZE] = {0};
+
+    static const uint8_t expected_signature_r[ECC_SECP256R1_BYTESIZE] = {
+        0x7E, 0x44, 0xE9, 0x6E, 0x91, 0x23, 0x4B, 0xD1, 0xAE, 0xA4, 0x03,
+        0x46, 0xAE, 0x03, 0x15, 0x88, 0xEA, 0x33, 0xE6, 0x4E, 0x73, 0x4F,
+        0xE6, 0x41, 0x65, 0x1F, 0x46, 0xD4, 0x43, 0xFD, 0xEE, 0x3C};
+
+    static const uint8_t expected_signature_s[ECC_SECP256R1_BYTESIZE] = {
+        0xA7, 0xD9, 0x2A, 0xF9, 0x61, 0xB8, 0x50, 0x7B, 0xFA, 0x44, 0x0B,
+        0xD0, 0x26, 0x0F, 0x6A, 0x88, 0x1D, 0xB7, 0x0A, 0x7D, 0xA6, 0x41,
+        0x18, 0x90, 0xC6, 0x05, 0x1E, 0xD9, 0xBF, 0x3E, 0x90, 0x32};
+
+    static const uint8_t priv_key[ECC_SECP256R1_BYTESIZE] = {
+        0xD1, 0xCD, 0x56, 0x34, 0x1B, 0x55, 0x61, 0x9B, 0x32, 0x98, 0x67,
+        0xE3, 0x44, 0xF4, 0xF5, 0xD9, 0x7E, 0xEF, 0x63, 0x67, 0x92, 0x00,
+        0x2C, 0xA0, 0x47, 0x4B, 0x08, 0x27, 0x6B, 0x84, 0x76, 0x6F};
+
+    static const uint8_t pub_key_x[ECC_SECP256R1_BYTESIZE] = {
+        0x9E, 0x65, 0x9B, 0x34, 0x1E, 0x56, 0xCA, 0xE7, 0x07, 0xED, 0x7D,
+        0x6A, 0x6B, 0x05, 0x1E, 0x71, 0x53, 0xF2, 0x30, 0x72, 0x54, 0xDD,
+        0x1D, 0x39, 0x2F, 0xA9, 0xC5, 0xF6, 0xEC, 0x9A, 0x77, 0x2E};
+
+    static const uint8_t pub_key_y[ECC_SECP256R1_BYTESIZE] = {
+        0x2B, 0x2C, 0xF4, 0x82, 0x0F, 0xAF, 0xBF, 0x4E, 0x5A, 0xD8, 0x82,
+        0xFC, 0x88, 0x86, 0x3A, 0xEA, 0x07, 0x22, 0x96, 0x6D, 0x98, 0x4A,
+        0xB3, 0x6A, 0xD5, 0xE1, 0x98, 0xF3, 0x9A, 0x9C, 0xD3, 0x06};
+
+    ecdsa_signature_t signature = {.r = signature_r, .s = signature_s};
+    const ecc_affine_const_point_t pub_key = {.x = pub_key_x, .y = pub_key_y};
+
+    memset(&pool, 0, sizeof(pool));
+    pool.curve_params = &ecc_secp256r1;
+    memcpy(pool.priv_key, priv_key, sizeof(priv_key));
+    pool.nonces = nonces;
+    pool.nb_nonces = sizeof(nonces) / sizeof(nonces[0]);
+
+    result = soft_ecdsa_nonce_pool_fill(&scl, &pool, pool.nb_nonces);
+
+    TEST_ASSERT_TRUE(2 == result);
+    TEST_ASSERT_TRUE(2 == pool.nb_available);
+
+    result = soft_ecdsa_signature_with_pool(&scl, &ecc_secp256r1, priv_key,
+                                            &pool, &signature, hash,
+                                            sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(1 == pool.nb_available);
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_r, signature_r,
+                                 ECC_SECP256R1_BYTESIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_s, signature_s,
+                                 ECC_SECP256R1_BYTESIZE);
+
+    result = soft_ecdsa_verification(&scl, &ecc_secp256r1, &pub_key,
+                                     (ecdsa_signature_const_t *)&signature,
+                                     hash, sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+}
+
+TEST(soft_ecdsa, test_p384r1_curve_input_384B_sign_with_pool)
+{
+    int32_t result = 0;
+    ecdsa_nonce_t nonces[2];
+    ecdsa_nonce_pool_t pool;
+
+    static const uint8_t hash[SHA384_BYTE_HASHSIZE] = {
+        0xA9, 0xD6, 0x4C, 0x68, 0x5C, 0x1A, 0xD0, 0xEF, 0x4C, 0xCF, 0x88, 0xBA,
+        0x92, 0x53, 0x2E, 0xEF, 0x8C, 0x44, 0xD4, 0x84, 0x61, 0x94, 0x3A, 0xF7,
+        0x90, 0x8E, 0x21, 0x70, 0xEF, 0x76, 0x01, 0x99, 0x67, 0x11, 0x6C, 0x20,
+        0x6B, 0x96, 0x57, 0x09, 0x48, 0x62, 0xD4, 0xB4, 0xA5, 0x50, 0xF0, 0x9F};
+    uint8_t signature_r[ECC_SECP384R1_BYTESIZE] = {0};
+    uint8_t signature_s[ECC_SECP384R1_BYTESIZE] = {0};
+
+    static const uint8_t expected_signature_r[ECC_SECP384R1_BYTESIZE] = {
+        0xA0, 0x40, 0xF4, 0x78, 0x57, 0x49, 0x72, 0xA3, 0x8D, 0x2A, 0x97, 0x84,
+        0xE3, 0x52, 0x3C, 0x1D, 0xE2, 0xE5, 0x64, 0xED, 0x37, 0xC3, 0x44, 0xF9,
+        0x57, 0x1D, 0xBE, 0x72, 0x67, 0xF3, 0x53, 0xA6, 0x86, 0xAF, 0x60, 0xF2,
+        0x74, 0x5C, 0xA9, 0x57, 0x29, 0xFB, 0x90, 0x18, 0x56, 0x2F, 0x82, 0x19};
+
+    static const uint8_t expected_signature_s[ECC_SECP384R1_BYTESIZE] = {
+        0xB4, 0x37, 0xA4, 0x29, 0xCA, 0x22, 0xE9, 0xA7, 0x69, 0x90, 0x0D, 0x02,
+        0x41, 0x7E, 0xC8, 0xE9, 0xFA, 0xA9, 0x5E, 0xEE, 0x44, 0xDB, 0x18, 0xFA,
+        0xB6, 0xBF, 0x0C, 0x70, 0x94, 0xC7, 0xFE, 0x63, 0xA6, 0xEA, 0x36, 0x95,
+        0xBA, 0xDB, 0x03, 0xC7, 0x11, 0x55, 0xB2, 0x11, 0xB4, 0xC2, 0x3B, 0xD1};
+
+    static const uint8_t priv_key[ECC_SECP384R1_BYTESIZE] = {
+        0x81, 0x88, 0x9C, 0x86, 0xA2, 0x82, 0xB4, 0x15, 0xB2, 0xF4, 0x98, 0xE4,
+        0x4C, 0xA8, 0x79, 0xE6, 0x1B, 0x8C, 0xDF, 0x3F, 0x29, 0xA1, 0xE6, 0x70,
+        0x70, 0x19, 0xAD, 0x7D, 0xB6, 0x30, 0xC0, 0xAC, 0x95, 0xE6, 0xFE, 0xEB,
+        0xD5, 0x41, 0x85, 0x97, 0x68, 0x97, 0x0F, 0x65, 0x97, 0x66, 0x37, 0xE9};
+
+    static const uint8_t pub_key_x[ECC_SECP384R1_BYTESIZE] = {
+        0x74, 0xE2, 0xF1, 0x57, 0x4D, 0x8A, 0x64, 0x81, 0x27, 0xA6, 0xBD, 0xDE,
+        0x18, 0x4F, 0x6A, 0xF5, 0xF1, 0x4C, 0xF8, 0x75, 0x36, 0xD9, 0x8D, 0x02,
+        0x84, 0x46, 0x6F, 0xE4, 0x34, 0xF7, 0x64, 0x3D, 0xEA, 0xC9, 0x37, 0x6F,
+        0x14, 0x04, 0xC6, 0x50, 0x1C, 0xAC, 0xEA, 0x0B, 0x88, 0xB9, 0xE0, 0x22};
+    static const uint8_t pub_key_y[ECC_SECP384R1_BYTESIZE] = {
+        0xD2, 0x36, 0x70, 0x68, 0xF1, 0xDB, 0x4D, 0xE6, 0xB2, 0xE9, 0x03, 0x16,
+        0x2A, 0xB3, 0xC9, 0xA4, 0x14, 0x9D, 0x09, 0x11, 0x7B, 0x9E, 0x6E, 0x65,
+        0x83, 0x0F, 0xE1, 0x51, 0x81, 0x76, 0x9F, 0x08, 0xD1, 0xB1, 0x99, 0xCC,
+        0xA2, 0xC7, 0x88, 0x1B, 0x36, 0x1C, 0xF9, 0x33, 0x20, 0x90, 0x75, 0x7B};
+
+    ecdsa_signature_t signature = {.r = signature_r, .s = signature_s};
+    const ecc_affine_const_point_t pub_key = {.x = pub_key_x, .y = pub_key_y};
+
+    memset(&pool, 0, sizeof(pool));
+    pool.curve_params = &ecc_secp384r1;
+    memcpy(pool.priv_key, priv_key, sizeof(priv_key));
+    pool.nonces = nonces;
+    pool.nb_nonces = sizeof(nonces) / sizeof(nonces[0]);
+
+    result = soft_ecdsa_nonce_pool_fill(&scl, &pool, pool.nb_nonces);
+
+    TEST_ASSERT_TRUE(2 == result);
+    TEST_ASSERT_TRUE(2 == pool.nb_available);
+
+    result = soft_ecdsa_signature_with_pool(&scl, &ecc_secp384r1, priv_key,
+                                            &pool, &signature, hash,
+                                            sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(1 == pool.nb_available);
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_r, signature_r,
+                                 ECC_SECP384R1_BYTESIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_s, signature_s,
+                                 ECC_SECP384R1_BYTESIZE);
+
+    result = soft_ecdsa_verification(&scl, &ecc_secp384r1, &pub_key,
+                                     (ecdsa_signature_const_t *)&signature,
+                                     hash, sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+}
+
+TEST(soft_ecdsa, test_p521r1_curve_input_512B_sign_with_pool)
+{
+    int32_t result = 0;
+    ecdsa_nonce_t nonces[2];
+    ecdsa_nonce_pool_t pool;
+
+    static const uint8_t hash[SHA512_BYTE_HASHSIZE] = {
+        0x72, 0xE1, 0x40, 0xFC, 0x83, 0x09, 0x1C, 0x84, 0x0E, 0x9E, 0x9A,
+        0xD1, 0x14, 0x99, 0x6D, 0x64, 0x80, 0xD2, 0x71, 0xBC, 0xB8, 0x08,
+        0x2E, 0x3D, 0x32, 0x30, 0xC1, 0x94, 0x5D, 0xE9, 0x40, 0x47, 0xEA,
+        0x18, 0x67, 0xA5, 0x6D, 0x43, 0xA2, 0x04, 0x4F, 0x84, 0x93, 0x4B,
+        0x27, 0x9F, 0xD1, 0xA3, 0x04, 0x76, 0x59, 0x28, 0xB2, 0xCB, 0x43,
+        0x89, 0x56, 0xF6, 0xBF, 0xAA, 0x0B, 0x71, 0x17, 0xF0};
+
+    uint8_t signature_r[ECC_SECP521R1_BYTESIZE] = {0};
+    uint8_t signature_s[ECC_SECP521R1_BYTESIZE] = {0};
+
+    static const uint8_t expected_signature_r[ECC_SECP521R1_BYTESIZE] = {
+        0x00, 0x6D, 0x5C, 0xC9, 0x62, 0x39, 0xF4, 0x1A, 0xC9, 0x0E, 0x92,
+        0x1E, 0xAA, 0xFA, 0x74, 0x82, 0xAB, 0x18, 0xC2, 0x25, 0x09, 0x9F,
+        0xFE, 0x73, 0x0F, 0xEC, 0x44, 0xBC, 0xD0, 0x42, 0x43, 0x17, 0xC3,
+        0xBB, 0xE7, 0xA9, 0x95, 0x9C, 0xC7, 0xC3, 0xDF, 0x5F, 0x4F, 0x89,
+        0xEE, 0xF6, 0x73, 0xEC, 0x9D, 0xDA, 0xED, 0x9D, 0x89, 0xC9, 0x1F,
+        0x29, 0x9C, 0x86, 0xAD, 0xBD, 0xC3, 0x86, 0xC7, 0x92, 0x5A, 0xE1};
+    static const uint8_t expected_signature_s[ECC_SECP521R1_BYTESIZE] = {
+        0x00, 0xAE, 0x2E, 0x2A, 0x6B, 0x36, 0xD1, 0x7F, 0x0D, 0x7D, 0xD4,
+        0x49, 0xA7, 0x2F, 0x1B, 0x4E, 0xBB, 0x69, 0x15, 0x99, 0x18, 0x11,
+        0x4B, 0x53, 0xA5, 0xB7, 0x3E, 0xD1, 0xCC, 0x38, 0x0B, 0x3B, 0xD7,
+        0xAE, 0xD6, 0x02, 0x86, 0x37, 0xD3, 0x53, 0x68, 0xFE, 0xDB, 0x4F,
+        0x6B, 0xC6, 0x1C, 0x97, 0x1B, 0xF9, 0x80, 0xA6, 0xAF, 0x9E, 0x7D,
+        0x6C, 0xA9, 0x52, 0x64, 0x68, 0x75, 0xE1, 0xE6, 0x6E, 0x96, 0x9A};
+
+    static const uint8_t priv_key[ECC_SECP521R1_BYTESIZE] = {
+        0x00, 0x61, 0x60, 0xE2, 0x53, 0xDF, 0x77, 0xE9, 0xA3, 0x80, 0xB0,
+        0xFE, 0xD7, 0x7D, 0xF1, 0x84, 0x5A, 0x45, 0x1D, 0xE7, 0x84, 0x86,
+        0x4A, 0x9E, 0x79, 0x5B, 0xFD, 0xDD, 0x77, 0xA2, 0xC5, 0xC7, 0xE8,
+        0xFF, 0x98, 0x0B, 0x7F, 0x0D, 0x60, 0x59, 0xED, 0x2A, 0x8A, 0x5B,
+        0xF3, 0xAD, 0x8B, 0xAE, 0x54, 0x43, 0xCB, 0x9F, 0x3D, 0x12, 0xD4,
+        0x97, 0x4C, 0xDE, 0x61, 0x1A, 0x77, 0xA0, 0xD6, 0x33, 0xA4, 0xC0};
+
+    static const uint8_t pub_key_x[ECC_SECP521R1_BYTESIZE] = {
+        0x01, 0x51, 0xEA, 0x05, 0xD1, 0x11, 0x5F, 0x52, 0x25, 0xFE, 0xC7,
+        0x25, 0x3A, 0x48, 0x30, 0xAB, 0x6D, 0x7A, 0xD9, 0x3C, 0x46, 0x6A,
+        0x29, 0x45, 0x6A, 0x9A, 0xB8, 0xAA, 0x4B, 0x1F, 0x22, 0x18, 0x6B,
+        0xDE, 0xF1, 0xDF, 0x67, 0x66, 0xA3, 0x41, 0xF8, 0x93, 0x28, 0x1D,
+        0x2D, 0x54, 0x58, 0x49, 0xF9, 0xE9, 0xDA, 0x55, 0xC7, 0xFF, 0x80,
+        0xEB, 0xCD, 0xB0, 0x1A, 0x3C, 0x3E, 0x56, 0xA2, 0xC5, 0x27, 0xE5};
+
+    static const uint8_t pub_key_y[ECC_SECP521R1_BYTESIZE] = {
+        0x01, 0xA9, 0xDE, 0xCE, 0xF5, 0x45, 0x65, 0x3E, 0x35, 0x22, 0xD7,
+        0x4E, 0x04, 0x3D, 0xE2, 0xEB, 0xAE, 0x0F, 0x19, 0x77, 0xF6, 0xDF,
+        0x88, 0xA3, 0x08, 0x90, 0x49, 0xB1, 0x24, 0xD6, 0xD9, 0xEE, 0x1F,
+        0xBC, 0x56, 0x5C, 0xAE, 0xFF, 0x8D, 0xD5, 0x1A, 0x7A, 0x95, 0xFD,
+        0x50, 0x4C, 0x16, 0x9C, 0xDE, 0xFA, 0xD9, 0x23, 0xBA, 0x3C, 0xEB,
+        0x3A, 0x1D, 0x1E, 0x19, 0xEB, 0xCC, 0xC9, 0x1C, 0x45, 0x00, 0x20};
+
+    ecdsa_signature_t signature = {.r = signature_r, .s = signature_s};
+    const ecc_affine_const_point_t pub_key = {.x = pub_key_x, .y = pub_key_y};
+
+    memset(&pool, 0, sizeof(pool));
+    pool.curve_params = &ecc_secp521r1;
+    memcpy(pool.priv_key, priv_key, sizeof(priv_key));
+    pool.nonces = nonces;
+    pool.nb_nonces = sizeof(nonces) / sizeof(nonces[0]);
+
+    result = soft_ecdsa_nonce_pool_fill(&scl, &pool, pool.nb_nonces);
+
+    TEST_ASSERT_TRUE(2 == result);
+    TEST_ASSERT_TRUE(2 == pool.nb_available);
+
+    result = soft_ecdsa_signature_with_pool(&scl, &ecc_secp521r1, priv_key,
+                                            &pool, &signature, hash,
+                                            sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(1 == pool.nb_available);
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_r, signature_r,
+                                 ECC_SECP521R1_BYTESIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_s, signature_s,
+                                 ECC_SECP521R1_BYTESIZE);
+
+    result = soft_ecdsa_verification(&scl, &ecc_secp521r1, &pub_key,
+                                     (ecdsa_signature_const_t *)&signature,
+                                     hash, sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+}
+
+TEST(soft_ecdsa, test_p256r1_sign_with_empty_pool)
+{
+    int32_t result = 0;
+    ecdsa_nonce_t nonces[1];
+    ecdsa_nonce_pool_t pool;
+
+    static const uint8_t hash[SHA256_BYTE_HASHSIZE] = {
+        0xC0, 0xFD, 0x8D, 0x84, 0x7A, 0x77, 0xEE, 0x19, 0xC8, 0xFC, 0x93,
+        0x4A, 0x40, 0xE7, 0x72, 0x14, 0x68, 0x7D, 0x76, 0x4F, 0x18, 0x70,
+        0x54, 0x55, 0xA4, 0x20, 0x46, 0xAB, 0x35, 0x50, 0xB7, 0x44};
+
+    uint8_t signature_r[ECC_SECP256R1_BYTESIZE] = {0};
+    uint8_t signature_s[ECC_SECP256R1_BYTESIZE] = {0};
+
+    static const uint8_t expected_signature_r[ECC_SECP256R1_BYTESIZE] = {
+        0x7E, 0x44, 0xE9, 0x6E, 0x91, 0x23, 0x4B, 0xD1, 0xAE, 0xA4, 0x03,
+        0x46, 0xAE, 0x03, 0x15, 0x88, 0xEA, 0x33, 0xE6, 0x4E, 0x73, 0x4F,
+        0xE6, 0x41, 0x65, 0x1F, 0x46, 0xD4, 0x43, 0xFD, 0xEE, 0x3C};
+
+    static const uint8_t expected_signature_s[ECC_SECP256R1_BYTESIZE] = {
+        0xA7, 0xD9, 0x2A, 0xF9, 0x61, 0xB8, 0x50, 0x7B, 0xFA, 0x44, 0x0B,
+        0xD0, 0x26, 0x0F, 0x6A, 0x88, 0x1D, 0xB7, 0x0A, 0x7D, 0xA6, 0x41,
+        0x18, 0x90, 0xC6, 0x05, 0x1E, 0xD9, 0xBF, 0x3E, 0x90, 0x32};
+
+    static const uint8_t priv_key[ECC_SECP256R1_BYTESIZE] = {
+        0xD1, 0xCD, 0x56, 0x34, 0x1B, 0x55, 0x61, 0x9B, 0x32, 0x98, 0x67,
+        0xE3, 0x44, 0xF4, 0xF5, 0xD9, 0x7E, 0xEF, 0x63, 0x67, 0x92, 0x00,
+        0x2C, 0xA0, 0x47, 0x4B, 0x08, 0x27, 0x6B, 0x84, 0x76, 0x6F};
+
+    static const uint8_t pub_key_x[ECC_SECP256R1_BYTESIZE] = {
+        0x9E, 0x65, 0x9B, 0x34, 0x1E, 0x56, 0xCA, 0xE7, 0x07, 0xED, 0x7D,
+        0x6A, 0x6B, 0x05, 0x1E, 0x71, 0x53, 0xF2, 0x30, 0x72, 0x54, 0xDD,
+        0x1D, 0x39, 0x2F, 0xA9, 0xC5, 0xF6, 0xEC, 0x9A, 0x77, 0x2E};
+
+    static const uint8_t pub_key_y[ECC_SECP256R1_BYTESIZE] = {
+        0x2B, 0x2C, 0xF4, 0x82, 0x0F, 0xAF, 0xBF, 0x4E, 0x5A, 0xD8, 0x82,
+        0xFC, 0x88, 0x86, 0x3A, 0xEA, 0x07, 0x22, 0x96, 0x6D, 0x98, 0x4A,
+        0xB3, 0x6A, 0xD5, 0xE1, 0x98, 0xF3, 0x9A, 0x9C, 0xD3, 0x06};
+
+    ecdsa_signature_t signature = {.r = signature_r, .s = signature_s};
+    const ecc_affine_const_point_t pub_key = {.x = pub_key_x, .y = pub_key_y};
+
+    memset(&pool, 0, sizeof(pool));
+    pool.curve_params = &ecc_secp256r1;
+    memcpy(pool.priv_key, priv_key, sizeof(priv_key));
+    pool.nonces = nonces;
+    pool.nb_nonces = sizeof(nonces) / sizeof(nonces[0]);
+
+    /* no nonce precomputed, fallback on regular signature */
+    result = soft_ecdsa_signature_with_pool(&scl, &ecc_secp256r1, priv_key,
+                                            &pool, &signature, hash,
+                                            sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_r, signature_r,
+                                 ECC_SECP256R1_BYTESIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_s, signature_s,
+                                 ECC_SECP256R1_BYTESIZE);
+
+    result = soft_ecdsa_verification(&scl, &ecc_secp256r1, &pub_key,
+                                     (ecdsa_signature_const_t *)&signature,
+                                     hash, sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+}
+
+TEST(soft_ecdsa, test_p256r1_sign_with_pool_wrong_binding)
+{
+    int32_t result = 0;
+    ecdsa_nonce_t nonces[1];
+    ecdsa_nonce_pool_t pool;
+
+    static const uint8_t hash[SHA256_BYTE_HASHSIZE] = {
+        0xC0, 0xFD, 0x8D, 0x84, 0x7A, 0x77, 0xEE, 0x19, 0xC8, 0xFC, 0x93,
+        0x4A, 0x40, 0xE7, 0x72, 0x14, 0x68, 0x7D, 0x76, 0x4F, 0x18, 0x70,
+        0x54, 0x55, 0xA4, 0x20, 0x46, 0xAB, 0x35, 0x50, 0xB7, 0x44};
+
+    uint8_t signature_r[ECC_SECP256R1_BYTESIZE] = {0};
+    uint8_t signature_s[ECC_SECP256R1_BYTESIZE] = {0};
+
+    static const uint8_t priv_key[ECC_SECP256R1_BYTESIZE] = {
+        0xD1, 0xCD, 0x56, 0x34, 0x1B, 0x55, 0x61, 0x9B, 0x32, 0x98, 0x67,
+        0xE3, 0x44, 0xF4, 0xF5, 0xD9, 0x7E, 0xEF, 0x63, 0x67, 0x92, 0x00,
+        0x2C, 0xA0, 0x47, 0x4B, 0x08, 0x27, 0x6B, 0x84, 0x76, 0x6F};
+
+    uint8_t other_priv_key[ECC_SECP256R1_BYTESIZE];
+
+    ecdsa_signature_t signature = {.r = signature_r, .s = signature_s};
+
+    memcpy(other_priv_key, priv_key, sizeof(priv_key));
+    other_priv_key[ECC_SECP256R1_BYTESIZE - 1] ^= 1;
+
+    memset(&pool, 0, sizeof(pool));
+    pool.curve_params = &ecc_secp256r1;
+    memcpy(pool.priv_key, priv_key, sizeof(priv_key));
+    pool.nonces = nonces;
+    pool.nb_nonces = sizeof(nonces) / sizeof(nonces[0]);
+
+    result = soft_ecdsa_nonce_pool_fill(&scl, &pool, pool.nb_nonces);
+
+    TEST_ASSERT_TRUE(1 == result);
+
+    result = soft_ecdsa_signature_with_pool(&scl, &ecc_secp256r1,
+                                            other_priv_key, &pool, &signature,
+                                            hash, sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_INVALID_INPUT == result);
+
+    result = soft_ecdsa_signature_with_pool(&scl, &ecc_secp384r1, priv_key,
+                                            &pool, &signature, hash,
+                                            sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_INVALID_INPUT == result);
+
+    /* the nonce shall not have been consumed */
+    TEST_ASSERT_TRUE(1 == pool.nb_available);
+}
+
+/* Signature with deterministic nonces */
+TEST(soft_ecdsa, test_p256r1_sign_deterministic_rfc6979)
+{
+    int32_t result = 0;
+
+    /* RFC 6979 A.2 with message "sample" */
+    static const uint8_t hash[SHA256_BYTE_HASHSIZE] = {
+        0xAF, 0x2B, 0xDB, 0xE1, 0xAA, 0x9B, 0x6E, 0xC1, 0xE2, 0xAD, 0xE1,
+        0xD6, 0x94, 0xF4, 0x1F, 0xC7, 0x1A, 0x83, 0x1D, 0x02, 0x68, 0xE9,
+        0x89, 0x15, 0x62, 0x11, 0x3D, 0x8A, 0x62, 0xAD, 0xD1, 0xBF};
+
+    uint8_t signature_r[ECC_SECP256R1_BYTESIZE] = {0};
+    uint8_t signature_s[ECC_SECP256R1_BYTESIZE] = {0};
+
+    static const uint8_t expected_signature_r[ECC_SECP256R1_BYTESIZE] = {
+        0xEF, 0xD4, 0x8B, 0x2A, 0xAC, 0xB6, 0xA8, 0xFD, 0x11, 0x40, 0xDD,
+        0x9C, 0xD4, 0x5E, 0x81, 0xD6, 0x9D, 0x2C, 0x87, 0x7B, 0x56, 0xAA,
+        0xF9, 0x91, 0xC3, 0x4D, 0x0E, 0xA8, 0x4E, 0xAF, 0x37, 0x16};
+
+    static const uint8_t expected_signature_s[ECC_SECP256R1_BYTESIZE] = {
+        0xF7, 0xCB, 0x1C, 0x94, 0x2D, 0x65, 0x7C, 0x41, 0xD4, 0x36, 0xC7,
+        0xA1, 0xB6, 0xE2, 0x9F, 0x65, 0xF3, 0xE9, 0x00, 0xDB, 0xB9, 0xAF,
+        0xF4, 0x06, 0x4D, 0xC4, 0xAB, 0x2F, 0x84, 0x3A, 0xCD, 0xA8};
+
+    static const uint8_t priv_key[ECC_SECP256R1_BYTESIZE] = {
+        0xC9, 0xAF, 0xA9, 0xD8, 0x45, 0xBA, 0x75, 0x16, 0x6B, 0x5C, 0x21,
+        0x57, 0x67, 0xB1, 0xD6, 0x93, 0x4E, 0x50, 0xC3, 0xDB, 0x36, 0xE8,
+        0x9B, 0x12, 0x7B, 0x8A, 0x62, 0x2B, 0x12, 0x0F, 0x67, 0x21};
+
+    static const uint8_t pub_key_x[ECC_SECP256R1_BYTESIZE] = {
+        0x60, 0xFE, 0xD4, 0xBA, 0x25, 0x5A, 0x9D, 0x31, 0xC9, 0x61, 0xEB,
+        0x74, 0xC6, 0x35, 0x6D, 0x68, 0xC0, 0x49, 0xB8, 0x92, 0x3B, 0x61,
+        0xFA, 0x6C, 0xE6, 0x69, 0x62, 0x2E, 0x60, 0xF2, 0x9F, 0xB6};
+
+    static const uint8_t pub_key_y[ECC_SECP256R1_BYTESIZE] = {
+        0x79, 0x03, 0xFE, 0x10, 0x08, 0xB8, 0xBC, 0x99, 0xA4, 0x1A, 0xE9,
+        0xE9, 0x56, 0x28, 0xBC, 0x64, 0xF2, 0xF1, 0xB2, 0x0C, 0x2D, 0x7E,
+        0x9F, 0x51, 0x77, 0xA3, 0xC2, 0x94, 0xD4, 0x46, 0x22, 0x99};
+
+    ecdsa_signature_t signature = {.r = signature_r, .s = signature_s};
+    const ecc_affine_const_point_t pub_key = {.x = pub_key_x, .y = pub_key_y};
+
+    /* no TRNG is required in deterministic mode */
+    result = soft_ecdsa_signature_with_nonce_mode(
+        &scl_no_trng, &ecc_secp256r1, priv_key, &signature, hash, sizeof(hash),
+        SCL_ECDSA_NONCE_DETERMINISTIC);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_r, signature_r,
+                                 ECC_SECP256R1_BYTESIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_s, signature_s,
+                                 ECC_SECP256R1_BYTESIZE);
+
+    result = soft_ecdsa_verification(&scl, &ecc_secp256r1, &pub_key,
+                                     (ecdsa_signature_const_t *)&signature,
+                                     hash, sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+}
+
+TEST(soft_ecdsa, test_p384r1_sign_deterministic_rfc6979)
+{
+    int32_t result = 0;
+
+    /* RFC 6979 A.2 with message "sample" */
+    static const uint8_t hash[SHA384_BYTE_HASHSIZE] = {
+        0x9A, 0x90, 0x83, 0x50, 0x5B, 0xC9, 0x22, 0x76, 0xAE, 0xC4, 0xBE, 0x31,
+        0x26, 0x96, 0xEF, 0x7B, 0xF3, 0xBF, 0x60, 0x3F, 0x4B, 0xBD, 0x38, 0x11,
+        0x96, 0xA0, 0x29, 0xF3, 0x40, 0x58, 0x53, 0x12, 0x31, 0x3B, 0xCA, 0x4A,
+        0x9B, 0x5B, 0x89, 0x0E, 0xFE, 0xE4, 0x2C, 0x77, 0xB1, 0xEE, 0x25, 0xFE};
+
+    uint8_t signature_r[ECC_SECP384R1_BYTESIZE] = {0};
+    uint8_t signature_s[ECC_SECP384R1_BYTESIZE] = {0};
+
+    static const uint8_t expected_signature_r[ECC_SECP384R1_BYTESIZE] = {
+        0x94, 0xED, 0xBB, 0x92, 0xA5, 0xEC, 0xB8, 0xAA, 0xD4, 0x73, 0x6E, 0x56,
+        0xC6, 0x91, 0x91, 0x6B, 0x3F, 0x88, 0x14, 0x06, 0x66, 0xCE, 0x9F, 0xA7,
+        0x3D, 0x64, 0xC4, 0xEA, 0x95, 0xAD, 0x13, 0x3C, 0x81, 0xA6, 0x48, 0x15,
+        0x2E, 0x44, 0xAC, 0xF9, 0x6E, 0x36, 0xDD, 0x1E, 0x80, 0xFA, 0xBE, 0x46};
+
+    static const uint8_t expected_signature_s[ECC_SECP384R1_BYTESIZE] = {
+        0x99, 0xEF, 0x4A, 0xEB, 0x15, 0xF1, 0x78, 0xCE, 0xA1, 0xFE, 0x40, 0xDB,
+        0x26, 0x03, 0x13, 0x8F, 0x13, 0x0E, 0x74, 0x0A, 0x19, 0x62, 0x45, 0x26,
+        0x20, 0x3B, 0x63, 0x51, 0xD0, 0xA3, 0xA9, 0x4F, 0xA3, 0x29, 0xC1, 0x45,
+        0x78, 0x6E, 0x67, 0x9E, 0x7B, 0x82, 0xC7, 0x1A, 0x38, 0x62, 0x8A, 0xC8};
+
+    static const uint8_t priv_key[ECC_SECP384R1_BYTESIZE] = {
+        0x6B, 0x9D, 0x3D, 0xAD, 0x2E, 0x1B, 0x8C, 0x1C, 0x05, 0xB1, 0x98, 0x75,
+        0xB6, 0x65, 0x9F, 0x4D, 0xE2, 0x3C, 0x3B, 0x66, 0x7B, 0xF2, 0x97, 0xBA,
+        0x9A, 0xA4, 0x77, 0x40, 0x78, 0x71, 0x37, 0xD8, 0x96, 0xD5, 0x72, 0x4E,
+        0x4C, 0x70, 0xA8, 0x25, 0xF8, 0x72, 0xC9, 0xEA, 0x60, 0xD2, 0xED, 0xF5};
+
+    static const uint8_t pub_key_x[ECC_SECP384R1_BYTESIZE] = {
+        0xEC, 0x3A, 0x4E, 0x41, 0x5B, 0x4E, 0x19, 0xA4, 0x56, 0x86, 0x18, 0x02,
+        0x9F, 0x42, 0x7F, 0xA5, 0xDA, 0x9A, 0x8B, 0xC4, 0xAE, 0x92, 0xE0, 0x2E,
+        0x06, 0xAA, 0xE5, 0x28, 0x6B, 0x30, 0x0C, 0x64, 0xDE, 0xF8, 0xF0, 0xEA,
+        0x90, 0x55, 0x86, 0x60, 0x64, 0xA2, 0x54, 0x51, 0x54, 0x80, 0xBC, 0x13};
+
+    static const uint8_t pub_key_y[ECC_SECP384R1_BYTESIZE] = {
+        0x80, 0x15, 0xD9, 0xB7, 0x2D, 0x7D, 0x57, 0x24, 0x4E, 0xA8, 0xEF, 0x9A,
+        0xC0, 0xC6, 0x21, 0x89, 0x67, 0x08, 0xA5, 0x93, 0x67, 0xF9, 0xDF, 0xB9,
+        0xF5, 0x4C, 0xA8, 0x4B, 0x3F, 0x1C, 0x9D, 0xB1, 0x28, 0x8B, 0x23, 0x1C,
+        0x3A, 0xE0, 0xD4, 0xFE, 0x73, 0x44, 0xFD, 0x25, 0x33, 0x26, 0x47, 0x20};
+
+    ecdsa_signature_t signature = {.r = signature_r, .s = signature_s};
+    const ecc_affine_const_point_t pub_key = {.x = pub_key_x, .y = pub_key_y};
+
+    result = soft_ecdsa_signature_with_nonce_mode(
+        &scl, &ecc_secp384r1, priv_key, &signature, hash, sizeof(hash),
+        SCL_ECDSA_NONCE_DETERMINISTIC);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_r, signature_r,
+                                 ECC_SECP384R1_BYTESIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_s, signature_s,
+                                 ECC_SECP384R1_BYTESIZE);
+
+    result = soft_ecdsa_verification(&scl, &ecc_secp384r1, &pub_key,
+                                     (ecdsa_signature_const_t *)&signature,
+                                     hash, sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+}
+
+TEST(soft_ecdsa, test_p521r1_sign_deterministic_rfc6979)
+{
+    int32_t result = 0;
+
+    /* RFC 6979 A.2 with message "sample" */
+    static const uint8_t hash[SHA512_BYTE_HASHSIZE] = {
+        0x39, 0xA5, 0xE0, 0x4A, 0xAF, 0xF7, 0x45, 0x5D, 0x98, 0x50, 0xC6,
+        0x05, 0x36, 0x4F, 0x51, 0x4C, 0x11, 0x32, 0x4C, 0xE6, 0x40, 0x16,
+        0x96, 0x0D, 0x23, 0xD5, 0xDC, 0x57, 0xD3, 0xFF, 0xD8, 0xF4, 0x9A,
+        0x73, 0x94, 0x68, 0xAB, 0x80, 0x49, 0xBF, 0x18, 0xEE, 0xF8, 0x20,
+        0xCD, 0xB1, 0xAD, 0x6C, 0x90, 0x15, 0xF8, 0x38, 0x55, 0x6B, 0xC7,
+        0xFA, 0xD4, 0x13, 0x8B, 0x23, 0xFD, 0xF9, 0x86, 0xC7};
+
+    uint8_t signature_r[ECC_SECP521R1_BYTESIZE] = {0};
+    uint8_t signature_s[ECC_SECP521R1_BYTESIZE] = {0};
+
+    static const uint8_t expected_signature_r[ECC_SECP521R1_BYTESIZE] = {
+        0x00, 0xC3, 0x28, 0xFA, 0xFC, 0xBD, 0x79, 0xDD, 0x77, 0x85, 0x03,
+        0x70, 0xC4, 0x63, 0x25, 0xD9, 0x87, 0xCB, 0x52, 0x55, 0x69, 0xFB,
+        0x63, 0xC5, 0xD3, 0xBC, 0x53, 0x95, 0x0E, 0x6D, 0x4C, 0x5F, 0x17,
+        0x4E, 0x25, 0xA1, 0xEE, 0x90, 0x17, 0xB5, 0xD4, 0x50, 0x60, 0x6A,
+        0xDD, 0x15, 0x2B, 0x53, 0x49, 0x31, 0xD7, 0xD4, 0xE8, 0x45, 0x5C,
+        0xC9, 0x1F, 0x9B, 0x15, 0xBF, 0x05, 0xEC, 0x36, 0xE3, 0x77, 0xFA};
+
+    static const uint8_t expected_signature_s[ECC_SECP521R1_BYTESIZE] = {
+        0x00, 0x61, 0x7C, 0xCE, 0x7C, 0xF5, 0x06, 0x48, 0x06, 0xC4, 0x67,
+        0xF6, 0x78, 0xD3, 0xB4, 0x08, 0x0D, 0x6F, 0x1C, 0xC5, 0x0A, 0xF2,
+        0x6C, 0xA2, 0x09, 0x41, 0x73, 0x08, 0x28, 0x1B, 0x68, 0xAF, 0x28,
+        0x26, 0x23, 0xEA, 0xA6, 0x3E, 0x5B, 0x5C, 0x07, 0x23, 0xD8, 0xB8,
+        0xC3, 0x7F, 0xF0, 0x77, 0x7B, 0x1A, 0x20, 0xF8, 0xCC, 0xB1, 0xDC,
+        0xCC, 0x43, 0x99, 0x7F, 0x1E, 0xE0, 0xE4, 0x4D, 0xA4, 0xA6, 0x7A};
+
+    static const uint8_t priv_key[ECC_SECP521R1_BYTESIZE] = {
+        0x00, 0xFA, 0xD0, 0x6D, 0xAA, 0x62, 0xBA, 0x3B, 0x25, 0xD2, 0xFB,
+        0x40, 0x13, 0x3D, 0xA7, 0x57, 0x20, 0x5D, 0xE6, 0x7F, 0x5B, 0xB0,
+        0x01, 0x8F, 0xEE, 0x8C, 0x86, 0xE1, 0xB6, 0x8C, 0x7E, 0x75, 0xCA,
+        0xA8, 0x96, 0xEB, 0x32, 0xF1, 0xF4, 0x7C, 0x70, 0x85, 0x58, 0x36,
+        0xA6, 0xD1, 0x6F, 0xCC, 0x14, 0x66, 0xF6, 0xD8, 0xFB, 0xEC, 0x67,
+        0xDB, 0x89, 0xEC, 0x0C, 0x08, 0xB0, 0xE9, 0x96, 0xB8, 0x35, 0x38};
+
+    static const uint8_t pub_key_x[ECC_SECP521R1_BYTESIZE] = {
+        0x01, 0x89, 0x45, 0x50, 0xD0, 0x78, 0x59, 0x32, 0xE0, 0x0E, 0xAA,
+        0x23, 0xB6, 0x94, 0xF2, 0x13, 0xF8, 0xC3, 0x12, 0x1F, 0x86, 0xDC,
+        0x97, 0xA0, 0x4E, 0x5A, 0x71, 0x67, 0xDB, 0x4E, 0x5B, 0xCD, 0x37,
+        0x11, 0x23, 0xD4, 0x6E, 0x45, 0xDB, 0x6B, 0x5D, 0x53, 0x70, 0xA7,
+        0xF2, 0x0F, 0xB6, 0x33, 0x15, 0x5D, 0x38, 0xFF, 0xA1, 0x6D, 0x2B,
+        0xD7, 0x61, 0xDC, 0xAC, 0x47, 0x4B, 0x9A, 0x2F, 0x50, 0x23, 0xA4};
+
+    static const uint8_t pub_key_y[ECC_SECP521R1_BYTESIZE] = {
+        0x00, 0x49, 0x31, 0x01, 0xC9, 0x62, 0xCD, 0x4D, 0x2F, 0xDD, 0xF7,
+        0x82, 0x28, 0x5E, 0x64, 0x58, 0x41, 0x39, 0xC2, 0xF9, 0x1B, 0x47,
+        0xF8, 0x7F, 0xF8, 0x23, 0x54, 0xD6, 0x63, 0x0F, 0x74, 0x6A, 0x28,
+        0xA0, 0xDB, 0x25, 0x74, 0x1B, 0x5B, 0x34, 0xA8, 0x28, 0x00, 0x8B,
+        0x22, 0xAC, 0xC2, 0x3F, 0x92, 0x4F, 0xAA, 0xFB, 0xD4, 0xD3, 0x3F,
+        0x81, 0xEA, 0x66, 0x95, 0x6D, 0xFE, 0xAA, 0x2B, 0xFD, 0xFC, 0xF5};
+
+    ecdsa_signature_t signature = {.r = signature_r, .s = signature_s};
+    const ecc_affine_const_point_t pub_key = {.x = pub_key_x, .y = pub_key_y};
+
+    result = soft_ecdsa_signature_with_nonce_mode(
+        &scl, &ecc_secp521r1, priv_key, &signature, hash, sizeof(hash),
+        SCL_ECDSA_NONCE_DETERMINISTIC);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_r, signature_r,
+                                 ECC_SECP521R1_BYTESIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_signature_s, signature_s,
+                                 ECC_SECP521R1_BYTESIZE);
+
+    result = soft_ecdsa_verification(&scl, &ecc_secp521r1, &pub_key,
+                                     (ecdsa_signature_const_t *)&signature,
+                                     hash, sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+}
+
+TEST(soft_ecdsa, test_p256r1_sign_hedged)
+{
+    int32_t result = 0;
+
+    static const uint8_t hash[SHA256_BYTE_HASHSIZE] = {
+        0xAF, 0x2B, 0xDB, 0xE1, 0xAA, 0x9B, 0x6E, 0xC1, 0xE2, 0xAD, 0xE1,
+        0xD6, 0x94, 0xF4, 0x1F, 0xC7, 0x1A, 0x83, 0x1D, 0x02, 0x68, 0xE9,
+        0x89, 0x15, 0x62, 0x11, 0x3D, 0x8A, 0x62, 0xAD, 0xD1, 0xBF};
+
+    uint8_t signature_r[ECC_SECP256R1_BYTESIZE] = {0};
+    uint8_t signature_s[ECC_SECP256R1_BYTESIZE] = {0};
+
+    /* deterministic signature r */
+    static const uint8_t deterministic_signature_r[ECC_SECP256R1_BYTESIZE] = {
+        0xEF, 0xD4, 0x8B, 0x2A, 0xAC, 0xB6, 0xA8, 0xFD, 0x11, 0x40, 0xDD,
+        0x9C, 0xD4, 0x5E, 0x81, 0xD6, 0x9D, 0x2C, 0x87, 0x7B, 0x56, 0xAA,
+        0xF9, 0x91, 0xC3, 0x4D, 0x0E, 0xA8, 0x4E, 0xAF, 0x37, 0x16};
+
+    static const uint8_t priv_key[ECC_SECP256R1_BYTESIZE] = {
+        0xC9, 0xAF, 0xA9, 0xD8, 0x45, 0xBA, 0x75, 0x16, 0x6B, 0x5C, 0x21,
+        0x57, 0x67, 0xB1, 0xD6, 0x93, 0x4E, 0x50, 0xC3, 0xDB, 0x36, 0xE8,
+        0x9B, 0x12, 0x7B, 0x8A, 0x62, 0x2B, 0x12, 0x0F, 0x67, 0x21};
+
+    static const uint8_t pub_key_x[ECC_SECP256R1_BYTESIZE] = {
+        0x60, 0xFE, 0xD4, 0xBA, 0x25, 0x5A, 0x9D, 0x31, 0xC9, 0x61, 0xEB,
+        0x74, 0xC6, 0x35, 0x6D, 0x68, 0xC0, 0x49, 0xB8, 0x92, 0x3B, 0x61,
+        0xFA, 0x6C, 0xE6, 0x69, 0x62, 0x2E, 0x60, 0xF2, 0x9F, 0xB6};
+
+    static const uint8_t pub_key_y[ECC_SECP256R1_BYTESIZE] = {
+        0x79, 0x03, 0xFE, 0x10, 0x08, 0xB8, 0xBC, 0x99, 0xA4, 0x1A, 0xE9,
+        0xE9, 0x56, 0x28, 0xBC, 0x64, 0xF2, 0xF1, 0xB2, 0x0C, 0x2D, 0x7E,
+        0x9F, 0x51, 0x77, 0xA3, 0xC2, 0x94, 0xD4, 0x46, 0x22, 0x99};
+
+    ecdsa_signature_t signature = {.r = signature_r, .s = signature_s};
+    const ecc_affine_const_point_t pub_key = {.x = pub_key_x, .y = pub_key_y};
+
+    /* hedged mode requires the TRNG */
+    result = soft_ecdsa_signature_with_nonce_mode(
+        &scl_no_trng, &ecc_secp256r1, priv_key, &signature, hash, sizeof(hash),
+        SCL_ECDSA_NONCE_HEDGED);
+
+    TEST_ASSERT_TRUE(SCL_ERROR_API_ENTRY_POINT == result);
+
+    result = soft_ecdsa_signature_with_nonce_mode(
+        &scl, &ecc_secp256r1, priv_key, &signature, hash, sizeof(hash),
+        SCL_ECDSA_NONCE_HEDGED);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(0 != memcmp(deterministic_signature_r, signature_r,
+                                 sizeof(signature_r)));
+
+    result = soft_ecdsa_verification(&scl, &ecc_secp256r1, &pub_key,
+                                     (ecdsa_signature_const_t *)&signature,
+                                     hash, sizeof(hash));
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+}
+
+TEST(soft_ecdsa, test_p256r1_sign_nonce_mode_invalid)
+{
+    int32_t result = 0;
+
+    static const uint8_t hash[SHA256_BYTE_HASHSIZE] = {0};
+    static const uint8_t priv_key[ECC_SECP256R1_BYTESIZE] = {1};
+
+    uint8_t signature_r[ECC_SECP256R1_BYTESIZE] = {0};
+    uint8_t signature_s[ECC_SECP256R1_BYTESIZE] = {0};
+
+    ecdsa_signature_t signature = {.r = signature_r, .s = signature_s};
+
+    result = soft_ecdsa_signature_with_nonce_mode(
+        &scl, &ecc_secp256r1, priv_key, &signature, hash, sizeof(hash),
+        (ecdsa_nonce_mode_t)3);
+
+    TEST_ASSERT_TRUE(SCL_INVALID_MODE == result);
+
+    /* the HMAC hash function can not be deduced from a 27 bytes hash */
+    result = soft_ecdsa_signature_with_nonce_mode(
+        &scl, &ecc_secp256r1, priv_key, &signature, hash, 27,
+        SCL_ECDSA_NONCE_DETERMINISTIC);
+
+    TEST_ASSERT_TRUE(SCL_ERR_HASH == result);
+}
@@ -39,6 +39,8 @@ static const metal_scl_t scl = {
             .set_modulus = soft_bignum_set_modulus,
             .mod_add = soft_bignum_mod_add,
             .mod_sub = soft_bignum_mod_sub,
+            .mod_add_lazy = soft_bignum_mod_add_lazy,
+            .mod_sub_lazy = soft_bignum_mod_sub_lazy,
             .mod_mult = soft_bignum_mod_mult,
             .mod_inv = soft_bignum_mod_inv,
             .mod_square = soft_bignum_mod_square,
@@ -2734,6 +2736,104 @@ TEST(soft_bignumbers, soft_bignum_mod_sub_size_5_2)
     TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_out, out, sizeof(expected_out));
 }
 
+/* Lazy modular addition/subtraction */
+TEST(soft_bignumbers, soft_bignum_mod_add_lazy_not_reduced)
+{
+    int32_t result = 0;
+
+    static const uint64_t in_a = 0x00000001FFFFFFFFUL;
+    static const uint64_t in_b = 0x0000000000000002UL;
+    uint64_t out = 0;
+    static const uint64_t modulus = 0x0000000200000001UL;
+    static const uint64_t expected_out = 0x0000000200000001UL;
+
+    bignum_ctx_t bignum_ctx;
+
+    memset(&bignum_ctx, 0, sizeof(bignum_ctx));
+
+    result = soft_bignum_set_modulus(&scl, &bignum_ctx, &modulus, 2);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = soft_bignum_mod_add_lazy(&scl, &bignum_ctx, &in_a, &in_b, &out, 2);
+
+    /* the result fits under the modulus msb word, it is not reduced */
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(expected_out == out);
+}
+
+TEST(soft_bignumbers, soft_bignum_mod_add_lazy_reduced)
+{
+    int32_t result = 0;
+
+    static const uint64_t in_a = 0x0000000200000000UL;
+    static const uint64_t in_b = 0x0000000100000000UL;
+    uint64_t out = 0;
+    static const uint64_t modulus = 0x0000000200000001UL;
+    static const uint64_t expected_out = 0x00000000FFFFFFFFUL;
+
+    bignum_ctx_t bignum_ctx;
+
+    memset(&bignum_ctx, 0, sizeof(bignum_ctx));
+
+    result = soft_bignum_set_modulus(&scl, &bignum_ctx, &modulus, 2);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = soft_bignum_mod_add_lazy(&scl, &bignum_ctx, &in_a, &in_b, &out, 2);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(expected_out == out);
+}
+
+TEST(soft_bignumbers, soft_bignum_mod_sub_lazy)
+{
+    int32_t result = 0;
+
+    static const uint64_t in_a = 0x0000000000000001UL;
+    static const uint64_t in_b = 0x0000000200000000UL;
+    uint64_t out = 0;
+    static const uint64_t modulus = 0x0000000200000001UL;
+    static const uint64_t expected_out = 0x0000000000000002UL;
+
+    bignum_ctx_t bignum_ctx;
+
+    memset(&bignum_ctx, 0, sizeof(bignum_ctx));
+
+    result = soft_bignum_set_modulus(&scl, &bignum_ctx, &modulus, 2);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = soft_bignum_mod_sub_lazy(&scl, &bignum_ctx, &in_a, &in_b, &out, 2);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(expected_out == out);
+}
+
+TEST(soft_bignumbers, soft_bignum_mod_sub_lazy_2)
+{
+    int32_t result = 0;
+
+    static const uint64_t in_a = 0x0000000000000000UL;
+    static const uint64_t in_b = 0x00000003FFFFFFFFUL;
+    uint64_t out = 0;
+    static const uint64_t modulus = 0x0000000200000001UL;
+    static const uint64_t expected_out = 0x0000000000000003UL;
+
+    bignum_ctx_t bignum_ctx;
+
+    memset(&bignum_ctx, 0, sizeof(bignum_ctx));
+
+    result = soft_bignum_set_modulus(&scl, &bignum_ctx, &modulus, 2);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = soft_bignum_mod_sub_lazy(&scl, &bignum_ctx, &in_a, &in_b, &out, 2);
+
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(expected_out == out);
+}
+
 /* Negate mod */
 TEST(soft_bignumbers, soft_bignum_mod_neg_size_0)
 {
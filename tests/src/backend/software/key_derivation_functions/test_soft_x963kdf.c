@@ -21,8 +21,17 @@ static const metal_scl_t scl = {.hca_base = 0,
                                     .sha_init = soft_sha_init,
                                     .sha_core = soft_sha_core,
                                     .sha_finish = soft_sha_finish,
+                                    .sha_export_state = soft_sha_export_state,
+                                    .sha_import_state = soft_sha_import_state,
                                 }};
 
+static const metal_scl_t scl_no_state = {.hca_base = 0,
+                                         .hash_func = {
+                                             .sha_init = soft_sha_init,
+                                             .sha_core = soft_sha_core,
+                                             .sha_finish = soft_sha_finish,
+                                         }};
+
 TEST_GROUP(soft_kdf_x963);
 
 TEST_SETUP(soft_kdf_x963) {}
@@ -436,3 +445,53 @@ TEST(soft_kdf_x963, soft_x963kdf_sha512_output_97B)
     TEST_ASSERT_EQUAL_HEX8_ARRAY(derived_key, expected_derived_key,
                                  sizeof(derived_key));
 }
+
+TEST(soft_kdf_x963, soft_x963kdf_sha256_long_key_output_80B)
+{
+    int32_t result;
+    size_t i;
+    x963kdf_ctx_t x963kdf_ctx;
+    sha_ctx_t sha_ctx;
+
+    /* more than one block of Z, absorbed once for all the counter blocks */
+    static uint8_t key[100];
+
+    static const uint8_t shared_info[] = {0x0F, 0xF4, 0x56, 0xF1, 0x2B,
+                                          0xD9, 0xC9, 0x60, 0x89, 0x5C};
+
+    uint8_t derived_key[80];
+
+    static const uint8_t expected_derived_key[sizeof(derived_key)] = {
+        0xb1, 0x1a, 0x16, 0x38, 0x86, 0x3d, 0x9b, 0x3f, 0xc1, 0x42, 0x12,
+        0xd0, 0x4f, 0x81, 0x01, 0xdf, 0xd8, 0x69, 0x27, 0xeb, 0x1b, 0x80,
+        0x86, 0x2a, 0xc6, 0xba, 0x4a, 0xa3, 0xcb, 0xe5, 0x3f, 0x3a, 0xf1,
+        0x00, 0xc1, 0x88, 0x49, 0x54, 0xe1, 0x43, 0xd3, 0x45, 0x45, 0xdd,
+        0x03, 0x88, 0xf0, 0x13, 0xe5, 0xc0, 0x02, 0x0a, 0xbe, 0x6a, 0x37,
+        0x42, 0x45, 0x17, 0x6a, 0xc1, 0xc0, 0x8b, 0x5d, 0xec, 0xca, 0x10,
+        0x09, 0xa8, 0x6e, 0x72, 0x0b, 0xdb, 0xd0, 0xf2, 0x52, 0xe0, 0x30,
+        0x3a, 0xcb, 0xcb};
+
+    for (i = 0; i < sizeof(key); i++)
+    {
+        key[i] = (uint8_t)(i * 5 + 3);
+    }
+
+    result = soft_kdf_x963_init(&scl, &x963kdf_ctx, &sha_ctx, SCL_HASH_SHA256,
+                                shared_info, sizeof(shared_info));
+    TEST_ASSERT_TRUE(0 == result);
+
+    result = soft_kdf_x963_derive(&scl, &x963kdf_ctx, key, sizeof(key),
+                                  derived_key, sizeof(derived_key));
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(derived_key, expected_derived_key,
+                                 sizeof(derived_key));
+
+    /* same result without state export/import entry points */
+    memset(derived_key, 0, sizeof(derived_key));
+    result = soft_kdf_x963_derive(&scl_no_state, &x963kdf_ctx, key,
+                                  sizeof(key), derived_key,
+                                  sizeof(derived_key));
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(derived_key, expected_derived_key,
+                                 sizeof(derived_key));
+}
@@ -25,8 +25,21 @@ static const metal_scl_t scl = {.hca_base = 0,
                                     .sha_init = soft_sha_init,
                                     .sha_core = soft_sha_core,
                                     .sha_finish = soft_sha_finish,
+                                    .sha_multi = soft_sha_multi,
+                                    .sha_export_state = soft_sha_export_state,
+                                    .sha_import_state = soft_sha_import_state,
+                                    .sha256_fixed = soft_sha256_fixed,
+                                    .sha256_merkle_level =
+                                        soft_sha256_merkle_level,
                                 }};
 
+static const metal_scl_t scl_no_multi = {.hca_base = 0,
+                                         .hash_func = {
+                                             .sha_init = soft_sha_init,
+                                             .sha_core = soft_sha_core,
+                                             .sha_finish = soft_sha_finish,
+                                         }};
+
 TEST_GROUP(scl_soft_sha_256);
 
 TEST_SETUP(scl_soft_sha_256) {}
@@ -180,3 +193,228 @@ TEST(scl_soft_sha_256, msg_2_blocks_digest_not_aligned)
     TEST_ASSERT_TRUE(
         0 == memcmp(expected_digest, &digest[1], sizeof(expected_digest)));
 }
+
+TEST(scl_soft_sha_256, msg_multi)
+{
+    int32_t result = 0;
+    size_t i, m;
+    static const scl_hash_mode_t modes[] = {SCL_HASH_SHA256, SCL_HASH_SHA224};
+    static const size_t lens[] = {0, 3, 55, 56, 63, 64, 119, 1000, 3};
+    /* one spare byte, the odd lanes start one byte earlier */
+    static uint8_t message[1001] __attribute__((aligned(8)));
+    const uint8_t *msgs[sizeof(lens) / sizeof(lens[0])];
+    uint8_t digests[sizeof(lens) / sizeof(lens[0])][SHA256_BYTE_HASHSIZE]
+        __attribute__((aligned(8)));
+    uint8_t *digests_ptr[sizeof(lens) / sizeof(lens[0])];
+    uint8_t expected_digest[SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    size_t digest_len;
+    size_t expected_len;
+
+    for (i = 0; i < sizeof(message); i++)
+    {
+        message[i] = (uint8_t)(i * 7 + 1);
+    }
+
+    // each lane hashes a different part of the message
+    for (i = 0; i < sizeof(lens) / sizeof(lens[0]); i++)
+    {
+        msgs[i] = &message[sizeof(message) - lens[i] - (i % 2)];
+        digests_ptr[i] = digests[i];
+    }
+
+    for (m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+    {
+        digest_len = sizeof(digests[0]);
+        result = scl_sha_multi(&scl, modes[m], msgs, lens,
+                               sizeof(lens) / sizeof(lens[0]), digests_ptr,
+                               &digest_len);
+        TEST_ASSERT_TRUE(0 == result);
+
+        for (i = 0; i < sizeof(lens) / sizeof(lens[0]); i++)
+        {
+            expected_len = sizeof(expected_digest);
+            result = scl_sha(&scl, modes[m], msgs[i], lens[i], expected_digest,
+                             &expected_len);
+            TEST_ASSERT_TRUE(0 == result);
+            TEST_ASSERT_TRUE(expected_len == digest_len);
+            TEST_ASSERT_TRUE(
+                0 == memcmp(expected_digest, digests[i], expected_len));
+        }
+    }
+}
+
+TEST(scl_soft_sha_256, msg_multi_fallback)
+{
+    int32_t result = 0;
+    size_t i;
+    static const size_t lens[] = {3, 64, 200};
+    static const uint8_t message[200] __attribute__((aligned(8))) = {0x61};
+    const uint8_t *msgs[] = {message, message, message};
+    uint8_t digests[3][SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    uint8_t *digests_ptr[] = {digests[0], digests[1], digests[2]};
+    uint8_t expected_digest[SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    size_t digest_len = sizeof(digests[0]);
+    size_t expected_len;
+
+    // no multi-buffer entry point, messages are hashed one by one
+    result = scl_sha_multi(&scl_no_multi, SCL_HASH_SHA256, msgs, lens, 3,
+                           digests_ptr, &digest_len);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_TRUE(SHA256_BYTE_HASHSIZE == digest_len);
+
+    for (i = 0; i < 3; i++)
+    {
+        expected_len = sizeof(expected_digest);
+        result = scl_sha(&scl, SCL_HASH_SHA256, msgs[i], lens[i],
+                         expected_digest, &expected_len);
+        TEST_ASSERT_TRUE(0 == result);
+        TEST_ASSERT_TRUE(
+            0 == memcmp(expected_digest, digests[i], expected_len));
+    }
+
+    digest_len = SHA256_BYTE_HASHSIZE - 1;
+    result = scl_sha_multi(&scl, SCL_HASH_SHA256, msgs, lens, 3, digests_ptr,
+                           &digest_len);
+    TEST_ASSERT_TRUE(SCL_INVALID_OUTPUT == result);
+}
+
+TEST(scl_soft_sha_256, msg_prefix_clone_and_resume)
+{
+    int32_t result = 0;
+    size_t i;
+    static uint8_t message[300] __attribute__((aligned(8)));
+    static const size_t prefix_len = 150;
+    static const size_t suffix_len[] = {0, 1, 100, 150};
+    scl_sha_ctx_t prefix_ctx;
+    scl_sha_ctx_t ctx;
+    scl_sha_state_t state;
+    uint8_t digest[SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    uint8_t expected_digest[SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    size_t digest_len;
+    size_t expected_len;
+
+    for (i = 0; i < sizeof(message); i++)
+    {
+        message[i] = (uint8_t)(i * 3 + 5);
+    }
+
+    result = scl_sha_init(&scl, &prefix_ctx, SCL_HASH_SHA256);
+    TEST_ASSERT_TRUE(0 == result);
+    result = scl_sha_core(&scl, &prefix_ctx, message, prefix_len);
+    TEST_ASSERT_TRUE(0 == result);
+
+    result = scl_sha_export_state(&scl, &prefix_ctx, &state);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_TRUE(SCL_HASH_SHA256 == state.mode);
+    TEST_ASSERT_TRUE((prefix_len * 8) == state.bitlen);
+
+    for (i = 0; i < sizeof(suffix_len) / sizeof(suffix_len[0]); i++)
+    {
+        expected_len = sizeof(expected_digest);
+        result = scl_sha(&scl, SCL_HASH_SHA256, message,
+                         prefix_len + suffix_len[i], expected_digest,
+                         &expected_len);
+        TEST_ASSERT_TRUE(0 == result);
+
+        // odd runs resume from the exported state, even runs from a clone
+        if (0 != (i % 2))
+        {
+            result = scl_sha_import_state(&scl, &ctx, &state);
+        }
+        else
+        {
+            result = scl_sha_ctx_clone(&scl, &prefix_ctx, &ctx);
+        }
+        TEST_ASSERT_TRUE(0 == result);
+
+        result =
+            scl_sha_core(&scl, &ctx, &message[prefix_len], suffix_len[i]);
+        TEST_ASSERT_TRUE(0 == result);
+
+        digest_len = sizeof(digest);
+        result = scl_sha_finish(&scl, &ctx, digest, &digest_len);
+        TEST_ASSERT_TRUE(0 == result);
+        TEST_ASSERT_TRUE(expected_len == digest_len);
+        TEST_ASSERT_TRUE(0 == memcmp(expected_digest, digest, digest_len));
+    }
+}
+
+TEST(scl_soft_sha_256, msg_fixed_32B_64B)
+{
+    int32_t result = 0;
+    size_t i;
+    uint8_t message[64] __attribute__((aligned(8)));
+    uint8_t digest[SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+
+    static const uint8_t expected_digest_32B[] __attribute__((aligned(8))) = {
+        0xb5, 0x44, 0x74, 0xb5, 0x57, 0x60, 0x88, 0x25, 0x24, 0x01, 0xe3,
+        0xfd, 0xe6, 0xfa, 0x26, 0xfa, 0xd6, 0xd6, 0xe1, 0xce, 0x2e, 0x8a,
+        0x7f, 0x71, 0xc1, 0xff, 0xf2, 0xc2, 0x73, 0xd9, 0x55, 0xb1};
+
+    static const uint8_t expected_digest_64B[] __attribute__((aligned(8))) = {
+        0x2d, 0x91, 0xca, 0xc9, 0x24, 0x6e, 0xa9, 0xf1, 0x19, 0x39, 0xb4,
+        0x73, 0x08, 0x36, 0x0f, 0x0c, 0x8e, 0x8b, 0xe8, 0x7d, 0xb6, 0x86,
+        0xdc, 0x3c, 0x1d, 0x1d, 0xcb, 0xf9, 0x1e, 0xb0, 0x54, 0xcf};
+
+    for (i = 0; i < sizeof(message); i++)
+    {
+        message[i] = (uint8_t)(i * 13 + 7);
+    }
+
+    result = scl_sha256_32B(&scl, message, digest);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_digest_32B, digest, sizeof(digest));
+
+    result = scl_sha256_64B(&scl, message, digest);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_digest_64B, digest, sizeof(digest));
+
+    // unaligned input, generic backend entry points
+    memmove(&message[1], message, 32);
+    result = scl_sha256_32B(&scl_no_multi, &message[1], digest);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_digest_32B, digest, sizeof(digest));
+}
+
+TEST(scl_soft_sha_256, merkle_root_odd_leaves)
+{
+    int32_t result = 0;
+    size_t i;
+    size_t n;
+    size_t hash_len;
+    uint8_t leaf;
+    uint8_t tree[5 * SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    uint8_t tree_generic[5 * SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+
+    /* leaves are SHA256(i), odd nodes are promoted */
+    static const uint8_t expected_root[] __attribute__((aligned(8))) = {
+        0x51, 0x74, 0xb1, 0x38, 0xf8, 0x22, 0xe5, 0x65, 0x03, 0xc0, 0x4b,
+        0xce, 0x38, 0xe3, 0x68, 0x67, 0x25, 0x93, 0xb4, 0xa2, 0x69, 0x44,
+        0x66, 0xc2, 0xe6, 0x0f, 0x12, 0x16, 0xca, 0xf2, 0x34, 0xbe};
+
+    for (i = 0; i < 5; i++)
+    {
+        leaf = (uint8_t)i;
+        hash_len = SHA256_BYTE_HASHSIZE;
+        result = scl_sha(&scl, SCL_HASH_SHA256, &leaf, 1,
+                         &tree[i * SHA256_BYTE_HASHSIZE], &hash_len);
+        TEST_ASSERT_TRUE(0 == result);
+    }
+
+    memcpy(tree_generic, tree, sizeof(tree));
+
+    // 5 -> 3 -> 2 -> 1, in place
+    for (n = 5; n > 1; n = (n + 1) / 2)
+    {
+        result = scl_sha256_merkle_level(&scl, tree, n, tree);
+        TEST_ASSERT_TRUE(0 == result);
+
+        result = scl_sha256_merkle_level(&scl_no_multi, tree_generic, n,
+                                         tree_generic);
+        TEST_ASSERT_TRUE(0 == result);
+    }
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_root, tree, SHA256_BYTE_HASHSIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_root, tree_generic,
+                                 SHA256_BYTE_HASHSIZE);
+}
@@ -25,6 +25,9 @@ static const metal_scl_t scl = {.hca_base = 0,
                                     .sha_init = soft_sha_init,
                                     .sha_core = soft_sha_core,
                                     .sha_finish = soft_sha_finish,
+                                    .sha_multi = soft_sha_multi,
+                                    .sha_export_state = soft_sha_export_state,
+                                    .sha_import_state = soft_sha_import_state,
                                 }};
 
 TEST_GROUP(scl_soft_sha_512);
@@ -201,3 +204,215 @@ TEST(scl_soft_sha_512, msg_2_blocks_digest_not_aligned)
     TEST_ASSERT_TRUE(
         0 == memcmp(expected_digest, &digest[1], sizeof(expected_digest)));
 }
+
+TEST(scl_soft_sha_512, msg_abc_sha512_224)
+{
+    int32_t result = 0;
+
+    static const uint8_t message[] __attribute__((aligned(8))) = {
+        0x61,
+        0x62,
+        0x63,
+    };
+
+    uint8_t digest[SHA512_224_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    size_t digest_len = sizeof(digest);
+
+    static const uint8_t expected_digest[SHA512_224_BYTE_HASHSIZE] = {
+        0x46, 0x34, 0x27, 0x0F, 0x70, 0x7B, 0x6A, 0x54, 0xDA, 0xAE, 0x75,
+        0x30, 0x46, 0x08, 0x42, 0xE2, 0x0E, 0x37, 0xED, 0x26, 0x5C, 0xEE,
+        0xE9, 0xA4, 0x3E, 0x89, 0x24, 0xAA};
+
+    result = scl_sha(&scl, SCL_HASH_SHA512_224, message, sizeof(message),
+                     digest, &digest_len);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_TRUE(SHA512_224_BYTE_HASHSIZE == digest_len);
+    TEST_ASSERT_TRUE(0 ==
+                     memcmp(expected_digest, digest, sizeof(expected_digest)));
+}
+
+TEST(scl_soft_sha_512, msg_2_blocks_sha512_224)
+{
+    int32_t result = 0;
+
+    static const uint8_t message[] __attribute__((aligned(8))) =
+        "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmn"
+        "opjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu";
+
+    uint8_t digest[SHA512_224_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    size_t digest_len = sizeof(digest);
+
+    static const uint8_t expected_digest[SHA512_224_BYTE_HASHSIZE] = {
+        0x23, 0xFE, 0xC5, 0xBB, 0x94, 0xD6, 0x0B, 0x23, 0x30, 0x81, 0x92,
+        0x64, 0x0B, 0x0C, 0x45, 0x33, 0x35, 0xD6, 0x64, 0x73, 0x4F, 0xE4,
+        0x0E, 0x72, 0x68, 0x67, 0x4A, 0xF9};
+
+    result = scl_sha(&scl, SCL_HASH_SHA512_224, message, sizeof(message) - 1,
+                     digest, &digest_len);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_TRUE(SHA512_224_BYTE_HASHSIZE == digest_len);
+    TEST_ASSERT_TRUE(0 ==
+                     memcmp(expected_digest, digest, sizeof(expected_digest)));
+}
+
+TEST(scl_soft_sha_512, msg_abc_sha512_256)
+{
+    int32_t result = 0;
+
+    static const uint8_t message[] __attribute__((aligned(8))) = {
+        0x61,
+        0x62,
+        0x63,
+    };
+
+    uint8_t digest[SHA512_256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    size_t digest_len = sizeof(digest);
+
+    static const uint8_t expected_digest[SHA512_256_BYTE_HASHSIZE] = {
+        0x53, 0x04, 0x8E, 0x26, 0x81, 0x94, 0x1E, 0xF9, 0x9B, 0x2E, 0x29,
+        0xB7, 0x6B, 0x4C, 0x7D, 0xAB, 0xE4, 0xC2, 0xD0, 0xC6, 0x34, 0xFC,
+        0x6D, 0x46, 0xE0, 0xE2, 0xF1, 0x31, 0x07, 0xE7, 0xAF, 0x23};
+
+    result = scl_sha(&scl, SCL_HASH_SHA512_256, message, sizeof(message),
+                     digest, &digest_len);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_TRUE(SHA512_256_BYTE_HASHSIZE == digest_len);
+    TEST_ASSERT_TRUE(0 ==
+                     memcmp(expected_digest, digest, sizeof(expected_digest)));
+}
+
+TEST(scl_soft_sha_512, msg_2_blocks_sha512_256)
+{
+    int32_t result = 0;
+
+    static const uint8_t message[] __attribute__((aligned(8))) =
+        "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmn"
+        "opjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu";
+
+    uint8_t digest[SHA512_256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    size_t digest_len = sizeof(digest);
+
+    static const uint8_t expected_digest[SHA512_256_BYTE_HASHSIZE] = {
+        0x39, 0x28, 0xE1, 0x84, 0xFB, 0x86, 0x90, 0xF8, 0x40, 0xDA, 0x39,
+        0x88, 0x12, 0x1D, 0x31, 0xBE, 0x65, 0xCB, 0x9D, 0x3E, 0xF8, 0x3E,
+        0xE6, 0x14, 0x6F, 0xEA, 0xC8, 0x61, 0xE1, 0x9B, 0x56, 0x3A};
+
+    result = scl_sha(&scl, SCL_HASH_SHA512_256, message, sizeof(message) - 1,
+                     digest, &digest_len);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_TRUE(SHA512_256_BYTE_HASHSIZE == digest_len);
+    TEST_ASSERT_TRUE(0 ==
+                     memcmp(expected_digest, digest, sizeof(expected_digest)));
+}
+
+TEST(scl_soft_sha_512, msg_multi)
+{
+    int32_t result = 0;
+    size_t i, m;
+    static const scl_hash_mode_t modes[] = {SCL_HASH_SHA512, SCL_HASH_SHA384,
+                                            SCL_HASH_SHA512_224,
+                                            SCL_HASH_SHA512_256};
+    static const size_t lens[] = {0, 3, 111, 112, 127, 128, 239, 1000, 3};
+    /* one spare byte, the odd lanes start one byte earlier */
+    static uint8_t message[1001] __attribute__((aligned(8)));
+    const uint8_t *msgs[sizeof(lens) / sizeof(lens[0])];
+    uint8_t digests[sizeof(lens) / sizeof(lens[0])][SHA512_BYTE_HASHSIZE]
+        __attribute__((aligned(8)));
+    uint8_t *digests_ptr[sizeof(lens) / sizeof(lens[0])];
+    uint8_t expected_digest[SHA512_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    size_t digest_len;
+    size_t expected_len;
+
+    for (i = 0; i < sizeof(message); i++)
+    {
+        message[i] = (uint8_t)(i * 7 + 1);
+    }
+
+    // each lane hashes a different part of the message
+    for (i = 0; i < sizeof(lens) / sizeof(lens[0]); i++)
+    {
+        msgs[i] = &message[sizeof(message) - lens[i] - (i % 2)];
+        digests_ptr[i] = digests[i];
+    }
+
+    for (m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+    {
+        digest_len = sizeof(digests[0]);
+        result = scl_sha_multi(&scl, modes[m], msgs, lens,
+                               sizeof(lens) / sizeof(lens[0]), digests_ptr,
+                               &digest_len);
+        TEST_ASSERT_TRUE(0 == result);
+
+        for (i = 0; i < sizeof(lens) / sizeof(lens[0]); i++)
+        {
+            expected_len = sizeof(expected_digest);
+            result = scl_sha(&scl, modes[m], msgs[i], lens[i], expected_digest,
+                             &expected_len);
+            TEST_ASSERT_TRUE(0 == result);
+            TEST_ASSERT_TRUE(expected_len == digest_len);
+            TEST_ASSERT_TRUE(
+                0 == memcmp(expected_digest, digests[i], expected_len));
+        }
+    }
+}
+
+TEST(scl_soft_sha_512, msg_prefix_clone_and_resume)
+{
+    int32_t result = 0;
+    size_t i;
+    static uint8_t message[300] __attribute__((aligned(8)));
+    static const size_t prefix_len = 150;
+    static const size_t suffix_len[] = {0, 1, 100, 150};
+    scl_sha_ctx_t prefix_ctx;
+    scl_sha_ctx_t ctx;
+    scl_sha_state_t state;
+    uint8_t digest[SHA512_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    uint8_t expected_digest[SHA512_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    size_t digest_len;
+    size_t expected_len;
+
+    for (i = 0; i < sizeof(message); i++)
+    {
+        message[i] = (uint8_t)(i * 3 + 5);
+    }
+
+    result = scl_sha_init(&scl, &prefix_ctx, SCL_HASH_SHA384);
+    TEST_ASSERT_TRUE(0 == result);
+    result = scl_sha_core(&scl, &prefix_ctx, message, prefix_len);
+    TEST_ASSERT_TRUE(0 == result);
+
+    result = scl_sha_export_state(&scl, &prefix_ctx, &state);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_TRUE(SCL_HASH_SHA384 == state.mode);
+    TEST_ASSERT_TRUE((prefix_len * 8) == state.bitlen);
+
+    for (i = 0; i < sizeof(suffix_len) / sizeof(suffix_len[0]); i++)
+    {
+        expected_len = sizeof(expected_digest);
+        result = scl_sha(&scl, SCL_HASH_SHA384, message,
+                         prefix_len + suffix_len[i], expected_digest,
+                         &expected_len);
+        TEST_ASSERT_TRUE(0 == result);
+
+        // odd runs resume from the exported state, even runs from a clone
+        if (0 != (i % 2))
+        {
+            result = scl_sha_import_state(&scl, &ctx, &state);
+        }
+        else
+        {
+            result = scl_sha_ctx_clone(&scl, &prefix_ctx, &ctx);
+        }
+        TEST_ASSERT_TRUE(0 == result);
+
+        result =
+            scl_sha_core(&scl, &ctx, &message[prefix_len], suffix_len[i]);
+        TEST_ASSERT_TRUE(0 == result);
+
+        digest_len = sizeof(digest);
+        result = scl_sha_finish(&scl, &ctx, digest, &digest_len);
+        TEST_ASSERT_TRUE(0 == result);
+        TEST_ASSERT_TRUE(expected_len == digest_len);
+        TEST_ASSERT_TRUE(0 == memcmp(expected_digest, digest, digest_len));
+    }
+}
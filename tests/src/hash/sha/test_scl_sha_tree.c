@@ -0,0 +1,239 @@
+/**
+ * @file test_scl_sha_tree.c
+ * @brief test suite for scl_sha_tree.c
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include <string.h>
+
+#include <backend/api/scl_backend_api.h>
+#include <scl/scl_sha.h>
+#include <scl/scl_sha_tree.h>
+
+#include <backend/api/hash/sha/sha.h>
+#include <backend/software/scl_soft.h>
+
+static const metal_scl_t scl = {.hca_base = 0,
+                                .hash_func = {
+                                    .sha_init = soft_sha_init,
+                                    .sha_core = soft_sha_core,
+                                    .sha_finish = soft_sha_finish,
+                                }};
+
+static uint8_t image[10000] __attribute__((aligned(8)));
+
+/* leaf hash, prefix || data */
+static void test_scl_sha_tree_prefixed(scl_hash_mode_t algo, uint8_t prefix,
+                                       const uint8_t *const data, size_t len,
+                                       uint8_t *const hash, size_t hash_len)
+{
+    int32_t result = 0;
+    scl_sha_ctx_t ctx;
+
+    result = scl_sha_init(&scl, &ctx, algo);
+    TEST_ASSERT_TRUE(0 == result);
+
+    result = scl_sha_core(&scl, &ctx, &prefix, sizeof(prefix));
+    TEST_ASSERT_TRUE(0 == result);
+
+    if (0 != len)
+    {
+        result = scl_sha_core(&scl, &ctx, data, len);
+        TEST_ASSERT_TRUE(0 == result);
+    }
+
+    result = scl_sha_finish(&scl, &ctx, hash, &hash_len);
+    TEST_ASSERT_TRUE(0 == result);
+}
+
+TEST_GROUP(scl_sha_tree);
+
+TEST_SETUP(scl_sha_tree)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(image); i++)
+    {
+        image[i] = (uint8_t)(i * 31 + 7);
+    }
+}
+
+TEST_TEAR_DOWN(scl_sha_tree) {}
+
+TEST(scl_sha_tree, sha256_root_10_chunks)
+{
+    int32_t result = 0;
+    size_t root_len = SHA256_BYTE_HASHSIZE;
+    uint8_t root[SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    uint8_t leaves[10 * SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    uint8_t digest[SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+
+    static const uint8_t expected_root[] __attribute__((aligned(8))) = {
+        0x92, 0x68, 0xa7, 0xd4, 0xe1, 0xc9, 0xac, 0x5b, 0xb0, 0x6e, 0x82,
+        0xe2, 0xfa, 0xf0, 0x3b, 0xbe, 0xe5, 0xde, 0x85, 0xe7, 0x9c, 0x92,
+        0x21, 0x40, 0xb5, 0x8e, 0x4b, 0xc1, 0x24, 0x8a, 0x99, 0x4a};
+
+    TEST_ASSERT_TRUE(10 == scl_sha_tree_nb_chunks(sizeof(image), 1024));
+
+    result = scl_sha_tree(&scl, SCL_HASH_SHA256, image, sizeof(image), 1024,
+                          root, &root_len);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_TRUE(SHA256_BYTE_HASHSIZE == root_len);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_root, root, sizeof(root));
+
+    // the last leaf hashes the shorter last chunk
+    result = scl_sha_tree_leaves(&scl, SCL_HASH_SHA256, image, sizeof(image),
+                                 1024, leaves, sizeof(leaves));
+    TEST_ASSERT_TRUE(0 == result);
+
+    test_scl_sha_tree_prefixed(SCL_HASH_SHA256, 0x00, &image[9 * 1024],
+                               sizeof(image) - 9 * 1024, digest,
+                               sizeof(digest));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(digest, &leaves[9 * SHA256_BYTE_HASHSIZE],
+                                 sizeof(digest));
+}
+
+TEST(scl_sha_tree, sha384_root_11_chunks)
+{
+    int32_t result = 0;
+    size_t root_len = SHA384_BYTE_HASHSIZE;
+    uint8_t root[SHA384_BYTE_HASHSIZE] __attribute__((aligned(8)));
+
+    static const uint8_t expected_root[] __attribute__((aligned(8))) = {
+        0x40, 0x5e, 0x20, 0xd1, 0x6b, 0x33, 0xbb, 0x74, 0x37, 0x9f, 0x86,
+        0x59, 0x08, 0x6e, 0x85, 0x79, 0xe4, 0xd2, 0x81, 0x69, 0xeb, 0xbd,
+        0x59, 0x43, 0x86, 0xdc, 0x96, 0x66, 0xc8, 0xd4, 0x2b, 0xf7, 0x26,
+        0x74, 0xf5, 0x7c, 0xdf, 0xb7, 0x79, 0x2b, 0x78, 0x1e, 0x50, 0x5e,
+        0x4e, 0x4e, 0x8b, 0x88};
+
+    result =
+        scl_sha_tree(&scl, SCL_HASH_SHA384, image, 1000, 96, root, &root_len);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_TRUE(SHA384_BYTE_HASHSIZE == root_len);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_root, root, sizeof(root));
+}
+
+TEST(scl_sha_tree, single_and_empty_image)
+{
+    int32_t result = 0;
+    size_t root_len;
+    uint8_t root[SHA512_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    uint8_t digest[SHA512_BYTE_HASHSIZE] __attribute__((aligned(8)));
+
+    // one chunk, the root is the leaf of the image
+    root_len = sizeof(root);
+    result =
+        scl_sha_tree(&scl, SCL_HASH_SHA512, image, 100, 128, root, &root_len);
+    TEST_ASSERT_TRUE(0 == result);
+
+    test_scl_sha_tree_prefixed(SCL_HASH_SHA512, 0x00, image, 100, digest,
+                               SHA512_BYTE_HASHSIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(digest, root, SHA512_BYTE_HASHSIZE);
+
+    // an empty image is one empty chunk
+    TEST_ASSERT_TRUE(1 == scl_sha_tree_nb_chunks(0, 64));
+
+    root_len = sizeof(root);
+    result = scl_sha_tree(&scl, SCL_HASH_SHA256, image, 0, 64, root, &root_len);
+    TEST_ASSERT_TRUE(0 == result);
+
+    test_scl_sha_tree_prefixed(SCL_HASH_SHA256, 0x00, image, 0, digest,
+                               SHA256_BYTE_HASHSIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(digest, root, SHA256_BYTE_HASHSIZE);
+
+    root_len = sizeof(root);
+    result = scl_sha_tree(&scl, SCL_HASH_SHA256, image, 0, 0, root, &root_len);
+    TEST_ASSERT_TRUE(SCL_INVALID_LENGTH == result);
+}
+
+TEST(scl_sha_tree, verify_reports_bad_chunks)
+{
+    int32_t result = 0;
+    size_t root_len = SHA256_BYTE_HASHSIZE;
+    uint8_t root[SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    /* 40 chunks of 250 bytes */
+    uint8_t leaves[40 * SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    uint32_t bad_chunks[2];
+
+    result = scl_sha_tree(&scl, SCL_HASH_SHA256, image, sizeof(image), 250,
+                          root, &root_len);
+    TEST_ASSERT_TRUE(0 == result);
+
+    result = scl_sha_tree_leaves(&scl, SCL_HASH_SHA256, image, sizeof(image),
+                                 250, leaves, sizeof(leaves));
+    TEST_ASSERT_TRUE(0 == result);
+
+    result = scl_sha_tree_verify(&scl, SCL_HASH_SHA256, image, sizeof(image),
+                                 250, leaves, root, bad_chunks,
+                                 sizeof(bad_chunks));
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_TRUE(0 == bad_chunks[0]);
+    TEST_ASSERT_TRUE(0 == bad_chunks[1]);
+
+    // corrupt chunks 3 and 39
+    image[3 * 250 + 17] ^= 1;
+    image[sizeof(image) - 1] ^= 0x80;
+
+    result = scl_sha_tree_verify(&scl, SCL_HASH_SHA256, image, sizeof(image),
+                                 250, leaves, root, bad_chunks,
+                                 sizeof(bad_chunks));
+    TEST_ASSERT_TRUE(SCL_ERR_HASH == result);
+    TEST_ASSERT_TRUE((1UL << 3) == bad_chunks[0]);
+    TEST_ASSERT_TRUE((1UL << (39 - 32)) == bad_chunks[1]);
+
+    // 40 chunks need 2 words of bitmap
+    result = scl_sha_tree_verify(&scl, SCL_HASH_SHA256, image, sizeof(image),
+                                 250, leaves, root, bad_chunks,
+                                 sizeof(bad_chunks[0]));
+    TEST_ASSERT_TRUE(SCL_INVALID_OUTPUT == result);
+
+    // leaves that do not match the root are rejected
+    leaves[0] ^= 1;
+    result = scl_sha_tree_verify(&scl, SCL_HASH_SHA256, image, sizeof(image),
+                                 250, leaves, root, bad_chunks,
+                                 sizeof(bad_chunks));
+    TEST_ASSERT_TRUE(SCL_INVALID_INPUT == result);
+}
+
+TEST(scl_sha_tree, leaves_are_not_nodes)
+{
+    int32_t result = 0;
+    size_t root_len = SHA256_BYTE_HASHSIZE;
+    uint8_t root[SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    uint8_t forged_root[SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    /* the 4 leaves of the 256 bytes image are a 128 bytes image */
+    uint8_t forged[4 * SHA256_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    uint8_t forged_leaves[2 * SHA256_BYTE_HASHSIZE]
+        __attribute__((aligned(8)));
+    uint32_t bad_chunks[1];
+
+    result =
+        scl_sha_tree(&scl, SCL_HASH_SHA256, image, 256, 64, root, &root_len);
+    TEST_ASSERT_TRUE(0 == result);
+
+    result = scl_sha_tree_leaves(&scl, SCL_HASH_SHA256, image, 256, 64, forged,
+                                 sizeof(forged));
+    TEST_ASSERT_TRUE(0 == result);
+
+    // without domain separation, its leaves would be the genuine nodes
+    root_len = sizeof(forged_root);
+    result = scl_sha_tree(&scl, SCL_HASH_SHA256, forged, sizeof(forged), 64,
+                          forged_root, &root_len);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_TRUE(0 != memcmp(root, forged_root, sizeof(root)));
+
+    result = scl_sha_tree_leaves(&scl, SCL_HASH_SHA256, forged, sizeof(forged),
+                                 64, forged_leaves, sizeof(forged_leaves));
+    TEST_ASSERT_TRUE(0 == result);
+
+    result = scl_sha_tree_verify(&scl, SCL_HASH_SHA256, forged, sizeof(forged),
+                                 64, forged_leaves, root, bad_chunks,
+                                 sizeof(bad_chunks));
+    TEST_ASSERT_TRUE(SCL_INVALID_INPUT == result);
+}
@@ -0,0 +1,186 @@
+/**
+ * @file test_scl_hkdf.c
+ * @brief test suite for scl_hkdf.c
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include <string.h>
+
+#include <backend/software/scl_soft.h>
+
+#include <scl/scl_hkdf.h>
+
+static const metal_scl_t scl = {
+    .hca_base = 0,
+    .hash_func =
+        {
+            .sha_init = soft_sha_init,
+            .sha_core = soft_sha_core,
+            .sha_finish = soft_sha_finish,
+            .sha_export_state = soft_sha_export_state,
+            .sha_import_state = soft_sha_import_state,
+        },
+    .hmac_func =
+        {
+            .init = soft_hmac_init,
+            .core = soft_hmac_core,
+            .finish = soft_hmac_finish,
+            .key_init = soft_hmac_key_init,
+            .init_with_key = soft_hmac_init_with_key,
+        },
+};
+
+TEST_GROUP(scl_hkdf);
+
+TEST_SETUP(scl_hkdf) {}
+
+TEST_TEAR_DOWN(scl_hkdf) {}
+
+/* RFC 5869 test case 1 */
+TEST(scl_hkdf, sha256_rfc5869_case_1)
+{
+    int32_t result;
+    scl_hkdf_ctx_t hkdf_ctx;
+
+    static const uint8_t ikm[22] = {
+        0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+        0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B};
+
+    static const uint8_t salt[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+                                   0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C};
+
+    static const uint8_t info[] = {0xF0, 0xF1, 0xF2, 0xF3, 0xF4,
+                                   0xF5, 0xF6, 0xF7, 0xF8, 0xF9};
+
+    uint8_t prk[SHA256_BYTE_HASHSIZE];
+    size_t prk_len = sizeof(prk);
+    uint8_t okm[42];
+
+    static const uint8_t expected_prk[SHA256_BYTE_HASHSIZE] = {
+        0x07, 0x77, 0x09, 0x36, 0x2C, 0x2E, 0x32, 0xDF, 0x0D, 0xDC, 0x3F,
+        0x0D, 0xC4, 0x7B, 0xBA, 0x63, 0x90, 0xB6, 0xC7, 0x3B, 0xB5, 0x0F,
+        0x9C, 0x31, 0x22, 0xEC, 0x84, 0x4A, 0xD7, 0xC2, 0xB3, 0xE5};
+
+    static const uint8_t expected_okm[sizeof(okm)] = {
+        0x3C, 0xB2, 0x5F, 0x25, 0xFA, 0xAC, 0xD5, 0x7A, 0x90, 0x43, 0x4F,
+        0x64, 0xD0, 0x36, 0x2F, 0x2A, 0x2D, 0x2D, 0x0A, 0x90, 0xCF, 0x1A,
+        0x5A, 0x4C, 0x5D, 0xB0, 0x2D, 0x56, 0xEC, 0xC4, 0xC5, 0xBF, 0x34,
+        0x00, 0x72, 0x08, 0xD5, 0xB8, 0x87, 0x18, 0x58, 0x65};
+
+    result = scl_hkdf_extract(&scl, SCL_HASH_SHA256, salt, sizeof(salt), ikm,
+                              sizeof(ikm), prk, &prk_len);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(SHA256_BYTE_HASHSIZE == prk_len);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_prk, prk, sizeof(expected_prk));
+
+    result =
+        scl_hkdf_expand_init(&scl, &hkdf_ctx, SCL_HASH_SHA256, prk, prk_len);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = scl_hkdf_expand(&scl, &hkdf_ctx, info, sizeof(info), okm,
+                             sizeof(okm));
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_okm, okm, sizeof(expected_okm));
+}
+
+/* RFC 5869 test case 3: no salt, no info */
+TEST(scl_hkdf, sha256_rfc5869_case_3)
+{
+    int32_t result;
+    scl_hkdf_ctx_t hkdf_ctx;
+
+    static const uint8_t ikm[22] = {
+        0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+        0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B};
+
+    uint8_t prk[SHA256_BYTE_HASHSIZE];
+    size_t prk_len = sizeof(prk);
+    uint8_t okm[42];
+
+    static const uint8_t expected_prk[SHA256_BYTE_HASHSIZE] = {
+        0x19, 0xEF, 0x24, 0xA3, 0x2C, 0x71, 0x7B, 0x16, 0x7F, 0x33, 0xA9,
+        0x1D, 0x6F, 0x64, 0x8B, 0xDF, 0x96, 0x59, 0x67, 0x76, 0xAF, 0xDB,
+        0x63, 0x77, 0xAC, 0x43, 0x4C, 0x1C, 0x29, 0x3C, 0xCB, 0x04};
+
+    static const uint8_t expected_okm[sizeof(okm)] = {
+        0x8D, 0xA4, 0xE7, 0x75, 0xA5, 0x63, 0xC1, 0x8F, 0x71, 0x5F, 0x80,
+        0x2A, 0x06, 0x3C, 0x5A, 0x31, 0xB8, 0xA1, 0x1F, 0x5C, 0x5E, 0xE1,
+        0x87, 0x9E, 0xC3, 0x45, 0x4E, 0x5F, 0x3C, 0x73, 0x8D, 0x2D, 0x9D,
+        0x20, 0x13, 0x95, 0xFA, 0xA4, 0xB6, 0x1A, 0x96, 0xC8};
+
+    result = scl_hkdf_extract(&scl, SCL_HASH_SHA256, NULL, 0, ikm,
+                              sizeof(ikm), prk, &prk_len);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_prk, prk, sizeof(expected_prk));
+
+    result =
+        scl_hkdf_expand_init(&scl, &hkdf_ctx, SCL_HASH_SHA256, prk, prk_len);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = scl_hkdf_expand(&scl, &hkdf_ctx, NULL, 0, okm, sizeof(okm));
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_okm, okm, sizeof(expected_okm));
+}
+
+TEST(scl_hkdf, sha384_several_labels)
+{
+    int32_t result;
+    scl_hkdf_ctx_t hkdf_ctx;
+
+    static const uint8_t ikm[] = "input key material";
+    static const uint8_t salt[] = "salt";
+    static const uint8_t label[] = "label";
+    static const uint8_t other_label[] = "other label";
+
+    uint8_t prk[SHA384_BYTE_HASHSIZE];
+    size_t prk_len = sizeof(prk);
+    uint8_t okm[100];
+    uint8_t other_okm[100];
+
+    static const uint8_t expected_okm[sizeof(okm)] = {
+        0x65, 0xC8, 0x78, 0x9B, 0xC0, 0x21, 0xA4, 0xF5, 0x86, 0x2C, 0x0D,
+        0x70, 0x63, 0xE5, 0x62, 0x82, 0xE9, 0xA7, 0x75, 0x62, 0x8D, 0x3D,
+        0x85, 0x99, 0xC5, 0xCB, 0x34, 0x56, 0x87, 0x28, 0x3C, 0xC8, 0x14,
+        0x42, 0xDD, 0xB3, 0x43, 0x66, 0xAE, 0xD0, 0xD5, 0xA8, 0xFE, 0x96,
+        0x9E, 0xFA, 0x85, 0xDC, 0xCA, 0x13, 0xBC, 0x5D, 0x83, 0x25, 0x2A,
+        0x73, 0x02, 0x75, 0xB0, 0x1A, 0x6D, 0x8C, 0x04, 0x32, 0xA4, 0x3A,
+        0x98, 0x89, 0xE1, 0x07, 0xBC, 0x9E, 0x7F, 0x65, 0xF8, 0x43, 0xA6,
+        0x77, 0xEE, 0x05, 0xF4, 0x9D, 0x2F, 0x58, 0xAB, 0x00, 0x08, 0xED,
+        0x6B, 0xA2, 0xA2, 0x72, 0xD3, 0x8E, 0x24, 0xEB, 0x47, 0x9A, 0x67,
+        0x95};
+
+    result = scl_hkdf_extract(&scl, SCL_HASH_SHA384, salt, sizeof(salt) - 1,
+                              ikm, sizeof(ikm) - 1, prk, &prk_len);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_TRUE(SHA384_BYTE_HASHSIZE == prk_len);
+
+    /* the PRK is keyed once for all the labels */
+    result =
+        scl_hkdf_expand_init(&scl, &hkdf_ctx, SCL_HASH_SHA384, prk, prk_len);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = scl_hkdf_expand(&scl, &hkdf_ctx, other_label,
+                             sizeof(other_label) - 1, other_okm,
+                             sizeof(other_okm));
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    result = scl_hkdf_expand(&scl, &hkdf_ctx, label, sizeof(label) - 1, okm,
+                             sizeof(okm));
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_okm, okm, sizeof(expected_okm));
+    TEST_ASSERT_TRUE(0 != memcmp(okm, other_okm, sizeof(okm)));
+
+    result = scl_hkdf_expand(&scl, &hkdf_ctx, label, sizeof(label) - 1, okm,
+                             SCL_HKDF_MAX_BLOCKS * SHA384_BYTE_HASHSIZE + 1);
+    TEST_ASSERT_TRUE(SCL_INVALID_LENGTH == result);
+
+    result = scl_hkdf_expand_init(&scl, &hkdf_ctx, SCL_HASH_SHA384, prk,
+                                  SHA256_BYTE_HASHSIZE);
+    TEST_ASSERT_TRUE(SCL_INVALID_LENGTH == result);
+}
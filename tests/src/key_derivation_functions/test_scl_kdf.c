@@ -26,11 +26,61 @@ static const metal_scl_t scl = {
             .sha_init = soft_sha_init,
             .sha_core = soft_sha_core,
             .sha_finish = soft_sha_finish,
+            .sha_export_state = soft_sha_export_state,
+            .sha_import_state = soft_sha_import_state,
         },
     .kdf_func =
         {
             .x963_init = soft_kdf_x963_init,
             .x963_derive = soft_kdf_x963_derive,
+            .pbkdf2 = soft_kdf_pbkdf2,
+            .sp800108_hmac_init = soft_kdf_sp800108_hmac_init,
+            .sp800108_cmac_init = soft_kdf_sp800108_cmac_init,
+            .sp800108_derive = soft_kdf_sp800108_derive,
+        },
+    .hmac_func =
+        {
+            .init = soft_hmac_init,
+            .core = soft_hmac_core,
+            .finish = soft_hmac_finish,
+            .key_init = soft_hmac_key_init,
+            .init_with_key = soft_hmac_init_with_key,
+        },
+};
+
+/* a backend that resumes imported states in software, like HCA 0.5.x */
+static int32_t soft_resume_import_state(const metal_scl_t *const scl,
+                                        sha_ctx_t *const ctx,
+                                        const sha_state_t *const state)
+{
+    int32_t result = soft_sha_import_state(scl, ctx, state);
+
+    ctx->soft_resume = true;
+
+    return (result);
+}
+
+static const metal_scl_t scl_soft_resume = {
+    .hca_base = 0,
+    .hash_func =
+        {
+            .sha_init = soft_sha_init,
+            .sha_core = soft_sha_core,
+            .sha_finish = soft_sha_finish,
+            .sha_export_state = soft_sha_export_state,
+            .sha_import_state = soft_resume_import_state,
+        },
+    .kdf_func =
+        {
+            .pbkdf2 = soft_kdf_pbkdf2,
+        },
+    .hmac_func =
+        {
+            .init = soft_hmac_init,
+            .core = soft_hmac_core,
+            .finish = soft_hmac_finish,
+            .key_init = soft_hmac_key_init,
+            .init_with_key = soft_hmac_init_with_key,
         },
 };
 
@@ -447,3 +497,386 @@ TEST(scl_kdf, x963kdf_sha512_output_97B)
     TEST_ASSERT_EQUAL_HEX8_ARRAY(derived_key, expected_derived_key,
                                  sizeof(derived_key));
 }
+
+TEST(scl_kdf, pbkdf2_sha224_embedded_nul_output_30B)
+{
+    int32_t result;
+
+    static const uint8_t password[] = {
+        0x70, 0x61, 0x73, 0x73, 0x00, 0x77, 0x6f, 0x72, 0x64};
+
+    static const uint8_t salt[] = {0x73, 0x61, 0x00, 0x6c, 0x74};
+
+    uint8_t derived_key[30];
+
+    static const uint8_t expected_derived_key[sizeof(derived_key)] = {
+        0x3c, 0x72, 0xd6, 0xc1, 0x6c, 0xab, 0xeb, 0x88, 0xda, 0xa8, 0x47,
+        0x2e, 0x2f, 0x72, 0x43, 0x5d, 0x7d, 0x02, 0x9b, 0x21, 0xf6, 0xd4,
+        0x40, 0x01, 0xa2, 0x7c, 0x55, 0xa3, 0xb8, 0xb8};
+
+    result = scl_pbkdf2(&scl, SCL_HASH_SHA224, password, sizeof(password), salt,
+                        sizeof(salt), 2, derived_key, sizeof(derived_key));
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(derived_key, expected_derived_key,
+                                 sizeof(derived_key));
+}
+
+TEST(scl_kdf, pbkdf2_sha256_1_iteration_output_64B)
+{
+    int32_t result;
+
+    static const uint8_t password[] = {0x70, 0x61, 0x73, 0x73, 0x77, 0x64};
+
+    static const uint8_t salt[] = {0x73, 0x61, 0x6c, 0x74};
+
+    uint8_t derived_key[64];
+
+    static const uint8_t expected_derived_key[sizeof(derived_key)] = {
+        0x55, 0xac, 0x04, 0x6e, 0x56, 0xe3, 0x08, 0x9f, 0xec, 0x16, 0x91,
+        0xc2, 0x25, 0x44, 0xb6, 0x05, 0xf9, 0x41, 0x85, 0x21, 0x6d, 0xde,
+        0x04, 0x65, 0xe6, 0x8b, 0x9d, 0x57, 0xc2, 0x0d, 0xac, 0xbc, 0x49,
+        0xca, 0x9c, 0xcc, 0xf1, 0x79, 0xb6, 0x45, 0x99, 0x16, 0x64, 0xb3,
+        0x9d, 0x77, 0xef, 0x31, 0x7c, 0x71, 0xb8, 0x45, 0xb1, 0xe3, 0x0b,
+        0xd5, 0x09, 0x11, 0x20, 0x41, 0xd3, 0xa1, 0x97, 0x83};
+
+    result = scl_pbkdf2(&scl, SCL_HASH_SHA256, password, sizeof(password), salt,
+                        sizeof(salt), 1, derived_key, sizeof(derived_key));
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(derived_key, expected_derived_key,
+                                 sizeof(derived_key));
+}
+
+TEST(scl_kdf, pbkdf2_sha256_80000_iterations_output_64B)
+{
+    int32_t result;
+
+    static const uint8_t password[] = {
+        0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64};
+
+    static const uint8_t salt[] = {0x4e, 0x61, 0x43, 0x6c};
+
+    uint8_t derived_key[64];
+
+    static const uint8_t expected_derived_key[sizeof(derived_key)] = {
+        0x4d, 0xdc, 0xd8, 0xf6, 0x0b, 0x98, 0xbe, 0x21, 0x83, 0x0c, 0xee,
+        0x5e, 0xf2, 0x27, 0x01, 0xf9, 0x64, 0x1a, 0x44, 0x18, 0xd0, 0x4c,
+        0x04, 0x14, 0xae, 0xff, 0x08, 0x87, 0x6b, 0x34, 0xab, 0x56, 0xa1,
+        0xd4, 0x25, 0xa1, 0x22, 0x58, 0x33, 0x54, 0x9a, 0xdb, 0x84, 0x1b,
+        0x51, 0xc9, 0xb3, 0x17, 0x6a, 0x27, 0x2b, 0xde, 0xbb, 0xa1, 0xd0,
+        0x78, 0x47, 0x8f, 0x62, 0xb3, 0x97, 0xf3, 0x3c, 0x8d};
+
+    result = scl_pbkdf2(&scl, SCL_HASH_SHA256, password, sizeof(password), salt,
+                        sizeof(salt), 80000, derived_key, sizeof(derived_key));
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(derived_key, expected_derived_key,
+                                 sizeof(derived_key));
+}
+
+TEST(scl_kdf, pbkdf2_sha384_long_password_output_60B)
+{
+    int32_t result;
+
+    uint8_t password[200];
+
+    static const uint8_t salt[] = {0x73, 0x61, 0x6c, 0x74};
+
+    uint8_t derived_key[60];
+
+    static const uint8_t expected_derived_key[sizeof(derived_key)] = {
+        0xd4, 0xa1, 0x44, 0x3f, 0x69, 0x04, 0x7b, 0x53, 0x53, 0x0a, 0xc6,
+        0xc8, 0xe6, 0xee, 0x29, 0x6e, 0x3e, 0x8d, 0x1b, 0xf0, 0xf4, 0x20,
+        0x79, 0x18, 0xc2, 0xb4, 0xa0, 0x98, 0x9c, 0xc9, 0x75, 0x70, 0x56,
+        0xfd, 0x88, 0xe4, 0x47, 0x0a, 0x8f, 0xa2, 0xe5, 0x0a, 0x32, 0xc5,
+        0x4c, 0x4b, 0x4f, 0x70, 0x07, 0xb7, 0xbd, 0x05, 0xff, 0x05, 0xe1,
+        0x0c, 0x2e, 0x06, 0x19, 0xba};
+
+    memset(password, 'p', sizeof(password));
+
+    result = scl_pbkdf2(&scl, SCL_HASH_SHA384, password, sizeof(password), salt,
+                        sizeof(salt), 3, derived_key, sizeof(derived_key));
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(derived_key, expected_derived_key,
+                                 sizeof(derived_key));
+}
+
+TEST(scl_kdf, pbkdf2_sha512_output_100B)
+{
+    int32_t result;
+
+    static const uint8_t password[] = {
+        0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64};
+
+    static const uint8_t salt[] = {0x73, 0x61, 0x6c, 0x74};
+
+    uint8_t derived_key[100];
+
+    static const uint8_t expected_derived_key[sizeof(derived_key)] = {
+        0xaf, 0xe6, 0xc5, 0x53, 0x07, 0x85, 0xb6, 0xcc, 0x6b, 0x1c, 0x64,
+        0x53, 0x38, 0x47, 0x31, 0xbd, 0x5e, 0xe4, 0x32, 0xee, 0x54, 0x9f,
+        0xd4, 0x2f, 0xb6, 0x69, 0x57, 0x79, 0xad, 0x8a, 0x1c, 0x5b, 0xf5,
+        0x9d, 0xe6, 0x9c, 0x48, 0xf7, 0x74, 0xef, 0xc4, 0x00, 0x7d, 0x52,
+        0x98, 0xf9, 0x03, 0x3c, 0x02, 0x41, 0xd5, 0xab, 0x69, 0x30, 0x5e,
+        0x7b, 0x64, 0xec, 0xee, 0xb8, 0xd8, 0x34, 0xcf, 0xec, 0x6a, 0xfd,
+        0xec, 0x3c, 0x1c, 0x23, 0x98, 0x2a, 0x12, 0x1f, 0x2d, 0x4b, 0xe0,
+        0x08, 0x88, 0x93, 0x78, 0xa4, 0x9a, 0x0d, 0xfb, 0x10, 0x4f, 0x0d,
+        0x28, 0x56, 0xe3, 0x8f, 0x44, 0x27, 0x1c, 0xda, 0xf6, 0xde, 0x43,
+        0x41};
+
+    result = scl_pbkdf2(&scl, SCL_HASH_SHA512, password, sizeof(password), salt,
+                        sizeof(salt), 1000, derived_key, sizeof(derived_key));
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(derived_key, expected_derived_key,
+                                 sizeof(derived_key));
+}
+
+TEST(scl_kdf, pbkdf2_sha512_224_output_60B)
+{
+    int32_t result;
+
+    static const uint8_t password[] = {
+        0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64};
+
+    static const uint8_t salt[] = {0x73, 0x61, 0x6c, 0x74};
+
+    uint8_t derived_key[60];
+
+    static const uint8_t expected_derived_key[sizeof(derived_key)] = {
+        0x2f, 0x7d, 0xd7, 0x17, 0x2b, 0x03, 0x24, 0xe8, 0x23, 0x4f, 0xb8,
+        0x7a, 0x2a, 0x78, 0x9b, 0x8c, 0xa2, 0x0f, 0x61, 0x3f, 0xb0, 0x43,
+        0xbe, 0x22, 0x8e, 0x1e, 0xdb, 0xfc, 0x15, 0x9a, 0x90, 0x9f, 0x4b,
+        0x9d, 0x36, 0xec, 0x65, 0x1e, 0x5b, 0x05, 0x1d, 0x94, 0x55, 0xe5,
+        0x4b, 0x56, 0xa7, 0xf2, 0x7f, 0xc4, 0x62, 0xfc, 0x9f, 0x33, 0x74,
+        0x3b, 0x2e, 0x3b, 0x9b, 0x9f};
+
+    result = scl_pbkdf2(&scl, SCL_HASH_SHA512_224, password, sizeof(password),
+                        salt, sizeof(salt), 1000, derived_key,
+                        sizeof(derived_key));
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(derived_key, expected_derived_key,
+                                 sizeof(derived_key));
+}
+
+TEST(scl_kdf, pbkdf2_zero_iteration)
+{
+    int32_t result;
+    static const uint8_t password[] = {0x70, 0x61, 0x73, 0x73};
+    static const uint8_t salt[] = {0x73, 0x61, 0x6c, 0x74};
+    uint8_t derived_key[32];
+
+    result = scl_pbkdf2(&scl, SCL_HASH_SHA256, password, sizeof(password), salt,
+                        sizeof(salt), 0, derived_key, sizeof(derived_key));
+    TEST_ASSERT_TRUE(SCL_INVALID_INPUT == result);
+}
+
+/* the HMAC key context keeps k0 instead of the pad states */
+TEST(scl_kdf, pbkdf2_key_ctx_without_states)
+{
+    int32_t result;
+    size_t m;
+    static const scl_hash_mode_t modes[] = {SCL_HASH_SHA256,
+                                            SCL_HASH_SHA512_224};
+    static const uint8_t password[] = {0x70, 0x61, 0x73, 0x73};
+    static const uint8_t salt[] = {0x73, 0x61, 0x6c, 0x74};
+    uint8_t derived_key[40];
+    uint8_t expected_derived_key[sizeof(derived_key)];
+
+    for (m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+    {
+        result = scl_pbkdf2(&scl, modes[m], password, sizeof(password), salt,
+                            sizeof(salt), 3, expected_derived_key,
+                            sizeof(expected_derived_key));
+        TEST_ASSERT_TRUE(0 == result);
+
+        result = scl_pbkdf2(&scl_soft_resume, modes[m], password,
+                            sizeof(password), salt, sizeof(salt), 3,
+                            derived_key, sizeof(derived_key));
+        TEST_ASSERT_TRUE(0 == result);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_derived_key, derived_key,
+                                     sizeof(derived_key));
+    }
+}
+
+TEST(scl_kdf, sp800108_hmac_sha224_no_label_output_30B)
+{
+    int32_t result;
+    scl_sp800108kdf_ctx_t sp800108kdf_ctx;
+    scl_sha_ctx_t sha_ctx;
+
+    static const uint8_t key[] = {
+        0x01, 0x08, 0x0f, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x39, 0x40, 0x47,
+        0x4e, 0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x7f, 0x86};
+
+    uint8_t derived_key[30];
+
+    static const uint8_t expected_derived_key[sizeof(derived_key)] = {
+        0x72, 0xd0, 0xbd, 0x29, 0x6b, 0x1e, 0xe4, 0xff, 0x1b, 0xc3, 0x8f,
+        0xf7, 0xac, 0x13, 0x30, 0x7e, 0xd9, 0x13, 0x90, 0x6e, 0x78, 0x27,
+        0x45, 0x1c, 0x69, 0xdf, 0xca, 0xda, 0x91, 0x50};
+
+    result = scl_kdf_sp800108_hmac_init(&scl, &sp800108kdf_ctx, &sha_ctx,
+                                        SCL_HASH_SHA224, key, sizeof(key));
+    TEST_ASSERT_TRUE(0 == result);
+
+    result = scl_kdf_sp800108_derive(&scl, &sp800108kdf_ctx, NULL, 0, NULL, 0,
+                                     derived_key, sizeof(derived_key));
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(derived_key, expected_derived_key,
+                                 sizeof(derived_key));
+}
+
+TEST(scl_kdf, sp800108_hmac_sha256_output_32B)
+{
+    int32_t result;
+    scl_sp800108kdf_ctx_t sp800108kdf_ctx;
+    scl_sha_ctx_t sha_ctx;
+
+    static const uint8_t key[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+        0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f};
+
+    static const uint8_t label[] = {0x65, 0x6e, 0x63};
+    static const uint8_t context[] = {0x63, 0x68, 0x61, 0x6e, 0x6e,
+                                      0x65, 0x6c, 0x2d, 0x31};
+
+    uint8_t derived_key[32];
+
+    static const uint8_t expected_derived_key[sizeof(derived_key)] = {
+        0xa1, 0x9b, 0x6a, 0xa4, 0xbc, 0x1e, 0x31, 0xee, 0xc5, 0x20, 0x83,
+        0xa8, 0x9b, 0x2f, 0xc2, 0x6e, 0x2e, 0x7d, 0x70, 0x71, 0xb9, 0x31,
+        0x26, 0x15, 0x4b, 0xe4, 0x41, 0x52, 0x2a, 0xec, 0xa1, 0x84};
+
+    result = scl_kdf_sp800108_hmac_init(&scl, &sp800108kdf_ctx, &sha_ctx,
+                                        SCL_HASH_SHA256, key, sizeof(key));
+    TEST_ASSERT_TRUE(0 == result);
+
+    result = scl_kdf_sp800108_derive(&scl, &sp800108kdf_ctx, label,
+                                     sizeof(label), context, sizeof(context),
+                                     derived_key, sizeof(derived_key));
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(derived_key, expected_derived_key,
+                                 sizeof(derived_key));
+}
+
+TEST(scl_kdf, sp800108_hmac_sha512_output_100B)
+{
+    int32_t result;
+    scl_sp800108kdf_ctx_t sp800108kdf_ctx;
+    scl_sha_ctx_t sha_ctx;
+
+    static const uint8_t key[] = {
+        0x00, 0x03, 0x06, 0x09, 0x0c, 0x0f, 0x12, 0x15, 0x18, 0x1b, 0x1e,
+        0x21, 0x24, 0x27, 0x2a, 0x2d, 0x30, 0x33, 0x36, 0x39, 0x3c, 0x3f,
+        0x42, 0x45, 0x48, 0x4b, 0x4e, 0x51, 0x54, 0x57, 0x5a, 0x5d, 0x60,
+        0x63, 0x66, 0x69, 0x6c, 0x6f, 0x72, 0x75, 0x78, 0x7b, 0x7e, 0x81,
+        0x84, 0x87, 0x8a, 0x8d, 0x90, 0x93, 0x96, 0x99, 0x9c, 0x9f, 0xa2,
+        0xa5, 0xa8, 0xab, 0xae, 0xb1, 0xb4, 0xb7, 0xba, 0xbd};
+
+    static const uint8_t label[] = {0x6b, 0x65, 0x79, 0x20,
+                                    0x77, 0x72, 0x61, 0x70};
+    static const uint8_t context[] = {
+        0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa,
+        0xab, 0xac, 0xad, 0xae, 0xaf, 0xb0, 0xb1, 0xb2, 0xb3};
+
+    uint8_t derived_key[100];
+
+    static const uint8_t expected_derived_key[sizeof(derived_key)] = {
+        0xa5, 0xd7, 0xf0, 0x51, 0xcb, 0xb8, 0x4b, 0xc0, 0x8d, 0xda, 0x43,
+        0x94, 0x8e, 0xa7, 0xa7, 0xf8, 0x73, 0xe8, 0xca, 0x28, 0xca, 0xd8,
+        0x26, 0x1d, 0x0c, 0xfe, 0xca, 0xb1, 0x86, 0x09, 0xf1, 0xdf, 0x4b,
+        0x98, 0xb4, 0x99, 0x07, 0x3d, 0xd6, 0x53, 0xbf, 0xe4, 0xec, 0xb7,
+        0x0d, 0x5b, 0x66, 0x21, 0x11, 0xa8, 0xf4, 0xc8, 0xf9, 0x2a, 0xf2,
+        0x3d, 0xec, 0x94, 0x5d, 0x11, 0xd9, 0xa6, 0xe1, 0x0e, 0xb6, 0x30,
+        0xe8, 0xd7, 0x4e, 0x6c, 0x3f, 0x91, 0xd6, 0xe8, 0x87, 0x47, 0xba,
+        0x5c, 0xdb, 0xdf, 0x0a, 0x4b, 0xf0, 0xb3, 0x80, 0xf2, 0x09, 0x86,
+        0xbb, 0x79, 0xdc, 0x92, 0x42, 0xc2, 0x11, 0xcf, 0x57, 0xb5, 0xf5,
+        0xf4};
+
+    result = scl_kdf_sp800108_hmac_init(&scl, &sp800108kdf_ctx, &sha_ctx,
+                                        SCL_HASH_SHA512, key, sizeof(key));
+    TEST_ASSERT_TRUE(0 == result);
+
+    result = scl_kdf_sp800108_derive(&scl, &sp800108kdf_ctx, label,
+                                     sizeof(label), context, sizeof(context),
+                                     derived_key, sizeof(derived_key));
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(derived_key, expected_derived_key,
+                                 sizeof(derived_key));
+}
+
+TEST(scl_kdf, sp800108_hmac_sha384_batch)
+{
+    int32_t result;
+    size_t i;
+    scl_sp800108kdf_ctx_t sp800108kdf_ctx;
+    scl_sha_ctx_t sha_ctx;
+    scl_sp800108kdf_request_t requests[3];
+
+    static const uint8_t key[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+        0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f};
+
+    static const uint8_t context[] = {0x63, 0x68, 0x61, 0x6e, 0x6e,
+                                      0x65, 0x6c, 0x2d, 0x31};
+
+    static const uint8_t label_enc[] = {0x65, 0x6e, 0x63};
+    static const uint8_t label_mac[] = {0x6d, 0x61, 0x63};
+    static const uint8_t label_iv[] = {0x69, 0x76};
+
+    uint8_t enc_key[16];
+    uint8_t mac_key[32];
+    uint8_t iv[40];
+    uint8_t single_key[40];
+
+    static const uint8_t expected_enc_key[sizeof(enc_key)] = {
+        0xf2, 0xcc, 0x32, 0xdf, 0x36, 0xd9, 0x76, 0x35, 0x8e, 0x35, 0x02,
+        0x87, 0x91, 0x06, 0xd8, 0xb4};
+
+    static const uint8_t expected_mac_key[sizeof(mac_key)] = {
+        0x90, 0x5f, 0x99, 0x70, 0x80, 0x9b, 0xda, 0x44, 0x3d, 0x01, 0x31,
+        0xc1, 0x65, 0x57, 0x63, 0x13, 0x1d, 0x22, 0x9f, 0xbe, 0x48, 0x6c,
+        0xb3, 0xf4, 0x69, 0x42, 0x04, 0xa8, 0xb2, 0xca, 0x77, 0x98};
+
+    static const uint8_t expected_iv[sizeof(iv)] = {
+        0x1d, 0xb2, 0x25, 0xf2, 0xba, 0x08, 0x70, 0x15, 0x3e, 0x4a, 0x5a,
+        0x13, 0xae, 0x8d, 0x9f, 0x8b, 0x16, 0x37, 0x92, 0x40, 0xe8, 0xdd,
+        0xa9, 0x11, 0x8c, 0x2a, 0xa3, 0x64, 0x07, 0xf9, 0x86, 0xf2, 0x40,
+        0x2b, 0x7c, 0x60, 0x85, 0xca, 0x02, 0x81};
+
+    result = scl_kdf_sp800108_hmac_init(&scl, &sp800108kdf_ctx, &sha_ctx,
+                                        SCL_HASH_SHA384, key, sizeof(key));
+    TEST_ASSERT_TRUE(0 == result);
+
+    for (i = 0; i < 3; i++)
+    {
+        requests[i].context = context;
+        requests[i].context_len = sizeof(context);
+    }
+
+    requests[0].label = label_enc;
+    requests[0].label_len = sizeof(label_enc);
+    requests[0].derivated_key = enc_key;
+    requests[0].derivated_key_length = sizeof(enc_key);
+    requests[1].label = label_mac;
+    requests[1].label_len = sizeof(label_mac);
+    requests[1].derivated_key = mac_key;
+    requests[1].derivated_key_length = sizeof(mac_key);
+    requests[2].label = label_iv;
+    requests[2].label_len = sizeof(label_iv);
+    requests[2].derivated_key = iv;
+    requests[2].derivated_key_length = sizeof(iv);
+
+    result = scl_kdf_sp800108_derive_batch(&scl, &sp800108kdf_ctx, requests, 3);
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(enc_key, expected_enc_key, sizeof(enc_key));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(mac_key, expected_mac_key, sizeof(mac_key));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(iv, expected_iv, sizeof(iv));
+
+    /* the context can be reused after a batch */
+    result = scl_kdf_sp800108_derive(&scl, &sp800108kdf_ctx, label_iv,
+                                     sizeof(label_iv), context, sizeof(context),
+                                     single_key, sizeof(single_key));
+    TEST_ASSERT_TRUE(0 == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(single_key, expected_iv, sizeof(single_key));
+}
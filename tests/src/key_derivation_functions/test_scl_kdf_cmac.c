@@ -0,0 +1,93 @@
+/**
+ * @file test_scl_kdf_cmac.c
+ * @brief test suite for CMAC based key derivation functions in scl_kdf.c
+ * @note These tests use HCA (Hardware Cryptographic Accelerator) for AES
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include <backend/api/scl_backend_api.h>
+#include <scl/scl_kdf.h>
+
+#include <backend/hardware/scl_hca.h>
+#include <backend/software/scl_soft.h>
+
+#include <metal/machine/platform.h>
+
+#if METAL_SIFIVE_HCA_VERSION >= HCA_VERSION(0, 5, 0)
+
+static const metal_scl_t scl = {
+    .hca_base = METAL_SIFIVE_HCA_0_BASE_ADDRESS,
+    .aes_func = {.setkey = hca_aes_setkey, .cipher = hca_aes_cipher},
+    .kdf_func = {.sp800108_cmac_init = soft_kdf_sp800108_cmac_init,
+                 .sp800108_derive = soft_kdf_sp800108_derive}};
+
+TEST_GROUP(scl_kdf_cmac);
+
+TEST_SETUP(scl_kdf_cmac) {}
+
+TEST_TEAR_DOWN(scl_kdf_cmac) {}
+
+TEST(scl_kdf_cmac, sp800108_cmac_aes128_batch)
+{
+    int32_t result;
+    scl_sp800108kdf_ctx_t sp800108kdf_ctx;
+    scl_sp800108kdf_request_t requests[2];
+
+    static const uint8_t key128[16] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+                                       0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+                                       0x0c, 0x0d, 0x0e, 0x0f};
+
+    static const uint8_t label_enc[] = {0x65, 0x6e, 0x63};
+    static const uint8_t context_enc[] = {0x63, 0x68, 0x61, 0x6e, 0x6e,
+                                          0x65, 0x6c, 0x2d, 0x31};
+
+    /* [i] || label || 0x00 || context || [L] is exactly two blocks */
+    static const uint8_t label_exact[] = {0x65, 0x78, 0x61, 0x63, 0x74};
+    static const uint8_t context_exact[] = {
+        0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+        0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72};
+
+    uint8_t enc_key[32];
+    uint8_t exact_key[40];
+
+    static const uint8_t expected_enc_key[sizeof(enc_key)] = {
+        0xea, 0xb1, 0x14, 0xd8, 0x27, 0x3a, 0xab, 0x08, 0x77, 0xcf, 0x7d,
+        0xd7, 0x01, 0x9f, 0x65, 0x7c, 0x9b, 0x62, 0x11, 0xc9, 0x0a, 0x0d,
+        0xed, 0xf5, 0xb6, 0xa3, 0xa3, 0xdb, 0x55, 0x06, 0x4a, 0x4e};
+
+    static const uint8_t expected_exact_key[sizeof(exact_key)] = {
+        0x12, 0x2b, 0xd6, 0x24, 0xc7, 0x2e, 0x29, 0x23, 0x6b, 0xc9, 0x94,
+        0x7f, 0x15, 0x39, 0x09, 0x1f, 0x9b, 0xaa, 0x6f, 0xae, 0xc9, 0x55,
+        0x20, 0x50, 0xbd, 0xe2, 0x69, 0xac, 0x1b, 0x51, 0x46, 0xa7, 0xea,
+        0x63, 0xb0, 0xb9, 0xca, 0x08, 0x20, 0x33};
+
+    result = scl_kdf_sp800108_cmac_init(&scl, &sp800108kdf_ctx, key128,
+                                        sizeof(key128));
+    TEST_ASSERT_TRUE(SCL_OK == result);
+
+    requests[0].label = label_enc;
+    requests[0].label_len = sizeof(label_enc);
+    requests[0].context = context_enc;
+    requests[0].context_len = sizeof(context_enc);
+    requests[0].derivated_key = enc_key;
+    requests[0].derivated_key_length = sizeof(enc_key);
+    requests[1].label = label_exact;
+    requests[1].label_len = sizeof(label_exact);
+    requests[1].context = context_exact;
+    requests[1].context_len = sizeof(context_exact);
+    requests[1].derivated_key = exact_key;
+    requests[1].derivated_key_length = sizeof(exact_key);
+
+    result = scl_kdf_sp800108_derive_batch(&scl, &sp800108kdf_ctx, requests, 2);
+    TEST_ASSERT_TRUE(SCL_OK == result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_enc_key, enc_key, sizeof(enc_key));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_exact_key, exact_key,
+                                 sizeof(exact_key));
+}
+#endif
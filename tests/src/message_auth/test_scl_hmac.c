@@ -25,13 +25,51 @@ static const metal_scl_t scl = {.hca_base = 0,
                                         .sha_init = soft_sha_init,
                                         .sha_core = soft_sha_core,
                                         .sha_finish = soft_sha_finish,
+                                        .sha_export_state =
+                                            soft_sha_export_state,
+                                        .sha_import_state =
+                                            soft_sha_import_state,
                                     },
                                 .hmac_func = {
                                     .init = soft_hmac_init,
                                     .core = soft_hmac_core,
                                     .finish = soft_hmac_finish,
+                                    .key_init = soft_hmac_key_init,
+                                    .init_with_key = soft_hmac_init_with_key,
                                 }};
 
+/* a backend that resumes imported states in software, like HCA 0.5.x */
+static int32_t soft_resume_import_state(const metal_scl_t *const scl,
+                                        sha_ctx_t *const ctx,
+                                        const sha_state_t *const state)
+{
+    int32_t result = soft_sha_import_state(scl, ctx, state);
+
+    ctx->soft_resume = true;
+
+    return (result);
+}
+
+static const metal_scl_t scl_soft_resume = {
+    .hca_base = 0,
+    .hash_func =
+        {
+            .sha_init = soft_sha_init,
+            .sha_core = soft_sha_core,
+            .sha_finish = soft_sha_finish,
+            .sha_export_state = soft_sha_export_state,
+            .sha_import_state = soft_resume_import_state,
+        },
+    .hmac_func =
+        {
+            .init = soft_hmac_init,
+            .core = soft_hmac_core,
+            .finish = soft_hmac_finish,
+            .key_init = soft_hmac_key_init,
+            .init_with_key = soft_hmac_init_with_key,
+        },
+};
+
 TEST_GROUP(scl_hmac);
 
 TEST_SETUP(scl_hmac) {}
@@ -575,3 +613,122 @@ TEST(scl_hmac, sha512_keysize_greater_than_blocksize)
     TEST_ASSERT_TRUE(SHA512_BYTE_HASHSIZE == mac_len);
     TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_mac, mac, sizeof(expected_mac));
 }
+
+/* HMAC with precomputed key context */
+TEST(scl_hmac, key_ctx_same_as_raw_key)
+{
+    int32_t result;
+    size_t i, k, m;
+    scl_hmac_ctx_t hmac_ctx;
+    scl_hmac_key_ctx_t key_ctx;
+    scl_sha_ctx_t sha_ctx;
+    static const scl_hash_mode_t modes[] = {SCL_HASH_SHA256, SCL_HASH_SHA384};
+    /* shorter than, equal to and greater than the block size */
+    static const size_t key_lens[] = {20, 64, 128, 200};
+    static const size_t msg_lens[] = {0, 16, 300};
+    static uint8_t key[200] __attribute__((aligned(8)));
+    static uint8_t message[300] __attribute__((aligned(8)));
+    uint8_t mac[SHA512_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    uint8_t expected_mac[SHA512_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    size_t mac_len;
+    size_t expected_mac_len;
+
+    for (i = 0; i < sizeof(key); i++)
+    {
+        key[i] = (uint8_t)(i * 11 + 1);
+    }
+
+    for (i = 0; i < sizeof(message); i++)
+    {
+        message[i] = (uint8_t)(i * 13 + 7);
+    }
+
+    for (m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+    {
+        for (k = 0; k < sizeof(key_lens) / sizeof(key_lens[0]); k++)
+        {
+            result = scl_hmac_key_init(&scl, &key_ctx, &sha_ctx, modes[m], key,
+                                       key_lens[k]);
+            TEST_ASSERT_TRUE(SCL_OK == result);
+
+            /* the key context is used for several MACs */
+            for (i = 0; i < sizeof(msg_lens) / sizeof(msg_lens[0]); i++)
+            {
+                result = scl_hmac_init(&scl, &hmac_ctx, &sha_ctx, modes[m],
+                                       key, key_lens[k]);
+                TEST_ASSERT_TRUE(SCL_OK == result);
+                result = scl_hmac_core(&scl, &hmac_ctx, message, msg_lens[i]);
+                TEST_ASSERT_TRUE(SCL_OK == result);
+                expected_mac_len = sizeof(expected_mac);
+                result = scl_hmac_finish(&scl, &hmac_ctx, expected_mac,
+                                         &expected_mac_len);
+                TEST_ASSERT_TRUE(SCL_OK == result);
+
+                result =
+                    scl_hmac_init_with_key(&scl, &hmac_ctx, &sha_ctx, &key_ctx);
+                TEST_ASSERT_TRUE(SCL_OK == result);
+                result = scl_hmac_core(&scl, &hmac_ctx, message, msg_lens[i]);
+                TEST_ASSERT_TRUE(SCL_OK == result);
+                mac_len = sizeof(mac);
+                result = scl_hmac_finish(&scl, &hmac_ctx, mac, &mac_len);
+                TEST_ASSERT_TRUE(SCL_OK == result);
+
+                TEST_ASSERT_TRUE(expected_mac_len == mac_len);
+                TEST_ASSERT_TRUE(0 == memcmp(expected_mac, mac, mac_len));
+            }
+        }
+    }
+}
+
+/* the key context keeps k0 when imported states would resume in software */
+TEST(scl_hmac, key_ctx_without_states)
+{
+    int32_t result;
+    size_t i, m;
+    scl_hmac_ctx_t hmac_ctx;
+    scl_hmac_key_ctx_t key_ctx;
+    scl_sha_ctx_t sha_ctx;
+    static const scl_hash_mode_t modes[] = {SCL_HASH_SHA256, SCL_HASH_SHA512};
+    static const uint8_t key[100] = {0x4b};
+    static const uint8_t message[] = {0x6d, 0x73, 0x67};
+    uint8_t mac[SHA512_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    uint8_t expected_mac[SHA512_BYTE_HASHSIZE] __attribute__((aligned(8)));
+    size_t mac_len;
+    size_t expected_mac_len;
+
+    for (m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+    {
+        result = scl_hmac_init(&scl, &hmac_ctx, &sha_ctx, modes[m], key,
+                               sizeof(key));
+        TEST_ASSERT_TRUE(SCL_OK == result);
+        result = scl_hmac_core(&scl, &hmac_ctx, message, sizeof(message));
+        TEST_ASSERT_TRUE(SCL_OK == result);
+        expected_mac_len = sizeof(expected_mac);
+        result =
+            scl_hmac_finish(&scl, &hmac_ctx, expected_mac, &expected_mac_len);
+        TEST_ASSERT_TRUE(SCL_OK == result);
+
+        result = scl_hmac_key_init(&scl_soft_resume, &key_ctx, &sha_ctx,
+                                   modes[m], key, sizeof(key));
+        TEST_ASSERT_TRUE(SCL_OK == result);
+        TEST_ASSERT_TRUE(false == key_ctx.resume_state);
+
+        /* the key context is used for several MACs */
+        for (i = 0; i < 2; i++)
+        {
+            result = scl_hmac_init_with_key(&scl_soft_resume, &hmac_ctx,
+                                            &sha_ctx, &key_ctx);
+            TEST_ASSERT_TRUE(SCL_OK == result);
+            result = scl_hmac_core(&scl_soft_resume, &hmac_ctx, message,
+                                   sizeof(message));
+            TEST_ASSERT_TRUE(SCL_OK == result);
+            mac_len = sizeof(mac);
+            result =
+                scl_hmac_finish(&scl_soft_resume, &hmac_ctx, mac, &mac_len);
+            TEST_ASSERT_TRUE(SCL_OK == result);
+
+            TEST_ASSERT_TRUE(expected_mac_len == mac_len);
+            TEST_ASSERT_TRUE(0 == memcmp(expected_mac, mac, mac_len));
+        }
+    }
+}
@@ -43,6 +43,7 @@ static void RunAllTests(void)
     RUN_TEST_GROUP(scl_soft_sha_256);
     RUN_TEST_GROUP(scl_soft_sha_384);
     RUN_TEST_GROUP(scl_soft_sha_512);
+    RUN_TEST_GROUP(scl_sha_tree);
 
     /* HMAC */
     RUN_TEST_GROUP(soft_hmac);
@@ -57,6 +58,8 @@ static void RunAllTests(void)
     /* ECC */
     RUN_TEST_GROUP(soft_ecc);
     RUN_TEST_GROUP(soft_ecc_keygen);
+    RUN_TEST_GROUP(soft_ecc_p521);
+    RUN_TEST_GROUP(soft_ecc_scalar);
     RUN_TEST_GROUP(scl_ecc_keygen);
 
     /* ECDSA */
@@ -71,6 +74,7 @@ static void RunAllTests(void)
     /* KDF */
     RUN_TEST_GROUP(soft_kdf_x963);
     RUN_TEST_GROUP(scl_kdf);
+    RUN_TEST_GROUP(scl_hkdf);
 
 #if METAL_SIFIVE_HCA_VERSION >= HCA_VERSION(0, 5, 0)
     // hardware implementation
@@ -89,6 +93,12 @@ static void RunAllTests(void)
     RUN_TEST_GROUP(scl_aes_192);
     RUN_TEST_GROUP(scl_aes_256);
 
+    /* KDF */
+    RUN_TEST_GROUP(scl_kdf_cmac);
+
+    /* ECIES */
+    RUN_TEST_GROUP(scl_ecies);
+
     RUN_TEST_GROUP(scl_trng);
 #endif
 }
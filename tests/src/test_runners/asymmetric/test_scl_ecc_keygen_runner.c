@@ -15,4 +15,9 @@ TEST_GROUP_RUNNER(scl_ecc_keygen)
     RUN_TEST_CASE(scl_ecc_keygen, scl_ecc_keygen_secp256r1_all_in_one);
     RUN_TEST_CASE(scl_ecc_keygen, scl_ecc_keygen_secp384r1_all_in_one);
     RUN_TEST_CASE(scl_ecc_keygen, scl_ecc_keygen_secp521r1_all_in_one);
+    RUN_TEST_CASE(scl_ecc_keygen, scl_ecc_keygen_batch_secp384r1);
+    RUN_TEST_CASE(scl_ecc_keygen, scl_ecc_point_compress_secp384r1);
+    RUN_TEST_CASE(scl_ecc_keygen, scl_ecc_pubkey_resumable_secp256r1);
+    RUN_TEST_CASE(scl_ecc_keygen, scl_ecc_key_on_curve_batch_secp256r1);
+    RUN_TEST_CASE(scl_ecc_keygen, scl_ecc_key_on_curve_batch_secp521r1);
 }
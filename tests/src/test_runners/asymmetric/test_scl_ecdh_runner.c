@@ -23,4 +23,5 @@ TEST_GROUP_RUNNER(scl_ecdh)
     /* SECP521r1 */
     RUN_TEST_CASE(scl_ecdh, secp_p521r1_curve_success);
     RUN_TEST_CASE(scl_ecdh, secp_p521r1_curve_not_on_curve);
+    RUN_TEST_CASE(scl_ecdh, secp_p256r1_curve_resumable);
 }
@@ -62,4 +62,11 @@ TEST_GROUP_RUNNER(scl_ecdsa)
     /* SECP521r1 */
     RUN_TEST_CASE(scl_ecdsa, test_p521r1_curve_input_512B_sign);
     RUN_TEST_CASE(scl_ecdsa, test_p521r1_curve_input_216B_sign);
+
+    /* Signature with precomputed nonces */
+    RUN_TEST_CASE(scl_ecdsa, test_p256r1_curve_input_256B_sign_with_pool);
+
+    /* Signature with deterministic nonces */
+    RUN_TEST_CASE(scl_ecdsa, test_p384r1_sign_deterministic_rfc6979);
+    RUN_TEST_CASE(scl_ecdsa, test_p256r1_curve_input_256B_verif_resumable);
 }
@@ -0,0 +1,28 @@
+/**
+ * @file test_scl_ecies_runner.c
+ * @brief test runner for test_scl_ecies.c tests
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include <backend/hardware/scl_hca.h>
+
+#include <metal/machine/platform.h>
+
+#if METAL_SIFIVE_HCA_VERSION >= HCA_VERSION(0, 5, 0)
+
+TEST_GROUP_RUNNER(scl_ecies)
+{
+    RUN_TEST_CASE(scl_ecies, decrypt_secp256r1_success);
+    RUN_TEST_CASE(scl_ecies, decrypt_secp256r1_bad_tag);
+    RUN_TEST_CASE(scl_ecies, decrypt_secp256r1_streaming);
+    RUN_TEST_CASE(scl_ecies, encrypt_decrypt_secp256r1);
+    RUN_TEST_CASE(scl_ecies, init_invalid_key_length);
+}
+
+#endif
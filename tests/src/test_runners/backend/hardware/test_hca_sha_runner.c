@@ -47,6 +47,7 @@ TEST_GROUP_RUNNER(hca_sha_256)
     RUN_TEST_CASE(hca_sha_256, msg_2_block_and_half_digest_aligned);
     RUN_TEST_CASE(hca_sha_256, msg_and_hash_twice);
     RUN_TEST_CASE(hca_sha_256, msg_1_block_in_3_pieces_digest_aligned);
+    RUN_TEST_CASE(hca_sha_256, msg_export_import_soft_resume);
 }
 
 // SHA 384
@@ -203,6 +203,10 @@ TEST_GROUP_RUNNER(soft_bignumbers)
     RUN_TEST_CASE(soft_bignumbers, soft_bignum_mod_sub_size_2_3);
     RUN_TEST_CASE(soft_bignumbers, soft_bignum_mod_sub_size_5);
     RUN_TEST_CASE(soft_bignumbers, soft_bignum_mod_sub_size_5_2);
+    RUN_TEST_CASE(soft_bignumbers, soft_bignum_mod_add_lazy_not_reduced);
+    RUN_TEST_CASE(soft_bignumbers, soft_bignum_mod_add_lazy_reduced);
+    RUN_TEST_CASE(soft_bignumbers, soft_bignum_mod_sub_lazy);
+    RUN_TEST_CASE(soft_bignumbers, soft_bignum_mod_sub_lazy_2);
 
     /* Negate mod */
     RUN_TEST_CASE(soft_bignumbers, soft_bignum_mod_neg_size_0);
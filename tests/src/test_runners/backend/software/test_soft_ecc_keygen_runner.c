@@ -38,4 +38,22 @@ TEST_GROUP_RUNNER(soft_ecc_keygen)
                   soft_ecc_keypair_generation_secp384r1_success);
     RUN_TEST_CASE(soft_ecc_keygen,
                   soft_ecc_keypair_generation_secp521r1_success);
+    RUN_TEST_CASE(soft_ecc_keygen,
+                  soft_ecc_keypair_generation_batch_secp256r1_success);
+    RUN_TEST_CASE(soft_ecc_keygen,
+                  soft_ecc_point_compress_secp256r1_success);
+    RUN_TEST_CASE(soft_ecc_keygen,
+                  soft_ecc_point_compress_secp384r1_success);
+    RUN_TEST_CASE(soft_ecc_keygen,
+                  soft_ecc_point_compress_secp521r1_success);
+    RUN_TEST_CASE(soft_ecc_keygen,
+                  soft_ecc_point_decompress_secp256r1_even);
+    RUN_TEST_CASE(soft_ecc_keygen,
+                  soft_ecc_point_decompress_custom_curve);
+    RUN_TEST_CASE(soft_ecc_keygen,
+                  soft_ecc_point_decompress_secp256r1_failure);
+    RUN_TEST_CASE(soft_ecc_keygen,
+                  soft_ecc_point_decompress_secp384r1_failure);
+    RUN_TEST_CASE(soft_ecc_keygen,
+                  soft_ecc_point_decompress_secp521r1_failure);
 }
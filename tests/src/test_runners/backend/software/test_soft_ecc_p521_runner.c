@@ -0,0 +1,18 @@
+/**
+ * @file test_soft_ecc_p521_runner.c
+ * @brief test runner for test_soft_ecc_p521.c
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(soft_ecc_p521)
+{
+    RUN_TEST_CASE(soft_ecc_p521, soft_ecc_p521_mult);
+    RUN_TEST_CASE(soft_ecc_p521, soft_ecc_p521_full_reduction);
+    RUN_TEST_CASE(soft_ecc_p521, soft_ecc_p521_double_generator);
+}
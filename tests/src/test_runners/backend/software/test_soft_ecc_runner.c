@@ -15,6 +15,21 @@ TEST_GROUP_RUNNER(soft_ecc)
     RUN_TEST_CASE(soft_ecc, test_p384r1_affine_2_jacobian_2_affine);
     RUN_TEST_CASE(soft_ecc, test_p384r1_double_affine_point_via_jacobian);
     RUN_TEST_CASE(soft_ecc, test_p384r1_add_affine_point_via_jacobian);
+    RUN_TEST_CASE(soft_ecc, test_soft_ecc_jacobian_pack_unpack);
+    RUN_TEST_CASE(soft_ecc, test_soft_ecc_packed_table_select);
     RUN_TEST_CASE(soft_ecc, test_soft_ecc_mult_coz);
+    RUN_TEST_CASE(soft_ecc, test_soft_ecc_mult_window_odd);
+    RUN_TEST_CASE(soft_ecc, test_soft_ecc_mult_window_even);
+    RUN_TEST_CASE(soft_ecc, test_soft_ecc_mult_window_k_equal_n);
+    RUN_TEST_CASE(soft_ecc, test_soft_ecc_mult_coz_x);
+    RUN_TEST_CASE(soft_ecc, test_soft_ecc_mult_window_edge_p256r1);
+    RUN_TEST_CASE(soft_ecc, test_soft_ecc_mult_window_edge_p384r1);
+    RUN_TEST_CASE(soft_ecc, test_soft_ecc_mult_window_edge_p521r1);
+    RUN_TEST_CASE(soft_ecc, test_soft_ecc_batch_jacobian_to_affine);
+    RUN_TEST_CASE(soft_ecc,
+                  test_soft_ecc_batch_jacobian_to_affine_infinite);
     RUN_TEST_CASE(soft_ecc, test_soft_ecc_xycz_addc);
+    RUN_TEST_CASE(soft_ecc, test_soft_ecc_msm_straus);
+    RUN_TEST_CASE(soft_ecc, test_soft_ecc_msm_pippenger);
+    RUN_TEST_CASE(soft_ecc, test_soft_ecc_msm_infinite);
 }
@@ -0,0 +1,17 @@
+/**
+ * @file test_soft_ecc_scalar_runner.c
+ * @brief test runner for test_soft_ecc_scalar.c
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(soft_ecc_scalar)
+{
+    RUN_TEST_CASE(soft_ecc_scalar, soft_ecc_scalar_secp256r1);
+    RUN_TEST_CASE(soft_ecc_scalar, soft_ecc_scalar_secp521r1_inv);
+}
@@ -62,4 +62,18 @@ TEST_GROUP_RUNNER(soft_ecdsa)
     /* SECP521r1 */
     RUN_TEST_CASE(soft_ecdsa, test_p521r1_curve_input_512B_sign);
     RUN_TEST_CASE(soft_ecdsa, test_p521r1_curve_input_216B_sign);
+
+    /* Signature with precomputed nonces */
+    RUN_TEST_CASE(soft_ecdsa, test_p256r1_curve_input_256B_sign_with_pool);
+    RUN_TEST_CASE(soft_ecdsa, test_p384r1_curve_input_384B_sign_with_pool);
+    RUN_TEST_CASE(soft_ecdsa, test_p521r1_curve_input_512B_sign_with_pool);
+    RUN_TEST_CASE(soft_ecdsa, test_p256r1_sign_with_empty_pool);
+    RUN_TEST_CASE(soft_ecdsa, test_p256r1_sign_with_pool_wrong_binding);
+
+    /* Signature with deterministic nonces */
+    RUN_TEST_CASE(soft_ecdsa, test_p256r1_sign_deterministic_rfc6979);
+    RUN_TEST_CASE(soft_ecdsa, test_p384r1_sign_deterministic_rfc6979);
+    RUN_TEST_CASE(soft_ecdsa, test_p521r1_sign_deterministic_rfc6979);
+    RUN_TEST_CASE(soft_ecdsa, test_p256r1_sign_hedged);
+    RUN_TEST_CASE(soft_ecdsa, test_p256r1_sign_nonce_mode_invalid);
 }
@@ -31,4 +31,5 @@ TEST_GROUP_RUNNER(soft_kdf_x963)
     RUN_TEST_CASE(soft_kdf_x963, soft_x963kdf_sha512_output_19B);
     RUN_TEST_CASE(soft_kdf_x963, soft_x963kdf_sha512_output_32B);
     RUN_TEST_CASE(soft_kdf_x963, soft_x963kdf_sha512_output_97B);
+    RUN_TEST_CASE(soft_kdf_x963, soft_x963kdf_sha256_long_key_output_80B);
 }
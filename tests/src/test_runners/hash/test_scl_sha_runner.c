@@ -30,6 +30,11 @@ TEST_GROUP_RUNNER(scl_soft_sha_256)
     RUN_TEST_CASE(scl_soft_sha_256, msg_2_blocks_msg_not_aligned);
     RUN_TEST_CASE(scl_soft_sha_256, msg_abc_digest_not_aligned);
     RUN_TEST_CASE(scl_soft_sha_256, msg_2_blocks_digest_not_aligned);
+    RUN_TEST_CASE(scl_soft_sha_256, msg_multi);
+    RUN_TEST_CASE(scl_soft_sha_256, msg_multi_fallback);
+    RUN_TEST_CASE(scl_soft_sha_256, msg_prefix_clone_and_resume);
+    RUN_TEST_CASE(scl_soft_sha_256, msg_fixed_32B_64B);
+    RUN_TEST_CASE(scl_soft_sha_256, merkle_root_odd_leaves);
 }
 
 // SHA 384
@@ -52,4 +57,20 @@ TEST_GROUP_RUNNER(scl_soft_sha_512)
     RUN_TEST_CASE(scl_soft_sha_512, msg_2_blocks_msg_not_aligned);
     RUN_TEST_CASE(scl_soft_sha_512, msg_abc_digest_not_aligned);
     RUN_TEST_CASE(scl_soft_sha_512, msg_2_blocks_digest_not_aligned);
+    RUN_TEST_CASE(scl_soft_sha_512, msg_abc_sha512_224);
+    RUN_TEST_CASE(scl_soft_sha_512, msg_2_blocks_sha512_224);
+    RUN_TEST_CASE(scl_soft_sha_512, msg_abc_sha512_256);
+    RUN_TEST_CASE(scl_soft_sha_512, msg_2_blocks_sha512_256);
+    RUN_TEST_CASE(scl_soft_sha_512, msg_multi);
+    RUN_TEST_CASE(scl_soft_sha_512, msg_prefix_clone_and_resume);
+}
+
+// SHA tree
+TEST_GROUP_RUNNER(scl_sha_tree)
+{
+    RUN_TEST_CASE(scl_sha_tree, sha256_root_10_chunks);
+    RUN_TEST_CASE(scl_sha_tree, sha384_root_11_chunks);
+    RUN_TEST_CASE(scl_sha_tree, single_and_empty_image);
+    RUN_TEST_CASE(scl_sha_tree, verify_reports_bad_chunks);
+    RUN_TEST_CASE(scl_sha_tree, leaves_are_not_nodes);
 }
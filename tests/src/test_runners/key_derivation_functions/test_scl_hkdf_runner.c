@@ -0,0 +1,18 @@
+/**
+ * @file test_scl_hkdf_runner.c
+ * @brief test runner for test_scl_hkdf.c tests
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(scl_hkdf)
+{
+    RUN_TEST_CASE(scl_hkdf, sha256_rfc5869_case_1);
+    RUN_TEST_CASE(scl_hkdf, sha256_rfc5869_case_3);
+    RUN_TEST_CASE(scl_hkdf, sha384_several_labels);
+}
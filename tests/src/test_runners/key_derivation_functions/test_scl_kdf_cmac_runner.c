@@ -0,0 +1,17 @@
+/**
+ * @file test_scl_kdf_cmac_runner.c
+ * @brief test runner for test_scl_kdf_cmac.c tests
+ *
+ * @copyright Copyright (c) 2020 SiFive, Inc
+ * @copyright SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(scl_kdf_cmac)
+{
+    /* SP 800-108 with AES-CMAC */
+    RUN_TEST_CASE(scl_kdf_cmac, sp800108_cmac_aes128_batch);
+}
@@ -31,4 +31,20 @@ TEST_GROUP_RUNNER(scl_kdf)
     RUN_TEST_CASE(scl_kdf, x963kdf_sha512_output_19B);
     RUN_TEST_CASE(scl_kdf, x963kdf_sha512_output_32B);
     RUN_TEST_CASE(scl_kdf, x963kdf_sha512_output_97B);
+
+    /* PBKDF2 */
+    RUN_TEST_CASE(scl_kdf, pbkdf2_sha224_embedded_nul_output_30B);
+    RUN_TEST_CASE(scl_kdf, pbkdf2_sha256_1_iteration_output_64B);
+    RUN_TEST_CASE(scl_kdf, pbkdf2_sha256_80000_iterations_output_64B);
+    RUN_TEST_CASE(scl_kdf, pbkdf2_sha384_long_password_output_60B);
+    RUN_TEST_CASE(scl_kdf, pbkdf2_sha512_output_100B);
+    RUN_TEST_CASE(scl_kdf, pbkdf2_sha512_224_output_60B);
+    RUN_TEST_CASE(scl_kdf, pbkdf2_zero_iteration);
+    RUN_TEST_CASE(scl_kdf, pbkdf2_key_ctx_without_states);
+
+    /* SP 800-108 */
+    RUN_TEST_CASE(scl_kdf, sp800108_hmac_sha224_no_label_output_30B);
+    RUN_TEST_CASE(scl_kdf, sp800108_hmac_sha256_output_32B);
+    RUN_TEST_CASE(scl_kdf, sp800108_hmac_sha512_output_100B);
+    RUN_TEST_CASE(scl_kdf, sp800108_hmac_sha384_batch);
 }
@@ -31,4 +31,6 @@ TEST_GROUP_RUNNER(scl_hmac)
     RUN_TEST_CASE(scl_hmac, sha512_keysize_shorter_than_blocksize);
     RUN_TEST_CASE(scl_hmac, sha512_keysize_equal_blocksize);
     RUN_TEST_CASE(scl_hmac, sha512_keysize_greater_than_blocksize);
+    RUN_TEST_CASE(scl_hmac, key_ctx_same_as_raw_key);
+    RUN_TEST_CASE(scl_hmac, key_ctx_without_states);
 }